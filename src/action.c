@@ -49,6 +49,10 @@ static void init(grib_action_class* c)
     if (!c)
         return;
 
+    /* Called for every action run: only the first call for a class locks */
+    if (GRIB_LOCK_FREE_READS && GRIB_PUBLISHED(c->inited))
+        return;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init_mutex);
     GRIB_MUTEX_LOCK(&mutex1);
     if (!c->inited) {
@@ -56,7 +60,7 @@ static void init(grib_action_class* c)
             init(*(c->super));
         }
         c->init_class(c);
-        c->inited = 1;
+        GRIB_PUBLISH(c->inited, 1);
     }
     GRIB_MUTEX_UNLOCK(&mutex1);
 }
@@ -22,6 +22,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump;xref
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char* target
    END_CLASS_DEF
 
@@ -42,6 +43,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_alias
@@ -66,9 +69,11 @@ static grib_action_class _grib_action_class_alias = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_alias = &_grib_action_class_alias;
@@ -216,14 +221,6 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
     }
 
     hand = grib_handle_of_accessor(x);
-    if (hand->use_trie) {
-        id = grib_hash_keys_get_id(x->context->keys, act->name);
-
-        if (hand->accessors[id] != x) {
-            /*x->same=hand->accessors[id];*/
-            hand->accessors[id] = x;
-        }
-    }
 
     i = 0;
     while (i < MAX_ACCESSOR_NAMES) {
@@ -243,6 +240,12 @@ static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
                 grib_context_log(p->h->context, GRIB_LOG_DEBUG, "alias %s.%s added (%s)",
                                  act->name_space, act->name, self->target);
             }
+            /* Only names of x can point to it: the table entries of the
+             * names of a section's accessors are redone when it is reparsed */
+            if (hand->use_trie) {
+                id = grib_hash_keys_get_id(x->context->keys, act->name);
+                grib_handle_set_accessor_by_id(hand, id, x);
+            }
             return GRIB_SUCCESS;
         }
         i++;
@@ -293,3 +296,24 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->op);
     grib_context_free_persistent(context, act->name_space);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_alias* a = (grib_action_alias*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_string(w, a->target);
+    grib_snapshot_write_string(w, act->name_space);
+    grib_snapshot_write_long(w, act->flags);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name       = grib_snapshot_read_string(r);
+    const char* target     = grib_snapshot_read_string(r);
+    const char* name_space = grib_snapshot_read_string(r);
+    long flags             = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_alias(context, name, target, name_space, flags);
+}
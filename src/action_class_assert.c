@@ -21,6 +21,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump;notify_change
    IMPLEMENTS = destroy; execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    END_CLASS_DEF
 
@@ -42,6 +43,8 @@ static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static int notify_change(grib_action* a, grib_accessor* observer, grib_accessor* observed);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_assert
@@ -66,9 +69,11 @@ static grib_action_class _grib_action_class_assert = {
 
     &create_accessor, /* create_accessor*/
 
-    &notify_change, /* notify_change */
-    0,              /* reparse */
-    &execute,       /* execute */
+    &notify_change,  /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_assert = &_grib_action_class_assert;
@@ -159,3 +164,18 @@ static int notify_change(grib_action* a, grib_accessor* observer, grib_accessor*
     else
         return GRIB_ASSERTION_FAILURE;
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_assert* a = (grib_action_assert*)act;
+    grib_snapshot_write_expression(w, a->expression);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_expression* expression = grib_snapshot_read_expression(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_assert(context, expression);
+}
@@ -22,6 +22,7 @@
    SUPER      = action_class_gen
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_concept_value* concept
    MEMBERS    = char* basename
    MEMBERS    = char* masterDir
@@ -44,6 +45,8 @@ or edit "action.class" and rerun ./make_class.pl
 static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_concept
@@ -76,9 +79,11 @@ static grib_action_class _grib_action_class_concept = {
 
     0, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_concept = &_grib_action_class_concept;
@@ -221,7 +226,7 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, self->basename);
 }
 
-static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept* self)
+static grib_concept_value* get_concept(grib_handle* h, grib_action_concept* self)
 {
     char buf[4096] = {0,};
     char master[1024] = {0,};
@@ -255,9 +260,17 @@ static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept*
 
     sprintf(key, "%s%s", master, local);
 
+    /* Loaded concepts are published once indexed, so they are found without the mutex */
     id = grib_itrie_get_id(h->context->concepts_index, key);
-    if ((c = h->context->concepts[id]) != NULL)
+    if (GRIB_LOCK_FREE_READS && (c = GRIB_PUBLISHED(h->context->concepts[id])) != NULL)
+        return c;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init)
+    GRIB_MUTEX_LOCK(&mutex);
+    if ((c = h->context->concepts[id]) != NULL) {
+        GRIB_MUTEX_UNLOCK(&mutex);
         return c;
+    }
 
     if (*local && (full = grib_context_full_defs_path(context, local)) != NULL) {
         c = grib_parse_concept_file(context, full);
@@ -282,6 +295,7 @@ static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept*
         grib_context_log(context, GRIB_LOG_FATAL,
                          "unable to find definition file %s in %s:%s\nDefinition files path=\"%s\"",
                          self->basename, master, local, context->grib_definition_files_path);
+        GRIB_MUTEX_UNLOCK(&mutex);
         return NULL;
     }
 
@@ -290,29 +304,19 @@ static grib_concept_value* get_concept_impl(grib_handle* h, grib_action_concept*
                          "Loading concept %s from %s", ((grib_action*)self)->name, full);
     }
 
-    h->context->concepts[id] = c;
     if (c) {
-        grib_trie* index = grib_trie_new(context);
-        while (c) {
-            c->index = index;
-            grib_trie_insert_no_replace(index, c->name, c);
-            c = c->next;
+        grib_concept_value* v = c;
+        grib_trie* index      = grib_trie_new(context);
+        while (v) {
+            v->index = index;
+            grib_trie_insert_no_replace(index, v->name, v);
+            v = v->next;
         }
     }
-
-    return h->context->concepts[id];
-}
-
-static grib_concept_value* get_concept(grib_handle* h, grib_action_concept* self)
-{
-    grib_concept_value* result = NULL;
-    GRIB_MUTEX_INIT_ONCE(&once, &init)
-    GRIB_MUTEX_LOCK(&mutex);
-
-    result = get_concept_impl(h, self);
-
+    GRIB_PUBLISH(h->context->concepts[id], c);
     GRIB_MUTEX_UNLOCK(&mutex);
-    return result;
+
+    return c;
 }
 
 static int concept_condition_expression_true(grib_handle* h, grib_concept_condition* c, char* exprVal)
@@ -413,3 +417,34 @@ int get_concept_condition_string(grib_handle* h, const char* key, const char* va
         return GRIB_CONCEPT_NO_MATCH;
     return GRIB_SUCCESS;
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_concept* a = (grib_action_concept*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_concept(w, a->concept);
+    grib_snapshot_write_string(w, a->basename);
+    grib_snapshot_write_string(w, act->name_space);
+    grib_snapshot_write_string(w, act->defaultkey);
+    grib_snapshot_write_string(w, a->masterDir);
+    grib_snapshot_write_string(w, a->localDir);
+    grib_snapshot_write_long(w, act->flags);
+    grib_snapshot_write_long(w, a->nofail);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name            = grib_snapshot_read_string(r);
+    grib_concept_value* concept = grib_snapshot_read_concept(r);
+    const char* basename        = grib_snapshot_read_string(r);
+    const char* name_space      = grib_snapshot_read_string(r);
+    const char* defaultkey      = grib_snapshot_read_string(r);
+    const char* masterDir       = grib_snapshot_read_string(r);
+    const char* localDir        = grib_snapshot_read_string(r);
+    long flags                  = grib_snapshot_read_long(r);
+    long nofail                 = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_concept(context, name, concept, basename, name_space, defaultkey, masterDir, localDir, NULL, flags, nofail);
+}
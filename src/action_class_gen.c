@@ -23,6 +23,7 @@
    IMPLEMENTS = dump;xref
    IMPLEMENTS = destroy
    IMPLEMENTS = notify_change
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = long            len
    MEMBERS    = grib_arguments* params
    END_CLASS_DEF
@@ -45,6 +46,8 @@ static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static int notify_change(grib_action* a, grib_accessor* observer, grib_accessor* observed);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_gen
@@ -70,9 +73,11 @@ static grib_action_class _grib_action_class_gen = {
 
     &create_accessor, /* create_accessor*/
 
-    &notify_change, /* notify_change */
-    0,              /* reparse */
-    0,              /* execute */
+    &notify_change,  /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_gen = &_grib_action_class_gen;
@@ -218,3 +223,32 @@ static void destroy(grib_context* context, grib_action* act)
     if (act->set)
         grib_context_free_persistent(context, act->set);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_gen* a = (grib_action_gen*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_string(w, act->op);
+    grib_snapshot_write_long(w, a->len);
+    grib_snapshot_write_arguments(w, a->params);
+    grib_snapshot_write_arguments(w, act->default_value);
+    grib_snapshot_write_long(w, act->flags);
+    grib_snapshot_write_string(w, act->name_space);
+    grib_snapshot_write_string(w, act->set);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name              = grib_snapshot_read_string(r);
+    const char* op                = grib_snapshot_read_string(r);
+    long len                      = grib_snapshot_read_long(r);
+    grib_arguments* params        = grib_snapshot_read_arguments(r);
+    grib_arguments* default_value = grib_snapshot_read_arguments(r);
+    long flags                    = grib_snapshot_read_long(r);
+    const char* name_space        = grib_snapshot_read_string(r);
+    const char* set               = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_gen(context, name, op, len, params, default_value, flags, name_space, set);
+}
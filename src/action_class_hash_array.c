@@ -21,6 +21,7 @@
    SUPER      = action_class_gen
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_hash_array_value* hash_array
    MEMBERS    = char* basename
    MEMBERS    = char* masterDir
@@ -44,6 +45,8 @@ or edit "action.class" and rerun ./make_class.pl
 static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_hash_array
@@ -77,9 +80,11 @@ static grib_action_class _grib_action_class_hash_array = {
 
     0, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_hash_array = &_grib_action_class_hash_array;
@@ -326,3 +331,36 @@ grib_hash_array_value* get_hash_array(grib_handle* h, grib_action* a)
     GRIB_MUTEX_UNLOCK(&mutex);
     return result;
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_hash_array* a = (grib_action_hash_array*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_hash_array(w, a->hash_array);
+    grib_snapshot_write_string(w, a->basename);
+    grib_snapshot_write_string(w, act->name_space);
+    grib_snapshot_write_string(w, act->defaultkey);
+    grib_snapshot_write_string(w, a->masterDir);
+    grib_snapshot_write_string(w, a->localDir);
+    grib_snapshot_write_string(w, a->ecmfDir);
+    grib_snapshot_write_long(w, act->flags);
+    grib_snapshot_write_long(w, a->nofail);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name                  = grib_snapshot_read_string(r);
+    grib_hash_array_value* hash_array = grib_snapshot_read_hash_array(r);
+    const char* basename              = grib_snapshot_read_string(r);
+    const char* name_space            = grib_snapshot_read_string(r);
+    const char* defaultkey            = grib_snapshot_read_string(r);
+    const char* masterDir             = grib_snapshot_read_string(r);
+    const char* localDir              = grib_snapshot_read_string(r);
+    const char* ecmfDir               = grib_snapshot_read_string(r);
+    long flags                        = grib_snapshot_read_long(r);
+    long nofail                       = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_hash_array(context, name, hash_array, basename, name_space, defaultkey, masterDir, localDir, ecmfDir, flags, nofail);
+}
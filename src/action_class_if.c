@@ -25,6 +25,7 @@
    IMPLEMENTS = destroy
    IMPLEMENTS = xref   
    IMPLEMENTS = reparse;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    MEMBERS    = grib_action     *block_true
    MEMBERS    = grib_action     *block_false
@@ -50,6 +51,8 @@ static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static grib_action* reparse(grib_action* a, grib_accessor* acc, int* doit);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_if
@@ -79,9 +82,11 @@ static grib_action_class _grib_action_class_if = {
 
     &create_accessor, /* create_accessor*/
 
-    0,        /* notify_change */
-    &reparse, /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    &reparse,        /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_if = &_grib_action_class_if;
@@ -309,3 +314,31 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_if* a = (grib_action_if*)act;
+    grib_snapshot_write_expression(w, a->expression);
+    grib_snapshot_write_actions(w, a->block_true);
+    grib_snapshot_write_actions(w, a->block_false);
+    grib_snapshot_write_long(w, a->transient);
+    grib_snapshot_write_string(w, act->debug_info);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_expression* expression = grib_snapshot_read_expression(r);
+    grib_action* block_true     = grib_snapshot_read_actions(r);
+    grib_action* block_false    = grib_snapshot_read_actions(r);
+    long transient              = grib_snapshot_read_long(r);
+    const char* debug_info      = grib_snapshot_read_string(r);
+    grib_action* act            = NULL;
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    act = grib_action_create_if(context, expression, block_true, block_false, transient, 0, NULL);
+    /* Only written where the file was parsed with debugging on */
+    if (debug_info && !act->debug_info)
+        act->debug_info = grib_context_strdup_persistent(context, debug_info);
+    return act;
+}
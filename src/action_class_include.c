@@ -0,0 +1,182 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * An include statement. The included file is found when the includer is
+ * parsed but is only parsed the first time the statement is executed, then
+ * shared through the parsed files of the context (see grib_parse_file). Its
+ * instructions are run in the section of the includer, as if their text had
+ * been included.
+ */
+
+#include "grib_api_internal.h"
+/*
+   This is used by make_class.pl
+
+   START_CLASS_DEF
+   CLASS      = action
+   IMPLEMENTS = create_accessor
+   IMPLEMENTS = dump
+   IMPLEMENTS = destroy
+   IMPLEMENTS = execute
+   IMPLEMENTS = write_snapshot;read_snapshot
+   MEMBERS    = char*           path
+   END_CLASS_DEF
+
+ */
+
+/* START_CLASS_IMP */
+
+/*
+
+Don't edit anything between START_CLASS_IMP and END_CLASS_IMP
+Instead edit values between START_CLASS_DEF and END_CLASS_DEF
+or edit "action.class" and rerun ./make_class.pl
+
+*/
+
+static void init_class(grib_action_class*);
+static void dump(grib_action* d, FILE*, int);
+static void destroy(grib_context*, grib_action*);
+static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
+
+
+typedef struct grib_action_include
+{
+    grib_action act;
+    /* Members defined in include */
+    char* path;
+} grib_action_include;
+
+
+static grib_action_class _grib_action_class_include = {
+    0,                           /* super                     */
+    "action_class_include",      /* name                      */
+    sizeof(grib_action_include), /* size                      */
+    0,                           /* inited */
+    &init_class,                 /* init_class */
+    0,                           /* init                      */
+    &destroy,                    /* destroy */
+
+    &dump, /* dump                      */
+    0,     /* xref                      */
+
+    &create_accessor, /* create_accessor*/
+
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
+};
+
+grib_action_class* grib_action_class_include = &_grib_action_class_include;
+
+static void init_class(grib_action_class* c)
+{
+}
+/* END_CLASS_IMP */
+
+grib_action* grib_action_create_include(grib_context* context, const char* fname)
+{
+    grib_action_include* a;
+    grib_action_class* c = grib_action_class_include;
+    grib_action* act     = NULL;
+    char* path           = NULL;
+
+    /* GRIB-796: Search for the included file in ECCODES_DEFINITION_PATH */
+    if ((path = grib_context_full_defs_path(context, fname)) == NULL) {
+        grib_context_log(context, GRIB_LOG_ERROR, "Unable to find included file %s. Definition files path: %s",
+                         fname, context->grib_definition_files_path);
+        return NULL;
+    }
+
+    act          = (grib_action*)grib_context_malloc_clear_persistent(context, c->size);
+    act->cclass  = c;
+    act->context = context;
+    act->name    = grib_context_strdup_persistent(context, fname);
+    a            = (grib_action_include*)act;
+    a->path      = grib_context_strdup_persistent(context, path);
+
+    return act;
+}
+
+static void dump(grib_action* act, FILE* f, int lvl)
+{
+    int i = 0;
+    for (i = 0; i < lvl; i++)
+        grib_context_print(act->context, f, "     ");
+    grib_context_print(act->context, f, "Include %s\n", act->name);
+}
+
+static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
+{
+    grib_action_include* a = (grib_action_include*)act;
+    grib_action* next      = grib_parse_file(p->h->context, a->path);
+    int ret                = GRIB_SUCCESS;
+
+    if (!next) {
+        grib_context_log(p->h->context, GRIB_LOG_ERROR, "Unable to parse included file %s", a->path);
+        return GRIB_INTERNAL_ERROR;
+    }
+
+    while (next) {
+        ret = grib_create_accessor(p, next, h);
+        if (ret != GRIB_SUCCESS)
+            return ret;
+        next = next->next;
+    }
+    return GRIB_SUCCESS;
+}
+
+static int execute(grib_action* act, grib_handle* h)
+{
+    grib_action_include* a = (grib_action_include*)act;
+    grib_action* next      = grib_parse_file(h->context, a->path);
+    int ret                = GRIB_SUCCESS;
+
+    if (!next) {
+        grib_context_log(h->context, GRIB_LOG_ERROR, "Unable to parse included file %s", a->path);
+        return GRIB_INTERNAL_ERROR;
+    }
+
+    while (next) {
+        ret = grib_action_execute(next, h);
+        if (ret != GRIB_SUCCESS)
+            return ret;
+        next = next->next;
+    }
+    return GRIB_SUCCESS;
+}
+
+static void destroy(grib_context* context, grib_action* act)
+{
+    grib_action_include* a = (grib_action_include*)act;
+
+    grib_context_free_persistent(context, a->path);
+    grib_context_free_persistent(context, act->name);
+}
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_snapshot_write_string(w, act->name);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_include(context, name);
+}
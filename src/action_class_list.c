@@ -24,6 +24,7 @@
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
    IMPLEMENTS = reparse
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    MEMBERS    = grib_action     *block_list
    END_CLASS_DEF
@@ -45,6 +46,8 @@ static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static grib_action* reparse(grib_action* a, grib_accessor* acc, int* doit);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_list
@@ -72,9 +75,11 @@ static grib_action_class _grib_action_class_list = {
 
     &create_accessor, /* create_accessor*/
 
-    0,        /* notify_change */
-    &reparse, /* reparse */
-    0,        /* execute */
+    0,               /* notify_change */
+    &reparse,        /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_list = &_grib_action_class_list;
@@ -190,3 +195,22 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->op);
     grib_expression_free(context, self->expression);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_list* a = (grib_action_list*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_expression(w, a->expression);
+    grib_snapshot_write_actions(w, a->block_list);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name            = grib_snapshot_read_string(r);
+    grib_expression* expression = grib_snapshot_read_expression(r);
+    grib_action* block          = grib_snapshot_read_actions(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_list(context, name, expression, block);
+}
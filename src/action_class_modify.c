@@ -21,6 +21,7 @@
    IMPLEMENTS = dump;xref
    IMPLEMENTS = create_accessor
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = long flags
    MEMBERS    = char *name
    END_CLASS_DEF
@@ -42,6 +43,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_modify
@@ -67,9 +70,11 @@ static grib_action_class _grib_action_class_modify = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_modify = &_grib_action_class_modify;
@@ -133,3 +138,20 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_modify* a = (grib_action_modify*)act;
+    grib_snapshot_write_string(w, a->name);
+    grib_snapshot_write_long(w, a->flags);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name = grib_snapshot_read_string(r);
+    long flags       = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_modify(context, name, flags);
+}
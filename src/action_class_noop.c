@@ -19,6 +19,8 @@
    START_CLASS_DEF
    CLASS      = action
    IMPLEMENTS = dump;destroy;xref;execute
+   IMPLEMENTS = create_accessor
+   IMPLEMENTS = write_snapshot;read_snapshot
    END_CLASS_DEF
 
  */
@@ -37,7 +39,10 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
+static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_noop
@@ -59,11 +64,13 @@ static grib_action_class _grib_action_class_noop = {
     &dump, /* dump                      */
     &xref, /* xref                      */
 
-    0, /* create_accessor*/
+    &create_accessor, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_noop = &_grib_action_class_noop;
@@ -107,7 +114,21 @@ static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
 
+static int create_accessor(grib_section* p, grib_action* act, grib_loader* h)
+{
+    return GRIB_SUCCESS;
+}
+
 static int execute(grib_action* act, grib_handle* h)
 {
     return 0;
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    return grib_action_create_noop(context, NULL);
+}
@@ -20,6 +20,7 @@
    CLASS      = action
    IMPLEMENTS = dump
    IMPLEMENTS = destroy;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char *name
    MEMBERS    = char *outname
    END_CLASS_DEF
@@ -40,6 +41,8 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_print
@@ -65,9 +68,11 @@ static grib_action_class _grib_action_class_print = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_print = &_grib_action_class_print;
@@ -153,3 +158,20 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_print* a = (grib_action_print*)act;
+    grib_snapshot_write_string(w, a->name);
+    grib_snapshot_write_string(w, a->outname);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name    = grib_snapshot_read_string(r);
+    const char* outname = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_print(context, name, (char*)outname);
+}
@@ -22,6 +22,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_arguments* args
    END_CLASS_DEF
 
@@ -41,6 +42,8 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_put
@@ -65,9 +68,11 @@ static grib_action_class _grib_action_class_put = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_put = &_grib_action_class_put;
@@ -140,3 +145,20 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_put* a = (grib_action_put*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_arguments(w, a->args);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name     = grib_snapshot_read_string(r);
+    grib_arguments* args = grib_snapshot_read_arguments(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_put(context, name, args);
+}
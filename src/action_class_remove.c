@@ -21,6 +21,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump
    IMPLEMENTS = destroy; xref
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_arguments* args
    END_CLASS_DEF
 
@@ -41,6 +42,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_remove
@@ -65,9 +68,11 @@ static grib_action_class _grib_action_class_remove = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_remove = &_grib_action_class_remove;
@@ -102,8 +107,8 @@ static void remove_accessor(grib_accessor* a)
     s = a->parent;
 
     if (grib_handle_of_accessor(a)->use_trie && *(a->all_names[0]) != '_') {
-        id                                        = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
-        grib_handle_of_accessor(a)->accessors[id] = NULL;
+        id = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
+        grib_handle_set_accessor_by_id(grib_handle_of_accessor(a), id, NULL);
     }
 
     if (a->next)
@@ -161,3 +166,18 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_remove* a = (grib_action_remove*)act;
+    grib_snapshot_write_arguments(w, a->args);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_arguments* args = grib_snapshot_read_arguments(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_remove(context, args);
+}
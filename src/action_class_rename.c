@@ -21,6 +21,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump
    IMPLEMENTS = destroy; xref
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char* the_old
    MEMBERS    = char* the_new
    END_CLASS_DEF
@@ -42,6 +43,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_rename
@@ -67,9 +70,11 @@ static grib_action_class _grib_action_class_rename = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_rename = &_grib_action_class_rename;
@@ -101,10 +106,11 @@ static void rename_accessor(grib_accessor* a, char* name)
     char* the_old = (char*)a->all_names[0];
 
     if (grib_handle_of_accessor(a)->use_trie && *(a->all_names[0]) != '_') {
-        id                                        = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
-        grib_handle_of_accessor(a)->accessors[id] = NULL;
-        id                                        = grib_hash_keys_get_id(a->context->keys, name);
-        grib_handle_of_accessor(a)->accessors[id] = a;
+        id = grib_hash_keys_get_id(a->context->keys, a->all_names[0]);
+        grib_handle_set_accessor_by_id(grib_handle_of_accessor(a), id, NULL);
+        id = grib_hash_keys_get_id(a->context->keys, name);
+        grib_handle_set_accessor_by_id(grib_handle_of_accessor(a), id, a);
+        a->name_id = *name != '_' ? id : -1;
     }
     a->all_names[0] = grib_context_strdup_persistent(a->context, name);
     a->name         = a->all_names[0];
@@ -154,3 +160,20 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_rename* a = (grib_action_rename*)act;
+    grib_snapshot_write_string(w, a->the_old);
+    grib_snapshot_write_string(w, a->the_new);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* the_old = grib_snapshot_read_string(r);
+    const char* the_new = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_rename(context, (char*)the_old, (char*)the_new);
+}
@@ -67,6 +67,8 @@ static grib_action_class _grib_action_class_section = {
     &notify_change, /* notify_change */
     &reparse,       /* reparse */
     0,              /* execute */
+    0,              /* write_snapshot */
+    0,              /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_section = &_grib_action_class_section;
@@ -91,8 +93,8 @@ static void check_sections(grib_section *s,grib_handle* h)
 }
 #endif
 
-static int notify_change(grib_action* act, grib_accessor* notified,
-                         grib_accessor* changed)
+/* Rebuild the section of 'notified' if the branch of 'act' it should hold has changed */
+static int reparse_section(grib_action* act, grib_accessor* notified, const char* changed)
 {
     grib_loader loader = { 0, 0, 0, 0, 0 };
 
@@ -113,7 +115,7 @@ static int notify_change(grib_action* act, grib_accessor* notified,
         }
         grib_context_log(h->context,
                          GRIB_LOG_DEBUG, "------------- SECTION action %s (%s) is triggered by [%s]%s",
-                         act->name, notified->name, changed->name, debug_str);
+                         act->name, notified->name, changed, debug_str);
     }
 
     la          = grib_action_reparse(act, notified, &doit);
@@ -140,7 +142,7 @@ static int notify_change(grib_action* act, grib_accessor* notified,
 
     loader.list_is_resized = (la == old_section->branch);
 
-    if (!strcmp(changed->name, "GRIBEditionNumber"))
+    if (!strcmp(changed, "GRIBEditionNumber"))
         loader.changing_edition = 1;
     else
         loader.changing_edition = 0;
@@ -209,13 +211,12 @@ static int notify_change(grib_action* act, grib_accessor* notified,
                        tmp_handle->root->block->first->sub_section);
 
     Assert(tmp_handle->dependencies == NULL);
-    /* printf("grib_handle_delete %p\n",(void*)tmp_handle); */
 
-    grib_handle_delete(tmp_handle);
+    h->kid = NULL;
+    grib_handle_update_accessors_table(h, tmp_handle->root->block->first->sub_section, old_section);
 
-    h->use_trie     = 1;
-    h->trie_invalid = 1;
-    h->kid          = NULL;
+    /* printf("grib_handle_delete %p\n",(void*)tmp_handle); */
+    grib_handle_delete(tmp_handle);
 
     err = grib_section_adjust_sizes(h->root, 1, 0);
     if (err)
@@ -236,6 +237,123 @@ static int notify_change(grib_action* act, grib_accessor* notified,
     return err;
 }
 
+/*
+ * Between grib_handle_begin_update and grib_handle_commit_update the sections
+ * to rebuild are queued on the handle instead, so that consecutive sets of
+ * keys changing the structure rebuild each section once. The setters apply
+ * the queue before setting any other key (see grib_value.c), and so does
+ * looking up a key (see grib_find_accessor), so that the message and the
+ * keys are the same as without the update.
+ */
+
+static int defer_reparse(grib_handle* h, grib_action* act, grib_accessor* notified, const char* changed)
+{
+    grib_deferred_reparse* d    = h->deferred_reparses;
+    grib_deferred_reparse* last = NULL;
+
+    for (; d; d = d->next) {
+        if (d->notified == notified)
+            return GRIB_SUCCESS;
+        last = d;
+    }
+
+    d = (grib_deferred_reparse*)grib_context_malloc_clear(h->context, sizeof(grib_deferred_reparse));
+    if (!d)
+        return GRIB_OUT_OF_MEMORY;
+    d->action   = act;
+    d->notified = notified;
+    d->changed  = changed;
+    if (last)
+        last->next = d;
+    else
+        h->deferred_reparses = d;
+    return GRIB_SUCCESS;
+}
+
+static int notify_change(grib_action* act, grib_accessor* notified,
+                         grib_accessor* changed)
+{
+    grib_handle* h = grib_handle_of_accessor(notified);
+    int err        = 0;
+
+    if (h->updating) {
+        /* A change of edition reparses the whole message: it cannot wait */
+        if (strcmp(changed->name, "GRIBEditionNumber"))
+            return defer_reparse(h, act, notified, changed->name);
+        if ((err = action_section_apply_deferred_reparses(h)) != GRIB_SUCCESS)
+            return err;
+    }
+    return reparse_section(act, notified, changed->name);
+}
+
+static int section_depth(const grib_accessor* a)
+{
+    int depth = 0;
+    for (; a; a = a->parent->owner)
+        depth++;
+    return depth;
+}
+
+static int section_contains(const grib_section* s, const grib_accessor* x)
+{
+    grib_accessor* a = s ? s->block->first : NULL;
+    for (; a; a = a->next) {
+        if (a == x || section_contains(a->sub_section, x))
+            return 1;
+    }
+    return 0;
+}
+
+/* Rebuild the queued sections, the outermost first. Those which were
+ * rebuilt with an enclosing section have gone from the tree and are skipped.
+ * The changes the rebuilding makes rebuild their sections at once, as they
+ * would outside an update, so nothing is queued while the queue is applied */
+int action_section_apply_deferred_reparses(grib_handle* h)
+{
+    int err      = GRIB_SUCCESS;
+    int updating = h->updating;
+
+    h->updating = 0;
+    while (h->deferred_reparses && !err) {
+        grib_deferred_reparse* list = h->deferred_reparses;
+        grib_deferred_reparse* d    = NULL;
+        h->deferred_reparses        = NULL;
+
+        for (d = list; d; d = d->next)
+            d->depth = section_depth(d->notified);
+
+        while (list) {
+            grib_deferred_reparse** p     = &list;
+            grib_deferred_reparse** outer = &list;
+            for (; *p; p = &(*p)->next) {
+                if ((*p)->depth < (*outer)->depth)
+                    outer = p;
+            }
+            d      = *outer;
+            *outer = d->next;
+
+            if (!err && section_contains(h->root, d->notified) && d->notified->creator == d->action)
+                err = reparse_section(d->action, d->notified, d->changed);
+            grib_context_free(h->context, d);
+        }
+    }
+    h->updating = updating;
+    if (err)
+        action_section_free_deferred_reparses(h);
+    return err;
+}
+
+void action_section_free_deferred_reparses(grib_handle* h)
+{
+    grib_deferred_reparse* d = h->deferred_reparses;
+    while (d) {
+        grib_deferred_reparse* next = d->next;
+        grib_context_free(h->context, d);
+        d = next;
+    }
+    h->deferred_reparses = NULL;
+}
+
 static grib_action* reparse(grib_action* a, grib_accessor* acc, int* doit)
 {
     /* Should be inherited */
@@ -19,6 +19,7 @@
    CLASS      = action
    IMPLEMENTS = dump;xref
    IMPLEMENTS = destroy;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    MEMBERS    = char *name
    MEMBERS    = int nofail
@@ -41,6 +42,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_set
@@ -67,9 +70,11 @@ static grib_action_class _grib_action_class_set = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_set = &_grib_action_class_set;
@@ -142,3 +147,22 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_set* a = (grib_action_set*)act;
+    grib_snapshot_write_string(w, a->name);
+    grib_snapshot_write_expression(w, a->expression);
+    grib_snapshot_write_long(w, a->nofail);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name            = grib_snapshot_read_string(r);
+    grib_expression* expression = grib_snapshot_read_expression(r);
+    long nofail                 = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_set(context, name, expression, nofail);
+}
@@ -19,6 +19,7 @@
    CLASS      = action
    IMPLEMENTS = dump;xref
    IMPLEMENTS = destroy;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_iarray *iarray
    MEMBERS    = char *name
    END_CLASS_DEF
@@ -40,6 +41,8 @@ static void dump(grib_action* d, FILE*, int);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_set_iarray
@@ -65,9 +68,11 @@ static grib_action_class _grib_action_class_set_iarray = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_set_iarray = &_grib_action_class_set_iarray;
@@ -133,3 +138,20 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_set_iarray* a = (grib_action_set_iarray*)act;
+    grib_snapshot_write_string(w, a->name);
+    grib_snapshot_write_iarray(w, a->iarray);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name    = grib_snapshot_read_string(r);
+    grib_iarray* iarray = grib_snapshot_read_iarray(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_set_iarray(context, name, iarray);
+}
@@ -19,6 +19,7 @@
    CLASS      = action
    IMPLEMENTS = dump
    IMPLEMENTS = destroy;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char *name
    END_CLASS_DEF
 
@@ -38,6 +39,8 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_set_missing
@@ -62,9 +65,11 @@ static grib_action_class _grib_action_class_set_missing = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_set_missing = &_grib_action_class_set_missing;
@@ -122,3 +127,18 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_set_missing* a = (grib_action_set_missing*)act;
+    grib_snapshot_write_string(w, a->name);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_set_missing(context, name);
+}
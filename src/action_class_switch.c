@@ -22,6 +22,7 @@
    IMPLEMENTS = destroy
    IMPLEMENTS = xref   
    IMPLEMENTS = execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_arguments* args
    MEMBERS    = grib_case *Case
    MEMBERS    = grib_action *Default
@@ -43,6 +44,8 @@ static void init_class(grib_action_class*);
 static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_switch
@@ -71,9 +74,11 @@ static grib_action_class _grib_action_class_switch = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_switch = &_grib_action_class_switch;
@@ -245,3 +250,22 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_switch* a = (grib_action_switch*)act;
+    grib_snapshot_write_arguments(w, a->args);
+    grib_snapshot_write_cases(w, a->Case);
+    grib_snapshot_write_actions(w, a->Default);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_arguments* args = grib_snapshot_read_arguments(r);
+    grib_case* Case      = grib_snapshot_read_cases(r);
+    grib_action* Default = grib_snapshot_read_actions(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_switch(context, args, Case, Default);
+}
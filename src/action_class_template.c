@@ -25,6 +25,7 @@
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
    IMPLEMENTS = reparse
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = int nofail
    MEMBERS    = char*           arg
    END_CLASS_DEF
@@ -46,6 +47,8 @@ static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static grib_action* reparse(grib_action* a, grib_accessor* acc, int* doit);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_template
@@ -73,9 +76,11 @@ static grib_action_class _grib_action_class_template = {
 
     &create_accessor, /* create_accessor*/
 
-    0,        /* notify_change */
-    &reparse, /* reparse */
-    0,        /* execute */
+    0,               /* notify_change */
+    &reparse,        /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_template = &_grib_action_class_template;
@@ -224,3 +229,22 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_template* a = (grib_action_template*)act;
+    grib_snapshot_write_long(w, a->nofail);
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_string(w, a->arg);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    long nofail      = grib_snapshot_read_long(r);
+    const char* name = grib_snapshot_read_string(r);
+    const char* arg  = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_template(context, nofail, name, arg);
+}
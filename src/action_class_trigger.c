@@ -25,6 +25,7 @@
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
    IMPLEMENTS = reparse
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_arguments* trigger_on
    MEMBERS    = grib_action     *block
    END_CLASS_DEF
@@ -46,6 +47,8 @@ static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static grib_action* reparse(grib_action* a, grib_accessor* acc, int* doit);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_trigger
@@ -73,9 +76,11 @@ static grib_action_class _grib_action_class_trigger = {
 
     &create_accessor, /* create_accessor*/
 
-    0,        /* notify_change */
-    &reparse, /* reparse */
-    0,        /* execute */
+    0,               /* notify_change */
+    &reparse,        /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_trigger = &_grib_action_class_trigger;
@@ -175,3 +180,20 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_trigger* a = (grib_action_trigger*)act;
+    grib_snapshot_write_arguments(w, a->trigger_on);
+    grib_snapshot_write_actions(w, a->block);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_arguments* args = grib_snapshot_read_arguments(r);
+    grib_action* block   = grib_snapshot_read_actions(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_trigger(context, args, block);
+}
@@ -20,6 +20,7 @@
    CLASS      = action
    SUPER      = action_class_gen
    IMPLEMENTS = execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    END_CLASS_DEF
 
  */
@@ -36,6 +37,8 @@ or edit "action.class" and rerun ./make_class.pl
 
 static void init_class(grib_action_class*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_variable
@@ -63,9 +66,11 @@ static grib_action_class _grib_action_class_variable = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_variable = &_grib_action_class_variable;
@@ -107,3 +112,30 @@ static int execute(grib_action* a, grib_handle* h)
 {
     return grib_create_accessor(h->root, a, NULL);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_variable* a = (grib_action_variable*)act;
+    grib_snapshot_write_string(w, act->name);
+    grib_snapshot_write_string(w, act->op);
+    grib_snapshot_write_long(w, a->len);
+    grib_snapshot_write_arguments(w, a->params);
+    grib_snapshot_write_arguments(w, act->default_value);
+    grib_snapshot_write_long(w, act->flags);
+    grib_snapshot_write_string(w, act->name_space);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name              = grib_snapshot_read_string(r);
+    const char* op                = grib_snapshot_read_string(r);
+    long len                      = grib_snapshot_read_long(r);
+    grib_arguments* params        = grib_snapshot_read_arguments(r);
+    grib_arguments* default_value = grib_snapshot_read_arguments(r);
+    long flags                    = grib_snapshot_read_long(r);
+    const char* name_space        = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_variable(context, name, op, len, params, default_value, flags, name_space);
+}
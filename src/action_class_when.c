@@ -20,6 +20,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump;xref
    IMPLEMENTS = destroy;notify_change
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    MEMBERS    = grib_action     *block_true
    MEMBERS    = grib_action     *block_false
@@ -44,6 +45,8 @@ static void xref(grib_action* d, FILE* f, const char* path);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
 static int notify_change(grib_action* a, grib_accessor* observer, grib_accessor* observed);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_when
@@ -71,9 +74,11 @@ static grib_action_class _grib_action_class_when = {
 
     &create_accessor, /* create_accessor*/
 
-    &notify_change, /* notify_change */
-    0,              /* reparse */
-    0,              /* execute */
+    &notify_change,  /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_when = &_grib_action_class_when;
@@ -236,3 +241,22 @@ static void destroy(grib_context* context, grib_action* act)
 static void xref(grib_action* d, FILE* f, const char* path)
 {
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_when* a = (grib_action_when*)act;
+    grib_snapshot_write_expression(w, a->expression);
+    grib_snapshot_write_actions(w, a->block_true);
+    grib_snapshot_write_actions(w, a->block_false);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_expression* expression = grib_snapshot_read_expression(r);
+    grib_action* block_true     = grib_snapshot_read_actions(r);
+    grib_action* block_false    = grib_snapshot_read_actions(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_when(context, expression, block_true, block_false);
+}
@@ -18,6 +18,7 @@
    IMPLEMENTS = create_accessor
    IMPLEMENTS = dump
    IMPLEMENTS = destroy
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *expression
    MEMBERS    = grib_action     *block_while
    END_CLASS_DEF
@@ -38,6 +39,8 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int create_accessor(grib_section*, grib_action*, grib_loader*);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_while
@@ -65,9 +68,11 @@ static grib_action_class _grib_action_class_while = {
 
     &create_accessor, /* create_accessor*/
 
-    0, /* notify_change */
-    0, /* reparse */
-    0, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    0,               /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_while = &_grib_action_class_while;
@@ -174,3 +179,20 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->op);
     grib_expression_free(context, self->expression);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_while* a = (grib_action_while*)act;
+    grib_snapshot_write_expression(w, a->expression);
+    grib_snapshot_write_actions(w, a->block_while);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    grib_expression* expression = grib_snapshot_read_expression(r);
+    grib_action* block          = grib_snapshot_read_actions(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_while(context, expression, block);
+}
@@ -19,6 +19,7 @@
    CLASS      = action
    IMPLEMENTS = dump
    IMPLEMENTS = destroy;execute
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char *name
    MEMBERS    = int append
    MEMBERS    = int padtomultiple
@@ -40,6 +41,8 @@ static void init_class(grib_action_class*);
 static void dump(grib_action* d, FILE*, int);
 static void destroy(grib_context*, grib_action*);
 static int execute(grib_action* a, grib_handle* h);
+static void write_snapshot(grib_action* a, grib_snapshot_writer* w);
+static grib_action* read_snapshot(grib_context* c, grib_snapshot_reader* r);
 
 
 typedef struct grib_action_write
@@ -66,9 +69,11 @@ static grib_action_class _grib_action_class_write = {
 
     0, /* create_accessor*/
 
-    0,        /* notify_change */
-    0,        /* reparse */
-    &execute, /* execute */
+    0,               /* notify_change */
+    0,               /* reparse */
+    &execute,        /* execute */
+    &write_snapshot, /* write_snapshot */
+    &read_snapshot,  /* read_snapshot */
 };
 
 grib_action_class* grib_action_class_write = &_grib_action_class_write;
@@ -206,3 +211,22 @@ static void destroy(grib_context* context, grib_action* act)
     grib_context_free_persistent(context, act->name);
     grib_context_free_persistent(context, act->op);
 }
+
+static void write_snapshot(grib_action* act, grib_snapshot_writer* w)
+{
+    grib_action_write* a = (grib_action_write*)act;
+    grib_snapshot_write_string(w, a->name);
+    grib_snapshot_write_long(w, a->append);
+    grib_snapshot_write_long(w, a->padtomultiple);
+}
+
+static grib_action* read_snapshot(grib_context* context, grib_snapshot_reader* r)
+{
+    const char* name   = grib_snapshot_read_string(r);
+    long append        = grib_snapshot_read_long(r);
+    long padtomultiple = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return grib_action_create_write(context, name, append, padtomultiple);
+}
@@ -67,6 +67,19 @@ int path_is_directory(const char* filename)
     return 0;
 }
 
+/* Return 1 if the filepath is a regular file, 0 otherwise */
+int path_is_regular_file(const char* filename)
+{
+    struct stat s;
+    int stat_val = stat(filename, &s);
+    if (stat_val == 0) {
+        if (S_ISREG(s.st_mode)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 char* codes_getenv(const char* name)
 {
     /* Look for the new ecCodes environment variable names */
@@ -361,10 +361,69 @@ int codes_get_double_array(const grib_handle* h, const char* key, double* vals,
 {
     return grib_get_double_array(h, key, vals, length);
 }
+int codes_get_float_array(const grib_handle* h, const char* key, float* vals, size_t* length)
+{
+    return grib_get_float_array(h, key, vals, length);
+}
 int codes_get_long_array(const grib_handle* h, const char* key, long* vals, size_t* length)
 {
     return grib_get_long_array(h, key, vals, length);
 }
+
+/* Compiled keys */
+/******************************************************************************/
+grib_key_id* codes_key_compile(grib_context* c, const char* key, int* err)
+{
+    return grib_key_compile(c, key, err);
+}
+void codes_key_delete(grib_key_id* k)
+{
+    grib_key_delete(k);
+}
+int codes_get_long_by_id(const grib_handle* h, const grib_key_id* k, long* value)
+{
+    return grib_get_long_by_id(h, k, value);
+}
+int codes_get_double_by_id(const grib_handle* h, const grib_key_id* k, double* value)
+{
+    return grib_get_double_by_id(h, k, value);
+}
+int codes_get_string_by_id(const grib_handle* h, const grib_key_id* k, char* mesg, size_t* length)
+{
+    return grib_get_string_by_id(h, k, mesg, length);
+}
+int codes_get_size_by_id(const grib_handle* h, const grib_key_id* k, size_t* size)
+{
+    return grib_get_size_by_id(h, k, size);
+}
+int codes_get_long_array_by_id(const grib_handle* h, const grib_key_id* k, long* vals, size_t* length)
+{
+    return grib_get_long_array_by_id(h, k, vals, length);
+}
+int codes_get_double_array_by_id(const grib_handle* h, const grib_key_id* k, double* vals, size_t* length)
+{
+    return grib_get_double_array_by_id(h, k, vals, length);
+}
+int codes_get_float_array_by_id(const grib_handle* h, const grib_key_id* k, float* vals, size_t* length)
+{
+    return grib_get_float_array_by_id(h, k, vals, length);
+}
+grib_key_plan* codes_key_plan_new(grib_context* c, const char** keys, const int* types, size_t nkeys, size_t string_length, int* err)
+{
+    return grib_key_plan_new(c, keys, types, nkeys, string_length, err);
+}
+void codes_key_plan_delete(grib_key_plan* p)
+{
+    grib_key_plan_delete(p);
+}
+size_t codes_key_plan_size(const grib_key_plan* p)
+{
+    return grib_key_plan_size(p);
+}
+int codes_key_plan_execute(grib_key_plan* p, const grib_handle* h, void** columns, size_t row, int* errors)
+{
+    return grib_key_plan_execute(p, h, columns, row, errors);
+}
 int codes_copy_namespace(grib_handle* dest, const char* name, grib_handle* src)
 {
     return grib_copy_namespace(dest, name, src);
@@ -389,6 +448,10 @@ int codes_set_double_array(grib_handle* h, const char* key, const double* vals,
 {
     return grib_set_double_array(h, key, vals, length);
 }
+int codes_set_float_array(grib_handle* h, const char* key, const float* vals, size_t length)
+{
+    return grib_set_float_array(h, key, vals, length);
+}
 int codes_set_force_double_array(grib_handle* h, const char* key, const double* vals, size_t length)
 {
     return grib_set_force_double_array(h, key, vals, length);
@@ -403,6 +466,16 @@ int codes_set_string_array(grib_handle* h, const char* key, const char** vals, s
     return grib_set_string_array(h, key, vals, length);
 }
 
+int codes_handle_begin_update(grib_handle* h)
+{
+    return grib_handle_begin_update(h);
+}
+
+int codes_handle_commit_update(grib_handle* h)
+{
+    return grib_handle_commit_update(h);
+}
+
 int codes_set_values(grib_handle* h, grib_values* grib_values, size_t arg_count)
 {
     return grib_set_values(h, grib_values, arg_count);
@@ -544,3 +617,11 @@ void codes_context_set_samples_path(grib_context* c, const char* path)
 {
     grib_context_set_samples_path(c, path);
 }
+void codes_context_set_threads(grib_context* c, int threads)
+{
+    grib_context_set_threads(c, threads);
+}
+void codes_context_set_values_cache_size(grib_context* c, size_t size)
+{
+    grib_context_set_values_cache_size(c, size);
+}
@@ -180,6 +180,21 @@ typedef struct grib_string_list codes_string_list;
 typedef struct grib_util_packing_spec codes_util_packing_spec;
 typedef struct grib_util_grid_spec codes_util_grid_spec;
 
+/*! A file mapped into memory, used to create handles without copying the messages.
+    \struct codes_mapped_file
+*/
+typedef struct grib_mapped_file codes_mapped_file;
+
+/*! A key name compiled once, to get its value from many handles without parsing the name each time.
+    \struct codes_key_id
+*/
+typedef struct grib_key_id codes_key_id;
+
+/*! A list of keys with their types, compiled once and extracted from many handles into columns.
+    \struct codes_key_plan
+*/
+typedef struct grib_key_plan codes_key_plan;
+
 
 codes_fieldset* codes_fieldset_new_from_files(codes_context* c, char* filenames[], int nfiles, char** keys, int nkeys, const char* where_string, const char* order_by_string, int* err);
 
@@ -406,6 +421,73 @@ codes_handle* codes_grib_handle_new_from_file(codes_context* c, FILE* f, int* er
 */
 codes_handle* codes_bufr_handle_new_from_file(codes_context* c, FILE* f, int* error);
 
+/**
+*  Create a handle from the n-th message of a file, without reading the messages before it.
+*  The position of each message is taken from the offset index "<filename>.offsets" which is
+*  built, and saved if possible, the first time it is needed. The index is rebuilt if the size or
+*  modification time of the file have changed.
+*  Remember always to delete the handle when it is not needed anymore.
+*
+* @param c           : the context from which the handle will be created (NULL for default context)
+* @param filename    : the path to the file
+* @param n           : the message number, starting at 1
+* @param error       : error code set if the returned handle is NULL
+* @return            the new handle, NULL if there is no such message or a problem is encountered
+*/
+codes_handle* codes_handle_new_from_file_at(codes_context* c, const char* filename, long n, int* error);
+
+/**
+*  Build the offset index "<filename>.offsets" used by codes_handle_new_from_file_at and codes_count_in_filename.
+*  Nothing is done if a valid index already exists.
+*
+* @param c           : the context (NULL for default context)
+* @param filename    : the path to the file
+* @return            0 if OK, integer value on error
+*/
+int codes_offset_index_build(codes_context* c, const char* filename);
+
+/**
+*  Map a file into memory so that handles can be created from it without copying the messages.
+*  Remember always to close the mapped file when it is not needed anymore.
+*  Not available on Windows.
+*
+* @param c           : the context from which the mapped file will be created (NULL for default context)
+* @param filename    : the path to the file
+* @param err         : error code set if the returned mapped file is NULL
+* @return            the new mapped file, NULL if the file cannot be opened or mapped
+*/
+codes_mapped_file* codes_mapped_file_open(codes_context* c, const char* filename, int* err);
+
+/**
+*  Create a handle from the next message in a memory-mapped file.
+*  The message is not copied: the handle refers directly to the mapped memory, which is
+*  kept alive even if the mapped file has been closed. The first time a key stored in
+*  the message is set, whether or not its size changes, the handle copies the message
+*  and releases the mapping.
+*  Remember always to delete the handle when it is not needed anymore.
+*
+* @param c           : the context from which the handle will be created (NULL for default context)
+* @param mf          : the mapped file
+* @param product     : the kind of product e.g. PRODUCT_GRIB, PRODUCT_BUFR, PRODUCT_ANY
+* @param error       : error code set if the returned handle is NULL and the end of file is not reached
+* @return            the new handle, NULL at the end of the file or if a problem is encountered
+*/
+codes_handle* codes_handle_new_from_mapped_file(codes_context* c, codes_mapped_file* mf, ProductKind product, int* error);
+
+/**
+*  Go back to the start of a memory-mapped file.
+*
+* @param mf          : the mapped file
+*/
+void codes_mapped_file_rewind(codes_mapped_file* mf);
+
+/**
+*  Close a memory-mapped file. The memory is unmapped once all the handles created from it are deleted.
+*
+* @param mf          : the mapped file
+*/
+void codes_mapped_file_close(codes_mapped_file* mf);
+
 
 /**
 *  Write a coded message to a file.
@@ -838,6 +920,19 @@ int codes_get_bytes(const codes_handle* h, const char* key, unsigned char* bytes
 */
 int codes_get_double_array(const codes_handle* h, const char* key, double* vals, size_t* length);
 
+/**
+*  Get values from a key as single precision floats. If several keys of the same name are present, the last one is returned.
+*  Data values are decoded straight into the float array where the packing allows it.
+* @see  codes_set_float_array
+*
+* @param h           : the handle to get the data from
+* @param key         : the key to be searched
+* @param vals        : the address of a float array where the data will be retrieved
+* @param length      : the address of a size_t that contains allocated length of the float array on input, and that contains the actual length of the float array on output
+* @return            0 if OK, integer value on error
+*/
+int codes_get_float_array(const codes_handle* h, const char* key, float* vals, size_t* length);
+
 /**
 *  Get long array values from a key. If several keys of the same name are present, the last one is returned
 * @see  codes_set_long_array
@@ -850,6 +945,153 @@ int codes_get_double_array(const codes_handle* h, const char* key, double* vals,
 */
 int codes_get_long_array(const codes_handle* h, const char* key, long* vals, size_t* length);
 
+/**
+*  Compile a key name for the codes_get_..._by_id functions. The name is parsed and hashed
+*  once, so getting the key from each handle is a direct lookup. Names with a rank, a
+*  condition or an attribute are accepted but are looked up as by the gets by name.
+*  The compiled key is only valid with handles created from the same context.
+*  Remember always to delete the compiled key when it is not needed anymore.
+*
+* @param c           : the context the handles are created from (NULL for default context)
+* @param key         : the key name, possibly with a namespace e.g. "mars.step"
+* @param err         : error code set if the returned key is NULL
+* @return            the compiled key, NULL on error
+*/
+codes_key_id* codes_key_compile(codes_context* c, const char* key, int* err);
+
+/**
+*  Delete a compiled key.
+*
+* @param k           : the compiled key
+*/
+void codes_key_delete(codes_key_id* k);
+
+/**
+*  Get a long value from a compiled key. Same as codes_get_long with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the data from
+* @param k           : the compiled key
+* @param value       : the address of a long where the data will be retrieved
+* @return            0 if OK, integer value on error
+*/
+int codes_get_long_by_id(const codes_handle* h, const codes_key_id* k, long* value);
+
+/**
+*  Get a double value from a compiled key. Same as codes_get_double with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the data from
+* @param k           : the compiled key
+* @param value       : the address of a double where the data will be retrieved
+* @return            0 if OK, integer value on error
+*/
+int codes_get_double_by_id(const codes_handle* h, const codes_key_id* k, double* value);
+
+/**
+*  Get a string value from a compiled key. Same as codes_get_string with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h         : the handle to get the data from
+* @param k         : the compiled key
+* @param mesg      : the address of a string where the data will be retrieved
+* @param length    : the address of a size_t that contains allocated length of the string on input, and that contains the actual length of the string on output
+* @return          0 if OK, integer value on error
+*/
+int codes_get_string_by_id(const codes_handle* h, const codes_key_id* k, char* mesg, size_t* length);
+
+/**
+*  Get the number of values of a compiled key. Same as codes_get_size with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the size from
+* @param k           : the compiled key
+* @param size        : the address of a size_t where the size will be set
+* @return            0 if OK, integer value on error
+*/
+int codes_get_size_by_id(const codes_handle* h, const codes_key_id* k, size_t* size);
+
+/**
+*  Get long array values from a compiled key. Same as codes_get_long_array with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the data from
+* @param k           : the compiled key
+* @param vals        : the address of a long array where the data will be retrieved
+* @param length      : the address of a size_t that contains allocated length of the long array on input, and that contains the actual length of the long array on output
+* @return            0 if OK, integer value on error
+*/
+int codes_get_long_array_by_id(const codes_handle* h, const codes_key_id* k, long* vals, size_t* length);
+
+/**
+*  Get double array values from a compiled key. Same as codes_get_double_array with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the data from
+* @param k           : the compiled key
+* @param vals        : the address of a double array where the data will be retrieved
+* @param length      : the address of a size_t that contains allocated length of the double array on input, and that contains the actual length of the double array on output
+* @return            0 if OK, integer value on error
+*/
+int codes_get_double_array_by_id(const codes_handle* h, const codes_key_id* k, double* vals, size_t* length);
+
+/**
+*  Get values from a compiled key as single precision floats. Same as codes_get_float_array with the name of the key.
+*  @see  codes_key_compile
+*
+* @param h           : the handle to get the data from
+* @param k           : the compiled key
+* @param vals        : the address of a float array where the data will be retrieved
+* @param length      : the address of a size_t that contains allocated length of the float array on input, and that contains the actual length of the float array on output
+* @return            0 if OK, integer value on error
+*/
+int codes_get_float_array_by_id(const codes_handle* h, const codes_key_id* k, float* vals, size_t* length);
+
+/**
+*  Compile a list of keys with their types, to extract them from many handles with codes_key_plan_execute.
+*  Keys naming the same key of a message (e.g. "paramId" and "mars.param") are decoded once per message.
+*  The plan is only valid with handles created from the same context and must be used by one thread at a time.
+*  Remember always to delete the plan when it is not needed anymore.
+*
+* @param c             : the context the handles are created from (NULL for default context)
+* @param keys          : the key names
+* @param types         : CODES_TYPE_LONG, CODES_TYPE_DOUBLE or CODES_TYPE_STRING for each key (NULL for all strings)
+* @param nkeys         : the number of keys
+* @param string_length : the size of a string value in the columns, terminating zero included
+* @param err           : error code set if the returned plan is NULL
+* @return              the compiled plan, NULL on error
+*/
+codes_key_plan* codes_key_plan_new(codes_context* c, const char** keys, const int* types, size_t nkeys, size_t string_length, int* err);
+
+/**
+*  Delete a key plan.
+*
+* @param p             : the plan
+*/
+void codes_key_plan_delete(codes_key_plan* p);
+
+/**
+*  Number of keys in a key plan.
+*
+* @param p             : the plan
+* @return              the number of keys
+*/
+size_t codes_key_plan_size(const codes_key_plan* p);
+
+/**
+*  Extract the keys of a plan from a handle into one row of the columns supplied by the caller.
+*  columns[i] is an array of long, of double or of string_length chars per row according to the type of key i.
+*  A key which cannot be extracted gets CODES_MISSING_LONG, CODES_MISSING_DOUBLE or an empty string.
+*
+* @param p             : the plan
+* @param h             : the handle to get the data from
+* @param columns       : one array per key of the plan
+* @param row           : the row of the columns to fill
+* @param errors        : if not NULL, the error of each key
+* @return              0 if all the keys were extracted, else the error of the last key which was not
+*/
+int codes_key_plan_execute(codes_key_plan* p, const codes_handle* h, void** columns, size_t row, int* errors);
+
 
 /*   setting      data         */
 /**
@@ -921,6 +1163,18 @@ int codes_set_bytes(codes_handle* h, const char* key, const unsigned char* bytes
 */
 int codes_set_double_array(codes_handle* h, const char* key, const double* vals, size_t length);
 
+/**
+*  Set a float array from a key. If several keys of the same name are present, the last one is set
+*   @see  codes_get_float_array
+*
+* @param h           : the handle to set the data to
+* @param key         : the key to be searched
+* @param vals        : the address of a float array where the data will be read
+* @param length      : a size_t that contains the length of the float array on input
+* @return            0 if OK, integer value on error
+*/
+int codes_set_float_array(codes_handle* h, const char* key, const float* vals, size_t length);
+
 /**
 * Same as codes_set_double_array but allows setting of READ-ONLY keys like codedValues.
 * Use with great caution!!
@@ -951,6 +1205,28 @@ int codes_set_long_array(codes_handle* h, const char* key, const long* vals, siz
 * @return            0 if OK, integer value on error
 */
 int codes_set_string_array(codes_handle* h, const char* key, const char** vals, size_t length);
+
+/**
+*  Start a batch of sets on a handle. Until the matching codes_handle_commit_update,
+*  the parts of the message whose structure a set changes (e.g. a new template)
+*  are not rebuilt after each set: consecutive sets of such keys rebuild them once,
+*  when a key of another kind is set, the message is got, or the update is committed.
+*  The resulting message is the same as without the update. Updates can be nested:
+*  the outermost commit rebuilds what is left.
+*
+* @param h           : the handle to update
+* @return            0 if OK, integer value on error
+*/
+int codes_handle_begin_update(codes_handle* h);
+
+/**
+*  End a batch of sets started by codes_handle_begin_update and rebuild the parts
+*  of the message whose structure it changed
+*
+* @param h           : the handle being updated
+* @return            0 if OK, integer value on error
+*/
+int codes_handle_commit_update(codes_handle* h);
 /*! @} */
 
 
@@ -1066,6 +1342,30 @@ void codes_context_set_definitions_path(codes_context* c, const char* path);
  */
 void codes_context_set_samples_path(codes_context* c, const char* path);
 
+/**
+ * Sets the number of threads used to decode and encode a single large field.
+ * Fields with fewer values than ECCODES_THREADS_MIN_VALUES are always done by
+ * the calling thread. The default is one thread or ECCODES_THREADS.
+ * Do not call this while handles of the context are in use in other threads.
+ *
+ * @param c       : the context to be modified
+ * @param threads : the number of threads, including the calling thread
+ */
+void codes_context_set_threads(codes_context* c, int threads);
+
+/**
+ * Sets the memory, in bytes, for keeping the values decoded from the data
+ * section of messages, so that getting them again (or getting max, average...
+ * and then the values) does not decode them again. The values of all the
+ * handles of the context share it: the least recently used are dropped first.
+ * It pays off for packings slow to decode (e.g. CCSDS, JPEG, spectral).
+ * The default is 0, no values kept, or ECCODES_VALUES_CACHE_SIZE.
+ *
+ * @param c       : the context to be modified
+ * @param size    : the memory in bytes
+ */
+void codes_context_set_values_cache_size(codes_context* c, size_t size);
+
 /**
 *  Turn on support for multiple fields in single GRIB messages
 *
@@ -204,3 +204,57 @@ const char* grib_unop_double_proc_name(grib_unop_double_proc proc)
     Assert(0);
     return NULL;
 }
+
+/* The reverse of the functions above, for the definitions snapshot */
+#define FIND(a)                      \
+    if (strcmp(name, "&" #a) == 0) { \
+        return &a;                   \
+    }
+grib_binop_long_proc grib_binop_long_proc_by_name(const char* name)
+{
+    FIND(grib_op_eq);
+    FIND(grib_op_ne);
+    FIND(grib_op_lt);
+    FIND(grib_op_gt);
+    FIND(grib_op_and);
+    FIND(grib_op_or);
+    FIND(grib_op_ge);
+    FIND(grib_op_le);
+    FIND(grib_op_bit);
+    FIND(grib_op_bitoff);
+    FIND(grib_op_pow);
+    FIND(grib_op_add);
+    FIND(grib_op_sub);
+    FIND(grib_op_div);
+    FIND(grib_op_mul);
+    FIND(grib_op_modulo);
+    return NULL;
+}
+
+grib_binop_double_proc grib_binop_double_proc_by_name(const char* name)
+{
+    FIND(grib_op_mul_d);
+    FIND(grib_op_div_d);
+    FIND(grib_op_add_d);
+    FIND(grib_op_sub_d);
+    FIND(grib_op_eq_d);
+    FIND(grib_op_ne_d);
+    FIND(grib_op_lt_d);
+    FIND(grib_op_gt_d);
+    FIND(grib_op_ge_d);
+    FIND(grib_op_le_d);
+    return NULL;
+}
+
+grib_unop_long_proc grib_unop_long_proc_by_name(const char* name)
+{
+    FIND(grib_op_not);
+    FIND(grib_op_neg);
+    return NULL;
+}
+
+grib_unop_double_proc grib_unop_double_proc_by_name(const char* name)
+{
+    FIND(grib_op_neg_d);
+    return NULL;
+}
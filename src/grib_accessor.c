@@ -15,6 +15,7 @@
  ***************************************************************************/
 
 #include "grib_api_internal.h"
+#include "grib_accessor_class.h"
 
 /* Note: A fast cut-down version of strcmp which does NOT return -1 */
 /* 0 means input strings are equal and 1 means not equal */
@@ -42,9 +43,42 @@ void grib_accessor_dump(grib_accessor* a, grib_dumper* f)
     Assert(0);
 }
 
+/* Whether packing the accessor can write into the message. Variables, such
+ * as the transient keys set while decoding, keep their value in the accessor */
+static int packs_into_message(const grib_accessor* a)
+{
+    grib_accessor_class* c = a->cclass;
+    while (c) {
+        if (c == grib_accessor_class_variable || c == grib_accessor_class_transient_darray)
+            return 0;
+        c = c->super ? *(c->super) : NULL;
+    }
+    return 1;
+}
+
+/* Called before a key is packed.
+ * A handle created from a memory-mapped file shares its message with the
+ * mapping, and a cloned handle with the handle it was cloned from. It gets
+ * its own copy the first time a key stored in the message is packed, unless
+ * no other handle holds the message any more.
+ * The values decoded from the message may change too (see grib_values_cache.c) */
+static void before_pack(grib_accessor* a)
+{
+    grib_handle* h = grib_handle_of_accessor(a);
+    if (h)
+        grib_values_cache_clear(h);
+    if (!h || !packs_into_message(a))
+        return;
+    if (h->mapped_file) {
+        grib_mapped_file_unshare_buffer(h->mapped_file, h->buffer);
+        h->mapped_file = NULL;
+    }
+}
+
 int grib_pack_missing(grib_accessor* a)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (double) %g",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->pack_missing) {
@@ -59,6 +93,7 @@ int grib_pack_missing(grib_accessor* a)
 int grib_pack_zero(grib_accessor* a)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (double) %g",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->clear) {
@@ -87,6 +122,7 @@ int grib_is_missing_internal(grib_accessor* a)
 int grib_pack_double(grib_accessor* a, const double* v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (double) %g",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->pack_double) {
@@ -101,6 +137,7 @@ int grib_pack_double(grib_accessor* a, const double* v, size_t* len)
 int grib_pack_expression(grib_accessor* a, grib_expression* e)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (double) %g",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->pack_expression) {
@@ -115,6 +152,7 @@ int grib_pack_expression(grib_accessor* a, grib_expression* e)
 int grib_pack_string(grib_accessor* a, const char* v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (string) %s",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?v:"(null)");*/
     while (c) {
         if (c->pack_string) {
@@ -129,6 +167,7 @@ int grib_pack_string(grib_accessor* a, const char* v, size_t* len)
 int grib_pack_string_array(grib_accessor* a, const char** v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (string) %s",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?v:"(null)");*/
     while (c) {
         if (c->pack_string_array) {
@@ -143,6 +182,7 @@ int grib_pack_string_array(grib_accessor* a, const char** v, size_t* len)
 int grib_pack_long(grib_accessor* a, const long* v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (long) %d",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->pack_long) {
@@ -157,6 +197,7 @@ int grib_pack_long(grib_accessor* a, const long* v, size_t* len)
 int grib_pack_bytes(grib_accessor* a, const unsigned char* v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
+    before_pack(a);
     /*grib_context_log(a->context, GRIB_LOG_DEBUG, "(%s)%s is packing (bytes) %d",(a->parent->owner)?(a->parent->owner->name):"root", a->name ,v?(*v):0); */
     while (c) {
         if (c->pack_bytes) {
@@ -209,6 +250,39 @@ int grib_unpack_double(grib_accessor* a, double* v, size_t* len)
     return 0;
 }
 
+/* Decode straight into floats when the class (or a super class whose
+ * unpack_double it did not override) has a float decoder, otherwise
+ * decode to doubles and narrow them. A class inherits the procedures
+ * it leaves unset */
+int grib_unpack_float(grib_accessor* a, float* v, size_t* len)
+{
+    grib_accessor_class* c = a->cclass;
+    double* dval           = NULL;
+    size_t i               = 0;
+    int err                = 0;
+
+    while (c) {
+        grib_accessor_class* super = c->super ? *(c->super) : NULL;
+        if (c->unpack_float) {
+            return c->unpack_float(a, v, len);
+        }
+        if (!super || (c->unpack_double && c->unpack_double != super->unpack_double))
+            break;
+        c = super;
+    }
+
+    dval = (double*)grib_context_malloc(a->context, (*len ? *len : 1) * sizeof(double));
+    if (!dval)
+        return GRIB_OUT_OF_MEMORY;
+    err = grib_unpack_double(a, dval, len);
+    if (err == GRIB_SUCCESS) {
+        for (i = 0; i < *len; i++)
+            v[i] = (float)dval[i];
+    }
+    grib_context_free(a->context, dval);
+    return err;
+}
+
 int grib_unpack_double_element(grib_accessor* a, size_t i, double* v)
 {
     grib_accessor_class* c = a->cclass;
@@ -221,6 +295,23 @@ int grib_unpack_double_element(grib_accessor* a, size_t i, double* v)
     return GRIB_NOT_IMPLEMENTED;
 }
 
+/* The set decoder of a super class is only used by classes decoding values as
+ * it does, i.e. not overriding unpack_double nor unpack_double_element.
+ * GRIB_NOT_IMPLEMENTED when the values must be decoded whole instead */
+int grib_unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    grib_accessor_class* c = a->cclass;
+    while (c) {
+        if (c->unpack_double_element_set) {
+            return c->unpack_double_element_set(a, index_array, len, val_array);
+        }
+        if (c->unpack_double || c->unpack_double_element)
+            break;
+        c = c->super ? *(c->super) : NULL;
+    }
+    return GRIB_NOT_IMPLEMENTED;
+}
+
 int grib_unpack_string(grib_accessor* a, char* v, size_t* len)
 {
     grib_accessor_class* c = a->cclass;
@@ -478,7 +569,7 @@ void grib_accessor_delete(grib_context* ct, grib_accessor* a)
         c = s;
     }
     /*printf("grib_accessor_delete before free a=%p\n", (void*)a);*/
-    grib_context_free(ct, a);
+    grib_handle_free(ct, a);
 }
 
 grib_accessor* grib_accessor_clone(grib_accessor* a, grib_section* s, int* err)
@@ -76,28 +76,33 @@ static struct table_entry table[] = {
 grib_section* grib_create_root_section(const grib_context* context, grib_handle* h)
 {
     char* fpath     = 0;
-    grib_section* s = (grib_section*)grib_context_malloc_clear(context, sizeof(grib_section));
-
-    GRIB_MUTEX_INIT_ONCE(&once, &init);
-    GRIB_MUTEX_LOCK(&mutex1);
-    if (h->context->grib_reader == NULL) {
-        if ((fpath = grib_context_full_defs_path(h->context, "boot.def")) == NULL) {
-            grib_context_log(h->context, GRIB_LOG_FATAL,
-                             "Unable to find boot.def. Context path=%s\n"
-                             "\nPossible causes:\n"
-                             "- The software is not correctly installed\n"
-                             "- The environment variable ECCODES_DEFINITION_PATH is defined but incorrect\n",
-                             context->grib_definition_files_path);
+    grib_section* s = (grib_section*)grib_handle_malloc_clear(h, sizeof(grib_section));
+
+    /* Once boot.def is parsed there is nothing to lock for. The list of
+     * files is published before boot.def is, when it starts being parsed */
+    grib_action_file_list* reader = GRIB_PUBLISHED(h->context->grib_reader);
+    if (!GRIB_LOCK_FREE_READS || reader == NULL || GRIB_PUBLISHED(reader->first) == NULL) {
+        GRIB_MUTEX_INIT_ONCE(&once, &init);
+        GRIB_MUTEX_LOCK(&mutex1);
+        if (h->context->grib_reader == NULL) {
+            if ((fpath = grib_context_full_defs_path(h->context, "boot.def")) == NULL) {
+                grib_context_log(h->context, GRIB_LOG_FATAL,
+                                 "Unable to find boot.def. Context path=%s\n"
+                                 "\nPossible causes:\n"
+                                 "- The software is not correctly installed\n"
+                                 "- The environment variable ECCODES_DEFINITION_PATH is defined but incorrect\n",
+                                 context->grib_definition_files_path);
+            }
+            grib_parse_file(h->context, fpath);
         }
-        grib_parse_file(h->context, fpath);
+        GRIB_MUTEX_UNLOCK(&mutex1);
     }
-    GRIB_MUTEX_UNLOCK(&mutex1);
 
     s->h        = h;
     s->aclength = NULL;
     s->owner    = NULL;
     s->block    = (grib_block_of_accessors*)
-        grib_context_malloc_clear(context, sizeof(grib_block_of_accessors));
+        grib_handle_malloc_clear(h, sizeof(grib_block_of_accessors));
     grib_context_log(context, GRIB_LOG_DEBUG, "Creating root section");
     return s;
 }
@@ -141,7 +146,7 @@ grib_accessor* grib_accessor_factory(grib_section* p, grib_action* creator,
     c = *((grib_accessor_classes_hash(creator->op, strlen(creator->op)))->cclass);
 #endif
 
-    a = (grib_accessor*)grib_context_malloc_clear(p->h->context, c->size);
+    a = (grib_accessor*)grib_handle_malloc_clear(p->h, c->size);
 
     a->name       = creator->name;
     a->name_space = creator->name_space;
@@ -247,6 +252,7 @@ void grib_push_accessor(grib_accessor* a, grib_block_of_accessors* l)
     }
     l->last = a;
 
+    a->name_id = -1;
     if (hand->use_trie) {
         DebugAssert( a->all_names[0] );
         if (*(a->all_names[0]) != '_') {
@@ -254,9 +260,10 @@ void grib_push_accessor(grib_accessor* a, grib_block_of_accessors* l)
 
             DebugAssert(id >= 0 && id < ACCESSORS_ARRAY_SIZE);
 
-            a->same = hand->accessors[id];
+            a->name_id = id;
+            a->same    = grib_handle_get_accessor_by_id(hand, id);
             link_same_attributes(a, a->same);
-            hand->accessors[id] = a;
+            grib_handle_set_accessor_by_id(hand, id, a);
 
             if (a->same == a) {
                 fprintf(stderr, "---> %s\n", a->name);
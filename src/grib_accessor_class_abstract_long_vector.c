@@ -73,6 +73,7 @@ static grib_accessor_class _grib_accessor_class_abstract_long_vector = {
     0,                                          /* grib_unpack procedures long    */
     0,                                          /* grib_pack procedures double    */
     0,                                          /* grib_unpack procedures double  */
+    0,                                          /* grib_unpack procedures float   */
     0,                                          /* grib_pack procedures string    */
     0,                                          /* grib_unpack procedures string  */
     0,                                          /* grib_pack array procedures string    */
@@ -88,6 +89,7 @@ static grib_accessor_class _grib_accessor_class_abstract_long_vector = {
     0,                                          /* next accessor    */
     0,                                          /* compare vs. another accessor   */
     0,                                          /* unpack only ith value          */
+    0,                                          /* unpack a given set of elements */
     0,                                          /* unpack a subarray         */
     0,                                          /* clear          */
     0,                                          /* clone accessor          */
@@ -134,3 +136,19 @@ static void init_class(grib_accessor_class* c)
 }
 
 /* END_CLASS_IMP */
+
+/* 'clone' is a copy of the bytes of 'a' in a cloned handle: give it its own values */
+int accessor_abstract_long_vector_clone_state(grib_accessor* a, grib_accessor* clone)
+{
+    grib_accessor_abstract_long_vector* self = (grib_accessor_abstract_long_vector*)a;
+    grib_accessor_abstract_long_vector* copy = (grib_accessor_abstract_long_vector*)clone;
+
+    copy->v = NULL;
+    if (self->v) {
+        copy->v = (long*)grib_context_malloc(a->context, sizeof(long) * self->number_of_elements);
+        if (!copy->v)
+            return GRIB_OUT_OF_MEMORY;
+        memcpy(copy->v, self->v, sizeof(long) * self->number_of_elements);
+    }
+    return GRIB_SUCCESS;
+}
@@ -18,6 +18,7 @@
 
    IMPLEMENTS = next_offset
    IMPLEMENTS = unpack_double;unpack_double_element
+   IMPLEMENTS = unpack_float
    IMPLEMENTS = unpack_long
    IMPLEMENTS = unpack_string
    IMPLEMENTS = init;dump;update_size
@@ -40,6 +41,7 @@ or edit "accessor.class" and rerun ./make_class.pl
 */
 
 static int unpack_double(grib_accessor*, double* val, size_t* len);
+static int unpack_float(grib_accessor*, float* val, size_t* len);
 static int unpack_long(grib_accessor*, long* val, size_t* len);
 static int unpack_string(grib_accessor*, char*, size_t* len);
 static long next_offset(grib_accessor*);
@@ -86,6 +88,7 @@ static grib_accessor_class _grib_accessor_class_bitmap = {
     &unpack_long,                 /* grib_unpack procedures long    */
     0,                            /* grib_pack procedures double    */
     &unpack_double,               /* grib_unpack procedures double  */
+    &unpack_float,                /* grib_unpack procedures float   */
     0,                            /* grib_pack procedures string    */
     &unpack_string,               /* grib_unpack procedures string  */
     0,                            /* grib_pack array procedures string    */
@@ -101,6 +104,7 @@ static grib_accessor_class _grib_accessor_class_bitmap = {
     0,                            /* next accessor    */
     0,                            /* compare vs. another accessor   */
     &unpack_double_element,       /* unpack only ith value          */
+    0,                            /* unpack a given set of elements */
     0,                            /* unpack a subarray         */
     0,                            /* clear          */
     0,                            /* clone accessor          */
@@ -261,6 +265,31 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     return GRIB_SUCCESS;
 }
 
+static int unpack_float(grib_accessor* a, float* val, size_t* len)
+{
+    long pos = a->offset * 8;
+    long tlen;
+    long i;
+    int err           = 0;
+    grib_handle* hand = grib_handle_of_accessor(a);
+
+    err = grib_value_count(a, &tlen);
+    if (err)
+        return err;
+
+    if (*len < tlen) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "Wrong size for %s it contains %d values ", a->name, tlen);
+        *len = 0;
+        return GRIB_ARRAY_TOO_SMALL;
+    }
+
+    for (i = 0; i < tlen; i++) {
+        val[i] = (float)grib_decode_unsigned_long(hand->buffer->data, &pos, 1);
+    }
+    *len = tlen;
+    return GRIB_SUCCESS;
+}
+
 static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
 {
     long pos = a->offset * 8;
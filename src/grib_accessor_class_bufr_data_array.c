@@ -177,6 +177,7 @@ static grib_accessor_class _grib_accessor_class_bufr_data_array = {
     0,                                     /* grib_unpack procedures long    */
     &pack_double,                          /* grib_pack procedures double    */
     &unpack_double,                        /* grib_unpack procedures double  */
+    0,                                     /* grib_unpack procedures float   */
     0,                                     /* grib_pack procedures string    */
     0,                                     /* grib_unpack procedures string  */
     0,                                     /* grib_pack array procedures string    */
@@ -192,6 +193,7 @@ static grib_accessor_class _grib_accessor_class_bufr_data_array = {
     0,                                     /* next accessor    */
     &compare,                              /* compare vs. another accessor   */
     0,                                     /* unpack only ith value          */
+    0,                                     /* unpack a given set of elements */
     0,                                     /* unpack a subarray         */
     0,                                     /* clear          */
     0,                                     /* clone accessor          */
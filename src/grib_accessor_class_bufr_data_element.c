@@ -109,6 +109,7 @@ static grib_accessor_class _grib_accessor_class_bufr_data_element = {
     &unpack_long,                            /* grib_unpack procedures long    */
     &pack_double,                            /* grib_pack procedures double    */
     &unpack_double,                          /* grib_unpack procedures double  */
+    0,                                       /* grib_unpack procedures float   */
     &pack_string,                            /* grib_pack procedures string    */
     &unpack_string,                          /* grib_unpack procedures string  */
     &pack_string_array,                      /* grib_pack array procedures string    */
@@ -124,6 +125,7 @@ static grib_accessor_class _grib_accessor_class_bufr_data_element = {
     0,                                       /* next accessor    */
     0,                                       /* compare vs. another accessor   */
     &unpack_double_element,                  /* unpack only ith value          */
+    0,                                       /* unpack a given set of elements */
     0,                                       /* unpack a subarray         */
     0,                                       /* clear          */
     &make_clone,                             /* clone accessor          */
@@ -122,6 +122,7 @@ static grib_accessor_class _grib_accessor_class_codetable = {
     &unpack_long,                    /* grib_unpack procedures long    */
     0,                               /* grib_pack procedures double    */
     0,                               /* grib_unpack procedures double  */
+    0,                               /* grib_unpack procedures float   */
     &pack_string,                    /* grib_pack procedures string    */
     &unpack_string,                  /* grib_unpack procedures string  */
     0,                               /* grib_pack array procedures string    */
@@ -137,6 +138,7 @@ static grib_accessor_class _grib_accessor_class_codetable = {
     0,                               /* next accessor    */
     0,                               /* compare vs. another accessor   */
     0,                               /* unpack only ith value          */
+    0,                               /* unpack a given set of elements */
     0,                               /* unpack a subarray         */
     0,                               /* clear          */
     0,                               /* clone accessor          */
@@ -289,13 +291,33 @@ static void dump_codetable(grib_codetable* atable)
     }
 }
 #endif
+static grib_codetable* find_table(grib_context* c, const char* filename, const char* localFilename)
+{
+    grib_codetable* next = GRIB_PUBLISHED(c->codetable);
+    while (next) {
+        if ((filename && next->filename[0] && grib_inline_strcmp(filename, next->filename[0]) == 0) &&
+            ((localFilename == 0 && next->filename[1] == NULL) ||
+             ((localFilename != 0 && next->filename[1] != NULL) && grib_inline_strcmp(localFilename, next->filename[1]) == 0))) {
+            return next;
+        }
+        /* Special case: see GRIB-735 */
+        if (filename == NULL && localFilename != NULL) {
+            if (str_eq(localFilename, next->filename[0]) ||
+                str_eq(localFilename, next->filename[1])) {
+                return next;
+            }
+        }
+        next = next->next;
+    }
+    return NULL;
+}
+
 static grib_codetable* load_table(grib_accessor_codetable* self)
 {
     size_t size           = 0;
     grib_handle* h        = ((grib_accessor*)self)->parent->h;
     grib_context* c       = h->context;
     grib_codetable* t     = NULL;
-    grib_codetable* next  = NULL;
     grib_accessor* a      = (grib_accessor*)self;
     char* filename        = 0;
     char recomposed[1024] = {0,};
@@ -330,32 +352,19 @@ static grib_codetable* load_table(grib_accessor_codetable* self)
         localFilename = grib_context_full_defs_path(c, localRecomposed);
     }
 
+    /*printf("DBG %s: Look in cache: f=%s lf=%s (recomposed=%s)\n", self->att.name, filename, localFilename,recomposed);*/
+    if (filename == NULL && localFilename == NULL)
+        return NULL;
+
+    /* Tables are added to the cache once loaded, so it is searched without the mutex */
+    if (GRIB_LOCK_FREE_READS && (t = find_table(c, filename, localFilename)) != NULL)
+        return t;
+
     GRIB_MUTEX_INIT_ONCE(&once, &thread_init);
     GRIB_MUTEX_LOCK(&mutex1); /* GRIB-930 */
 
-    /*printf("DBG %s: Look in cache: f=%s lf=%s (recomposed=%s)\n", self->att.name, filename, localFilename,recomposed);*/
-    if (filename == NULL && localFilename == NULL) {
-        t = NULL;
+    if ((t = find_table(c, filename, localFilename)) != NULL)
         goto the_end;
-    }
-    next = c->codetable;
-    while (next) {
-        if ((filename && next->filename[0] && grib_inline_strcmp(filename, next->filename[0]) == 0) &&
-            ((localFilename == 0 && next->filename[1] == NULL) ||
-             ((localFilename != 0 && next->filename[1] != NULL) && grib_inline_strcmp(localFilename, next->filename[1]) == 0))) {
-            t = next;
-            goto the_end;
-        }
-        /* Special case: see GRIB-735 */
-        if (filename == NULL && localFilename != NULL) {
-            if (str_eq(localFilename, next->filename[0]) ||
-                str_eq(localFilename, next->filename[1])) {
-                t = next;
-                goto the_end;
-            }
-        }
-        next = next->next;
-    }
 
     if (a->flags & GRIB_ACCESSOR_FLAG_TRANSIENT) {
         Assert(a->vvalue != NULL);
@@ -384,6 +393,9 @@ static grib_codetable* load_table(grib_accessor_codetable* self)
         goto the_end;
     }
 
+    t->next = c->codetable;
+    GRIB_PUBLISH(c->codetable, t);
+
 the_end:
     GRIB_MUTEX_UNLOCK(&mutex1);
 
@@ -407,9 +419,7 @@ static int grib_load_codetable(grib_context* c, const char* filename,
     if (t->filename[0] == NULL) {
         t->filename[0]        = grib_context_strdup_persistent(c, filename);
         t->recomposed_name[0] = grib_context_strdup_persistent(c, recomposed_name);
-        t->next               = c->codetable;
         t->size               = size;
-        c->codetable          = t;
     }
     else {
         t->filename[1]        = grib_context_strdup_persistent(c, filename);
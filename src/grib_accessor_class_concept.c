@@ -87,6 +87,7 @@ static grib_accessor_class _grib_accessor_class_concept = {
     &unpack_long,                  /* grib_unpack procedures long    */
     &pack_double,                  /* grib_pack procedures double    */
     &unpack_double,                /* grib_unpack procedures double  */
+    0,                             /* grib_unpack procedures float   */
     &pack_string,                  /* grib_pack procedures string    */
     &unpack_string,                /* grib_unpack procedures string  */
     0,                             /* grib_pack array procedures string    */
@@ -102,6 +103,7 @@ static grib_accessor_class _grib_accessor_class_concept = {
     0,                             /* next accessor    */
     &compare,                      /* compare vs. another accessor   */
     0,                             /* unpack only ith value          */
+    0,                             /* unpack a given set of elements */
     0,                             /* unpack a subarray         */
     0,                             /* clear          */
     0,                             /* clone accessor          */
@@ -248,8 +250,12 @@ static const char* concept_evaluate(grib_accessor* a)
     int match        = 0;
     const char* best = 0;
     /* const char* prev = 0; */
-    grib_concept_value* c = action_concept_get_concept(a);
-    grib_handle* h        = grib_handle_of_accessor(a);
+    grib_concept_value* c     = action_concept_get_concept(a);
+    grib_handle* h            = grib_handle_of_accessor(a);
+    grib_concept_index* index = grib_concept_index_get(a->context, c);
+
+    if (index)
+        return grib_concept_index_evaluate(h, index);
 
     while (c) {
         grib_concept_condition* e = c->conditions;
@@ -18,6 +18,8 @@
    SUPER      = grib_accessor_class_gen
    IMPLEMENTS = init
    IMPLEMENTS = unpack_double;unpack_double_element
+   IMPLEMENTS = unpack_double_element_set
+   IMPLEMENTS = unpack_float
    IMPLEMENTS = pack_double
    IMPLEMENTS = value_count
    IMPLEMENTS = dump;get_native_type
@@ -43,11 +45,13 @@ or edit "accessor.class" and rerun ./make_class.pl
 static int get_native_type(grib_accessor*);
 static int pack_double(grib_accessor*, const double* val, size_t* len);
 static int unpack_double(grib_accessor*, double* val, size_t* len);
+static int unpack_float(grib_accessor*, float* val, size_t* len);
 static int value_count(grib_accessor*, long*);
 static void dump(grib_accessor*, grib_dumper*);
 static void init(grib_accessor*, const long, grib_arguments*);
 static void init_class(grib_accessor_class*);
 static int unpack_double_element(grib_accessor*, size_t i, double* val);
+static int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array);
 
 typedef struct grib_accessor_data_apply_bitmap
 {
@@ -87,6 +91,7 @@ static grib_accessor_class _grib_accessor_class_data_apply_bitmap = {
     0,                                       /* grib_unpack procedures long    */
     &pack_double,                            /* grib_pack procedures double    */
     &unpack_double,                          /* grib_unpack procedures double  */
+    &unpack_float,                           /* grib_unpack procedures float   */
     0,                                       /* grib_pack procedures string    */
     0,                                       /* grib_unpack procedures string  */
     0,                                       /* grib_pack array procedures string    */
@@ -102,6 +107,7 @@ static grib_accessor_class _grib_accessor_class_data_apply_bitmap = {
     0,                                       /* next accessor    */
     0,                                       /* compare vs. another accessor   */
     &unpack_double_element,                  /* unpack only ith value          */
+    &unpack_double_element_set,              /* unpack a given set of elements */
     0,                                       /* unpack a subarray         */
     0,                                       /* clear          */
     0,                                       /* clone accessor          */
@@ -258,6 +264,83 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     return err;
 }
 
+static int unpack_float(grib_accessor* a, float* val, size_t* len)
+{
+    grib_accessor_data_apply_bitmap* self = (grib_accessor_data_apply_bitmap*)a;
+    grib_handle* gh                       = grib_handle_of_accessor(a);
+
+    size_t i             = 0;
+    size_t j             = 0;
+    size_t n_vals        = 0;
+    long nn              = 0;
+    int err              = 0;
+    size_t coded_n_vals  = 0;
+    float* coded_vals    = NULL;
+    double missing_value = 0;
+
+    err    = grib_value_count(a, &nn);
+    n_vals = nn;
+    if (err)
+        return err;
+
+    if (!grib_find_accessor(gh, self->bitmap))
+        return grib_get_float_array(gh, self->coded_values, val, len);
+
+    if ((err = grib_get_size(gh, self->coded_values, &coded_n_vals)) != GRIB_SUCCESS)
+        return err;
+
+    if ((err = grib_get_double_internal(gh, self->missing_value, &missing_value)) != GRIB_SUCCESS)
+        return err;
+
+    if (*len < n_vals) {
+        *len = n_vals;
+        return GRIB_ARRAY_TOO_SMALL;
+    }
+
+    if (coded_n_vals == 0) {
+        for (i = 0; i < n_vals; i++)
+            val[i] = (float)missing_value;
+
+        *len = n_vals;
+        return GRIB_SUCCESS;
+    }
+
+    if ((err = grib_get_float_array(gh, self->bitmap, val, &n_vals)) != GRIB_SUCCESS)
+        return err;
+
+    coded_vals = (float*)grib_context_malloc(a->context, coded_n_vals * sizeof(float));
+    if (coded_vals == NULL)
+        return GRIB_OUT_OF_MEMORY;
+
+    if ((err = grib_get_float_array(gh, self->coded_values, coded_vals, &coded_n_vals)) != GRIB_SUCCESS) {
+        grib_context_free(a->context, coded_vals);
+        return err;
+    }
+
+    for (i = 0; i < n_vals; i++) {
+        if (val[i] == 0) {
+            val[i] = (float)missing_value;
+        }
+        else {
+            if (j >= coded_n_vals) {
+                grib_context_free(a->context, coded_vals);
+                grib_context_log(a->context, GRIB_LOG_ERROR,
+                                 "grib_accessor_class_data_apply_bitmap [%s]:"
+                                 " unpack_float :  number of coded values does not match bitmap %ld %ld",
+                                 a->name, coded_n_vals, n_vals);
+
+                return GRIB_ARRAY_TOO_SMALL;
+            }
+            val[i] = coded_vals[j++];
+        }
+    }
+
+    *len = n_vals;
+
+    grib_context_free(a->context, coded_vals);
+    return err;
+}
+
 static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
 {
     grib_accessor_data_apply_bitmap* self = (grib_accessor_data_apply_bitmap*)a;
@@ -304,6 +387,80 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     return grib_get_double_element_internal(grib_handle_of_accessor(a), self->coded_values, cidx, val);
 }
 
+/* The bitmap is read once for all the values, and the coded values are got as a set */
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    grib_accessor_data_apply_bitmap* self = (grib_accessor_data_apply_bitmap*)a;
+    grib_handle* h                        = grib_handle_of_accessor(a);
+    int err                               = 0;
+    size_t i = 0, j = 0, n_coded = 0;
+    double missing_value = 0;
+    double count         = 0;
+    double* bvals        = NULL;
+    size_t* cidx_array   = NULL;
+    double* cval_array   = NULL;
+    size_t n_vals        = 0;
+    long nn              = 0;
+
+    if (!grib_find_accessor(h, self->bitmap))
+        return grib_get_double_element_set(h, self->coded_values, index_array, len, val_array);
+
+    if ((err = grib_value_count(a, &nn)) != GRIB_SUCCESS)
+        return err;
+    n_vals = nn;
+
+    if ((err = grib_get_double_internal(h, self->missing_value, &missing_value)) != GRIB_SUCCESS)
+        return err;
+
+    bvals      = (double*)grib_context_malloc(a->context, n_vals * sizeof(double));
+    cidx_array = (size_t*)grib_context_malloc(a->context, (len ? len : 1) * sizeof(size_t));
+    cval_array = (double*)grib_context_malloc(a->context, (len ? len : 1) * sizeof(double));
+    if (!bvals || !cidx_array || !cval_array) {
+        err = GRIB_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
+    if ((err = grib_get_double_array_internal(h, self->bitmap, bvals, &n_vals)) != GRIB_SUCCESS)
+        goto cleanup;
+
+    /* Each value present gets the index of its coded value, the others -1 */
+    for (j = 0; j < n_vals; j++) {
+        if (bvals[j] != 0) {
+            bvals[j] = count;
+            count += 1;
+        }
+        else {
+            bvals[j] = -1;
+        }
+    }
+
+    for (i = 0; i < len; i++) {
+        if (index_array[i] >= n_vals) {
+            err = GRIB_INVALID_ARGUMENT;
+            goto cleanup;
+        }
+        if (bvals[index_array[i]] >= 0)
+            cidx_array[n_coded++] = (size_t)bvals[index_array[i]];
+    }
+
+    if (n_coded > 0 &&
+        (err = grib_get_double_element_set(h, self->coded_values, cidx_array, n_coded, cval_array)) != GRIB_SUCCESS)
+        goto cleanup;
+
+    for (i = 0, j = 0; i < len; i++) {
+        if (bvals[index_array[i]] >= 0)
+            val_array[i] = cval_array[j++];
+        else
+            val_array[i] = missing_value;
+    }
+
+cleanup:
+    grib_context_free(a->context, bvals);
+    grib_context_free(a->context, cidx_array);
+    grib_context_free(a->context, cval_array);
+    return err;
+}
+
 static int pack_double(grib_accessor* a, const double* val, size_t* len)
 {
     grib_accessor_data_apply_bitmap* self = (grib_accessor_data_apply_bitmap*)a;
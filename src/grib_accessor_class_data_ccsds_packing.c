@@ -18,9 +18,12 @@
    SUPER      = grib_accessor_class_values
    IMPLEMENTS = init
    IMPLEMENTS = unpack_double
+   IMPLEMENTS = unpack_float
    IMPLEMENTS = pack_double
    IMPLEMENTS = unpack_double_element
+   IMPLEMENTS = unpack_double_element_set
    IMPLEMENTS = value_count
+   IMPLEMENTS = destroy
    MEMBERS=const char*   number_of_values
    MEMBERS=const char*   reference_value
    MEMBERS=const char*   binary_scale_factor
@@ -33,6 +36,8 @@
    MEMBERS=const char*   ccsds_block_size
    MEMBERS=const char*   ccsds_rsi
 
+   MEMBERS=grib_ccsds_rsi_index* rsi_index
+
    END_CLASS_DEF
 
  */
@@ -49,10 +54,13 @@ or edit "accessor.class" and rerun ./make_class.pl
 
 static int pack_double(grib_accessor*, const double* val, size_t* len);
 static int unpack_double(grib_accessor*, double* val, size_t* len);
+static int unpack_float(grib_accessor*, float* val, size_t* len);
 static int value_count(grib_accessor*, long*);
+static void destroy(grib_context*, grib_accessor*);
 static void init(grib_accessor*, const long, grib_arguments*);
 static void init_class(grib_accessor_class*);
 static int unpack_double_element(grib_accessor*, size_t i, double* val);
+static int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array);
 
 typedef struct grib_accessor_data_ccsds_packing
 {
@@ -74,6 +82,7 @@ typedef struct grib_accessor_data_ccsds_packing
     const char* ccsds_flags;
     const char* ccsds_block_size;
     const char* ccsds_rsi;
+    grib_ccsds_rsi_index* rsi_index;
 } grib_accessor_data_ccsds_packing;
 
 extern grib_accessor_class* grib_accessor_class_values;
@@ -86,7 +95,7 @@ static grib_accessor_class _grib_accessor_class_data_ccsds_packing = {
     &init_class,                              /* init_class */
     &init,                                    /* init                      */
     0,                                        /* post_init                      */
-    0,                                        /* free mem                       */
+    &destroy,                                 /* free mem                       */
     0,                                        /* describes himself         */
     0,                                        /* get length of section     */
     0,                                        /* get length of string      */
@@ -101,6 +110,7 @@ static grib_accessor_class _grib_accessor_class_data_ccsds_packing = {
     0,                                        /* grib_unpack procedures long    */
     &pack_double,                             /* grib_pack procedures double    */
     &unpack_double,                           /* grib_unpack procedures double  */
+    &unpack_float,                            /* grib_unpack procedures float   */
     0,                                        /* grib_pack procedures string    */
     0,                                        /* grib_unpack procedures string  */
     0,                                        /* grib_pack array procedures string    */
@@ -116,6 +126,7 @@ static grib_accessor_class _grib_accessor_class_data_ccsds_packing = {
     0,                                        /* next accessor    */
     0,                                        /* compare vs. another accessor   */
     &unpack_double_element,                   /* unpack only ith value          */
+    &unpack_double_element_set,               /* unpack a given set of elements */
     0,                                        /* unpack a subarray         */
     0,                                        /* clear          */
     0,                                        /* clone accessor          */
@@ -174,10 +185,26 @@ static void init(grib_accessor* a, const long v, grib_arguments* args)
     self->ccsds_flags      = grib_arguments_get_name(grib_handle_of_accessor(a), args, self->carg++);
     self->ccsds_block_size = grib_arguments_get_name(grib_handle_of_accessor(a), args, self->carg++);
     self->ccsds_rsi        = grib_arguments_get_name(grib_handle_of_accessor(a), args, self->carg++);
+    self->rsi_index        = NULL;
 
     a->flags |= GRIB_ACCESSOR_FLAG_DATA;
 }
 
+static void destroy(grib_context* context, grib_accessor* a)
+{
+    grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
+    grib_ccsds_rsi_index_delete(context, self->rsi_index);
+    self->rsi_index = NULL;
+}
+
+/* The index of the clone is made again when needed */
+int accessor_data_ccsds_packing_clone_state(grib_accessor* a, grib_accessor* clone)
+{
+    grib_accessor_data_ccsds_packing* copy = (grib_accessor_data_ccsds_packing*)clone;
+    copy->rsi_index                        = NULL;
+    return GRIB_SUCCESS;
+}
+
 static int value_count(grib_accessor* a, long* count)
 {
     grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
@@ -189,7 +216,248 @@ static int value_count(grib_accessor* a, long* count)
 
 #include <libaec.h>
 
-static int unpack_double(grib_accessor* a, double* val, size_t* len)
+/* Bytes of the decoded samples scaled at a time, to stay in cache */
+#define CCSDS_CHUNK_BYTES 32768
+
+/* Bytes per decoded sample, see libaec.h */
+static size_t sample_bytes(long bits_per_value, long ccsds_flags)
+{
+    if (bits_per_value > 16)
+        return (bits_per_value <= 24 && (ccsds_flags & AEC_DATA_3BYTE)) ? 3 : 4;
+    return bits_per_value > 8 ? 2 : 1;
+}
+
+/*
+ * Large fields are decoded and encoded a range of RSIs per thread: RSIs are
+ * coded apart from each other, so the stream of a range is the part of the
+ * stream of the field holding its samples
+ */
+
+typedef struct ccsds_decode_task
+{
+    grib_context* context;
+    const grib_ccsds_rsi_index* index;
+    size_t n_vals;
+    double reference_value;
+    double bscale;
+    double dscale;
+    double* dval;
+    float* fval;
+    int* errs;
+} ccsds_decode_task;
+
+static void decode_task(void* data, int k, int ntasks)
+{
+    const ccsds_decode_task* t = (const ccsds_decode_task*)data;
+    const grib_ccsds_params* p = &t->index->params;
+    size_t per_rsi             = p->rsi * p->block_size;
+    size_t begin = 0, end = 0, r = 0, i = 0, n = 0;
+    uint32_t* samples = NULL;
+
+    grib_thread_pool_range(t->n_vals, per_rsi, k, ntasks, &begin, &end);
+    if (begin == end)
+        return;
+    samples = (uint32_t*)grib_context_malloc(t->context, per_rsi * sizeof(uint32_t));
+    if (!samples) {
+        t->errs[k] = GRIB_OUT_OF_MEMORY;
+        return;
+    }
+    for (r = begin / per_rsi; r * per_rsi < end; r++) {
+        const size_t first = r * per_rsi;
+        if ((t->errs[k] = grib_ccsds_decode_rsi(t->index, r, samples, &n)) != GRIB_SUCCESS)
+            break;
+        if (t->fval) {
+            for (i = 0; i < n; i++)
+                t->fval[first + i] = (float)(((samples[i] * t->bscale) + t->reference_value) * t->dscale);
+        }
+        else {
+            for (i = 0; i < n; i++)
+                t->dval[first + i] = ((samples[i] * t->bscale) + t->reference_value) * t->dscale;
+        }
+    }
+    grib_context_free(t->context, samples);
+}
+
+/* Decode with ntasks tasks. An error means the field is to be decoded by libaec */
+static int unpack_values_threaded(grib_accessor* a, const grib_ccsds_params* params, const unsigned char* buf, size_t buflen,
+                                  size_t n_vals, int ntasks, double reference_value, double bscale, double dscale,
+                                  double* dval, float* fval)
+{
+    grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
+    ccsds_decode_task t;
+    int err = 0, k = 0;
+
+    /* Where the RSIs start is found once and kept until the field is packed again */
+    if ((err = grib_ccsds_index_rsis(a->context, &self->rsi_index, params, buf, buflen, n_vals)) != GRIB_SUCCESS)
+        return err;
+
+    t.context         = a->context;
+    t.index           = self->rsi_index;
+    t.n_vals          = n_vals;
+    t.reference_value = reference_value;
+    t.bscale          = bscale;
+    t.dscale          = dscale;
+    t.dval            = dval;
+    t.fval            = fval;
+    t.errs            = (int*)grib_context_malloc_clear(a->context, ntasks * sizeof(int));
+    if (!t.errs)
+        return GRIB_OUT_OF_MEMORY;
+
+    grib_thread_pool_run(a->context, ntasks, &decode_task, &t);
+
+    for (k = 0; k < ntasks && !err; k++)
+        err = t.errs[k];
+    grib_context_free(a->context, t.errs);
+    return err;
+}
+
+typedef struct ccsds_encode_task
+{
+    grib_context* context;
+    const struct aec_stream* settings;
+    const grib_ccsds_params* params;
+    const unsigned char* samples; /* whole bytes per sample */
+    size_t sample_bytes;
+    size_t n_vals;
+    unsigned char** streams;
+    size_t* skip; /* bits of the stream before the range */
+    size_t* bits; /* of the range */
+    int* errs;
+} ccsds_encode_task;
+
+static void encode_task(void* data, int k, int ntasks)
+{
+    const ccsds_encode_task* t = (const ccsds_encode_task*)data;
+    size_t per_rsi             = t->params->rsi * t->params->block_size;
+    size_t begin = 0, end = 0, start = 0, len = 0, bits = 0;
+    struct aec_stream strm;
+
+    grib_thread_pool_range(t->n_vals, per_rsi, k, ntasks, &begin, &end);
+    if (begin == end)
+        return;
+
+    /* The RSIs before the range needed for libaec to code it as the whole field, see grib_ccsds.c */
+    start = grib_ccsds_encode_start(t->params, t->samples, t->sample_bytes, begin);
+
+    /* As much room as the serial encoding gives the whole field */
+    len           = (end - start) * t->sample_bytes + 10240;
+    t->streams[k] = (unsigned char*)grib_context_malloc(t->context, len);
+    if (!t->streams[k]) {
+        t->errs[k] = GRIB_OUT_OF_MEMORY;
+        return;
+    }
+
+    strm           = *t->settings;
+    strm.next_in   = t->samples + start * t->sample_bytes;
+    strm.avail_in  = (end - start) * t->sample_bytes;
+    strm.next_out  = t->streams[k];
+    strm.avail_out = len;
+    if (aec_buffer_encode(&strm) != AEC_OK) {
+        t->errs[k] = GRIB_ENCODING_ERROR;
+        return;
+    }
+    if ((t->errs[k] = grib_ccsds_stream_bits(t->params, t->streams[k], strm.total_out, begin - start, &t->skip[k])) != GRIB_SUCCESS)
+        return;
+    if ((t->errs[k] = grib_ccsds_stream_bits(t->params, t->streams[k], strm.total_out, end - start, &bits)) != GRIB_SUCCESS)
+        return;
+    t->bits[k] = bits - t->skip[k];
+}
+
+/* Copy nbits from bit src_pos of src to bit pos of dst, which is cleared from there on */
+static void append_bits(unsigned char* dst, size_t pos, const unsigned char* src, size_t src_pos, size_t nbits)
+{
+    while (nbits > 0) {
+        const size_t n      = nbits < 8 ? nbits : 8;
+        const size_t s      = src_pos / 8;
+        const int src_shift = (int)(src_pos % 8);
+        const int shift     = (int)(pos % 8);
+        unsigned int b      = (unsigned int)src[s] << src_shift;
+
+        if (src_shift + n > 8)
+            b |= src[s + 1] >> (8 - src_shift);
+        b &= (0xff00u >> n) & 0xff;
+
+        dst[pos / 8] |= (unsigned char)(b >> shift);
+        if (shift + n > 8)
+            dst[pos / 8 + 1] |= (unsigned char)(b << (8 - shift));
+
+        pos += n;
+        src_pos += n;
+        nbits -= n;
+    }
+}
+
+/*
+ * Encode with ntasks tasks into a new buffer, the same stream libaec gives
+ * for the whole field. An error means the field is to be encoded by libaec
+ */
+static int pack_values_threaded(grib_context* c, const struct aec_stream* settings, const unsigned char* samples,
+                                size_t sample_bytes, size_t n_vals, int ntasks, unsigned char** buf, size_t* buflen)
+{
+    ccsds_encode_task t;
+    grib_ccsds_params params;
+    size_t total = 0;
+    int err = 0, k = 0;
+
+    /* Streams of little-endian samples are only coded as a whole (see grib_ccsds.c) */
+    if (!(settings->flags & AEC_DATA_MSB))
+        return GRIB_NOT_IMPLEMENTED;
+
+    params.flags           = settings->flags;
+    params.bits_per_sample = settings->bits_per_sample;
+    params.block_size      = settings->block_size;
+    params.rsi             = settings->rsi;
+
+    t.context      = c;
+    t.settings     = settings;
+    t.params       = &params;
+    t.samples      = samples;
+    t.sample_bytes = sample_bytes;
+    t.n_vals       = n_vals;
+    t.streams      = (unsigned char**)grib_context_malloc_clear(c, ntasks * sizeof(unsigned char*));
+    t.skip         = (size_t*)grib_context_malloc_clear(c, ntasks * sizeof(size_t));
+    t.bits         = (size_t*)grib_context_malloc_clear(c, ntasks * sizeof(size_t));
+    t.errs         = (int*)grib_context_malloc_clear(c, ntasks * sizeof(int));
+
+    if (!t.streams || !t.skip || !t.bits || !t.errs)
+        err = GRIB_OUT_OF_MEMORY;
+    if (!err)
+        grib_thread_pool_run(c, ntasks, &encode_task, &t);
+
+    for (k = 0; k < ntasks && !err; k++) {
+        err = t.errs[k];
+        total += t.bits[k];
+    }
+    if (!err) {
+        *buflen = (total + 7) / 8;
+        *buf    = (unsigned char*)grib_context_buffer_malloc_clear(c, *buflen);
+        if (!*buf)
+            err = GRIB_OUT_OF_MEMORY;
+    }
+    if (!err) {
+        total = 0;
+        for (k = 0; k < ntasks; k++) {
+            append_bits(*buf, total, t.streams[k], t.skip[k], t.bits[k]);
+            total += t.bits[k];
+        }
+    }
+
+    for (k = 0; t.streams && k < ntasks; k++)
+        grib_context_free(c, t.streams[k]);
+    grib_context_free(c, t.streams);
+    grib_context_free(c, t.skip);
+    grib_context_free(c, t.bits);
+    grib_context_free(c, t.errs);
+    return err;
+}
+
+/*
+ * Decode into either dval or fval (exactly one of them is set). The samples
+ * are decoded a chunk at a time and scaled before the next chunk is decoded
+ * over them, so no buffer is as large as the field. Large fields are decoded
+ * by the threads of the context
+ */
+static int unpack_values(grib_accessor* a, double* dval, float* fval, size_t* len)
 {
     grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
 
@@ -201,9 +469,13 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     double dscale      = 0;
     unsigned char* buf = NULL;
     size_t n_vals      = 0;
-    size_t size;
+    size_t nbytes      = 0;
+    size_t chunk       = 0; /* samples per chunk */
+    size_t done        = 0;
+    int aec_err        = 0;
+    int ntasks         = 0;
+    grib_ccsds_params params;
     unsigned char* decoded = NULL;
-    unsigned char* p       = NULL;
     long pos               = 0;
     long nn                = 0;
 
@@ -211,7 +483,6 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     long decimal_scale_factor = 0;
     double reference_value    = 0;
     long bits_per_value       = 0;
-    long bits8;
 
     long ccsds_flags;
     long ccsds_block_size;
@@ -250,8 +521,12 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
 
     /* Special case */
     if (bits_per_value == 0) {
-        for (i = 0; i < n_vals; i++)
-            val[i] = reference_value;
+        for (i = 0; i < n_vals; i++) {
+            if (fval)
+                fval[i] = (float)reference_value;
+            else
+                dval[i] = reference_value;
+        }
         *len = n_vals;
         return GRIB_SUCCESS;
     }
@@ -259,6 +534,19 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     buf = (unsigned char*)grib_handle_of_accessor(a)->buffer->data;
     buf += grib_byte_offset(a);
 
+    ntasks = grib_thread_pool_ntasks(a->context, n_vals);
+    if (ntasks > 1) {
+        params.flags           = ccsds_flags;
+        params.bits_per_sample = bits_per_value;
+        params.block_size      = ccsds_block_size;
+        params.rsi             = ccsds_rsi;
+        if (unpack_values_threaded(a, &params, buf, buflen, n_vals, ntasks, reference_value, bscale, dscale,
+                                   dval, fval) == GRIB_SUCCESS) {
+            *len = n_vals;
+            return GRIB_SUCCESS;
+        }
+    }
+
     strm.flags           = ccsds_flags;
     strm.bits_per_sample = bits_per_value;
     strm.block_size      = ccsds_block_size;
@@ -267,49 +555,60 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     strm.next_in  = buf;
     strm.avail_in = buflen;
 
-    /*
-    printf("aec_options.options_mask %d\n", aec_options.options_mask);
-    printf("aec_options.bits_per_pixel %d\n", aec_options.bits_per_pixel);
-    printf("aec_options.pixels_per_block %d\n", aec_options.pixels_per_block);
-    printf("aec_options.pixels_per_scanline %d\n", aec_options.pixels_per_scanline);
-    */
-
-    bits8   = ((bits_per_value + 7) / 8) * 8;
-    size    = n_vals * ((bits_per_value + 7) / 8);
-    decoded = grib_context_buffer_malloc_clear(a->context, size);
-    if (!decoded) {
-        err = GRIB_OUT_OF_MEMORY;
-        goto cleanup;
-    }
-    strm.next_out  = decoded;
-    strm.avail_out = size;
-
-    if ((err = aec_buffer_decode(&strm)) != AEC_OK) {
-        fprintf(stderr, "aec_buffer_decode Error %d\n", err);
-        err = GRIB_ENCODING_ERROR;
-        goto cleanup;
+    nbytes = sample_bytes(bits_per_value, ccsds_flags);
+    chunk  = CCSDS_CHUNK_BYTES / nbytes;
+    if (chunk > n_vals)
+        chunk = n_vals;
+    decoded = (unsigned char*)grib_context_malloc(a->context, chunk * nbytes);
+    if (!decoded)
+        return GRIB_OUT_OF_MEMORY;
+
+    if ((aec_err = aec_decode_init(&strm)) != AEC_OK) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "data_ccsds_packing: aec_decode_init error %d", aec_err);
+        grib_context_free(a->context, decoded);
+        return GRIB_ENCODING_ERROR;
     }
 
-    /* printf("bscale=%g dscale=%g reference_value=%g\n",bscale,dscale,reference_value); */
-    pos = 0;
-    p   = decoded;
-    for (i = 0; i < n_vals; i++) {
-        val[i] = (double)(((grib_decode_unsigned_long(p, &pos, bits8) * bscale) + reference_value) * dscale);
+    /* The samples are whole big-endian bytes: ((x * bscale) + reference_value) * dscale */
+    for (done = 0; done < n_vals; done += chunk) {
+        if (chunk > n_vals - done)
+            chunk = n_vals - done;
+        strm.next_out  = decoded;
+        strm.avail_out = chunk * nbytes;
+        if ((aec_err = aec_decode(&strm, AEC_FLUSH)) != AEC_OK) {
+            grib_context_log(a->context, GRIB_LOG_ERROR, "data_ccsds_packing: aec_decode error %d", aec_err);
+            err = GRIB_ENCODING_ERROR;
+            break;
+        }
+        /* Samples missing from the end of the stream are 0, as they always were */
+        memset(strm.next_out, 0, strm.avail_out);
+        pos = 0;
+        grib_decode_array_threaded(a->context, decoded, &pos, nbytes * 8, reference_value, bscale, dscale, chunk,
+                                   dval ? dval + done : NULL, fval ? fval + done : NULL);
     }
-    /*-------------------------------------------*/
-    *len = n_vals;
 
-cleanup:
-    grib_context_buffer_free(a->context, decoded);
+    aec_decode_end(&strm);
+    grib_context_free(a->context, decoded);
+    if (err == GRIB_SUCCESS)
+        *len = n_vals;
     return err;
 }
 
+static int unpack_double(grib_accessor* a, double* val, size_t* len)
+{
+    return unpack_values(a, val, NULL, len);
+}
+
+static int unpack_float(grib_accessor* a, float* val, size_t* len)
+{
+    return unpack_values(a, NULL, val, len);
+}
+
 static int pack_double(grib_accessor* a, const double* val, size_t* len)
 {
     grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
 
     int err = GRIB_SUCCESS;
-    int i;
     size_t buflen = 0;
 
     unsigned char* buf     = NULL;
@@ -326,7 +625,7 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
 
     double d;
 
-    unsigned char* p;
+    long off = 0;
     double divisor;
 
     long number_of_data_points;
@@ -334,10 +633,13 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     long ccsds_flags;
     long ccsds_block_size;
     long ccsds_rsi;
+    int ntasks = 0;
 
     struct aec_stream strm;
 
     self->dirty = 1;
+    grib_ccsds_rsi_index_delete(a->context, self->rsi_index);
+    self->rsi_index = NULL;
 
     if ((err = grib_value_count(a, &nn)) != GRIB_SUCCESS)
         return err;
@@ -394,14 +696,7 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
 
     d = grib_power(decimal_scale_factor, 10);
 
-    max = val[0];
-    min = max;
-    for (i = 1; i < n_vals; i++) {
-        if (val[i] > max)
-            max = val[i];
-        else if (val[i] < min)
-            min = val[i];
-    }
+    grib_minmax_double_array(val, n_vals, &min, &max);
     min *= d;
     max *= d;
 
@@ -419,7 +714,7 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     binary_scale_factor = grib_get_binary_scale_fact(max, reference_value, bits_per_value, &err);
     divisor             = grib_power(-binary_scale_factor, 2);
 
-    bits8   = (bits_per_value + 7) / 8 * 8;
+    bits8   = sample_bytes(bits_per_value, ccsds_flags) * 8;
     encoded = grib_context_buffer_malloc_clear(a->context, bits8 / 8 * n_vals);
 
     if (!encoded) {
@@ -427,33 +722,14 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
         goto cleanup;
     }
 
-    buflen = 0;
-    p      = encoded;
-    for (i = 0; i < n_vals; i++) {
-        long blen                  = bits8;
-        unsigned long unsigned_val = (unsigned long)((((val[i] * d) - (reference_value)) * divisor) + 0.5);
-        while (blen >= 8) {
-            blen -= 8;
-            *p = (unsigned_val >> blen);
-            p++;
-            buflen++;
-        }
-    }
-    /*       buflen = n_vals*(bits_per_value/8);*/
+    /* Each sample takes whole bytes, most significant first */
+    grib_encode_double_array_threaded(a->context, n_vals, val, bits8, reference_value, d, divisor, encoded, &off);
 
     grib_context_log(a->context, GRIB_LOG_DEBUG,
                      "grib_accessor_data_ccsds_packing : pack_double : packing %s, %d values", a->name, n_vals);
 
-    buflen += 10240;
-    buf = grib_context_buffer_malloc_clear(a->context, buflen);
-
-    if (!buf) {
-        err = GRIB_OUT_OF_MEMORY;
-        goto cleanup;
-    }
-
     if ((err = grib_set_double_internal(grib_handle_of_accessor(a), self->reference_value, reference_value)) != GRIB_SUCCESS)
-        return err;
+        goto cleanup;
     {
         /* Make sure we can decode it again */
         double ref = 1e-100;
@@ -462,16 +738,31 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     }
 
     if ((err = grib_set_long_internal(grib_handle_of_accessor(a), self->binary_scale_factor, binary_scale_factor)) != GRIB_SUCCESS)
-        return err;
+        goto cleanup;
 
     if ((err = grib_set_long_internal(grib_handle_of_accessor(a), self->decimal_scale_factor, decimal_scale_factor)) != GRIB_SUCCESS)
-        return err;
+        goto cleanup;
 
     strm.flags           = ccsds_flags;
     strm.bits_per_sample = bits_per_value;
     strm.block_size      = ccsds_block_size;
     strm.rsi             = ccsds_rsi;
 
+    /* Large fields are encoded by the threads of the context */
+    ntasks = grib_thread_pool_ntasks(a->context, n_vals);
+    if (ntasks > 1 &&
+        pack_values_threaded(a->context, &strm, encoded, bits8 / 8, n_vals, ntasks, &buf, &buflen) == GRIB_SUCCESS) {
+        grib_buffer_replace(a, buf, buflen, 1, 1);
+        goto cleanup;
+    }
+
+    buflen = bits8 / 8 * n_vals + 10240;
+    buf    = grib_context_buffer_malloc_clear(a->context, buflen);
+    if (!buf) {
+        err = GRIB_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
     strm.next_out  = buf;
     strm.avail_out = buflen;
     strm.next_in   = encoded;
@@ -515,9 +806,9 @@ cleanup:
     return err;
 }
 
-static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
+/* For streams grib_ccsds.c cannot decode a part of */
+static int unpack_double_element_decoding_all(grib_accessor* a, size_t idx, double* val)
 {
-    /* The index idx relates to codedValues NOT values! */
     size_t size    = 0;
     double* values = NULL;
     int err        = grib_get_size(grib_handle_of_accessor(a), "codedValues", &size);
@@ -535,6 +826,80 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     return err;
 }
 
+/* Only the reference sample interval holding the value is decoded, see grib_ccsds.c.
+ * GRIB_NOT_IMPLEMENTED for streams it cannot decode a part of */
+static int decode_element(grib_accessor* a, size_t idx, double* val)
+{
+    /* The index idx relates to codedValues NOT values! */
+    grib_accessor_data_ccsds_packing* self = (grib_accessor_data_ccsds_packing*)a;
+    grib_handle* h                         = grib_handle_of_accessor(a);
+    grib_ccsds_params params;
+    double bscale             = 0;
+    double dscale             = 0;
+    long binary_scale_factor  = 0;
+    long decimal_scale_factor = 0;
+    double reference_value    = 0;
+    long nn                   = 0;
+    uint32_t sample           = 0;
+    int err                   = 0;
+
+    if ((err = grib_value_count(a, &nn)) != GRIB_SUCCESS)
+        return err;
+    if (idx >= (size_t)nn)
+        return GRIB_INVALID_NEAREST;
+
+    if ((err = grib_get_long_internal(h, self->bits_per_value, &params.bits_per_sample)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_double_internal(h, self->reference_value, &reference_value)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long_internal(h, self->binary_scale_factor, &binary_scale_factor)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long_internal(h, self->decimal_scale_factor, &decimal_scale_factor)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long(h, self->ccsds_flags, &params.flags)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long_internal(h, self->ccsds_block_size, &params.block_size)) != GRIB_SUCCESS)
+        return err;
+    if ((err = grib_get_long_internal(h, self->ccsds_rsi, &params.rsi)) != GRIB_SUCCESS)
+        return err;
+
+    if (params.bits_per_sample == 0) {
+        *val = reference_value;
+        return GRIB_SUCCESS;
+    }
+
+    err = grib_ccsds_decode_sample(a->context, &self->rsi_index, &params,
+                                   h->buffer->data + grib_byte_offset(a), grib_byte_count(a), nn, idx, &sample);
+    if (err)
+        return err;
+
+    bscale = grib_power(binary_scale_factor, 2);
+    dscale = grib_power(-decimal_scale_factor, 10);
+    *val   = ((sample * bscale) + reference_value) * dscale;
+    return GRIB_SUCCESS;
+}
+
+static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
+{
+    int err = decode_element(a, idx, val);
+    if (err == GRIB_NOT_IMPLEMENTED)
+        return unpack_double_element_decoding_all(a, idx, val);
+    return err;
+}
+
+/* The last reference sample interval decoded is kept, so values close to
+ * each other cost one decoding. Streams decoded whole are left to the caller */
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    size_t i = 0;
+    int err  = 0;
+    for (i = 0; i < len; i++) {
+        if ((err = decode_element(a, index_array[i], &val_array[i])) != GRIB_SUCCESS)
+            return err;
+    }
+    return GRIB_SUCCESS;
+}
+
 #else
 
 static void print_error_msg(grib_context* c)
@@ -548,6 +913,11 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     print_error_msg(a->context);
     return GRIB_FUNCTIONALITY_NOT_ENABLED;
 }
+static int unpack_float(grib_accessor* a, float* val, size_t* len)
+{
+    print_error_msg(a->context);
+    return GRIB_FUNCTIONALITY_NOT_ENABLED;
+}
 static int pack_double(grib_accessor* a, const double* val, size_t* len)
 {
     print_error_msg(a->context);
@@ -558,5 +928,10 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     print_error_msg(a->context);
     return GRIB_FUNCTIONALITY_NOT_ENABLED;
 }
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    print_error_msg(a->context);
+    return GRIB_FUNCTIONALITY_NOT_ENABLED;
+}
 
 #endif
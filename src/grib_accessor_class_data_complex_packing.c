@@ -11,6 +11,7 @@
 #include "grib_api_internal.h"
 #include "grib_optimize_decimal_factor.h"
 #include <math.h>
+#include <float.h>
 /*
    This is used by make_class.pl
 
@@ -111,6 +112,7 @@ static grib_accessor_class _grib_accessor_class_data_complex_packing = {
     0,                                          /* grib_unpack procedures long    */
     &pack_double,                               /* grib_pack procedures double    */
     &unpack_double,                             /* grib_unpack procedures double  */
+    0,                                          /* grib_unpack procedures float   */
     0,                                          /* grib_pack procedures string    */
     0,                                          /* grib_unpack procedures string  */
     0,                                          /* grib_pack array procedures string    */
@@ -126,6 +128,7 @@ static grib_accessor_class _grib_accessor_class_data_complex_packing = {
     0,                                          /* next accessor    */
     0,                                          /* compare vs. another accessor   */
     0,                                          /* unpack only ith value          */
+    0,                                          /* unpack a given set of elements */
     0,                                          /* unpack a subarray         */
     0,                                          /* clear          */
     0,                                          /* clone accessor          */
@@ -223,32 +226,120 @@ static int value_count(grib_accessor* a, long* count)
     return ret;
 }
 
+/*
+ * The coefficients are stored by zonal wavenumber m, as (real, imaginary)
+ * pairs for n = m..J. The pairs of the sub-truncation (n <= JS) are IEEE or
+ * IBM floats, the others are packed. Each row m can be found from m alone,
+ * so that rows are decoded independently, and in parallel.
+ */
+typedef struct complex_decode_task
+{
+    const unsigned char* hres; /* floats of the sub-truncation */
+    const unsigned char* lres; /* packed values */
+    long lpos;                 /* bit offset of the packed values in lres */
+    long pen_j;
+    long sub_j;
+    int bytes;
+    decode_float_proc decode_float;
+    long GRIBEX_sh_bug_present;
+    long bits_per_value;
+    double reference_value;
+    double s;
+    double d;
+    const double* scals;
+    size_t n_vals;
+    double* val;
+} complex_decode_task;
+
+static unsigned long read_float_bits(const unsigned char* p, int bytes)
+{
+    unsigned long x = 0;
+    int i;
+    for (i = 0; i < bytes; i++)
+        x = (x << 8) | p[i];
+    return x;
+}
+
+/* Row m: nsub pairs from the floats at hpos (in values), then nlow packed pairs at bit lpos */
+static void decode_row(const complex_decode_task* t, long m, long nsub, long nlow, size_t hpos, long lpos, double* val)
+{
+    const double* scals    = t->scals + m; /* scals[j] is for pair j of the row, n = m + j */
+    const unsigned char* h = t->hres + hpos * t->bytes;
+    double* low            = val + 2 * nsub;
+    long j;
+
+    for (j = 0; j < 2 * nsub; j++)
+        val[j] = t->decode_float(read_float_bits(h + j * t->bytes, t->bytes));
+    if (t->GRIBEX_sh_bug_present && nsub > 0) {
+        /*  bug in ecmwf data, last row (K+1)is scaled but should not */
+        val[2 * nsub - 2] *= scals[nsub - 1];
+        val[2 * nsub - 1] *= scals[nsub - 1];
+    }
+
+    if (nlow == 0)
+        return;
+    if (t->bits_per_value == 0) {
+        const double x = ((0 * t->s) + t->reference_value) * t->d;
+        for (j = 0; j < 2 * nlow; j++)
+            low[j] = x;
+    }
+    else {
+        long pos = lpos % 8;
+        grib_decode_double_array(t->lres + lpos / 8, &pos, t->bits_per_value, t->reference_value, t->s, t->d,
+                                 2 * nlow, low);
+    }
+    scals += nsub;
+    for (j = 0; j < nlow; j++) {
+        low[2 * j] *= scals[j];
+        low[2 * j + 1] *= scals[j];
+    }
+    /* These values should always be zero, but as they are packed,
+       it is necessary to force them back to zero */
+    if (m == 0) {
+        for (j = 0; j < nlow; j++)
+            low[2 * j + 1] = 0;
+    }
+}
+
+/* The rows starting in the task's share of the values */
+static void decode_rows_task(void* data, int k, int ntasks)
+{
+    const complex_decode_task* t = (const complex_decode_task*)data;
+    size_t begin = 0, end = 0, i = 0, hpos = 0;
+    long lpos = t->lpos;
+    long m;
+
+    grib_thread_pool_range(t->n_vals, 2, k, ntasks, &begin, &end);
+    for (m = 0; m <= t->pen_j && i < end; m++) {
+        const long npairs = t->pen_j + 1 - m;
+        const long nsub   = m <= t->sub_j ? t->sub_j + 1 - m : 0;
+        const long nlow   = npairs - nsub;
+        if (i >= begin)
+            decode_row(t, m, nsub, nlow, hpos, lpos, t->val + i);
+        i += 2 * npairs;
+        hpos += 2 * nsub;
+        lpos += 2 * nlow * t->bits_per_value;
+    }
+}
+
 static int unpack_double(grib_accessor* a, double* val, size_t* len)
 {
     grib_accessor_data_complex_packing* self = (grib_accessor_data_complex_packing*)a;
     grib_handle* gh                          = grib_handle_of_accessor(a);
 
-    size_t i       = 0;
-    int ret        = GRIB_SUCCESS;
-    long hcount    = 0;
-    long lcount    = 0;
-    long hpos      = 0;
-    long lup       = 0;
-    long mmax      = 0;
-    long n_vals    = 0;
-    double* scals  = NULL;
-    double *pscals = NULL, *pval = NULL;
+    size_t i      = 0;
+    int ret       = GRIB_SUCCESS;
+    long n_vals   = 0;
+    double* scals = NULL;
 
     double s                 = 0;
     double d                 = 0;
     double laplacianOperator = 0;
     unsigned char* buf       = NULL;
-    unsigned char* hres      = NULL;
-    unsigned char* lres      = NULL;
     unsigned long packed_offset;
-    long lpos = 0;
+    long maxv  = 0;
+    int ntasks = 0;
 
-    long maxv                  = 0;
     long GRIBEX_sh_bug_present = 0;
     long ieee_floats           = 0;
 
@@ -270,6 +361,7 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     int err = 0;
 
     decode_float_proc decode_float = NULL;
+    complex_decode_task t;
 
     err = grib_value_count(a, &n_vals);
     if (err)
@@ -343,8 +435,6 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     maxv = pen_j + 1;
 
     buf += grib_byte_offset(a);
-    hres = buf;
-    lres = buf;
 
     if (pen_j == sub_j) {
         n_vals = (pen_j + 1) * (pen_j + 2);
@@ -359,11 +449,10 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
 
     packed_offset = grib_byte_offset(a) + bytes * (sub_k + 1) * (sub_k + 2);
 
-    lpos = 8 * (packed_offset - offsetdata);
-
     s = grib_power(binary_scale_factor, 2);
     d = grib_power(-decimal_scale_factor, 10);
 
+    /* One operator per total wavenumber n */
     scals = (double*)grib_context_malloc(a->context, maxv * sizeof(double));
     Assert(scals);
 
@@ -380,59 +469,30 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
         }
     }
 
-    /*
-    printf("UNPACKING LAPLACE=%.20f\n",laplacianOperator);
-    printf("packed offset=%ld\n",packed_offset);
-    for(i=0;i<maxv;i++)
-        printf("scals[%d]=%g\n",i,scals[i]);*/
-
-    i = 0;
-
-    while (maxv > 0) {
-        lup = mmax;
-        if (sub_k >= 0) {
-            for (hcount = 0; hcount < sub_k + 1; hcount++) {
-                val[i++] = decode_float(grib_decode_unsigned_long(hres, &hpos, 8 * bytes));
-                val[i++] = decode_float(grib_decode_unsigned_long(hres, &hpos, 8 * bytes));
-
-                if (GRIBEX_sh_bug_present && hcount == sub_k) {
-                    /*  bug in ecmwf data, last row (K+1)is scaled but should not */
-                    val[i - 2] *= scals[lup];
-                    val[i - 1] *= scals[lup];
-                }
-                lup++;
-            }
-            sub_k--;
-        }
-
-        pscals = scals + lup;
-        pval   = val + i;
-#if FAST_BIG_ENDIAN
-        grib_decode_double_array_complex(lres,
-                                         &lpos, bits_per_value,
-                                         reference_value, s, pscals, (maxv - hcount) * 2, pval);
-        i += (maxv - hcount) * 2;
-#else
-        (void)pscals; /* suppress gcc warning */
-        (void)pval;   /* suppress gcc warning */
-        for (lcount = hcount; lcount < maxv; lcount++) {
-            val[i++] = d * (double)((grib_decode_unsigned_long(lres, &lpos, bits_per_value) * s) + reference_value) * scals[lup];
-            val[i++] = d * (double)((grib_decode_unsigned_long(lres, &lpos, bits_per_value) * s) + reference_value) * scals[lup];
-            /* These values should always be zero, but as they are packed,
-               it is necessary to force them back to zero */
-            if (mmax == 0)
-                val[i - 1] = 0;
-            lup++;
-        }
-#endif
-
-        maxv--;
-        hcount = 0;
-        mmax++;
-    }
-
-    Assert(*len >= i);
-    *len = i;
+    t.hres                  = buf;
+    t.lres                  = buf;
+    t.lpos                  = 8 * (packed_offset - offsetdata);
+    t.pen_j                 = pen_j;
+    t.sub_j                 = sub_j;
+    t.bytes                 = bytes;
+    t.decode_float          = decode_float;
+    t.GRIBEX_sh_bug_present = GRIBEX_sh_bug_present;
+    t.bits_per_value        = bits_per_value;
+    t.reference_value       = reference_value;
+    t.s                     = s;
+    t.d                     = d;
+    t.scals                 = scals;
+    t.n_vals                = n_vals;
+    t.val                   = val;
+
+    ntasks = grib_thread_pool_ntasks(a->context, n_vals);
+    if (ntasks > 1)
+        grib_thread_pool_run(a->context, ntasks, &decode_rows_task, &t);
+    else
+        decode_rows_task(&t, 0, 1);
+
+    Assert(*len >= n_vals);
+    *len = n_vals;
 
     grib_context_free(a->context, scals);
 
@@ -473,30 +533,18 @@ static double calculate_pfactor(grib_context* ctx, const double* spectralField,
         norms[loop] = 0.0;
 
     /*
-     * Form norms for the rows which contain part of the unscaled subset.
+     * Form norms in one pass over the rows: the coefficients n < subsetTruncation
+     * of the rows which contain part of the unscaled subset are skipped.
      */
-
-    index = -2;
-    for (m = 0; m < subsetTruncation; m++) {
-        for (n = m; n <= fieldTruncation; n++) {
-            index += 2;
-            if (n >= subsetTruncation) {
-                norms[n] = MAXVAL(norms[n], fabs(spectralField[index]));
-                norms[n] = MAXVAL(norms[n], fabs(spectralField[index + 1]));
-            }
-        }
-    }
-
-    /*
-     * Form norms for the rows which do not contain part of the unscaled subset.
-     */
-
-    for (m = subsetTruncation; m <= fieldTruncation; m++) {
-        for (n = m; n <= fieldTruncation; n++) {
-            index += 2;
-            norms[n] = MAXVAL(norms[n], fabs(spectralField[index]));
-            norms[n] = MAXVAL(norms[n], fabs(spectralField[index + 1]));
+    index = 0;
+    for (m = 0; m <= fieldTruncation; m++) {
+        const double* p = spectralField + index;
+        n               = m < subsetTruncation ? subsetTruncation : m;
+        for (p += 2 * (n - m); n <= fieldTruncation; n++, p += 2) {
+            norms[n] = MAXVAL(norms[n], fabs(p[0]));
+            norms[n] = MAXVAL(norms[n], fabs(p[1]));
         }
+        index += 2 * (fieldTruncation + 1 - m);
     }
 
     /*
@@ -548,23 +596,124 @@ static double calculate_pfactor(grib_context* ctx, const double* spectralField,
     return pFactor;
 }
 
+/*
+ * Encoding goes over the rows m in two passes: the range of the laplacian
+ * scaled values outside the sub-truncation, then, once the scaling is known,
+ * the floats of the sub-truncation are written and the other values gathered
+ * into one array to be packed. Each task does the rows starting in its share
+ * of the values.
+ */
+typedef struct complex_encode_task
+{
+    const double* val;
+    size_t n_vals;
+    long pen_j;
+    long sub_j;
+    const double* scals;
+    int gather; /* second pass */
+    /* Range of the scaled values, per task */
+    double* min;
+    double* max;
+    /* Second pass */
+    double d;
+    unsigned char* hres;
+    int bytes;
+    encode_float_proc encode_float;
+    long GRIBEX_sh_bug_present;
+    double* low;
+    double* low_min; /* per task */
+} complex_encode_task;
+
+static void encode_row_range(const complex_encode_task* t, const double* val, const double* scals, long nlow,
+                             double* min, double* max)
+{
+    /* Real and imaginary parts in separate chains: both start at the first
+     * value, so NaNs are skipped as they would be in a single chain */
+    double min_r = *min, max_r = *max, min_i = *min, max_i = *max;
+    long j;
+    for (j = 0; j < nlow; j++) {
+        const double r = val[2 * j] * scals[j];
+        const double i = val[2 * j + 1] * scals[j];
+        max_r          = r > max_r ? r : max_r;
+        min_r          = r < min_r ? r : min_r;
+        max_i          = i > max_i ? i : max_i;
+        min_i          = i < min_i ? i : min_i;
+    }
+    *max = max_i > max_r ? max_i : max_r;
+    *min = min_i < min_r ? min_i : min_r;
+}
+
+static void encode_row_gather(const complex_encode_task* t, long m, long nsub, long npairs, const double* val,
+                              size_t hpos, double* low, double* low_min)
+{
+    const double* scals = t->scals + m;
+    const double d      = t->d;
+    double lmin         = *low_min;
+    long pos            = hpos * 8 * t->bytes;
+    long j;
+
+    for (j = 0; j < nsub; j++) {
+        if (t->GRIBEX_sh_bug_present && j == nsub - 1) {
+            grib_encode_unsigned_long(t->hres, t->encode_float((val[2 * j] * d) * scals[j]), &pos, 8 * t->bytes);
+            grib_encode_unsigned_long(t->hres, t->encode_float((val[2 * j + 1] * d) * scals[j]), &pos, 8 * t->bytes);
+        }
+        else {
+            grib_encode_unsigned_long(t->hres, t->encode_float(val[2 * j]), &pos, 8 * t->bytes);
+            grib_encode_unsigned_long(t->hres, t->encode_float(val[2 * j + 1]), &pos, 8 * t->bytes);
+        }
+    }
+    for (; j < npairs; j++) {
+        const double r = (val[2 * j] * d) * scals[j];
+        const double i = (val[2 * j + 1] * d) * scals[j];
+        *low++         = r;
+        *low++         = i;
+        lmin           = r < lmin ? r : lmin;
+        lmin           = i < lmin ? i : lmin;
+    }
+    *low_min = lmin;
+}
+
+static void encode_rows_task(void* data, int k, int ntasks)
+{
+    const complex_encode_task* t = (const complex_encode_task*)data;
+    size_t begin = 0, end = 0, i = 0, hpos = 0, lpos = 0;
+    long m;
+
+    grib_thread_pool_range(t->n_vals, 2, k, ntasks, &begin, &end);
+    for (m = 0; m <= t->pen_j && i < end; m++) {
+        const long npairs = t->pen_j + 1 - m;
+        const long nsub   = m <= t->sub_j ? t->sub_j + 1 - m : 0;
+        if (i >= begin) {
+            if (t->gather)
+                encode_row_gather(t, m, nsub, npairs, t->val + i, hpos, t->low + lpos, &t->low_min[k]);
+            else
+                encode_row_range(t, t->val + i + 2 * nsub, t->scals + m + nsub, npairs - nsub, &t->min[k], &t->max[k]);
+        }
+        i += 2 * npairs;
+        hpos += 2 * nsub;
+        lpos += 2 * (npairs - nsub);
+    }
+}
+
 static int pack_double(grib_accessor* a, const double* val, size_t* len)
 {
     grib_accessor_data_complex_packing* self = (grib_accessor_data_complex_packing*)a;
     grib_handle* gh                          = grib_handle_of_accessor(a);
 
-    size_t i      = 0;
-    int ret       = GRIB_SUCCESS;
-    long hcount   = 0;
-    long lcount   = 0;
-    long hpos     = 0;
-    long lup      = 0;
-    long mmax     = 0;
-    long n_vals   = 0;
-    double* scals = NULL;
+    size_t i       = 0;
+    int ret        = GRIB_SUCCESS;
+    long k         = 0;
+    long hpos      = 0;
+    long n_vals    = 0;
+    long nlow      = 0;
+    int ntasks     = 0;
+    double* scals  = NULL;
+    double* low    = NULL;
+    double* ranges = NULL; /* min, max and low_min of the tasks */
 
-    double s = 0;
-    double d = 0;
+    double s    = 0;
+    double d    = 0;
+    double lmin = 0;
 
     unsigned char* buf = NULL;
 
@@ -597,11 +746,10 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     long ieee_floats           = 0;
     double min                 = 0;
     double max                 = 0;
-    double current_val         = 0;
-    short mixmax_unset         = 0;
     int bytes;
 
     encode_float_proc encode_float = NULL;
+    complex_encode_task t;
 
     if (*len == 0)
         return GRIB_NO_VALUES;
@@ -710,13 +858,17 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     }
 
     hsize = bytes * (sub_k + 1) * (sub_k + 2);
-    lsize = ((n_vals - ((sub_k + 1) * (sub_k + 2))) * bits_per_value) / 8;
+    nlow  = n_vals - ((sub_k + 1) * (sub_k + 2));
+    lsize = (nlow * bits_per_value) / 8;
 
     buflen = hsize + lsize;
 
-    buf  = (unsigned char*)grib_context_malloc(a->context, buflen);
+    /* The last packed value can spill into one more byte */
+    buf  = (unsigned char*)grib_context_malloc_clear(a->context, buflen + 1);
     hres = buf;
     lres = buf + hsize;
+    if (!buf)
+        return GRIB_OUT_OF_MEMORY;
 
     maxv = pen_j + 1;
 
@@ -730,46 +882,47 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     for (i = 1; i < maxv; i++)
         scals[i] = ((double)pow(i * (i + 1), laplacianOperator));
 
-    mmax   = 0;
-    maxv   = pen_j + 1;
-    i      = 0;
-    hcount = 0;
-    sub_k  = sub_j;
-
-    while (maxv > 0) {
-        lup = mmax;
-
-        if (sub_k >= 0) {
-            i += 2 * (sub_k + 1);
-            lup += sub_k + 1;
-            hcount += sub_k + 1;
-            sub_k--;
-        }
-
-        for (lcount = hcount; lcount < maxv; lcount++) {
-            current_val = ((val[i++]) * scals[lup]);
-            if (mixmax_unset == 0) {
-                max          = current_val;
-                min          = current_val;
-                mixmax_unset = 1;
-            }
-
-            if (current_val > max)
-                max = current_val;
-            if (current_val < min)
-                min = current_val;
-
-            current_val = ((val[i++]) * scals[lup]);
-            if (current_val > max)
-                max = current_val;
-            if (current_val < min)
-                min = current_val;
+    ntasks = grib_thread_pool_ntasks(a->context, n_vals);
+    ranges = (double*)grib_context_malloc(a->context, 3 * ntasks * sizeof(double));
+    if (!ranges) {
+        grib_context_free(a->context, buf);
+        grib_context_free(a->context, scals);
+        return GRIB_OUT_OF_MEMORY;
+    }
 
-            lup++;
-        }
-        maxv--;
-        hcount = 0;
-        mmax++;
+    t.val                   = val;
+    t.n_vals                = n_vals;
+    t.pen_j                 = pen_j;
+    t.sub_j                 = sub_j;
+    t.scals                 = scals;
+    t.gather                = 0;
+    t.min                   = ranges;
+    t.max                   = ranges + ntasks;
+    t.d                     = 0;
+    t.hres                  = hres;
+    t.bytes                 = bytes;
+    t.encode_float          = encode_float;
+    t.GRIBEX_sh_bug_present = GRIBEX_sh_bug_present;
+    t.low                   = NULL;
+    t.low_min               = ranges + 2 * ntasks;
+
+    /* Range of the scaled values outside the sub-truncation. Every task starts
+     * from the first of them, so that NaNs are skipped as in a single pass */
+    if (nlow > 0) {
+        const long nsub = sub_j >= 0 ? sub_j + 1 : 0;
+        min = max = val[2 * nsub] * scals[nsub];
+    }
+    for (k = 0; k < ntasks; k++) {
+        t.min[k] = min;
+        t.max[k] = max;
+    }
+    if (ntasks > 1)
+        grib_thread_pool_run(a->context, ntasks, &encode_rows_task, &t);
+    else
+        encode_rows_task(&t, 0, 1);
+    for (k = 0; k < ntasks; k++) {
+        max = t.max[k] > max ? t.max[k] : max;
+        min = t.min[k] < min ? t.min[k] : min;
     }
 
     if (optimize_scaling_factor) {
@@ -781,6 +934,9 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
         if (ret != GRIB_SUCCESS) {
             grib_context_log(gh->context, GRIB_LOG_ERROR,
                              "unable to find nearest_smaller_value of %g for %s", min, self->reference_value);
+            grib_context_free(a->context, buf);
+            grib_context_free(a->context, scals);
+            grib_context_free(a->context, ranges);
             return GRIB_INTERNAL_ERROR;
         }
         d = grib_power(+decimal_scale_factor, 10);
@@ -790,6 +946,9 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
         if (grib_get_nearest_smaller_value(gh, self->reference_value, d * min, &reference_value) != GRIB_SUCCESS) {
             grib_context_log(gh->context, GRIB_LOG_ERROR,
                              "unable to find nearest_smaller_value of %g for %s", d * min, self->reference_value);
+            grib_context_free(a->context, buf);
+            grib_context_free(a->context, scals);
+            grib_context_free(a->context, ranges);
             return GRIB_INTERNAL_ERROR;
         }
         binary_scale_factor = grib_get_binary_scale_fact(d * max, reference_value, bits_per_value, &ret);
@@ -802,83 +961,43 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
         else {
             if (ret != GRIB_SUCCESS) {
                 grib_context_log(a->context, GRIB_LOG_ERROR, "COMPLEX_PACKING : Cannot compute binary_scale_factor");
+                grib_context_free(a->context, buf);
+                grib_context_free(a->context, scals);
+                grib_context_free(a->context, ranges);
                 return ret;
             }
         }
     }
     s = grib_power(-binary_scale_factor, 2);
 
-    i = 0;
-
-    mmax   = 0;
-    maxv   = pen_j + 1;
-    hcount = 0;
-    sub_k  = sub_j;
-
-    while (maxv > 0) {
-        lup = mmax;
-
-        if (sub_k >= 0) {
-            for (hcount = 0; hcount < sub_k + 1; hcount++) {
-                if (GRIBEX_sh_bug_present && hcount == sub_k) {
-                    /* _test(val[i]*d*scals[lup],1); */
-                    grib_encode_unsigned_long(hres, encode_float((val[i++] * d) * scals[lup]), &hpos, 8 * bytes);
-                    /* _test(val[i]*d*scals[lup],1); */
-                    grib_encode_unsigned_long(hres, encode_float((val[i++] * d) * scals[lup]), &hpos, 8 * bytes);
-                }
-                else {
-                    /* _test(val[i]*d,0); */
-                    grib_encode_unsigned_long(hres, encode_float(val[i++]), &hpos, 8 * bytes);
-                    /* _test(val[i]*d,0); */
-                    grib_encode_unsigned_long(hres, encode_float(val[i++]), &hpos, 8 * bytes);
-                }
-                lup++;
-            }
-            sub_k--;
-        }
-
-#if FAST_BIG_ENDIAN
-        grib_encode_double_array_complex((maxv - hcount) * 2, &(val[i]), bits_per_value, reference_value, &(scals[lup]), d, s, lres, &lpos);
-        i += (maxv - hcount) * 2;
-#else
-        if (bits_per_value % 8) {
-            for (lcount = hcount; lcount < maxv; lcount++) {
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "COMPLEX_PACKING : negative coput before packing (%g)", current_val);
-                grib_encode_unsigned_longb(lres, current_val, &lpos, bits_per_value);
-
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "COMPLEX_PACKING : negative coput before packing (%g)", current_val);
-                grib_encode_unsigned_longb(lres, current_val, &lpos, bits_per_value);
-                lup++;
-            }
-        }
-        else {
-            for (lcount = hcount; lcount < maxv; lcount++) {
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "COMPLEX_PACKING : negative coput before packing (%g)", current_val);
-                grib_encode_unsigned_long(lres, current_val, &lpos, bits_per_value);
-
-                current_val = (((((val[i++] * d) * scals[lup]) - reference_value) * s) + 0.5);
-                if (current_val < 0)
-                    grib_context_log(a->context, GRIB_LOG_ERROR,
-                                     "COMPLEX_PACKING : negative coput before packing (%g)", current_val);
-                grib_encode_unsigned_long(lres, current_val, &lpos, bits_per_value);
-                lup++;
-            }
-        }
-#endif
-
-        maxv--;
-        hcount = 0;
-        mmax++;
+    low = (double*)grib_context_malloc(a->context, (nlow > 0 ? nlow : 1) * sizeof(double));
+    if (!low) {
+        grib_context_free(a->context, buf);
+        grib_context_free(a->context, scals);
+        grib_context_free(a->context, ranges);
+        return GRIB_OUT_OF_MEMORY;
     }
+    t.gather = 1;
+    t.d      = d;
+    t.low    = low;
+    /* Not 0, which is below the reference value of positive fields */
+    for (k = 0; k < ntasks; k++)
+        t.low_min[k] = DBL_MAX;
+    if (ntasks > 1)
+        grib_thread_pool_run(a->context, ntasks, &encode_rows_task, &t);
+    else
+        encode_rows_task(&t, 0, 1);
+    hpos = 8 * hsize;
+
+    lmin = DBL_MAX;
+    for (k = 0; k < ntasks; k++)
+        lmin = t.low_min[k] < lmin ? t.low_min[k] : lmin;
+    if ((((lmin - reference_value) * s) + 0.5) < 0)
+        grib_context_log(a->context, GRIB_LOG_ERROR,
+                         "COMPLEX_PACKING : negative coput before packing (%g)", ((lmin - reference_value) * s) + 0.5);
+    grib_encode_double_array_threaded(a->context, nlow, low, bits_per_value, reference_value, 1, s, lres, &lpos);
+    grib_context_free(a->context, low);
+    grib_context_free(a->context, ranges);
 
     if (((hpos / 8) != hsize) && ((lpos / 8) != lsize)) {
         grib_context_log(a->context, GRIB_LOG_ERROR,
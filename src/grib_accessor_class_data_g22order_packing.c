@@ -20,6 +20,7 @@
    IMPLEMENTS = unpack_double
    IMPLEMENTS = pack_double
    IMPLEMENTS = unpack_double_element
+   IMPLEMENTS = unpack_double_element_set
    IMPLEMENTS = value_count
    MEMBERS=const char*  numberOfValues
    MEMBERS=const char*  bits_per_value
@@ -61,6 +62,7 @@ static int value_count(grib_accessor*, long*);
 static void init(grib_accessor*, const long, grib_arguments*);
 static void init_class(grib_accessor_class*);
 static int unpack_double_element(grib_accessor*, size_t i, double* val);
+static int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array);
 
 typedef struct grib_accessor_data_g22order_packing
 {
@@ -119,6 +121,7 @@ static grib_accessor_class _grib_accessor_class_data_g22order_packing = {
     0,                                           /* grib_unpack procedures long    */
     &pack_double,                                /* grib_pack procedures double    */
     &unpack_double,                              /* grib_unpack procedures double  */
+    0,                                           /* grib_unpack procedures float   */
     0,                                           /* grib_pack procedures string    */
     0,                                           /* grib_unpack procedures string  */
     0,                                           /* grib_pack array procedures string    */
@@ -134,6 +137,7 @@ static grib_accessor_class _grib_accessor_class_data_g22order_packing = {
     0,                                           /* next accessor    */
     0,                                           /* compare vs. another accessor   */
     &unpack_double_element,                      /* unpack only ith value          */
+    &unpack_double_element_set,                  /* unpack a given set of elements */
     0,                                           /* unpack a subarray         */
     0,                                           /* clear          */
     0,                                           /* clone accessor          */
@@ -258,35 +262,40 @@ static int calc_bits_needed(unsigned long spread)
     return nbit;
 }
 
+/*
+ * The longest group from vals on: it ends after l-1 values, or with the value
+ * that makes it need more than w-2 bits
+ */
 static int find_next_group(const unsigned long* vals, size_t len, unsigned long w, unsigned long l, long* nbits, long* groupsize, long* r_val)
 {
     unsigned long lmin = 0;
     unsigned long lmax = 0;
-
-    size_t i = 0;
+    long bits          = 0;
+    size_t n           = 0;
 
     if (len == 0)
         return GRIB_ARRAY_TOO_SMALL;
     lmin = vals[0];
     lmax = lmin;
 
-    while (i < len) {
-        if (vals[i] > lmax)
-            lmax = vals[i];
-        else if (vals[i] < lmin)
-            lmin = vals[i];
-        /*Assert((lmax-lmin) >= 0);*/
-        *nbits = calc_bits_needed(lmax - lmin);
-        *r_val = lmin;
-        i++;
-        *groupsize = i;
-
-        if (*groupsize > l - 2)
-            return GRIB_SUCCESS;
-        if (*nbits > w - 2)
-            return GRIB_SUCCESS;
+    while (n < len) {
+        const unsigned long v = vals[n++];
+        /* The width only changes with the range */
+        if (v > lmax) {
+            lmax = v;
+            bits = calc_bits_needed(lmax - lmin);
+        }
+        else if (v < lmin) {
+            lmin = v;
+            bits = calc_bits_needed(lmax - lmin);
+        }
+        if (n > l - 2 || (unsigned long)bits > w - 2)
+            break;
     }
 
+    *nbits     = bits;
+    *r_val     = lmin;
+    *groupsize = n;
     return GRIB_SUCCESS;
 }
 
@@ -343,63 +352,6 @@ static int spatial_difference (grib_context *c, unsigned long* vals, long  len,
 }
 #endif
 
-static int post_process(grib_context* c, long* vals, long len, long order, long bias, unsigned long extras[2])
-{
-    unsigned long last, penultimate, j = 0;
-    Assert(order > 0);
-    Assert(order <= 3);
-    if (!vals)
-        return GRIB_INTERNAL_ERROR;
-
-    if (order == 1) {
-        last = extras[0];
-        while (j < len) {
-            if (vals[j] == LONG_MAX)
-                j++;
-            else {
-                vals[j++] = extras[0];
-                break;
-            }
-        }
-        while (j < len) {
-            if (vals[j] == LONG_MAX)
-                j++;
-            else {
-                vals[j] += last + bias;
-                last = vals[j++];
-            }
-        }
-    }
-    else if (order == 2) {
-        penultimate = extras[0];
-        last        = extras[1];
-        while (j < len) {
-            if (vals[j] == LONG_MAX)
-                j++;
-            else {
-                vals[j++] = extras[0];
-                break;
-            }
-        }
-        while (j < len) {
-            if (vals[j] == LONG_MAX)
-                j++;
-            else {
-                vals[j++] = extras[1];
-                break;
-            }
-        }
-        for (; j < len; j++) {
-            if (vals[j] != LONG_MAX) {
-                vals[j]     = vals[j] + bias + last + last - penultimate;
-                penultimate = last;
-                last        = vals[j];
-            }
-        }
-    }
-    return GRIB_SUCCESS;
-}
-
 #if 0
 static int de_spatial_difference (grib_context *c, unsigned long* vals, long  len, long order, long bias)
 {
@@ -444,12 +396,219 @@ static int de_spatial_difference (grib_context *c, unsigned long* vals, long  le
 }
 #endif
 
+/* A group of values: reference, width, number of values, index of the first value and its bit offset */
+typedef struct g22order_group
+{
+    long ref;
+    long nbits;
+    long nvals;
+    long first;
+    long bitp;
+} g22order_group;
+
+/*
+ * The reference, width and length of each group. Each of the three is
+ * packed on its own, so they are decoded an array at a time.
+ */
+static int decode_groups_metadata(grib_context* c, const unsigned char* buf_ref, long ref_p, long bits_per_value,
+                                  const unsigned char* buf_width, long numberOfBitsUsedForTheGroupWidths, long referenceForGroupWidths,
+                                  const unsigned char* buf_length, long numberOfBitsUsedForTheScaledGroupLengths,
+                                  long referenceForGroupLengths, long lengthIncrementForTheGroupLengths, long trueLengthOfLastGroup,
+                                  long numberOfGroupsOfDataValues, long n_vals, g22order_group* groups)
+{
+    long* meta   = (long*)grib_context_malloc(c, numberOfGroupsOfDataValues * sizeof(long));
+    long pos     = 0;
+    long vcount  = 0;
+    long vals_p  = 0;
+    long i       = 0;
+
+    if (!meta)
+        return GRIB_OUT_OF_MEMORY;
+
+    grib_decode_long_array(buf_ref, &ref_p, bits_per_value, numberOfGroupsOfDataValues, meta);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++)
+        groups[i].ref = meta[i];
+
+    pos = 0;
+    grib_decode_long_array(buf_width, &pos, numberOfBitsUsedForTheGroupWidths, numberOfGroupsOfDataValues, meta);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++)
+        groups[i].nbits = meta[i] + referenceForGroupWidths;
+
+    pos = 0;
+    grib_decode_long_array(buf_length, &pos, numberOfBitsUsedForTheScaledGroupLengths, numberOfGroupsOfDataValues, meta);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++) {
+        g22order_group* g = &groups[i];
+        g->nvals          = meta[i] * lengthIncrementForTheGroupLengths + referenceForGroupLengths;
+        if (i == numberOfGroupsOfDataValues - 1)
+            g->nvals = trueLengthOfLastGroup;
+        Assert(n_vals >= vcount + g->nvals);
+        g->first = vcount;
+        g->bitp  = vals_p;
+        vcount += g->nvals;
+        vals_p += g->nbits * g->nvals;
+    }
+
+    grib_context_free(c, meta);
+    return GRIB_SUCCESS;
+}
+
+/*
+ * Unpack the n values of nbits bits (at most 25) from bit bitp of p, adding
+ * ref to each. A value of up to 25 bits fits in the 4 bytes from its first
+ * one, which are read at once as long as they are among the nbytes of p.
+ * Returns how many values were unpacked; the caller finishes the tail.
+ */
+static long unpack_group(const unsigned char* p, size_t nbytes, long bitp, long nbits, long n, long ref, long* out)
+{
+    const int shift = (int)(32 - nbits);
+    long j          = 0;
+
+    if (nbytes < 4)
+        return 0;
+    /* Values starting at most at bit limit have their 4 bytes in p */
+    {
+        const long limit = (long)(nbytes - 4) * 8 + 7;
+        if (bitp > limit)
+            return 0;
+        if ((limit - bitp) / nbits + 1 < n)
+            n = (limit - bitp) / nbits + 1;
+    }
+    for (j = 0; j < n; j++) {
+        const unsigned char* q = p + (bitp >> 3);
+        const unsigned int x   = ((unsigned int)q[0] << 24) | ((unsigned int)q[1] << 16) | ((unsigned int)q[2] << 8) | q[3];
+        out[j]                 = ref + (long)((x << (bitp & 7)) >> shift);
+        bitp += nbits;
+    }
+    return n;
+}
+
+/*
+ * Decode the values of a group into out. Missing values are set to LONG_MAX.
+ * nbytes is how many bytes from buf_vals on can be read.
+ */
+static void decode_group(const unsigned char* buf_vals, size_t nbytes, const g22order_group* g,
+                         long missingValueManagementUsed, long bits_per_value, long* out)
+{
+    const long ref = missingValueManagementUsed == 0 ? g->ref : 0;
+    long bitp      = g->bitp;
+    long j         = 0;
+
+    if (g->nbits == 0) {
+        /* All the values are the reference, which can be a missing value */
+        const long maxn = (1 << bits_per_value) - 1;
+        long v          = g->ref;
+        if ((missingValueManagementUsed == 1 && v == maxn) ||
+            (missingValueManagementUsed == 2 && (v == maxn || v == maxn - 1)))
+            v = LONG_MAX;
+        for (j = 0; j < g->nvals; j++)
+            out[j] = v;
+        return;
+    }
+
+    if (g->nbits <= 25)
+        j = unpack_group(buf_vals, nbytes, bitp, g->nbits, g->nvals, ref, out);
+    if (j < g->nvals) {
+        long k = 0;
+        bitp += j * g->nbits;
+        grib_decode_long_array(buf_vals, &bitp, g->nbits, g->nvals - j, out + j);
+        for (k = j; k < g->nvals; k++)
+            out[k] += ref;
+    }
+
+    if (missingValueManagementUsed != 0) {
+        /* Primary (and secondary if 2) missing values included within data values */
+        const long maxn  = (1 << g->nbits) - 1;
+        const long maxn2 = missingValueManagementUsed == 2 ? maxn - 1 : maxn;
+        for (j = 0; j < g->nvals; j++) {
+            const int missing = (out[j] == maxn) | (out[j] == maxn2);
+            out[j]            = missing ? LONG_MAX : out[j] + g->ref;
+        }
+    }
+}
+
+/* (x*2^E+R)*10^-D of the integers, or the missing value */
+static void scale_values(const long* sec_val, size_t n, double reference_value, double binary_s, double decimal_s,
+                         double missingValue, double* val)
+{
+    size_t i = 0;
+    for (i = 0; i < n; i++) {
+        /* Without a branch, as missing values are scattered */
+        const double x = (double)((((double)sec_val[i]) * binary_s) + reference_value) * decimal_s;
+        val[i]         = sec_val[i] == LONG_MAX ? missingValue : x;
+    }
+}
+
+/*
+ * Undo the spatial differencing of order 1 or 2 (code table 5.6) and scale in
+ * the same pass. The first values are given by extras, and missing values are
+ * not part of the differences.
+ */
+static void undo_differencing(const long* sec_val, size_t n, long order, long bias, const unsigned long extras[2],
+                              double reference_value, double binary_s, double decimal_s, double missingValue, double* val)
+{
+    unsigned long last = 0, penultimate = 0;
+    long seen          = 0;
+    size_t i           = 0;
+
+    for (i = 0; i < n && seen < order; i++) {
+        if (sec_val[i] == LONG_MAX) {
+            val[i] = missingValue;
+        }
+        else {
+            penultimate = last;
+            last        = extras[seen++];
+            val[i]      = (double)((((double)(long)last) * binary_s) + reference_value) * decimal_s;
+        }
+    }
+
+    /* Missing values can be anywhere: they are dealt with by selection rather than branches */
+    for (; i < n; i++) {
+        const int missing = sec_val[i] == LONG_MAX;
+        const long x      = order == 1 ? (long)(sec_val[i] + last + bias) : (long)(sec_val[i] + bias + last + last - penultimate);
+        const double v    = (double)((((double)x) * binary_s) + reference_value) * decimal_s;
+        penultimate       = missing ? penultimate : last;
+        last              = missing ? last : (unsigned long)x;
+        val[i]            = missing ? missingValue : v;
+    }
+}
+
+typedef struct g22order_decode_task
+{
+    const unsigned char* buf_vals;
+    size_t nbytes; /* that can be read from buf_vals */
+    const g22order_group* groups;
+    long ngroups;
+    long missingValueManagementUsed;
+    long bits_per_value;
+    long* sec_val;
+    /* Without spatial differencing each group is scaled as soon as it is decoded */
+    double* val;
+    double reference_value;
+    double binary_s;
+    double decimal_s;
+    double missingValue;
+} g22order_decode_task;
+
+static void decode_groups_task(void* data, int k, int ntasks)
+{
+    const g22order_decode_task* t = (const g22order_decode_task*)data;
+    size_t begin = 0, end = 0, i = 0;
+
+    grib_thread_pool_range(t->ngroups, 1, k, ntasks, &begin, &end);
+    for (i = begin; i < end; i++) {
+        const g22order_group* g = &t->groups[i];
+        decode_group(t->buf_vals, t->nbytes, g, t->missingValueManagementUsed, t->bits_per_value, t->sec_val + g->first);
+        if (t->val)
+            scale_values(t->sec_val + g->first, g->nvals, t->reference_value, t->binary_s, t->decimal_s,
+                         t->missingValue, t->val + g->first);
+    }
+}
+
 static int unpack_double(grib_accessor* a, double* val, size_t* len)
 {
     grib_accessor_data_g22order_packing* self = (grib_accessor_data_g22order_packing*)a;
 
     size_t i    = 0;
-    size_t j    = 0;
     long n_vals = 0;
     long vcount = 0;
     int err     = GRIB_SUCCESS;
@@ -466,11 +625,6 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     long length_p = 0;
     long ref_p    = 0;
     long width_p  = 0;
-    long vals_p   = 0;
-
-    long nvals_per_group     = 0;
-    long nbits_per_group_val = 0;
-    long group_ref_val       = 0;
 
     long bits_per_value    = 0;
     double binary_s        = 0;
@@ -495,6 +649,10 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     long numberOfOctetsExtraDescriptors;
     double missingValue = 0;
 
+    g22order_group* groups = NULL;
+    g22order_decode_task t;
+    int ntasks = 1;
+
     err = grib_value_count(a, &n_vals);
     if (err)
         return err;
@@ -544,10 +702,16 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
 
     self->dirty = 0;
 
+    /* For Complex packing, order == 0 */
+    /* For Complex packing and spatial differencing, order == 1 or 2 (code table 5.6) */
+    if (orderOfSpatialDifferencing != 0 && orderOfSpatialDifferencing != 1 && orderOfSpatialDifferencing != 2) {
+        grib_context_log(a->context, GRIB_LOG_ERROR, "Unsupported order of spatial differencing %ld", orderOfSpatialDifferencing);
+        return GRIB_INTERNAL_ERROR;
+    }
+
     sec_val = (long*)grib_context_malloc(a->context, (n_vals) * sizeof(long));
     if (!sec_val)
         return GRIB_OUT_OF_MEMORY;
-    memset(sec_val, 0, (n_vals) * sizeof(long)); /* See SUP-718 */
 
     buf_ref = buf + a->offset;
 
@@ -564,131 +728,118 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
     length_p = (numberOfGroupsOfDataValues * numberOfBitsUsedForTheScaledGroupLengths);
     buf_vals = buf_length + (length_p / 8) + ((length_p % 8) ? 1 : 0);
 
-    length_p = 0;
-    ref_p    = orderOfSpatialDifferencing ? (orderOfSpatialDifferencing + 1) * (numberOfOctetsExtraDescriptors * 8) : 0;
-    width_p  = 0;
-    vals_p   = 0;
-    vcount   = 0;
-
-    for (i = 0; i < numberOfGroupsOfDataValues; i++) {
-        group_ref_val       = grib_decode_unsigned_long(buf_ref, &ref_p, bits_per_value);
-        nvals_per_group     = grib_decode_unsigned_long(buf_length, &length_p, numberOfBitsUsedForTheScaledGroupLengths);
-        nbits_per_group_val = grib_decode_unsigned_long(buf_width, &width_p, numberOfBitsUsedForTheGroupWidths);
-
-        nvals_per_group *= lengthIncrementForTheGroupLengths;
-        nvals_per_group += referenceForGroupLengths;
-        nbits_per_group_val += referenceForGroupWidths;
+    ref_p = orderOfSpatialDifferencing ? (orderOfSpatialDifferencing + 1) * (numberOfOctetsExtraDescriptors * 8) : 0;
 
-        if (i == numberOfGroupsOfDataValues - 1)
-            nvals_per_group = trueLengthOfLastGroup;
-        Assert(n_vals >= vcount + nvals_per_group);
-
-        /*grib_decode_long_array(buf_vals, &vals_p, nbits_per_group_val, nvals_per_group,
-                               &sec_val[vcount]); */
-        if (missingValueManagementUsed == 0) {
-            /* No explicit missing values included within data values */
-            for (j = 0; j < nvals_per_group; j++) {
-                DebugAssertAccess(sec_val, (long)(vcount + j), n_vals);
-                sec_val[vcount + j] = group_ref_val + grib_decode_unsigned_long(buf_vals, &vals_p, nbits_per_group_val);
-                /*printf("sec_val[%ld]=%ld\n", vcount+j, sec_val[vcount+j]);*/
-            }
-        }
-        else if (missingValueManagementUsed == 1) {
-            /* Primary missing values included within data values */
-            long maxn = 0; /* (1 << bits_per_value) - 1; */
-            for (j = 0; j < nvals_per_group; j++) {
-                if (nbits_per_group_val == 0) {
-                    maxn = (1 << bits_per_value) - 1;
-                    if (group_ref_val == maxn) {
-                        sec_val[vcount + j] = LONG_MAX; /* missing value */
-                    }
-                    else {
-                        long temp           = grib_decode_unsigned_long(buf_vals, &vals_p, nbits_per_group_val);
-                        sec_val[vcount + j] = group_ref_val + temp;
-                    }
-                }
-                else {
-                    long temp = grib_decode_unsigned_long(buf_vals, &vals_p, nbits_per_group_val);
-                    maxn      = (1 << nbits_per_group_val) - 1;
-                    if (temp == maxn) {
-                        sec_val[vcount + j] = LONG_MAX; /* missing value */
-                    }
-                    else {
-                        sec_val[vcount + j] = group_ref_val + temp;
-                    }
-                }
-            }
-        }
-        else if (missingValueManagementUsed == 2) {
-            /* Primary and secondary missing values included within data values */
-            long maxn  = (1 << bits_per_value) - 1;
-            long maxn2 = 0; /* maxn - 1; */
-            for (j = 0; j < nvals_per_group; j++) {
-                if (nbits_per_group_val == 0) {
-                    maxn2 = maxn - 1;
-                    if (group_ref_val == maxn || group_ref_val == maxn2) {
-                        sec_val[vcount + j] = LONG_MAX; /* missing value */
-                    }
-                    else {
-                        long temp           = grib_decode_unsigned_long(buf_vals, &vals_p, nbits_per_group_val);
-                        sec_val[vcount + j] = group_ref_val + temp;
-                    }
-                }
-                else {
-                    long temp = grib_decode_unsigned_long(buf_vals, &vals_p, nbits_per_group_val);
-                    maxn      = (1 << nbits_per_group_val) - 1;
-                    maxn2     = maxn - 1;
-                    if (temp == maxn || temp == maxn2) {
-                        sec_val[vcount + j] = LONG_MAX; /* missing value */
-                    }
-                    else {
-                        sec_val[vcount + j] = group_ref_val + temp;
-                    }
-                }
-            }
+    if (numberOfGroupsOfDataValues > 0) {
+        groups = (g22order_group*)grib_context_malloc(a->context, numberOfGroupsOfDataValues * sizeof(g22order_group));
+        if (!groups) {
+            err = GRIB_OUT_OF_MEMORY;
+            goto cleanup;
         }
+        err = decode_groups_metadata(a->context, buf_ref, ref_p, bits_per_value,
+                                     buf_width, numberOfBitsUsedForTheGroupWidths, referenceForGroupWidths,
+                                     buf_length, numberOfBitsUsedForTheScaledGroupLengths,
+                                     referenceForGroupLengths, lengthIncrementForTheGroupLengths, trueLengthOfLastGroup,
+                                     numberOfGroupsOfDataValues, n_vals, groups);
+        if (err)
+            goto cleanup;
+        vcount = groups[numberOfGroupsOfDataValues - 1].first + groups[numberOfGroupsOfDataValues - 1].nvals;
+    }
+
+    binary_s  = grib_power(binary_scale_factor, 2);
+    decimal_s = grib_power(-decimal_scale_factor, 10);
 
-        vcount += nvals_per_group;
+    t.buf_vals                   = buf_vals;
+    t.nbytes                     = buf_vals < buf + gh->buffer->ulength ? buf + gh->buffer->ulength - buf_vals : 0;
+    t.groups                     = groups;
+    t.ngroups                    = numberOfGroupsOfDataValues;
+    t.missingValueManagementUsed = missingValueManagementUsed;
+    t.bits_per_value             = bits_per_value;
+    t.sec_val                    = sec_val;
+    t.val                        = orderOfSpatialDifferencing ? NULL : val;
+    t.reference_value            = reference_value;
+    t.binary_s                   = binary_s;
+    t.decimal_s                  = decimal_s;
+    t.missingValue               = missingValue;
+
+    /* Large fields: the groups are decoded in parallel */
+    ntasks = grib_thread_pool_ntasks(a->context, n_vals);
+    if (ntasks > 1 && numberOfGroupsOfDataValues > 1) {
+        /* Groups differ in size: more tasks than threads evens out the work */
+        grib_thread_pool_run(a->context, 4 * ntasks, &decode_groups_task, &t);
+    }
+    else {
+        decode_groups_task(&t, 0, 1);
     }
 
+    /* Values not in any group are 0. See SUP-718 */
+    for (i = vcount; i < n_vals; i++)
+        sec_val[i] = 0;
+
     if (orderOfSpatialDifferencing) {
         long bias               = 0;
         unsigned long extras[2] = {0,};
         ref_p = 0;
 
-        /* For Complex packing, order == 0 */
-        /* For Complex packing and spatial differencing, order == 1 or 2 (code table 5.6) */
-        if (orderOfSpatialDifferencing != 1 && orderOfSpatialDifferencing != 2) {
-            grib_context_log(a->context, GRIB_LOG_ERROR, "Unsupported order of spatial differencing %ld", orderOfSpatialDifferencing);
-            return GRIB_INTERNAL_ERROR;
-        }
-
         for (i = 0; i < orderOfSpatialDifferencing; i++) {
             extras[i] = grib_decode_unsigned_long(buf_ref, &ref_p, numberOfOctetsExtraDescriptors * 8);
         }
 
         bias = grib_decode_signed_longb(buf_ref, &ref_p, numberOfOctetsExtraDescriptors * 8);
 
-        post_process(a->context, sec_val, n_vals, orderOfSpatialDifferencing, bias, extras);
-        /*de_spatial_difference (a->context, sec_val, n_vals, orderOfSpatialDifferencing, bias);*/
+        undo_differencing(sec_val, n_vals, orderOfSpatialDifferencing, bias, extras,
+                          reference_value, binary_s, decimal_s, missingValue, val);
     }
-
-    binary_s  = grib_power(binary_scale_factor, 2);
-    decimal_s = grib_power(-decimal_scale_factor, 10);
-
-    for (i = 0; i < n_vals; i++) {
-        if (sec_val[i] == LONG_MAX) {
-            val[i] = missingValue;
-        }
-        else {
-            val[i] = (double)((((double)sec_val[i]) * binary_s) + reference_value) * decimal_s;
-        }
+    else {
+        scale_values(sec_val + vcount, n_vals - vcount, reference_value, binary_s, decimal_s, missingValue, val + vcount);
     }
 
+cleanup:
+    grib_context_free(a->context, groups);
     grib_context_free(a->context, sec_val);
     return err;
 }
 
+/* Big-endian bit writer into a cleared buffer, for the parts of the packed data */
+typedef struct g22order_bit_writer
+{
+    unsigned char* p;
+    unsigned long long acc; /* the last nacc bits are still to be written */
+    int nacc;
+} g22order_bit_writer;
+
+static void bit_writer_start(g22order_bit_writer* w, unsigned char* p)
+{
+    w->p    = p;
+    w->acc  = 0;
+    w->nacc = 0;
+}
+
+/* The nbits least significant bits of val, as grib_encode_unsigned_longb */
+static void bit_writer_put(g22order_bit_writer* w, unsigned long val, long nbits)
+{
+    if (nbits > 32) {
+        bit_writer_put(w, val >> 32, nbits - 32);
+        nbits = 32;
+    }
+    if (nbits <= 0)
+        return;
+    w->acc = (w->acc << nbits) | (val & ((1ULL << nbits) - 1));
+    w->nacc += (int)nbits;
+    while (w->nacc >= 8) {
+        w->nacc -= 8;
+        *w->p++ = (unsigned char)(w->acc >> w->nacc);
+    }
+}
+
+/* Write the last bits, padded with zeros to a whole byte */
+static void bit_writer_end(g22order_bit_writer* w)
+{
+    if (w->nacc > 0)
+        *w->p++ = (unsigned char)(w->acc << (8 - w->nacc));
+    w->nacc = 0;
+}
+
 static int pack_double(grib_accessor* a, const double* val, size_t* len)
 {
     grib_accessor_data_g22order_packing* self = (grib_accessor_data_g22order_packing*)a;
@@ -715,10 +866,7 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     double max;
     double min;
 
-    long length_p = 0;
-    long ref_p    = 0;
-    long width_p  = 0;
-    long vals_p   = 0;
+    long vals_p = 0;
 
     size_t nv       = 0;
     size_t buf_size = 0;
@@ -750,6 +898,9 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
 
     long maxgrw;
     long maxgrl;
+    g22order_group* groups = NULL;
+    size_t max_groups      = 0;
+    g22order_bit_writer w;
     char packingType[254] = {0,};
     size_t slen = 254;
 
@@ -801,42 +952,55 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
 
     d = grib_power(decimal_scale_factor, 10);
 
-    max = val[0];
-    min = max;
-    for (i = 0; i < n_vals; i++) {
-        if (val[i] > max)
-            max = val[i];
-        else if (val[i] < min)
-            min = val[i];
-    }
+    grib_minmax_double_array(val, n_vals, &min, &max);
     min *= d;
     max *= d;
 
     if (grib_get_nearest_smaller_value(gh, self->reference_value, min, &reference_value) != GRIB_SUCCESS) {
         grib_context_log(a->context, GRIB_LOG_ERROR,
                          "unable to find nearest_smaller_value of %g for %s", min, self->reference_value);
+        grib_context_free(a->context, sec_val);
         return GRIB_INTERNAL_ERROR;
     }
 
     binary_scale_factor = grib_get_binary_scale_fact(max, reference_value, bits_per_value, &err);
-    if (err != GRIB_SUCCESS)
+    if (err != GRIB_SUCCESS) {
+        grib_context_free(a->context, sec_val);
         return err;
+    }
     divisor = grib_power(-binary_scale_factor, 2);
 
     for (i = 0; i < n_vals; i++)
         sec_val[i] = (unsigned long)((((val[i] * d) - reference_value) * divisor) + 0.5);
 
-    group_val = sec_val;
-
     maxgrw = calc_pow_2(numberOfBitsUsedForTheGroupWidths);
     maxgrl = calc_pow_2(numberOfBitsUsedForTheScaledGroupLengths);
 
+    /* The groups are found in one pass over the values, then written */
     numberOfGroupsOfDataValues = 0;
     nv                         = n_vals;
+    group_val                  = sec_val;
     vals_p                     = 0;
 
     while (find_next_group(group_val, nv, maxgrw, maxgrl, &nbits_per_group_val, &nvals_per_group, &group_ref_val) == GRIB_SUCCESS) {
+        if (numberOfGroupsOfDataValues == max_groups) {
+            g22order_group* more = NULL;
+            max_groups           = max_groups ? 2 * max_groups : 1024;
+            more                 = (g22order_group*)grib_context_realloc(a->context, groups, max_groups * sizeof(g22order_group));
+            if (!more) {
+                grib_context_free(a->context, groups);
+                grib_context_free(a->context, sec_val);
+                return GRIB_OUT_OF_MEMORY;
+            }
+            groups = more;
+        }
+        groups[numberOfGroupsOfDataValues].ref   = group_ref_val;
+        groups[numberOfGroupsOfDataValues].nbits = nbits_per_group_val;
+        groups[numberOfGroupsOfDataValues].nvals = nvals_per_group;
+        groups[numberOfGroupsOfDataValues].first = n_vals - nv;
+        groups[numberOfGroupsOfDataValues].bitp  = vals_p;
         numberOfGroupsOfDataValues++;
+
         nv -= nvals_per_group;
         group_val += nvals_per_group;
         vals_p += nbits_per_group_val * nvals_per_group;
@@ -851,38 +1015,45 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     buf_size += (vals_p / 8) + ((vals_p % 8) ? 1 : 0);
 
     buf = (unsigned char*)grib_context_malloc_clear(a->context, buf_size);
+    if (!buf) {
+        grib_context_free(a->context, groups);
+        grib_context_free(a->context, sec_val);
+        return GRIB_OUT_OF_MEMORY;
+    }
 
     buf_ref    = buf;
     buf_width  = buf_ref + (7 + (numberOfGroupsOfDataValues * bits_per_value)) / 8;
     buf_length = buf_width + (7 + (numberOfGroupsOfDataValues * numberOfBitsUsedForTheGroupWidths)) / 8;
     buf_vals   = buf_length + (7 + (numberOfGroupsOfDataValues * numberOfBitsUsedForTheScaledGroupLengths)) / 8;
 
-    nv        = n_vals;
-    group_val = sec_val;
-    vals_p    = 0;
-    ref_p     = 0;
-    width_p   = 0;
-    length_p  = 0;
-    i         = 0;
+    /* Each part starts on a byte of its own */
+    bit_writer_start(&w, buf_ref);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++)
+        bit_writer_put(&w, groups[i].ref, bits_per_value);
+    bit_writer_end(&w);
 
-    while (find_next_group(group_val, nv, maxgrw, maxgrl, &nbits_per_group_val, &nvals_per_group, &group_ref_val) == GRIB_SUCCESS) {
-        grib_encode_unsigned_longb(buf_ref, group_ref_val, &ref_p, bits_per_value);
-        grib_encode_unsigned_longb(buf_width, nbits_per_group_val, &width_p, numberOfBitsUsedForTheGroupWidths);
-        grib_encode_unsigned_longb(buf_length, nvals_per_group, &length_p, numberOfBitsUsedForTheScaledGroupLengths);
+    bit_writer_start(&w, buf_width);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++)
+        bit_writer_put(&w, groups[i].nbits, numberOfBitsUsedForTheGroupWidths);
+    bit_writer_end(&w);
 
-        if (nbits_per_group_val)
-            for (j = 0; j < nvals_per_group; j++) {
-                grib_encode_unsigned_longb(buf_vals, sec_val[i + j] - group_ref_val, &vals_p, nbits_per_group_val);
-            }
-        i += nvals_per_group;
-        group_val += nvals_per_group;
-        nv -= nvals_per_group;
-    }
+    bit_writer_start(&w, buf_length);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++)
+        bit_writer_put(&w, groups[i].nvals, numberOfBitsUsedForTheScaledGroupLengths);
+    bit_writer_end(&w);
 
-    /*fprintf(stdout,"spatial pack_double::  %ld  bytes %lu marked\n", (ref_p+7)/8 + (width_p+7)/8 + (length_p+7)/8 + (vals_p+7)/8, buf_size);*/
+    bit_writer_start(&w, buf_vals);
+    for (i = 0; i < numberOfGroupsOfDataValues; i++) {
+        const g22order_group* g = &groups[i];
+        if (g->nbits)
+            for (j = 0; j < g->nvals; j++)
+                bit_writer_put(&w, sec_val[g->first + j] - g->ref, g->nbits);
+    }
+    bit_writer_end(&w);
 
     grib_buffer_replace(a, buf, buf_size, 1, 1);
     grib_context_free(a->context, buf);
+    grib_context_free(a->context, groups);
     grib_context_free(a->context, sec_val);
 
     if ((err = grib_set_long_internal(gh, self->bits_per_value, bits_per_value)) != GRIB_SUCCESS)
@@ -958,6 +1129,31 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     return err;
 }
 
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    size_t size = 0, i = 0;
+    double* values = NULL;
+    int err        = grib_get_size(grib_handle_of_accessor(a), "codedValues", &size);
+    if (err)
+        return err;
+    for (i = 0; i < len; i++) {
+        if (index_array[i] >= size)
+            return GRIB_INVALID_NEAREST;
+    }
+
+    /* The field is decoded once for all the values */
+    values = (double*)grib_context_malloc_clear(a->context, size * sizeof(double));
+    if (!values)
+        return GRIB_OUT_OF_MEMORY;
+    err = grib_get_double_array(grib_handle_of_accessor(a), "codedValues", values, &size);
+    if (!err) {
+        for (i = 0; i < len; i++)
+            val_array[i] = values[index_array[i]];
+    }
+    grib_context_free(a->context, values);
+    return err;
+}
+
 static int value_count(grib_accessor* a, long* count)
 {
     grib_accessor_data_g22order_packing* self = (grib_accessor_data_g22order_packing*)a;
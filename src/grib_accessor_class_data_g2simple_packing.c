@@ -89,6 +89,7 @@ static grib_accessor_class _grib_accessor_class_data_g2simple_packing = {
     0,                                           /* grib_unpack procedures long    */
     &pack_double,                                /* grib_pack procedures double    */
     0,                                           /* grib_unpack procedures double  */
+    0,                                           /* grib_unpack procedures float   */
     0,                                           /* grib_pack procedures string    */
     0,                                           /* grib_unpack procedures string  */
     0,                                           /* grib_pack array procedures string    */
@@ -104,6 +105,7 @@ static grib_accessor_class _grib_accessor_class_data_g2simple_packing = {
     0,                                           /* next accessor    */
     0,                                           /* compare vs. another accessor   */
     0,                                           /* unpack only ith value          */
+    0,                                           /* unpack a given set of elements */
     0,                                           /* unpack a subarray         */
     0,                                           /* clear          */
     0,                                           /* clone accessor          */
@@ -258,7 +260,7 @@ static int pack_double(grib_accessor* a, const double* cval, size_t* len)
     buf     = (unsigned char*)grib_context_buffer_malloc_clear(a->context, buflen);
     encoded = buf;
 
-    grib_encode_double_array(n_vals, val, bits_per_value, reference_value, decimal, divisor, encoded, &off);
+    grib_encode_double_array_threaded(a->context, n_vals, val, bits_per_value, reference_value, decimal, divisor, encoded, &off);
 
     grib_context_log(a->context, GRIB_LOG_DEBUG,
                      "grib_accessor_data_g2simple_packing : pack_double : packing %s, %d values", a->name, n_vals);
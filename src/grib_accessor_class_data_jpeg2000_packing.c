@@ -20,6 +20,7 @@
    IMPLEMENTS = unpack_double
    IMPLEMENTS = pack_double
    IMPLEMENTS = unpack_double_element
+   IMPLEMENTS = unpack_double_element_set
    IMPLEMENTS = value_count
    MEMBERS=const char*   type_of_compression_used
    MEMBERS=const char*   target_compression_ratio
@@ -50,6 +51,7 @@ static int value_count(grib_accessor*, long*);
 static void init(grib_accessor*, const long, grib_arguments*);
 static void init_class(grib_accessor_class*);
 static int unpack_double_element(grib_accessor*, size_t i, double* val);
+static int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array);
 
 typedef struct grib_accessor_data_jpeg2000_packing
 {
@@ -109,6 +111,7 @@ static grib_accessor_class _grib_accessor_class_data_jpeg2000_packing = {
     0,                                           /* grib_unpack procedures long    */
     &pack_double,                                /* grib_pack procedures double    */
     &unpack_double,                              /* grib_unpack procedures double  */
+    0,                                           /* grib_unpack procedures float   */
     0,                                           /* grib_pack procedures string    */
     0,                                           /* grib_unpack procedures string  */
     0,                                           /* grib_pack array procedures string    */
@@ -124,6 +127,7 @@ static grib_accessor_class _grib_accessor_class_data_jpeg2000_packing = {
     0,                                           /* next accessor    */
     0,                                           /* compare vs. another accessor   */
     &unpack_double_element,                      /* unpack only ith value          */
+    &unpack_double_element_set,                  /* unpack a given set of elements */
     0,                                           /* unpack a subarray         */
     0,                                           /* clear          */
     0,                                           /* clone accessor          */
@@ -597,3 +601,28 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     grib_context_free(a->context, values);
     return err;
 }
+
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    size_t size = 0, i = 0;
+    double* values = NULL;
+    int err        = grib_get_size(grib_handle_of_accessor(a), "codedValues", &size);
+    if (err)
+        return err;
+    for (i = 0; i < len; i++) {
+        if (index_array[i] >= size)
+            return GRIB_INVALID_NEAREST;
+    }
+
+    /* The field is decoded once for all the values */
+    values = (double*)grib_context_malloc_clear(a->context, size * sizeof(double));
+    if (!values)
+        return GRIB_OUT_OF_MEMORY;
+    err = grib_get_double_array(grib_handle_of_accessor(a), "codedValues", values, &size);
+    if (!err) {
+        for (i = 0; i < len; i++)
+            val_array[i] = values[index_array[i]];
+    }
+    grib_context_free(a->context, values);
+    return err;
+}
@@ -24,7 +24,9 @@
    SUPER      = grib_accessor_class_values
    IMPLEMENTS = init
    IMPLEMENTS = unpack_double
+   IMPLEMENTS = unpack_float
    IMPLEMENTS = unpack_double_element
+   IMPLEMENTS = unpack_double_element_set
    IMPLEMENTS = unpack_double_subarray
    IMPLEMENTS = pack_double
    IMPLEMENTS = value_count
@@ -54,10 +56,12 @@ or edit "accessor.class" and rerun ./make_class.pl
 
 static int pack_double(grib_accessor*, const double* val, size_t* len);
 static int unpack_double(grib_accessor*, double* val, size_t* len);
+static int unpack_float(grib_accessor*, float* val, size_t* len);
 static int value_count(grib_accessor*, long*);
 static void init(grib_accessor*, const long, grib_arguments*);
 static void init_class(grib_accessor_class*);
 static int unpack_double_element(grib_accessor*, size_t i, double* val);
+static int unpack_double_element_set(grib_accessor*, const size_t* index_array, size_t len, double* val_array);
 static int unpack_double_subarray(grib_accessor*, double* val, size_t start, size_t len);
 
 typedef struct grib_accessor_data_simple_packing
@@ -108,6 +112,7 @@ static grib_accessor_class _grib_accessor_class_data_simple_packing = {
     0,                                         /* grib_unpack procedures long    */
     &pack_double,                              /* grib_pack procedures double    */
     &unpack_double,                            /* grib_unpack procedures double  */
+    &unpack_float,                             /* grib_unpack procedures float   */
     0,                                         /* grib_pack procedures string    */
     0,                                         /* grib_unpack procedures string  */
     0,                                         /* grib_pack array procedures string    */
@@ -123,6 +128,7 @@ static grib_accessor_class _grib_accessor_class_data_simple_packing = {
     0,                                         /* next accessor    */
     0,                                         /* compare vs. another accessor   */
     &unpack_double_element,                    /* unpack only ith value          */
+    &unpack_double_element_set,                /* unpack a given set of elements */
     &unpack_double_subarray,                   /* unpack a subarray         */
     0,                                         /* clear          */
     0,                                         /* clone accessor          */
@@ -303,7 +309,30 @@ static int unpack_double_element(grib_accessor* a, size_t idx, double* val)
     return err;
 }
 
-static int _unpack_double(grib_accessor* a, double* val, size_t* len, unsigned char* buf, long pos, size_t n_vals)
+/* The values a unitsFactor or unitsBias applies to are left to unpack_double, which resets them */
+static int unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array)
+{
+    grib_accessor_data_simple_packing* self = (grib_accessor_data_simple_packing*)a;
+    grib_handle* gh                         = grib_handle_of_accessor(a);
+    double units_factor                     = 1.0;
+    double units_bias                       = 0.0;
+    size_t i                                = 0;
+    int err                                 = 0;
+
+    if (self->units_factor && grib_get_double(gh, self->units_factor, &units_factor) == GRIB_SUCCESS && units_factor != 1.0)
+        return GRIB_NOT_IMPLEMENTED;
+    if (self->units_bias && grib_get_double(gh, self->units_bias, &units_bias) == GRIB_SUCCESS && units_bias != 0.0)
+        return GRIB_NOT_IMPLEMENTED;
+
+    for (i = 0; i < len; i++) {
+        if ((err = unpack_double_element(a, index_array[i], &val_array[i])) != GRIB_SUCCESS)
+            return err;
+    }
+    return GRIB_SUCCESS;
+}
+
+/* Decode n_vals values into either dval or fval (exactly one of them is set) */
+static int unpack_values(grib_accessor* a, double* dval, float* fval, size_t* len, unsigned char* buf, long pos, size_t n_vals)
 {
     grib_accessor_data_simple_packing* self = (grib_accessor_data_simple_packing*)a;
     grib_handle* gh                         = grib_handle_of_accessor(a);
@@ -368,8 +397,12 @@ static int _unpack_double(grib_accessor* a, double* val, size_t* len, unsigned c
     /* Special case */
 
     if (bits_per_value == 0) {
-        for (i = 0; i < n_vals; i++)
-            val[i] = reference_value;
+        for (i = 0; i < n_vals; i++) {
+            if (fval)
+                fval[i] = (float)reference_value;
+            else
+                dval[i] = reference_value;
+        }
         *len = n_vals;
         return GRIB_SUCCESS;
     }
@@ -404,21 +437,40 @@ static int _unpack_double(grib_accessor* a, double* val, size_t* len, unsigned c
     grib_context_log(a->context, GRIB_LOG_DEBUG,
                      "unpack_double: calling outline function : bpv %d, rv : %g, sf : %d, dsf : %d ",
                      bits_per_value, reference_value, binary_scale_factor, decimal_scale_factor);
-    grib_decode_double_array(buf, &pos, bits_per_value, reference_value, s, d, n_vals, val);
+    if (fval && units_factor == 1.0 && units_bias == 0.0) {
+        grib_decode_array_threaded(a->context, buf, &pos, bits_per_value, reference_value, s, d, n_vals, NULL, fval);
+        *len = (long)n_vals;
+        return err;
+    }
+    if (fval) {
+        /* The units are applied in double precision, so values are only rounded once */
+        double* tmp = (double*)grib_context_malloc(a->context, n_vals * sizeof(double));
+        if (!tmp)
+            return GRIB_OUT_OF_MEMORY;
+        grib_decode_array_threaded(a->context, buf, &pos, bits_per_value, reference_value, s, d, n_vals, tmp, NULL);
+        *len = (long)n_vals;
+
+        for (i = 0; i < n_vals; i++)
+            fval[i] = (float)(tmp[i] * units_factor + units_bias);
+        grib_context_free(a->context, tmp);
+        return err;
+    }
+
+    grib_decode_array_threaded(a->context, buf, &pos, bits_per_value, reference_value, s, d, n_vals, dval, NULL);
 
     *len = (long)n_vals;
 
     if (units_factor != 1.0) {
         if (units_bias != 0.0)
             for (i = 0; i < n_vals; i++)
-                val[i] = val[i] * units_factor + units_bias;
+                dval[i] = dval[i] * units_factor + units_bias;
         else
             for (i = 0; i < n_vals; i++)
-                val[i] *= units_factor;
+                dval[i] *= units_factor;
     }
     else if (units_bias != 0.0)
         for (i = 0; i < n_vals; i++)
-            val[i] += units_bias;
+            dval[i] += units_bias;
 
     return err;
 }
@@ -439,7 +491,7 @@ static int unpack_double_subarray(grib_accessor* a, double* val, size_t start, s
 
     buf += (start * bits_per_value) / 8;
     pos = start * bits_per_value % 8;
-    return _unpack_double(a, val, plen, buf, pos, nvals);
+    return unpack_values(a, val, NULL, plen, buf, pos, nvals);
 }
 
 static int unpack_double(grib_accessor* a, double* val, size_t* len)
@@ -455,7 +507,20 @@ static int unpack_double(grib_accessor* a, double* val, size_t* len)
         return err;
     nvals = count;
 
-    return _unpack_double(a, val, len, buf, pos, nvals);
+    return unpack_values(a, val, NULL, len, buf, pos, nvals);
+}
+
+static int unpack_float(grib_accessor* a, float* val, size_t* len)
+{
+    unsigned char* buf = (unsigned char*)grib_handle_of_accessor(a)->buffer->data;
+    int err            = 0;
+    long count         = 0;
+
+    err = grib_value_count(a, &count);
+    if (err)
+        return err;
+
+    return unpack_values(a, NULL, val, len, buf, 0, count);
 }
 
 #if GRIB_IBMPOWER67_OPT
@@ -532,7 +597,6 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
     grib_accessor_data_simple_packing* self = (grib_accessor_data_simple_packing*)a;
     grib_handle* gh                         = grib_handle_of_accessor(a);
 
-    size_t i;
     size_t n_vals = *len;
     int err       = 0;
     int last;
@@ -580,17 +644,12 @@ static int pack_double(grib_accessor* a, const double* val, size_t* len)
 
     self->dirty = 1;
 
+#if GRIB_IBMPOWER67_OPT
     max = val[0];
     min = max;
-#if GRIB_IBMPOWER67_OPT
     minmax_val(val + 1, n_vals - 1, &min, &max);
 #else
-    for (i = 1; i < n_vals; i++) {
-        if (val[i] > max)
-            max = val[i];
-        else if (val[i] < min)
-            min = val[i];
-    }
+    grib_minmax_double_array(val, n_vals, &min, &max);
 #endif
     if ((err = check_range(gh, min, max)) != GRIB_SUCCESS) {
         return err;
@@ -79,6 +79,7 @@ static grib_accessor_class _grib_accessor_class_g2_aerosol = {
     &unpack_long,                     /* grib_unpack procedures long    */
     0,                                /* grib_pack procedures double    */
     0,                                /* grib_unpack procedures double  */
+    0,                                /* grib_unpack procedures float   */
     0,                                /* grib_pack procedures string    */
     0,                                /* grib_unpack procedures string  */
     0,                                /* grib_pack array procedures string    */
@@ -94,6 +95,7 @@ static grib_accessor_class _grib_accessor_class_g2_aerosol = {
     0,                                /* next accessor    */
     0,                                /* compare vs. another accessor   */
     0,                                /* unpack only ith value          */
+    0,                                /* unpack a given set of elements */
     0,                                /* unpack a subarray         */
     0,                                /* clear          */
     0,                                /* clone accessor          */
@@ -108,6 +108,7 @@ static grib_accessor_class _grib_accessor_class_gen = {
     &unpack_long,              /* grib_unpack procedures long    */
     &pack_double,              /* grib_pack procedures double    */
     &unpack_double,            /* grib_unpack procedures double  */
+    0,                         /* grib_unpack procedures float   */
     &pack_string,              /* grib_pack procedures string    */
     &unpack_string,            /* grib_unpack procedures string  */
     &pack_string_array,        /* grib_pack array procedures string    */
@@ -123,6 +124,7 @@ static grib_accessor_class _grib_accessor_class_gen = {
     &next,                     /* next accessor    */
     &compare,                  /* compare vs. another accessor   */
     &unpack_double_element,    /* unpack only ith value          */
+    0,                         /* unpack a given set of elements */
     &unpack_double_subarray,   /* unpack a subarray         */
     &clear,                    /* clear          */
     &make_clone,               /* clone accessor          */
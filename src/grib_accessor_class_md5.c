@@ -78,6 +78,7 @@ static grib_accessor_class _grib_accessor_class_md5 = {
     0,                         /* grib_unpack procedures long    */
     0,                         /* grib_pack procedures double    */
     0,                         /* grib_unpack procedures double  */
+    0,                         /* grib_unpack procedures float   */
     0,                         /* grib_pack procedures string    */
     &unpack_string,            /* grib_unpack procedures string  */
     0,                         /* grib_pack array procedures string    */
@@ -93,6 +94,7 @@ static grib_accessor_class _grib_accessor_class_md5 = {
     0,                         /* next accessor    */
     &compare,                  /* compare vs. another accessor   */
     0,                         /* unpack only ith value          */
+    0,                         /* unpack a given set of elements */
     0,                         /* unpack a subarray         */
     0,                         /* clear          */
     0,                         /* clone accessor          */
@@ -272,3 +274,24 @@ static int value_count(grib_accessor* a, long* count)
     *count = 16;
     return 0;
 }
+
+/* 'clone' is a copy of the bytes of 'a' in a cloned handle: give it its own list of keys to skip */
+int accessor_md5_clone_state(grib_accessor* a, grib_accessor* clone)
+{
+    grib_accessor_md5* self = (grib_accessor_md5*)a;
+    grib_accessor_md5* copy = (grib_accessor_md5*)clone;
+    grib_string_list* from  = self->blocklist;
+    grib_string_list** to   = &copy->blocklist;
+
+    copy->blocklist = NULL;
+    while (from) {
+        *to = (grib_string_list*)grib_context_malloc_clear(a->context, sizeof(grib_string_list));
+        if (!*to)
+            return GRIB_OUT_OF_MEMORY;
+        if (((*to)->value = grib_context_strdup(a->context, from->value)) == NULL)
+            return GRIB_OUT_OF_MEMORY;
+        to   = &(*to)->next;
+        from = from->next;
+    }
+    return GRIB_SUCCESS;
+}
@@ -72,6 +72,7 @@ static grib_accessor_class _grib_accessor_class_step_human_readable = {
     0,                /* grib_unpack procedures long    */
     0,                /* grib_pack procedures double    */
     0,              /* grib_unpack procedures double  */
+    0,              /* grib_unpack procedures float   */
     0,                /* grib_pack procedures string    */
     &unpack_string,              /* grib_unpack procedures string  */
     0,          /* grib_pack array procedures string    */
@@ -87,6 +88,7 @@ static grib_accessor_class _grib_accessor_class_step_human_readable = {
     0,                       /* next accessor    */
     0,                    /* compare vs. another accessor   */
     0,      /* unpack only ith value          */
+    0,      /* unpack a given set of elements */
     0,     /* unpack a subarray         */
     0,                      /* clear          */
     0,                 /* clone accessor          */
@@ -92,6 +92,7 @@ static grib_accessor_class _grib_accessor_class_variable = {
     &unpack_long,                   /* grib_unpack procedures long    */
     &pack_double,                   /* grib_pack procedures double    */
     &unpack_double,                 /* grib_unpack procedures double  */
+    0,                              /* grib_unpack procedures float   */
     &pack_string,                   /* grib_pack procedures string    */
     &unpack_string,                 /* grib_unpack procedures string  */
     0,                              /* grib_pack array procedures string    */
@@ -107,6 +108,7 @@ static grib_accessor_class _grib_accessor_class_variable = {
     0,                              /* next accessor    */
     &compare,                       /* compare vs. another accessor   */
     0,                              /* unpack only ith value          */
+    0,                              /* unpack a given set of elements */
     0,                              /* unpack a subarray         */
     0,                              /* clear          */
     &make_clone,                    /* clone accessor          */
@@ -193,6 +195,26 @@ void accessor_variable_set_type(grib_accessor* a, int type)
     self->type                   = type;
 }
 
+/* 'clone' is a copy of the bytes of 'a' in a cloned handle: give it its own strings */
+int accessor_variable_clone_state(grib_accessor* a, grib_accessor* clone)
+{
+    grib_accessor_variable* self = (grib_accessor_variable*)a;
+    grib_accessor_variable* copy = (grib_accessor_variable*)clone;
+
+    copy->cval  = NULL;
+    copy->cname = NULL;
+    if (self->cval && (copy->cval = grib_context_strdup(a->context, self->cval)) == NULL)
+        return GRIB_OUT_OF_MEMORY;
+    if (self->cname) {
+        if ((copy->cname = grib_context_strdup(a->context, self->cname)) == NULL)
+            return GRIB_OUT_OF_MEMORY;
+        /* ECC-765: the name of a cloned variable is its cname */
+        if (clone->name == self->cname)
+            clone->name = clone->all_names[0] = copy->cname;
+    }
+    return GRIB_SUCCESS;
+}
+
 static void dump(grib_accessor* a, grib_dumper* dumper)
 {
     grib_accessor_variable* self = (grib_accessor_variable*)a;
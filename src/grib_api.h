@@ -219,6 +219,12 @@ typedef struct grib_points grib_points;
 typedef struct grib_keys_iterator grib_keys_iterator;
 typedef struct bufr_keys_iterator bufr_keys_iterator;
 
+/*! Key name compiled once, to get its value from many handles without parsing the name each time. */
+typedef struct grib_key_id grib_key_id;
+
+/*! List of keys with their types, compiled once and extracted from many handles. */
+typedef struct grib_key_plan grib_key_plan;
+
 typedef struct grib_fieldset grib_fieldset;
 
 typedef struct grib_order_by grib_order_by;
@@ -863,6 +869,19 @@ int grib_get_bytes(const grib_handle* h, const char* key, unsigned char* bytes,
 */
 int grib_get_double_array(const grib_handle* h, const char* key, double* vals, size_t* length);
 
+/**
+*  Get values from a key as single precision floats. If several keys of the same name are present, the last one is returned.
+*  Data values are decoded straight into the float array where the packing allows it.
+* @see  grib_set_float_array
+*
+* @param h           : the handle to get the data from
+* @param key         : the key to be searched
+* @param vals        : the address of a float array where the data will be retrieved
+* @param length      : the address of a size_t that contains allocated length of the float array on input, and that contains the actual length of the float array on output
+* @return            0 if OK, integer value on error
+*/
+int grib_get_float_array(const grib_handle* h, const char* key, float* vals, size_t* length);
+
 /**
 *  Get long array values from a key. If several keys of the same name are present, the last one is returned
 * @see  grib_set_long_array
@@ -875,6 +894,42 @@ int grib_get_double_array(const grib_handle* h, const char* key, double* vals, s
 */
 int grib_get_long_array(const grib_handle* h, const char* key, long* vals, size_t* length);
 
+/**
+*  Compile a key name for the grib_get_..._by_id functions, which give the same results as
+*  the gets by name without parsing and hashing the name on every call.
+*  The compiled key is only valid with handles created from the same context.
+*
+* @param c           : the context the handles are created from (NULL for default context)
+* @param key         : the key name, possibly with a namespace e.g. "mars.step"
+* @param err         : error code set if the returned key is NULL
+* @return            the compiled key, NULL on error
+*/
+grib_key_id* grib_key_compile(grib_context* c, const char* key, int* err);
+void grib_key_delete(grib_key_id* k);
+int grib_get_long_by_id(const grib_handle* h, const grib_key_id* k, long* value);
+int grib_get_double_by_id(const grib_handle* h, const grib_key_id* k, double* value);
+int grib_get_string_by_id(const grib_handle* h, const grib_key_id* k, char* mesg, size_t* length);
+int grib_get_size_by_id(const grib_handle* h, const grib_key_id* k, size_t* size);
+int grib_get_long_array_by_id(const grib_handle* h, const grib_key_id* k, long* vals, size_t* length);
+int grib_get_double_array_by_id(const grib_handle* h, const grib_key_id* k, double* vals, size_t* length);
+int grib_get_float_array_by_id(const grib_handle* h, const grib_key_id* k, float* vals, size_t* length);
+
+/**
+*  Compile a list of keys with their types for grib_key_plan_execute.
+*
+* @param c             : the context the handles are created from (NULL for default context)
+* @param keys          : the key names
+* @param types         : GRIB_TYPE_LONG, GRIB_TYPE_DOUBLE or GRIB_TYPE_STRING for each key (NULL for all strings)
+* @param nkeys         : the number of keys
+* @param string_length : the size of a string value, terminating zero included
+* @param err           : error code set if the returned plan is NULL
+* @return              the compiled plan, NULL on error
+*/
+grib_key_plan* grib_key_plan_new(grib_context* c, const char** keys, const int* types, size_t nkeys, size_t string_length, int* err);
+void grib_key_plan_delete(grib_key_plan* p);
+size_t grib_key_plan_size(const grib_key_plan* p);
+int grib_key_plan_execute(grib_key_plan* p, const grib_handle* h, void** columns, size_t row, int* errors);
+
 
 /*   setting      data         */
 /**
@@ -946,6 +1001,18 @@ int grib_set_bytes(grib_handle* h, const char* key, const unsigned char* bytes,
 */
 int grib_set_double_array(grib_handle* h, const char* key, const double* vals, size_t length);
 
+/**
+*  Set a float array from a key. If several keys of the same name are present, the last one is set
+*   @see  grib_get_float_array
+*
+* @param h           : the handle to set the data to
+* @param key         : the key to be searched
+* @param vals        : the address of a float array where the data will be read
+* @param length      : a size_t that contains the length of the float array on input
+* @return            0 if OK, integer value on error
+*/
+int grib_set_float_array(grib_handle* h, const char* key, const float* vals, size_t length);
+
 /**
 * Same as grib_set_double_array but allows setting of READ-ONLY keys like codedValues.
 * Use with great caution!!
@@ -976,6 +1043,28 @@ int grib_set_long_array(grib_handle* h, const char* key, const long* vals, size_
 * @return            0 if OK, integer value on error
 */
 int grib_set_string_array(grib_handle* h, const char* key, const char** vals, size_t length);
+
+/**
+*  Start a batch of sets on a handle. Until the matching grib_handle_commit_update,
+*  the parts of the message whose structure a set changes (e.g. a new template)
+*  are not rebuilt after each set: consecutive sets of such keys rebuild them once,
+*  when a key of another kind is set, the message is got, or the update is committed.
+*  The resulting message is the same as without the update. Updates can be nested:
+*  the outermost commit rebuilds what is left.
+*
+* @param h           : the handle to update
+* @return            0 if OK, integer value on error
+*/
+int grib_handle_begin_update(grib_handle* h);
+
+/**
+*  End a batch of sets started by grib_handle_begin_update and rebuild the parts
+*  of the message whose structure it changed
+*
+* @param h           : the handle being updated
+* @return            0 if OK, integer value on error
+*/
+int grib_handle_commit_update(grib_handle* h);
 /*! @} */
 
 
@@ -1172,6 +1261,30 @@ void grib_context_set_definitions_path(grib_context* c, const char* path);
  */
 void grib_context_set_samples_path(grib_context* c, const char* path);
 
+/**
+ * Sets the number of threads used to decode and encode a single large field.
+ * Fields with fewer values than ECCODES_THREADS_MIN_VALUES are always done by
+ * the calling thread. The default is one thread or ECCODES_THREADS.
+ * Do not call this while handles of the context are in use in other threads.
+ *
+ * @param c       : the context to be modified
+ * @param threads : the number of threads, including the calling thread
+ */
+void grib_context_set_threads(grib_context* c, int threads);
+
+/**
+ * Sets the memory, in bytes, for keeping the values decoded from the data
+ * section of messages, so that getting them again (or getting max, average...
+ * and then the values) does not decode them again. The values of all the
+ * handles of the context share it: the least recently used are dropped first.
+ * It pays off for packings slow to decode (e.g. CCSDS, JPEG, spectral).
+ * The default is 0, no values kept, or ECCODES_VALUES_CACHE_SIZE.
+ *
+ * @param c       : the context to be modified
+ * @param size    : the memory in bytes
+ */
+void grib_context_set_values_cache_size(grib_context* c, size_t size);
+
 /**
 *  Sets memory procedures of the context
 *
@@ -148,6 +148,25 @@ extern int pthread_mutexattr_settype(pthread_mutexattr_t* attr, int type);
 #define GRIB_MUTEX_UNLOCK(a)
 #endif
 
+/* Shared caches (tries, parsed files, code tables...) are filled under their
+ * mutex, then published by storing a pointer or a flag with GRIB_PUBLISH, a
+ * release store. Readers load it with GRIB_PUBLISHED, an acquire load, and
+ * see the object filled. With threads but without such atomics
+ * GRIB_LOCK_FREE_READS is 0 and the readers take the mutex too */
+#if (GRIB_PTHREADS || GRIB_OMP_THREADS) && defined(__ATOMIC_ACQUIRE)
+#define GRIB_LOCK_FREE_READS 1
+#define GRIB_PUBLISH(a, v) __atomic_store_n(&(a), (v), __ATOMIC_RELEASE)
+#define GRIB_PUBLISHED(a) __atomic_load_n(&(a), __ATOMIC_ACQUIRE)
+#else
+#if GRIB_PTHREADS || GRIB_OMP_THREADS
+#define GRIB_LOCK_FREE_READS 0
+#else
+#define GRIB_LOCK_FREE_READS 1
+#endif
+#define GRIB_PUBLISH(a, v) ((a) = (v))
+#define GRIB_PUBLISHED(a) (a)
+#endif
+
 #if GRIB_LINUX_PTHREADS
 /* Note: in newer pthreads PTHREAD_MUTEX_RECURSIVE and PTHREAD_MUTEX_RECURSIVE_NP are enums */
 #if !defined(PTHREAD_MUTEX_RECURSIVE)
@@ -252,6 +271,8 @@ typedef struct grib_arguments grib_arguments;
 
 typedef struct grib_action_file grib_action_file;
 typedef struct grib_action_file_list grib_action_file_list;
+typedef struct grib_arena grib_arena;
+typedef struct grib_accessors_table_entry grib_accessors_table_entry;
 typedef struct grib_block_of_accessors grib_block_of_accessors;
 typedef struct grib_buffer grib_buffer;
 typedef struct grib_accessor_class grib_accessor_class;
@@ -269,6 +290,16 @@ typedef struct grib_box_class grib_box_class;
 typedef struct grib_dumper grib_dumper;
 typedef struct grib_dumper_class grib_dumper_class;
 typedef struct grib_dependency grib_dependency;
+typedef struct grib_deferred_reparse grib_deferred_reparse;
+typedef struct grib_values_cache grib_values_cache;
+typedef struct grib_values_cache_entry grib_values_cache_entry;
+typedef struct grib_ccsds_params grib_ccsds_params;
+typedef struct grib_ccsds_rsi_index grib_ccsds_rsi_index;
+typedef struct grib_mapped_file grib_mapped_file;
+typedef struct grib_offset_index grib_offset_index;
+typedef struct grib_definitions_snapshot grib_definitions_snapshot;
+typedef struct grib_snapshot_writer grib_snapshot_writer;
+typedef struct grib_snapshot_reader grib_snapshot_reader;
 typedef struct string_feed string_feed;
 
 typedef struct codes_condition codes_condition;
@@ -307,7 +338,9 @@ typedef void (*accessor_destroy_proc)(grib_context*, grib_accessor*);
 
 typedef int (*accessor_unpack_long_proc)(grib_accessor*, long*, size_t* len);
 typedef int (*accessor_unpack_double_proc)(grib_accessor*, double*, size_t* len);
+typedef int (*accessor_unpack_float_proc)(grib_accessor*, float*, size_t* len);
 typedef int (*accessor_unpack_double_element_proc)(grib_accessor*, size_t, double*);
+typedef int (*accessor_unpack_double_element_set_proc)(grib_accessor*, const size_t*, size_t, double*);
 typedef int (*accessor_unpack_double_subarray_proc)(grib_accessor*, double*, size_t, size_t);
 typedef int (*accessor_unpack_string_proc)(grib_accessor*, char*, size_t* len);
 typedef int (*accessor_unpack_string_array_proc)(grib_accessor*, char**, size_t* len);
@@ -455,6 +488,8 @@ typedef void (*action_init_proc)(grib_action* a);
 typedef void (*action_destroy_proc)(grib_context* context, grib_action* a);
 typedef grib_action* (*action_reparse_proc)(grib_action* a, grib_accessor*, int*);
 typedef int (*action_execute_proc)(grib_action* a, grib_handle*);
+typedef void (*action_write_snapshot_proc)(grib_action* a, grib_snapshot_writer*);
+typedef grib_action* (*action_read_snapshot_proc)(grib_context*, grib_snapshot_reader*);
 
 /**
 *  an action_class
@@ -481,6 +516,9 @@ struct grib_action_class
 
     action_reparse_proc reparse;
     action_execute_proc execute;
+
+    action_write_snapshot_proc write_snapshot; /** < write the arguments of the constructor, see grib_definitions_snapshot.c */
+    action_read_snapshot_proc read_snapshot;   /** < call the constructor with the arguments written */
 };
 
 
@@ -540,6 +578,7 @@ struct grib_accessor
     int dirty;
 
     grib_accessor* same;        /** < accessors with the same name */
+    int name_id;                /** < key id of the name, -1 if not in the accessors table */
     long loop;                  /** < used in lists */
     long bufr_subset_number;    /** < bufr subset (bufr data accessors belong to different subsets)*/
     long bufr_group_number;     /** < used in bufr */
@@ -714,6 +753,41 @@ struct grib_dependency
     grib_accessor* observed;
     grib_accessor* observer;
     int run;
+    unsigned long hash;         /* of the observer/observed pair when added */
+    grib_dependency* hash_next; /* next in the same bucket of the handle index */
+};
+
+/* A section to rebuild when the update of the handle is committed, see action_class_section.c */
+struct grib_deferred_reparse
+{
+    grib_deferred_reparse* next;
+    grib_action* action;     /* which created the section */
+    grib_accessor* notified; /* owner of the section */
+    const char* changed;     /* name of the key which triggered it */
+    int depth;
+};
+
+/* Parameters of a CCSDS (AEC) stream, the flags as in libaec */
+struct grib_ccsds_params
+{
+    long flags;
+    long bits_per_sample;
+    long block_size;
+    long rsi; /* blocks per reference sample interval */
+};
+
+/* Where the reference sample intervals of a CCSDS stream start, found as
+ * far as needed so far, and the samples of the last one decoded, see grib_ccsds.c */
+struct grib_ccsds_rsi_index
+{
+    grib_ccsds_params params;
+    const unsigned char* data;
+    size_t len;
+    size_t n_vals;
+    size_t count;     /* of intervals found */
+    size_t* offsets;  /* in bits */
+    size_t decoded;   /* interval in samples, (size_t)-1 if none */
+    uint32_t* samples;
 };
 
 struct grib_block_of_accessors
@@ -871,6 +945,82 @@ void codes_assertion_failed(const char* message, const char* file, int line);
 #define MAX_SET_VALUES 10
 #define MAX_ACCESSOR_CACHE 100
 
+/* Position of every message in a file, see grib_offset_index.c */
+struct grib_offset_index
+{
+    grib_context* context;
+    unsigned char* data; /** header followed by one record per message */
+    size_t size;
+    long count;
+    int mapped; /** data is a mapping of the index file */
+    long refs;
+    char* filename;           /** set if kept in memory by the context */
+    grib_offset_index* next; /** next index kept by the context */
+};
+
+/* The definition files parsed in advance, see grib_definitions_snapshot.c */
+struct grib_definitions_snapshot
+{
+    unsigned char* data; /** header followed by one record per file */
+    size_t size;
+    long count;
+    int mapped;                   /** data is a mapping of the snapshot file */
+    char* filename;
+    const char* definitions_path; /** path the files were found in, in data */
+    const unsigned char* records;
+};
+
+typedef struct grib_snapshot_file
+{
+    char* filename;
+    int kind;      /** of the tree: actions, concept or hash array */
+    size_t offset; /** of the tree in the buffer of the writer */
+    size_t length;
+} grib_snapshot_file;
+
+/* Writes the constructor calls making the trees of definition files */
+struct grib_snapshot_writer
+{
+    grib_context* context;
+    grib_buffer* buffer; /** trees of the files added */
+    grib_snapshot_file* files;
+    long count;
+    long size; /** of files */
+    int err;
+};
+
+/* Replays the constructor calls of a tree in a snapshot */
+struct grib_snapshot_reader
+{
+    grib_context* context;
+    const unsigned char* p;
+    const unsigned char* end;
+    int err;
+};
+
+/* A file mapped into memory. Handles created from it point straight into the mapping.
+ * The message of a handle cloned is held the same way, by the handle and its clones */
+struct grib_mapped_file
+{
+    grib_context* context;
+    char* filename;
+    unsigned char* data; /** start of the mapping, or the message */
+    size_t size;         /** size of the file */
+    size_t position;     /** offset of the next message scan */
+    int refcount;        /** number of handles plus the caller holding the mapping */
+    int mapped;          /** data is a mapping, else a message freed with the last handle */
+};
+
+/* A key name resolved once, for repeated gets on many handles (see grib_query.c) */
+struct grib_key_id
+{
+    grib_context* context;
+    char* name;       /** name as given */
+    char* name_space; /** NULL if the name has no namespace */
+    char* basename;   /** name without the namespace */
+    int id;           /** key id of the basename, -1 if the name needs the general search */
+};
+
 struct grib_handle
 {
     grib_context* context;         /** < context attached to this handle    */
@@ -879,10 +1029,16 @@ struct grib_handle
     grib_section* asserts;         /** the assertion section*/
     grib_section* rules;           /** the rules     section*/
     grib_dependency* dependencies; /** List of dependencies */
+    grib_dependency* dependencies_last;   /** Tail of the list of dependencies */
+    grib_dependency** dependencies_index; /** Buckets of dependencies by observer/observed pair */
+    size_t dependencies_index_size;
+    size_t dependencies_count;
     grib_handle* main;             /** Used during reparsing */
     grib_handle* kid;              /** Used during reparsing */
     grib_loader* loader;           /** Used during reparsing */
     int values_stack;
+    int updating;                              /** Nesting of grib_handle_begin_update */
+    grib_deferred_reparse* deferred_reparses;  /** Sections to rebuild when the update is committed */
     const grib_values* values[MAX_SET_VALUES]; /** Used when setting multiple values at once */
     size_t values_count[MAX_SET_VALUES];       /** Used when setting multiple values at once */
     int dont_trigger;                          /** Don't notify triggers */
@@ -891,8 +1047,9 @@ struct grib_handle
     char* gts_header;
     size_t gts_header_len;
     int use_trie;
-    int trie_invalid;
-    grib_accessor* accessors[ACCESSORS_ARRAY_SIZE];
+    grib_accessors_table_entry* accessors_table; /** Accessors by key id, see grib_query.c */
+    size_t accessors_table_size;
+    size_t accessors_table_count;
     char* section_offset[MAX_NUM_SECTIONS];
     char* section_length[MAX_NUM_SECTIONS];
     int sections_count;
@@ -904,6 +1061,9 @@ struct grib_handle
     double missingValueDouble;
     ProductKind product_kind;
     grib_trie* bufr_elements_table;
+    grib_mapped_file* mapped_file; /** Mapping holding the message, if created from a memory-mapped file */
+    grib_arena* arena;             /** Accessors, sections and dependencies of the handle */
+    grib_values_cache_entry* values_cache; /** Decoded values of data keys of the handle, see grib_values_cache.c */
 };
 
 struct grib_multi_handle
@@ -949,6 +1109,7 @@ struct grib_accessor_class
 
     accessor_pack_double_proc pack_double;
     accessor_unpack_double_proc unpack_double;
+    accessor_unpack_float_proc unpack_float;
 
     accessor_pack_string_proc pack_string;
     accessor_unpack_string_proc unpack_string;
@@ -971,6 +1132,7 @@ struct grib_accessor_class
     accessor_next_proc next;
     accessor_compare_proc compare;
     accessor_unpack_double_element_proc unpack_double_element;
+    accessor_unpack_double_element_set_proc unpack_double_element_set;
     accessor_unpack_double_subarray_proc unpack_double_subarray;
     accessor_clear_proc clear;
     accessor_clone_proc make_clone;
@@ -992,6 +1154,10 @@ struct grib_multi_support
     grib_multi_support* next;
 };
 
+/* Thread pool for splitting one field across cores. Task k of ntasks */
+typedef struct grib_thread_pool grib_thread_pool;
+typedef void (*grib_thread_pool_proc)(void* data, int k, int ntasks);
+
 /* Hash_array */
 typedef struct grib_hash_array_value grib_hash_array_value;
 
@@ -1024,6 +1190,7 @@ struct grib_concept_value_name
 };
 
 typedef struct grib_concept_value grib_concept_value;
+typedef struct grib_concept_index grib_concept_index;
 
 struct grib_concept_value
 {
@@ -1031,6 +1198,8 @@ struct grib_concept_value
     char* name;
     grib_concept_condition* conditions;
     grib_trie* index;
+    grib_concept_index* conditions_index; /* of the concept starting at this value, see grib_concept_index.c */
+    int conditions_index_failed;
 };
 
 /* ----------*/
@@ -1105,6 +1274,14 @@ struct grib_context
     grib_trie* lists;
     grib_trie* expanded_descriptors;
     int file_pool_max_opened_files;
+    int threads;
+    size_t threads_min_values;
+    grib_thread_pool* thread_pool;
+    int handle_arena;
+    size_t values_cache_size; /* budget in bytes, 0 for no cache */
+    grib_values_cache* values_cache;
+    grib_offset_index* offset_indexes; /* built but not saved, see grib_offset_index.c */
+    grib_definitions_snapshot* definitions_snapshot;
 #if GRIB_PTHREADS
     pthread_mutex_t mutex;
 #elif GRIB_OMP_THREADS
@@ -1129,6 +1306,8 @@ typedef void (*expression_init_proc)(grib_expression* e);
 typedef void (*expression_destroy_proc)(grib_context*, grib_expression* e);
 
 typedef int (*expression_native_type_proc)(grib_expression*, grib_handle*);
+typedef void (*expression_write_snapshot_proc)(grib_expression*, grib_snapshot_writer*);
+typedef grib_expression* (*expression_read_snapshot_proc)(grib_context*, grib_snapshot_reader*);
 
 struct grib_expression
 {
@@ -1156,6 +1335,9 @@ struct grib_expression_class
     expression_evaluate_long_proc evaluate_long;
     expression_evaluate_double_proc evaluate_double;
     expression_evaluate_string_proc evaluate_string;
+
+    expression_write_snapshot_proc write_snapshot; /** < see grib_definitions_snapshot.c */
+    expression_read_snapshot_proc read_snapshot;
 };
 
 
@@ -1302,44 +1484,6 @@ struct grib_fieldset
 };
 #endif
 
-/* concept index structures */
-
-typedef struct grib_concept_index_key grib_concept_index_key;
-typedef struct grib_concept_index grib_concept_index;
-typedef struct grib_conditions_tree grib_conditions_tree;
-typedef struct grib_concept_entry grib_concept_entry;
-typedef struct grib_concept_key grib_concept_key;
-
-struct grib_concept_index_entry
-{
-    char* name;
-    char* value;
-    int type;
-    grib_concept_entry* next;
-};
-
-struct grib_concept_index_key
-{
-    char* name;
-    int type;
-    grib_concept_key* next;
-};
-
-struct grib_concept_index
-{
-    grib_context* context;
-    grib_concept_key* keys;
-    grib_conditions_tree* conditions;
-};
-
-struct grib_conditions_tree
-{
-    char* value;
-    void* object;
-    grib_conditions_tree* next;
-    grib_conditions_tree* next_key;
-};
-
 /* support for in-memory definition and tables */
 
 extern int codes_memfs_exists(const char* path);
@@ -1426,12 +1570,16 @@ struct grib_action_file
     char* filename;
     grib_action* root;
     grib_action_file* next;
+    grib_action_file* hash_next; /* next in the same bucket of the list index */
 };
 
+#define ACTION_FILE_INDEX_SIZE 509
+
 struct grib_action_file_list
 {
     grib_action_file* first;
     grib_action_file* last;
+    grib_action_file* index[ACTION_FILE_INDEX_SIZE]; /* by filename */
 };
 
 /* Common keys iterator */
@@ -31,6 +31,8 @@ grib_case* grib_case_new(grib_context* c, grib_arguments* values, grib_action* a
 /* grib_accessor_class_mars_param.c */
 
 /* action_class_section.c */
+int action_section_apply_deferred_reparses(grib_handle* h);
+void action_section_free_deferred_reparses(grib_handle* h);
 
 /* action_class_list.c */
 grib_action* grib_action_create_list(grib_context* context, const char* name, grib_expression* expression, grib_action* block);
@@ -57,6 +59,9 @@ grib_action* grib_action_create_assert(grib_context* context, grib_expression* e
 grib_action* grib_action_create_template(grib_context* context, int nofail, const char* name, const char* arg1);
 grib_action* get_empty_template(grib_context* c, int* err);
 
+/* action_class_include.c */
+grib_action* grib_action_create_include(grib_context* context, const char* fname);
+
 /* action_class_trigger.c */
 grib_action* grib_action_create_trigger(grib_context* context, grib_arguments* args, grib_action* block);
 
@@ -120,7 +125,9 @@ int grib_pack_bytes(grib_accessor* a, const unsigned char* v, size_t* len);
 int grib_unpack_bytes(grib_accessor* a, unsigned char* v, size_t* len);
 int grib_unpack_double_subarray(grib_accessor* a, double* v, size_t start, size_t len);
 int grib_unpack_double(grib_accessor* a, double* v, size_t* len);
+int grib_unpack_float(grib_accessor* a, float* v, size_t* len);
 int grib_unpack_double_element(grib_accessor* a, size_t i, double* v);
+int grib_unpack_double_element_set(grib_accessor* a, const size_t* index_array, size_t len, double* val_array);
 int grib_unpack_string(grib_accessor* a, char* v, size_t* len);
 int grib_unpack_string_array(grib_accessor* a, char** v, size_t* len);
 int grib_accessors_list_unpack_long(grib_accessors_list* al, long* val, size_t* buffer_len);
@@ -165,6 +172,11 @@ void grib_concept_value_delete(grib_context* c, grib_concept_value* v);
 grib_concept_condition* grib_concept_condition_new(grib_context* c, const char* name, grib_expression* expression, grib_iarray* iarray);
 void grib_concept_condition_delete(grib_context* c, grib_concept_condition* v);
 
+/* grib_concept_index.c */
+grib_concept_index* grib_concept_index_get(grib_context* c, grib_concept_value* concept);
+void grib_concept_index_delete(grib_context* c, grib_concept_index* index);
+const char* grib_concept_index_evaluate(grib_handle* h, grib_concept_index* index);
+
 /* grib_hash_array.c */
 grib_hash_array_value* grib_integer_hash_array_value_new(grib_context* c, const char* name, grib_iarray* array);
 grib_hash_array_value* grib_double_hash_array_value_new(grib_context* c, const char* name, grib_darray* array);
@@ -585,6 +597,7 @@ int grib_get_g1_message_size(grib_handle* h, grib_accessor* tl, grib_accessor* s
 /* grib_accessor_class_data_simple_packing.c */
 
 /* grib_accessor_class_data_ccsds_packing.c */
+int accessor_data_ccsds_packing_clone_state(grib_accessor* a, grib_accessor* clone);
 
 /* grib_accessor_class_count_missing.c */
 
@@ -610,6 +623,7 @@ second_order_packed* grib_get_second_order_groups(grib_context* c, const unsigne
 
 /* grib_accessor_class_variable.c */
 void accessor_variable_set_type(grib_accessor* a, int type);
+int accessor_variable_clone_state(grib_accessor* a, grib_accessor* clone);
 
 /* grib_accessor_class_second_order_bits_per_value.c */
 
@@ -686,6 +700,7 @@ bufr_descriptors_array* grib_accessor_class_expanded_descriptors_get_expanded(gr
 /* grib_accessor_class_transient_darray.c */
 
 /* grib_accessor_class_md5.c */
+int accessor_md5_clone_state(grib_accessor* a, grib_accessor* clone);
 
 /* grib_jasper_encoding.c */
 int grib_jasper_decode(grib_context* c, unsigned char* buf, size_t* buflen, double* values, size_t* no_values);
@@ -800,8 +815,10 @@ void grib_get_reduced_row(long pl, double lon_first, double lon_last, long* npoi
 void grib_get_reduced_row_p(long pl, double lon_first, double lon_last, long* npoints, double* olon_first, double* olon_last);
 
 /* grib_accessor_class_abstract_vector.c */
+int accessor_abstract_vector_clone_state(grib_accessor* a, grib_accessor* clone);
 
 /* grib_accessor_class_abstract_long_vector.c */
+int accessor_abstract_long_vector_clone_state(grib_accessor* a, grib_accessor* clone);
 
 /* grib_loader_from_handle.c */
 int grib_lookup_long_from_handle(grib_context* gc, grib_loader* loader, const char* name, long* value);
@@ -816,6 +833,15 @@ int grib_get_bit(const unsigned char* p, long bitp);
 void grib_set_bit(unsigned char* p, long bitp, int val);
 long grib_decode_signed_longb(const unsigned char* p, long* bitp, long nbits);
 int grib_encode_signed_longb(unsigned char* p, long val, long* bitp, long nb);
+void grib_minmax_double_array(const double* val, size_t n_vals, double* min, double* max);
+void grib_decode_array_threaded(grib_context* c, const unsigned char* p, long* bitp, long bits_per_value, double reference_value, double s, double d, size_t n_vals, double* dval, float* fval);
+int grib_encode_double_array_threaded(grib_context* c, size_t n_vals, const double* val, long bits_per_value, double reference_value, double d, double divisor, unsigned char* p, long* off);
+
+/* grib_thread_pool.c */
+void grib_thread_pool_run(grib_context* c, int ntasks, grib_thread_pool_proc proc, void* data);
+void grib_thread_pool_delete(grib_context* c);
+int grib_thread_pool_ntasks(grib_context* c, size_t n_vals);
+void grib_thread_pool_range(size_t n_vals, size_t grain, int k, int ntasks, size_t* begin, size_t* end);
 
 /* grib_timer.c */
 double proc_cpu(void);
@@ -972,6 +998,8 @@ void codes_bufr_multi_element_constant_arrays_on(grib_context* c);
 void codes_bufr_multi_element_constant_arrays_off(grib_context* c);
 void grib_context_set_definitions_path(grib_context* c, const char* path);
 void grib_context_set_samples_path(grib_context* c, const char* path);
+void grib_context_set_threads(grib_context* c, int threads);
+void grib_context_set_values_cache_size(grib_context* c, size_t size);
 void* grib_context_malloc_persistent(const grib_context* c, size_t size);
 char* grib_context_strdup_persistent(const grib_context* c, const char* s);
 void* grib_context_malloc_clear_persistent(const grib_context* c, size_t size);
@@ -1066,6 +1094,7 @@ grib_handle* codes_grib_handle_new_from_file(grib_context* c, FILE* f, int* erro
 grib_handle* codes_bufr_handle_new_from_file(grib_context* c, FILE* f, int* error);
 grib_handle* codes_metar_handle_new_from_file(grib_context* c, FILE* f, int* error);
 grib_handle* codes_gts_handle_new_from_file(grib_context* c, FILE* f, int* error);
+grib_handle* codes_handle_new_from_mapped_file(grib_context* c, grib_mapped_file* mf, ProductKind product, int* error);
 grib_handle* grib_handle_new_from_message_copy(grib_context* c, const void* data, size_t size);
 grib_handle* grib_handle_new_from_partial_message_copy(grib_context* c, const void* data, size_t size);
 grib_handle* grib_handle_new_from_partial_message(grib_context* c, const void* data, size_t buflen);
@@ -1091,6 +1120,8 @@ int codes_check_message_header(const void* bytes, size_t length, ProductKind pro
 int codes_check_message_footer(const void* bytes, size_t length, ProductKind product);
 int grib_get_message_size(const grib_handle* h, size_t* size);
 int grib_get_message(const grib_handle* h, const void** msg, size_t* size);
+int grib_handle_begin_update(grib_handle* h);
+int grib_handle_commit_update(grib_handle* h);
 int grib_get_message_headers(grib_handle* h, const void** msg, size_t* size);
 grib_handle* grib_handle_new(grib_context* c);
 grib_action* grib_action_from_filter(const char* filter);
@@ -1099,6 +1130,31 @@ int grib_handle_prepare_action(grib_handle* h, grib_action* a);
 void grib_multi_support_reset_file(grib_context* c, FILE* f);
 void grib_multi_support_reset(grib_context* c);
 
+/* grib_handle_arena.c */
+void* grib_handle_malloc_clear(grib_handle* h, size_t size);
+void grib_handle_free(grib_context* c, void* p);
+void grib_arena_delete(grib_arena* arena);
+
+/* grib_handle_clone.c */
+grib_handle* grib_handle_clone_shared(const grib_handle* h);
+
+/* grib_values_cache.c */
+int grib_values_cache_get(const grib_accessor* a, double* val, size_t* len);
+int grib_values_cache_get_float(const grib_accessor* a, float* val, size_t* len);
+int grib_values_cache_get_element(const grib_accessor* a, size_t i, double* val);
+void grib_values_cache_put(const grib_accessor* a, const double* val, size_t len);
+void grib_values_cache_clear(grib_handle* h);
+void grib_values_cache_resize(grib_context* c, size_t size);
+void grib_values_cache_delete(grib_context* c);
+
+/* grib_ccsds.c */
+void grib_ccsds_rsi_index_delete(grib_context* c, grib_ccsds_rsi_index* index);
+int grib_ccsds_index_rsis(grib_context* c, grib_ccsds_rsi_index** pindex, const grib_ccsds_params* p, const unsigned char* data, size_t len, size_t n_vals);
+int grib_ccsds_decode_rsi(const grib_ccsds_rsi_index* index, size_t r, uint32_t* samples, size_t* n);
+int grib_ccsds_decode_sample(grib_context* c, grib_ccsds_rsi_index** pindex, const grib_ccsds_params* p, const unsigned char* data, size_t len, size_t n_vals, size_t i, uint32_t* sample);
+int grib_ccsds_stream_bits(const grib_ccsds_params* p, const unsigned char* data, size_t len, size_t n_vals, size_t* bits);
+size_t grib_ccsds_encode_start(const grib_ccsds_params* p, const unsigned char* samples, size_t nbytes, size_t first);
+
 /* grib_header_compute.c */
 void print_math(grib_math* m);
 grib_math* grib_math_clone(grib_context* c, grib_math* m);
@@ -1135,9 +1191,65 @@ int grib_read_any_headers_only_from_file(grib_context* ctx, FILE* f, void* buffe
 int grib_read_any_from_file(grib_context* ctx, FILE* f, void* buffer, size_t* len);
 int grib_read_any_from_memory_alloc(grib_context* ctx, unsigned char** data, size_t* data_length, void** buffer, size_t* length);
 int grib_read_any_from_memory(grib_context* ctx, unsigned char** data, size_t* data_length, void* buffer, size_t* len);
+grib_mapped_file* codes_mapped_file_open(grib_context* c, const char* filename, int* err);
+grib_mapped_file* grib_mapped_file_hold_buffer(grib_context* c, grib_buffer* b);
+void grib_mapped_file_unshare_buffer(grib_mapped_file* mf, grib_buffer* b);
+void grib_mapped_file_acquire(grib_mapped_file* mf);
+void grib_mapped_file_release(grib_mapped_file* mf);
+void codes_mapped_file_close(grib_mapped_file* mf);
+void codes_mapped_file_rewind(grib_mapped_file* mf);
+int grib_mapped_file_next_message(grib_mapped_file* mf, ProductKind product, unsigned char** msg, size_t* size, off_t* offset);
+int grib_mapped_file_scan(grib_mapped_file* mf, ProductKind product, int nthreads, off_t** offsets, size_t** lengths, long* count);
+int grib_scan_any_from_file(FILE* f, off_t* offset, size_t* length);
+int grib_scan_file(grib_context* c, const char* filename, ProductKind product, int nthreads, off_t** offsets, size_t** lengths, long* count);
 int grib_count_in_file(grib_context* c, FILE* f, int* n);
 int grib_count_in_filename(grib_context* c, const char* filename, int* n);
 
+/* grib_offset_index.c */
+grib_offset_index* grib_offset_index_new(grib_context* c, const char* filename, int build, int* err);
+long grib_offset_index_count(const grib_offset_index* oi);
+int grib_offset_index_get(const grib_offset_index* oi, long n, off_t* offset, size_t* length, long* edition, ProductKind* product);
+void grib_offset_index_delete(grib_offset_index* oi);
+void grib_offset_index_forget(grib_context* c);
+int codes_offset_index_build(grib_context* c, const char* filename);
+grib_handle* codes_handle_new_from_file_at(grib_context* c, const char* filename, long n, int* error);
+
+/* grib_definitions_snapshot.c */
+void grib_snapshot_write_long(grib_snapshot_writer* w, long val);
+void grib_snapshot_write_double(grib_snapshot_writer* w, double val);
+void grib_snapshot_write_string(grib_snapshot_writer* w, const char* val);
+void grib_snapshot_write_expression(grib_snapshot_writer* w, grib_expression* e);
+void grib_snapshot_write_arguments(grib_snapshot_writer* w, grib_arguments* args);
+void grib_snapshot_write_actions(grib_snapshot_writer* w, grib_action* actions);
+void grib_snapshot_write_cases(grib_snapshot_writer* w, grib_case* cases);
+void grib_snapshot_write_iarray(grib_snapshot_writer* w, grib_iarray* v);
+void grib_snapshot_write_darray(grib_snapshot_writer* w, grib_darray* v);
+void grib_snapshot_write_sarray(grib_snapshot_writer* w, grib_sarray* v);
+void grib_snapshot_write_concept(grib_snapshot_writer* w, grib_concept_value* concept);
+void grib_snapshot_write_hash_array(grib_snapshot_writer* w, grib_hash_array_value* hash_array);
+int grib_snapshot_read_failed(const grib_snapshot_reader* r);
+long grib_snapshot_read_long(grib_snapshot_reader* r);
+double grib_snapshot_read_double(grib_snapshot_reader* r);
+const char* grib_snapshot_read_string(grib_snapshot_reader* r);
+grib_expression* grib_snapshot_read_expression(grib_snapshot_reader* r);
+grib_arguments* grib_snapshot_read_arguments(grib_snapshot_reader* r);
+grib_action* grib_snapshot_read_actions(grib_snapshot_reader* r);
+grib_case* grib_snapshot_read_cases(grib_snapshot_reader* r);
+grib_iarray* grib_snapshot_read_iarray(grib_snapshot_reader* r);
+grib_darray* grib_snapshot_read_darray(grib_snapshot_reader* r);
+grib_sarray* grib_snapshot_read_sarray(grib_snapshot_reader* r);
+grib_concept_value* grib_snapshot_read_concept(grib_snapshot_reader* r);
+grib_hash_array_value* grib_snapshot_read_hash_array(grib_snapshot_reader* r);
+grib_definitions_snapshot* grib_definitions_snapshot_open(grib_context* c, const char* filename);
+void grib_definitions_snapshot_close(grib_context* c);
+grib_action* grib_definitions_snapshot_actions(grib_context* c, const char* filename);
+grib_concept_value* grib_definitions_snapshot_concept(grib_context* c, const char* filename);
+grib_hash_array_value* grib_definitions_snapshot_hash_array(grib_context* c, const char* filename);
+grib_snapshot_writer* grib_snapshot_writer_new(grib_context* c);
+void grib_snapshot_writer_delete(grib_snapshot_writer* w);
+int grib_snapshot_writer_add_file(grib_snapshot_writer* w, const char* filename);
+int grib_snapshot_writer_save(grib_snapshot_writer* w, const char* filename);
+
 /* grib_trie.c */
 grib_trie* grib_trie_new(grib_context* c);
 void grib_trie_delete_container(grib_trie* t);
@@ -1203,15 +1315,31 @@ grib_concept_value* grib_parse_concept_file(grib_context* gc, const char* filena
 grib_hash_array_value* grib_parse_hash_array_file(grib_context* gc, const char* filename);
 grib_rule* grib_parse_rules_file(grib_context* gc, const char* filename);
 grib_action* grib_parse_file(grib_context* gc, const char* filename);
+int grib_parse_definition_file(grib_context* gc, const char* filename, grib_action** actions, grib_concept_value** concept, grib_hash_array_value** hash_array);
 int grib_type_to_int(char id);
 
 /* grib_query.c */
+grib_accessor* grib_handle_get_accessor_by_id(const grib_handle* h, int id);
+void grib_handle_set_accessor_by_id(grib_handle* h, int id, grib_accessor* a);
+int grib_handle_copy_accessors_table(grib_handle* h, const grib_handle* src, grib_accessor* (*map)(void*, const grib_accessor*), void* data);
+void grib_handle_delete_accessors_table(grib_handle* h);
+void grib_handle_update_accessors_table(grib_handle* h, grib_section* removed, grib_section* added);
 grib_accessors_list* grib_find_accessors_list(const grib_handle* h, const char* name);
+grib_key_id* grib_key_compile(grib_context* c, const char* name, int* err);
+void grib_key_delete(grib_key_id* k);
+grib_accessor* grib_find_accessor_by_key_id(const grib_handle* ch, const grib_key_id* k);
 char* grib_split_name_attribute(grib_context* c, const char* name, char* attribute_name);
+grib_accessor* grib_find_accessor_as_built(const grib_handle* h, const char* name);
 grib_accessor* grib_find_accessor(const grib_handle* h, const char* name);
 grib_accessor* grib_find_attribute(grib_handle* h, const char* name, const char* attr_name, int* err);
 grib_accessor* grib_find_accessor_fast(grib_handle* h, const char* name);
 
+/* grib_key_plan.c */
+void grib_key_plan_delete(grib_key_plan* p);
+grib_key_plan* grib_key_plan_new(grib_context* c, const char** keys, const int* types, size_t nkeys, size_t string_length, int* err);
+size_t grib_key_plan_size(const grib_key_plan* p);
+int grib_key_plan_execute(grib_key_plan* p, const grib_handle* h, void** columns, size_t row, int* errors);
+
 /* grib_scaling.c */
 double grib_power(long s, long n);
 long grib_get_binary_scale_fact(double max, double min, long bpval, int* ret);
@@ -1230,6 +1358,7 @@ void grib_dependency_add(grib_accessor* observer, grib_accessor* observed);
 void grib_dependency_remove_observed(grib_accessor* observed);
 int _grib_dependency_notify_change(grib_handle* h, grib_accessor* observed);
 int grib_dependency_notify_change(grib_accessor* observed);
+int grib_dependency_triggers_reparse(grib_accessor* observed);
 void grib_dependency_remove_observer(grib_accessor* observer);
 void grib_dependency_observe_expression(grib_accessor* observer, grib_expression* e);
 void grib_dependency_observe_arguments(grib_accessor* observer, grib_arguments* a);
@@ -1260,6 +1389,7 @@ int grib_set_flag(grib_handle* h, const char* name, unsigned long flag);
 int grib_set_double_array_internal(grib_handle* h, const char* name, const double* val, size_t length);
 int grib_set_force_double_array(grib_handle* h, const char* name, const double* val, size_t length);
 int grib_set_double_array(grib_handle* h, const char* name, const double* val, size_t length);
+int grib_set_float_array(grib_handle* h, const char* name, const float* val, size_t length);
 int grib_set_long_array_internal(grib_handle* h, const char* name, const long* val, size_t length);
 int grib_set_long_array(grib_handle* h, const char* name, const long* val, size_t length);
 int grib_get_long_internal(grib_handle* h, const char* name, long* val);
@@ -1270,6 +1400,7 @@ int grib_get_double_internal(grib_handle* h, const char* name, double* val);
 int grib_get_double(const grib_handle* h, const char* name, double* val);
 int grib_get_double_element_internal(grib_handle* h, const char* name, int i, double* val);
 int grib_get_double_element(const grib_handle* h, const char* name, int i, double* val);
+int grib_get_double_element_set(const grib_handle* h, const char* name, const size_t* index_array, size_t len, double* val_array);
 int grib_points_get_values(grib_handle* h, grib_points* points, double* val);
 int grib_get_double_elements(const grib_handle* h, const char* name, int* index_array, long len, double* val_array);
 int grib_get_string_internal(grib_handle* h, const char* name, char* val, size_t* length);
@@ -1281,6 +1412,7 @@ const char* grib_get_accessor_class_name(grib_handle* h, const char* name);
 int _grib_get_double_array_internal(const grib_handle* h, grib_accessor* a, double* val, size_t buffer_len, size_t* decoded_length);
 int grib_get_double_array_internal(const grib_handle* h, const char* name, double* val, size_t* length);
 int grib_get_double_array(const grib_handle* h, const char* name, double* val, size_t* length);
+int grib_get_float_array(const grib_handle* h, const char* name, float* val, size_t* length);
 int _grib_get_string_length(grib_accessor* a, size_t* size);
 int grib_get_string_length(const grib_handle* h, const char* name, size_t* size);
 int _grib_get_size(const grib_handle* h, grib_accessor* a, size_t* size);
@@ -1293,6 +1425,13 @@ int grib_get_string_array(const grib_handle* h, const char* name, char** val, si
 int _grib_get_long_array_internal(const grib_handle* h, grib_accessor* a, long* val, size_t buffer_len, size_t* decoded_length);
 int grib_get_long_array_internal(grib_handle* h, const char* name, long* val, size_t* length);
 int grib_get_long_array(const grib_handle* h, const char* name, long* val, size_t* length);
+int grib_get_long_by_id(const grib_handle* h, const grib_key_id* k, long* val);
+int grib_get_double_by_id(const grib_handle* h, const grib_key_id* k, double* val);
+int grib_get_string_by_id(const grib_handle* h, const grib_key_id* k, char* val, size_t* length);
+int grib_get_size_by_id(const grib_handle* h, const grib_key_id* k, size_t* size);
+int grib_get_long_array_by_id(const grib_handle* h, const grib_key_id* k, long* val, size_t* length);
+int grib_get_double_array_by_id(const grib_handle* h, const grib_key_id* k, double* val, size_t* length);
+int grib_get_float_array_by_id(const grib_handle* h, const grib_key_id* k, float* val, size_t* length);
 grib_key_value_list* grib_key_value_list_clone(grib_context* c, grib_key_value_list* list);
 void grib_key_value_list_delete(grib_context* c, grib_key_value_list* kvl);
 int grib_get_key_value_list(grib_handle* h, grib_key_value_list* list);
@@ -1461,6 +1600,7 @@ grib_expression* grib_arguments_get_expression(grib_handle* h, grib_arguments* a
 double normalise_longitude_in_degrees(double lon);
 char get_dir_separator_char(void);
 int path_is_directory(const char* filename);
+int path_is_regular_file(const char* filename);
 char* codes_getenv(const char* name);
 
 /* grib_util.c */
@@ -1532,6 +1672,10 @@ const char* grib_binop_long_proc_name(grib_binop_long_proc proc);
 const char* grib_binop_double_proc_name(grib_binop_double_proc proc);
 const char* grib_unop_long_proc_name(grib_unop_long_proc proc);
 const char* grib_unop_double_proc_name(grib_unop_double_proc proc);
+grib_binop_long_proc grib_binop_long_proc_by_name(const char* name);
+grib_binop_double_proc grib_binop_double_proc_by_name(const char* name);
+grib_unop_long_proc grib_unop_long_proc_by_name(const char* name);
+grib_unop_double_proc grib_unop_double_proc_by_name(const char* name);
 
 /* codes_memfs.c */
 FILE* codes_fopen(const char* name, const char* mode);
@@ -1559,6 +1703,7 @@ int grib_encode_size_tb(unsigned char* p, size_t val, long* bitp, long nb);
 /* grib_bits_any_endian_simple.c */
 int grib_decode_long_array(const unsigned char* p, long* bitp, long bitsPerValue, size_t n_vals, long* val);
 int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerValue, double reference_value, double s, double d, size_t n_vals, double* val);
+int grib_decode_float_array(const unsigned char* p, long* bitp, long bitsPerValue, double reference_value, double s, double d, size_t n_vals, float* val);
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* d, size_t size, double* val);
 int grib_encode_long_array(size_t n_vals, const long* val, long bits_per_value, unsigned char* p, long* off);
 int grib_encode_double_array(size_t n_vals, const double* val, long bits_per_value, double reference_value, double d, double divisor, unsigned char* p, long* off);
@@ -196,3 +196,137 @@ int grib_encode_signed_longb(unsigned char* p, long val, long* bitp, long nb)
 #include "grib_bits_any_endian.c"
 #endif
 #endif
+
+/*
+ * Minimum and maximum of n_vals (at least one) values. A NaN is skipped
+ * unless it is the first value, as in the loop this replaces.
+ */
+void grib_minmax_double_array(const double* val, size_t n_vals, double* min, double* max)
+{
+    size_t i = 0;
+
+    *min = *max = val[0];
+#if GRIB_BITS_SIMD
+    i = minmax_array_simd(val, n_vals, min, max);
+#endif
+    for (; i < n_vals; i++) {
+        if (val[i] > *max)
+            *max = val[i];
+        else if (val[i] < *min)
+            *min = val[i];
+    }
+}
+
+/* Decoding and encoding of simple packing split across the threads of the context */
+
+typedef struct bits_task
+{
+    unsigned char* p;
+    long bits_per_value;
+    double reference_value;
+    double s;
+    double d;
+    double divisor;
+    size_t n_vals;
+    const double* val;
+    double* dval;
+    float* fval;
+} bits_task;
+
+static void decode_task(void* data, int k, int ntasks)
+{
+    const bits_task* t = (const bits_task*)data;
+    size_t begin = 0, end = 0;
+    long pos = 0;
+
+    grib_thread_pool_range(t->n_vals, 8, k, ntasks, &begin, &end);
+    if (begin == end)
+        return;
+    /* Eight values are a whole number of bytes */
+    if (t->fval)
+        grib_decode_float_array(t->p + begin / 8 * t->bits_per_value, &pos, t->bits_per_value,
+                                t->reference_value, t->s, t->d, end - begin, t->fval + begin);
+    else
+        grib_decode_double_array(t->p + begin / 8 * t->bits_per_value, &pos, t->bits_per_value,
+                                 t->reference_value, t->s, t->d, end - begin, t->dval + begin);
+}
+
+/*
+ * As grib_decode_double_array or grib_decode_float_array, into dval or fval
+ * (exactly one is set). The split is only done when *bitp is on a byte boundary.
+ */
+void grib_decode_array_threaded(grib_context* c, const unsigned char* p, long* bitp, long bits_per_value,
+                                double reference_value, double s, double d,
+                                size_t n_vals, double* dval, float* fval)
+{
+    bits_task t;
+    int ntasks = grib_thread_pool_ntasks(c, n_vals);
+
+    if (ntasks <= 1 || *bitp % 8) {
+        if (fval)
+            grib_decode_float_array(p, bitp, bits_per_value, reference_value, s, d, n_vals, fval);
+        else
+            grib_decode_double_array(p, bitp, bits_per_value, reference_value, s, d, n_vals, dval);
+        return;
+    }
+
+    /* The byte aligned decoder always starts at p */
+    t.p               = (unsigned char*)((bits_per_value % 8) ? p + *bitp / 8 : p);
+    t.bits_per_value  = bits_per_value;
+    t.reference_value = reference_value;
+    t.s               = s;
+    t.d               = d;
+    t.divisor         = 0;
+    t.n_vals          = n_vals;
+    t.val             = NULL;
+    t.dval            = dval;
+    t.fval            = fval;
+    grib_thread_pool_run(c, ntasks, &decode_task, &t);
+
+    if (bits_per_value % 8)
+        *bitp += n_vals * bits_per_value;
+}
+
+static void encode_task(void* data, int k, int ntasks)
+{
+    const bits_task* t = (const bits_task*)data;
+    size_t begin = 0, end = 0;
+    long off = 0;
+
+    grib_thread_pool_range(t->n_vals, 8, k, ntasks, &begin, &end);
+    if (begin == end)
+        return;
+    grib_encode_double_array(end - begin, t->val + begin, t->bits_per_value, t->reference_value, t->d, t->divisor,
+                             t->p + begin / 8 * t->bits_per_value, &off);
+}
+
+/*
+ * As grib_encode_double_array. The split is only done when *off is on a byte
+ * boundary, which is always the case for the buffers of the packing accessors.
+ */
+int grib_encode_double_array_threaded(grib_context* c, size_t n_vals, const double* val, long bits_per_value,
+                                      double reference_value, double d, double divisor,
+                                      unsigned char* p, long* off)
+{
+    bits_task t;
+    int ntasks = grib_thread_pool_ntasks(c, n_vals);
+
+    if (ntasks <= 1 || *off % 8)
+        return grib_encode_double_array(n_vals, val, bits_per_value, reference_value, d, divisor, p, off);
+
+    /* The byte aligned encoder always starts at p */
+    t.p               = (bits_per_value % 8) ? p + *off / 8 : p;
+    t.bits_per_value  = bits_per_value;
+    t.reference_value = reference_value;
+    t.s               = 0;
+    t.d               = d;
+    t.divisor         = divisor;
+    t.n_vals          = n_vals;
+    t.val             = val;
+    t.dval            = NULL;
+    t.fval            = NULL;
+    grib_thread_pool_run(c, ntasks, &encode_task, &t);
+
+    *off += n_vals * bits_per_value;
+    return GRIB_SUCCESS;
+}
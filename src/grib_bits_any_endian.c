@@ -422,5 +422,6 @@ int grib_encode_size_tb(unsigned char* p, size_t val, long* bitp, long nb)
 #elif VECTOR
 #include "grib_bits_any_endian_vector.c"
 #else
+#include "grib_bits_any_endian_simd.c"
 #include "grib_bits_any_endian_simple.c"
 #endif
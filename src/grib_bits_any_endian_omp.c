@@ -136,6 +136,64 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerVal
     return 0;
 }
 
+/**
+ * decode an array of n_vals values from an octet-bitstream to float-representation
+ *
+ * @param p input bitstream, for technical reasons put into octets
+ * @param bitp current position in the bitstream
+ * @param bitsPerValue number of bits needed to build a number (e.g. 8=byte, 16=short, 32=int, but also other sizes allowed)
+ * @param n_vals number of values to decode
+ * @param val output, values encoded as 32/64bit numbers
+ */
+int grib_decode_float_array(const unsigned char* p, long* bitp, long bitsPerValue,
+                            double reference_value, double s, double d,
+                            size_t n_vals, float* val)
+{
+    long i               = 0;
+    unsigned long lvalue = 0;
+    double x;
+
+    unsigned long mask = BIT_MASK(bitsPerValue);
+
+    /* pi: position of bitp in p[]. >>3 == /8 */
+    long pi = *bitp / 8;
+    /* some bits might of the current byte at pi might be used */
+    /* by the previous number usefulBitsInByte gives remaining unused bits */
+    /* number of useful bits in current byte */
+    int usefulBitsInByte = 8 - (*bitp & 7);
+    for (i = 0; i < n_vals; i++) {
+        /* value read as long */
+        long bitsToRead = 0;
+        lvalue          = 0;
+        bitsToRead      = bitsPerValue;
+        /* read one byte after the other to lvalue until >= bitsPerValue are read */
+        while (bitsToRead > 0) {
+            lvalue <<= 8;
+            lvalue += p[pi];
+            pi++;
+            bitsToRead -= usefulBitsInByte;
+            usefulBitsInByte = 8;
+        }
+        *bitp += bitsPerValue;
+        /* bitsToRead is now <= 0, remove the last bits */
+        lvalue >>= -1 * bitsToRead;
+        /* set leading bits to 0 - removing bits used for previous number */
+        lvalue &= mask;
+
+        usefulBitsInByte = -1 * bitsToRead; /* prepare for next round */
+        if (usefulBitsInByte > 0) {
+            pi--; /* reread the current byte */
+        }
+        else {
+            usefulBitsInByte = 8; /* start with next full byte */
+        }
+        /* scaling and move value to output */
+        x      = ((lvalue * s) + reference_value) * d;
+        val[i] = (float)x;
+    }
+    return 0;
+}
+
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* d, size_t size, double* val)
 {
     return GRIB_NOT_IMPLEMENTED;
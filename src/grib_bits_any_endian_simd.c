@@ -0,0 +1,564 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * SIMD kernels for simple packing. Decoding does the bit extraction and the
+ * (x*s+R)*d scaling in one pass (or only the extraction, for the integer
+ * arrays of grib_decode_long_array); encoding quantises a group of values in
+ * vector registers and appends the codes straight to the big-endian bit
+ * stream, and the minimum and maximum needed beforehand are found with
+ * vector min/max. The kernel is chosen at run time from the CPU features,
+ * so a generic x86-64 build uses AVX2 or AVX-512 where the machine has it.
+ *
+ * Eight values of width w always take exactly w bytes, so the byte offset and
+ * the shift of each value inside a group are the same for every group. They are
+ * computed once per call and each group costs two (AVX2) or four (AVX-512)
+ * unaligned 16-byte loads, a byte shuffle and two shifts.
+ *
+ * The scaling uses separate multiplies and adds (no FMA) so that the results are
+ * bit-identical to the scalar code.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__PGI) && !defined(__INTEL_COMPILER) && \
+    (__GNUC__ >= 5 || (defined(__clang__) && __clang_major__ >= 4))
+#define GRIB_BITS_SIMD 1
+#else
+#define GRIB_BITS_SIMD 0
+#endif
+
+#if GRIB_BITS_SIMD
+
+#include <immintrin.h>
+
+/* A value of up to 25 bits starting anywhere in a byte fits in 4 bytes */
+#define SIMD_MAX_BITS 25
+/* Not worth setting up the shuffles for fewer values */
+#define SIMD_MIN_VALUES 64
+/* Without the scaling the shuffles pay off sooner, e.g. for the groups of second order packing */
+#define SIMD_MIN_LONG_VALUES 16
+
+enum
+{
+    SIMD_UNKNOWN = -1,
+    SIMD_NONE    = 0,
+    SIMD_AVX2,
+    SIMD_AVX512
+};
+
+static int simd_level = SIMD_UNKNOWN;
+
+static int simd_detect()
+{
+    if (simd_level == SIMD_UNKNOWN) {
+        /* Racing threads all store the same answer */
+        int level = SIMD_NONE;
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            level = SIMD_AVX2;
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            level = SIMD_AVX512;
+        simd_level = level;
+    }
+    return simd_level;
+}
+
+/*
+ * Shuffle control and shifts for the four values of a 128-bit lane.
+ * The lane is loaded from byte (first_bit >> 3); value j starts at
+ * first_bit + j * nbits. Each dword gets the 4 bytes holding its value in
+ * big-endian order so that the value can be moved into place with shifts.
+ */
+static void simd_lane_setup(long first_bit, long nbits, unsigned char* shuffle, unsigned int* shift)
+{
+    long base = first_bit >> 3;
+    int j, k;
+    for (j = 0; j < 4; j++) {
+        long bit   = first_bit + j * nbits - 8 * base;
+        long start = bit >> 3;
+        for (k = 0; k < 4; k++)
+            shuffle[4 * j + k] = (unsigned char)(start + 3 - k);
+        shift[j] = (unsigned int)(bit & 7);
+    }
+}
+
+/* The eight values at q (lane 0) and q + lane1 (lane 1) as 32-bit integers */
+__attribute__((target("avx2"))) static inline __m256i simd_extract_avx2(const unsigned char* q, long lane1,
+                                                                      __m256i vshuffle, __m256i vshift, __m128i vright)
+{
+    __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)q)),
+                                        _mm_loadu_si128((const __m128i*)(q + lane1)), 1);
+    v         = _mm256_shuffle_epi8(v, vshuffle);
+    return _mm256_srl_epi32(_mm256_sllv_epi32(v, vshift), vright);
+}
+
+__attribute__((target("avx2"))) static size_t simd_decode_avx2(const unsigned char* p, long bitp, long nbits,
+                                                               double reference_value, double s, double d,
+                                                               size_t n_vals, double* dval, float* fval)
+{
+    unsigned char shuffle[32];
+    unsigned int shift[8];
+    long lane1          = ((bitp & 7) + 4 * nbits) >> 3;
+    const size_t nbytes = (((bitp & 7) + n_vals * nbits) + 7) >> 3;
+    const unsigned char* q = p + (bitp >> 3);
+    size_t i = 0, offset = 0;
+    __m256i vshuffle, vshift;
+    __m128i vright;
+    __m256d vs, vr, vd;
+
+    simd_lane_setup(bitp & 7, nbits, shuffle, shift);
+    simd_lane_setup((bitp & 7) + 4 * nbits, nbits, shuffle + 16, shift + 4);
+
+    vshuffle = _mm256_loadu_si256((const __m256i*)shuffle);
+    vshift   = _mm256_loadu_si256((const __m256i*)shift);
+    vright   = _mm_cvtsi32_si128(32 - (int)nbits);
+    vs       = _mm256_set1_pd(s);
+    vr       = _mm256_set1_pd(reference_value);
+    vd       = _mm256_set1_pd(d);
+
+    /* Only whole groups whose loads stay inside the packed data */
+    while (i + 8 <= n_vals && offset + lane1 + 16 <= nbytes) {
+        __m256i v = simd_extract_avx2(q + offset, lane1, vshuffle, vshift, vright);
+        __m256d lo, hi;
+        lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(v));
+        hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1));
+        lo = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(lo, vs), vr), vd);
+        hi = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(hi, vs), vr), vd);
+        if (fval) {
+            _mm_storeu_ps(fval + i, _mm256_cvtpd_ps(lo));
+            _mm_storeu_ps(fval + i + 4, _mm256_cvtpd_ps(hi));
+        }
+        else {
+            _mm256_storeu_pd(dval + i, lo);
+            _mm256_storeu_pd(dval + i + 4, hi);
+        }
+        i += 8;
+        offset += nbits;
+    }
+    return i;
+}
+
+/* The sixteen values of the four lanes starting at q as 32-bit integers */
+__attribute__((target("avx512f,avx512bw"))) static inline __m512i simd_extract_avx512(const unsigned char* q, const long* lane,
+                                                                                    __m512i vshuffle, __m512i vshift, __m128i vright)
+{
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i*)q));
+    v         = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i*)(q + lane[1])), 1);
+    v         = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i*)(q + lane[2])), 2);
+    v         = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i*)(q + lane[3])), 3);
+    v         = _mm512_shuffle_epi8(v, vshuffle);
+    return _mm512_srl_epi32(_mm512_sllv_epi32(v, vshift), vright);
+}
+
+__attribute__((target("avx512f,avx512bw"))) static size_t simd_decode_avx512(const unsigned char* p, long bitp, long nbits,
+                                                                             double reference_value, double s, double d,
+                                                                             size_t n_vals, double* dval, float* fval)
+{
+    unsigned char shuffle[64];
+    unsigned int shift[16];
+    long lane[4];
+    const size_t nbytes = (((bitp & 7) + n_vals * nbits) + 7) >> 3;
+    const unsigned char* q = p + (bitp >> 3);
+    size_t i = 0, offset = 0;
+    __m512i vshuffle, vshift;
+    __m128i vright;
+    __m512d vs, vr, vd;
+    int k;
+
+    for (k = 0; k < 4; k++) {
+        lane[k] = ((bitp & 7) + 4 * k * nbits) >> 3;
+        simd_lane_setup((bitp & 7) + 4 * k * nbits, nbits, shuffle + 16 * k, shift + 4 * k);
+    }
+
+    vshuffle = _mm512_loadu_si512((const void*)shuffle);
+    vshift   = _mm512_loadu_si512((const void*)shift);
+    vright   = _mm_cvtsi32_si128(32 - (int)nbits);
+    vs       = _mm512_set1_pd(s);
+    vr       = _mm512_set1_pd(reference_value);
+    vd       = _mm512_set1_pd(d);
+
+    /* Sixteen values take 2 * nbits bytes */
+    while (i + 16 <= n_vals && offset + lane[3] + 16 <= nbytes) {
+        __m512i v = simd_extract_avx512(q + offset, lane, vshuffle, vshift, vright);
+        __m512d lo, hi;
+        lo = _mm512_cvtepi32_pd(_mm512_castsi512_si256(v));
+        hi = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1));
+        lo = _mm512_mul_pd(_mm512_add_pd(_mm512_mul_pd(lo, vs), vr), vd);
+        hi = _mm512_mul_pd(_mm512_add_pd(_mm512_mul_pd(hi, vs), vr), vd);
+        if (fval) {
+            _mm256_storeu_ps(fval + i, _mm512_cvtpd_ps(lo));
+            _mm256_storeu_ps(fval + i + 8, _mm512_cvtpd_ps(hi));
+        }
+        else {
+            _mm512_storeu_pd(dval + i, lo);
+            _mm512_storeu_pd(dval + i + 8, hi);
+        }
+        i += 16;
+        offset += 2 * nbits;
+    }
+    return i;
+}
+
+/*
+ * Decode as many of the n_vals values starting at bit bitp of p as the best
+ * available kernel can, into dval or fval (exactly one is set).
+ * Returns how many values were decoded; the caller finishes the tail.
+ */
+static size_t decode_array_simd(const unsigned char* p, long bitp, long nbits,
+                                double reference_value, double s, double d,
+                                size_t n_vals, double* dval, float* fval)
+{
+    if (nbits < 1 || nbits > SIMD_MAX_BITS || n_vals < SIMD_MIN_VALUES)
+        return 0;
+
+    switch (simd_detect()) {
+        case SIMD_AVX512:
+            return simd_decode_avx512(p, bitp, nbits, reference_value, s, d, n_vals, dval, fval);
+        case SIMD_AVX2:
+            return simd_decode_avx2(p, bitp, nbits, reference_value, s, d, n_vals, dval, fval);
+        default:
+            return 0;
+    }
+}
+
+/* As simd_decode_avx2, without the scaling: the values are stored as they are */
+__attribute__((target("avx2"))) static size_t simd_decode_long_avx2(const unsigned char* p, long bitp, long nbits,
+                                                                    size_t n_vals, long* val)
+{
+    unsigned char shuffle[32];
+    unsigned int shift[8];
+    long lane1          = ((bitp & 7) + 4 * nbits) >> 3;
+    const size_t nbytes = (((bitp & 7) + n_vals * nbits) + 7) >> 3;
+    const unsigned char* q = p + (bitp >> 3);
+    size_t i = 0, offset = 0;
+    __m256i vshuffle, vshift;
+    __m128i vright;
+
+    simd_lane_setup(bitp & 7, nbits, shuffle, shift);
+    simd_lane_setup((bitp & 7) + 4 * nbits, nbits, shuffle + 16, shift + 4);
+
+    vshuffle = _mm256_loadu_si256((const __m256i*)shuffle);
+    vshift   = _mm256_loadu_si256((const __m256i*)shift);
+    vright   = _mm_cvtsi32_si128(32 - (int)nbits);
+
+    while (i + 8 <= n_vals && offset + lane1 + 16 <= nbytes) {
+        __m256i v = simd_extract_avx2(q + offset, lane1, vshuffle, vshift, vright);
+        _mm256_storeu_si256((__m256i*)(val + i), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256((__m256i*)(val + i + 4), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+        i += 8;
+        offset += nbits;
+    }
+    return i;
+}
+
+__attribute__((target("avx512f,avx512bw"))) static size_t simd_decode_long_avx512(const unsigned char* p, long bitp, long nbits,
+                                                                                  size_t n_vals, long* val)
+{
+    unsigned char shuffle[64];
+    unsigned int shift[16];
+    long lane[4];
+    const size_t nbytes = (((bitp & 7) + n_vals * nbits) + 7) >> 3;
+    const unsigned char* q = p + (bitp >> 3);
+    size_t i = 0, offset = 0;
+    __m512i vshuffle, vshift;
+    __m128i vright;
+    int k;
+
+    for (k = 0; k < 4; k++) {
+        lane[k] = ((bitp & 7) + 4 * k * nbits) >> 3;
+        simd_lane_setup((bitp & 7) + 4 * k * nbits, nbits, shuffle + 16 * k, shift + 4 * k);
+    }
+
+    vshuffle = _mm512_loadu_si512((const void*)shuffle);
+    vshift   = _mm512_loadu_si512((const void*)shift);
+    vright   = _mm_cvtsi32_si128(32 - (int)nbits);
+
+    while (i + 16 <= n_vals && offset + lane[3] + 16 <= nbytes) {
+        __m512i v = simd_extract_avx512(q + offset, lane, vshuffle, vshift, vright);
+        _mm512_storeu_si512((void*)(val + i), _mm512_cvtepu32_epi64(_mm512_castsi512_si256(v)));
+        _mm512_storeu_si512((void*)(val + i + 8), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+        i += 16;
+        offset += 2 * nbits;
+    }
+    return i;
+}
+
+/*
+ * Decode as many of the n_vals values starting at bit bitp of p into val as
+ * the best available kernel can, for grib_decode_long_array. The kernels
+ * widen to 64 bits, so nothing is done where a long is shorter.
+ * Returns how many values were decoded; the caller finishes the tail.
+ */
+static size_t decode_long_array_simd(const unsigned char* p, long bitp, long nbits, size_t n_vals, long* val)
+{
+    if (sizeof(long) != 8 || nbits < 1 || nbits > SIMD_MAX_BITS || n_vals < SIMD_MIN_LONG_VALUES)
+        return 0;
+
+    switch (simd_detect()) {
+        case SIMD_AVX512:
+            return simd_decode_long_avx512(p, bitp, nbits, n_vals, val);
+        case SIMD_AVX2:
+            return simd_decode_long_avx2(p, bitp, nbits, n_vals, val);
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Big-endian bit stream written 32 bits at a time. Codes are shifted into
+ * acc, which holds nacc pending bits; nbits is at most 31, so acc never
+ * needs more than 63 bits.
+ */
+typedef struct simd_bitstream
+{
+    unsigned char* q;
+    unsigned long long acc;
+    int nacc;
+} simd_bitstream;
+
+static void simd_stream_start(simd_bitstream* s, unsigned char* p, long bitp)
+{
+    s->q    = p + (bitp >> 3);
+    s->nacc = (int)(bitp & 7);
+    /* Keep the bits already in the first byte */
+    s->acc = s->nacc ? (*s->q >> (8 - s->nacc)) : 0;
+}
+
+static void simd_stream_put(simd_bitstream* s, const unsigned int* codes, int n, long nbits)
+{
+    const unsigned int mask = (1u << nbits) - 1;
+    unsigned long long acc  = s->acc;
+    int nacc                = s->nacc;
+    unsigned char* q        = s->q;
+    int k;
+    for (k = 0; k < n; k++) {
+        acc = (acc << nbits) | (codes[k] & mask);
+        nacc += (int)nbits;
+        if (nacc >= 32) {
+            unsigned int w;
+            nacc -= 32;
+            w    = (unsigned int)(acc >> nacc);
+            q[0] = (unsigned char)(w >> 24);
+            q[1] = (unsigned char)(w >> 16);
+            q[2] = (unsigned char)(w >> 8);
+            q[3] = (unsigned char)w;
+            q += 4;
+        }
+    }
+    s->acc  = acc;
+    s->nacc = nacc;
+    s->q    = q;
+}
+
+/* Write out the pending bits, keeping the rest of the last byte */
+static void simd_stream_end(simd_bitstream* s)
+{
+    while (s->nacc >= 8) {
+        s->nacc -= 8;
+        *s->q++ = (unsigned char)(s->acc >> s->nacc);
+    }
+    if (s->nacc) {
+        int r = s->nacc;
+        *s->q = (unsigned char)((s->acc << (8 - r)) & 0xff) | (*s->q & (0xff >> r));
+    }
+}
+
+__attribute__((target("avx2"))) static size_t simd_encode_avx2(const double* val, size_t n_vals, long nbits,
+                                                               double reference_value, double d, double divisor,
+                                                               unsigned char* p, long bitp)
+{
+    unsigned int codes[8];
+    simd_bitstream s;
+    size_t i       = 0;
+    __m256d vd     = _mm256_set1_pd(d);
+    __m256d vr     = _mm256_set1_pd(reference_value);
+    __m256d vdiv   = _mm256_set1_pd(divisor);
+    __m256d vhalf  = _mm256_set1_pd(0.5);
+    __m256d vzero  = _mm256_setzero_pd();
+    __m256d vlimit = _mm256_set1_pd(2147483648.0);
+
+    simd_stream_start(&s, p, bitp);
+    for (; i + 8 <= n_vals; i += 8) {
+        __m256d lo = _mm256_loadu_pd(val + i);
+        __m256d hi = _mm256_loadu_pd(val + i + 4);
+        __m256d ok;
+        lo = _mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(lo, vd), vr), vdiv), vhalf);
+        hi = _mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(hi, vd), vr), vdiv), vhalf);
+        ok = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(lo, vzero, _CMP_GE_OQ), _mm256_cmp_pd(lo, vlimit, _CMP_LT_OQ)),
+                           _mm256_and_pd(_mm256_cmp_pd(hi, vzero, _CMP_GE_OQ), _mm256_cmp_pd(hi, vlimit, _CMP_LT_OQ)));
+        if (_mm256_movemask_pd(ok) != 0xf)
+            break;
+        _mm_storeu_si128((__m128i*)codes, _mm256_cvttpd_epi32(lo));
+        _mm_storeu_si128((__m128i*)(codes + 4), _mm256_cvttpd_epi32(hi));
+        simd_stream_put(&s, codes, 8, nbits);
+    }
+    simd_stream_end(&s);
+    return i;
+}
+
+__attribute__((target("avx512f,avx512bw"))) static size_t simd_encode_avx512(const double* val, size_t n_vals, long nbits,
+                                                                             double reference_value, double d, double divisor,
+                                                                             unsigned char* p, long bitp)
+{
+    unsigned int codes[16];
+    simd_bitstream s;
+    size_t i       = 0;
+    __m512d vd     = _mm512_set1_pd(d);
+    __m512d vr     = _mm512_set1_pd(reference_value);
+    __m512d vdiv   = _mm512_set1_pd(divisor);
+    __m512d vhalf  = _mm512_set1_pd(0.5);
+    __m512d vzero  = _mm512_setzero_pd();
+    __m512d vlimit = _mm512_set1_pd(2147483648.0);
+
+    simd_stream_start(&s, p, bitp);
+    for (; i + 16 <= n_vals; i += 16) {
+        __m512d lo = _mm512_loadu_pd(val + i);
+        __m512d hi = _mm512_loadu_pd(val + i + 8);
+        __mmask8 ok;
+        lo = _mm512_add_pd(_mm512_mul_pd(_mm512_sub_pd(_mm512_mul_pd(lo, vd), vr), vdiv), vhalf);
+        hi = _mm512_add_pd(_mm512_mul_pd(_mm512_sub_pd(_mm512_mul_pd(hi, vd), vr), vdiv), vhalf);
+        ok = _mm512_cmp_pd_mask(lo, vzero, _CMP_GE_OQ) & _mm512_cmp_pd_mask(lo, vlimit, _CMP_LT_OQ) &
+             _mm512_cmp_pd_mask(hi, vzero, _CMP_GE_OQ) & _mm512_cmp_pd_mask(hi, vlimit, _CMP_LT_OQ);
+        if (ok != 0xff)
+            break;
+        _mm256_storeu_si256((__m256i*)codes, _mm512_cvttpd_epi32(lo));
+        _mm256_storeu_si256((__m256i*)(codes + 8), _mm512_cvttpd_epi32(hi));
+        simd_stream_put(&s, codes, 16, nbits);
+    }
+    simd_stream_end(&s);
+    return i;
+}
+
+/*
+ * Encode as many of the n_vals values as the best available kernel can,
+ * starting at bit bitp of p. The bits of p outside the values written are
+ * left alone. Returns how many values were encoded; the caller finishes the tail.
+ */
+static size_t encode_array_simd(const double* val, size_t n_vals, long nbits,
+                                double reference_value, double d, double divisor,
+                                unsigned char* p, long bitp)
+{
+    if (nbits < 1 || nbits > 31 || n_vals < SIMD_MIN_VALUES)
+        return 0;
+
+    switch (simd_detect()) {
+        case SIMD_AVX512:
+            return simd_encode_avx512(val, n_vals, nbits, reference_value, d, divisor, p, bitp);
+        case SIMD_AVX2:
+            return simd_encode_avx2(val, n_vals, nbits, reference_value, d, divisor, p, bitp);
+        default:
+            return 0;
+    }
+}
+
+/*
+ * The NaN handling matches the scalar loop: max_pd/min_pd return their second
+ * operand when either is a NaN, so a NaN value is skipped unless the running
+ * extreme (val[0]) is itself a NaN.
+ */
+__attribute__((target("avx2"))) static size_t simd_minmax_avx2(const double* val, size_t n_vals, double* min, double* max)
+{
+    double lmin[4], lmax[4];
+    __m256d vmin0 = _mm256_set1_pd(*min), vmin1 = vmin0;
+    __m256d vmax0 = _mm256_set1_pd(*max), vmax1 = vmax0;
+    size_t i = 0;
+    int k;
+
+    for (; i + 8 <= n_vals; i += 8) {
+        __m256d v0 = _mm256_loadu_pd(val + i);
+        __m256d v1 = _mm256_loadu_pd(val + i + 4);
+        vmin0      = _mm256_min_pd(v0, vmin0);
+        vmax0      = _mm256_max_pd(v0, vmax0);
+        vmin1      = _mm256_min_pd(v1, vmin1);
+        vmax1      = _mm256_max_pd(v1, vmax1);
+    }
+    _mm256_storeu_pd(lmin, _mm256_min_pd(vmin1, vmin0));
+    _mm256_storeu_pd(lmax, _mm256_max_pd(vmax1, vmax0));
+    for (k = 0; k < 4; k++) {
+        if (lmin[k] < *min)
+            *min = lmin[k];
+        if (lmax[k] > *max)
+            *max = lmax[k];
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) static size_t simd_minmax_avx512(const double* val, size_t n_vals, double* min, double* max)
+{
+    double lmin[8], lmax[8];
+    __m512d vmin0 = _mm512_set1_pd(*min), vmin1 = vmin0;
+    __m512d vmax0 = _mm512_set1_pd(*max), vmax1 = vmax0;
+    size_t i = 0;
+    int k;
+
+    for (; i + 16 <= n_vals; i += 16) {
+        __m512d v0 = _mm512_loadu_pd(val + i);
+        __m512d v1 = _mm512_loadu_pd(val + i + 8);
+        vmin0      = _mm512_min_pd(v0, vmin0);
+        vmax0      = _mm512_max_pd(v0, vmax0);
+        vmin1      = _mm512_min_pd(v1, vmin1);
+        vmax1      = _mm512_max_pd(v1, vmax1);
+    }
+    _mm512_storeu_pd(lmin, _mm512_min_pd(vmin1, vmin0));
+    _mm512_storeu_pd(lmax, _mm512_max_pd(vmax1, vmax0));
+    for (k = 0; k < 8; k++) {
+        if (lmin[k] < *min)
+            *min = lmin[k];
+        if (lmax[k] > *max)
+            *max = lmax[k];
+    }
+    return i;
+}
+
+/*
+ * Fold the first values of val into *min and *max, which the caller has
+ * initialised. Returns how many values were looked at.
+ */
+static size_t minmax_array_simd(const double* val, size_t n_vals, double* min, double* max)
+{
+    if (n_vals < SIMD_MIN_VALUES)
+        return 0;
+
+    switch (simd_detect()) {
+        case SIMD_AVX512:
+            return simd_minmax_avx512(val, n_vals, min, max);
+        case SIMD_AVX2:
+            return simd_minmax_avx2(val, n_vals, min, max);
+        default:
+            return 0;
+    }
+}
+
+#else
+
+static size_t decode_long_array_simd(const unsigned char* p, long bitp, long nbits, size_t n_vals, long* val)
+{
+    return 0;
+}
+
+static size_t decode_array_simd(const unsigned char* p, long bitp, long nbits,
+                                double reference_value, double s, double d,
+                                size_t n_vals, double* dval, float* fval)
+{
+    return 0;
+}
+
+static size_t encode_array_simd(const double* val, size_t n_vals, long nbits,
+                                double reference_value, double d, double divisor,
+                                unsigned char* p, long bitp)
+{
+    return 0;
+}
+
+static size_t minmax_array_simd(const double* val, size_t n_vals, double* min, double* max)
+{
+    return 0;
+}
+
+#endif
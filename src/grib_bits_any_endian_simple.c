@@ -31,13 +31,16 @@ int grib_decode_long_array(const unsigned char* p, long* bitp, long bitsPerValue
                            size_t n_vals, long* val)
 {
     unsigned long mask = BIT_MASK1(bitsPerValue);
+    size_t i           = decode_long_array_simd(p, *bitp, bitsPerValue, n_vals, val);
+    long pi;
+    int usefulBitsInByte;
 
+    *bitp += i * bitsPerValue;
     /* pi: position of bitp in p[]. >>3 == /8 */
-    long pi = *bitp / 8;
-    size_t i;
+    pi = *bitp / 8;
     /* number of useful bits in current byte */
-    int usefulBitsInByte = 8 - (*bitp & 7);
-    for (i = 0; i < n_vals; i++) {
+    usefulBitsInByte = 8 - (*bitp & 7);
+    for (; i < n_vals; i++) {
         /* read at least enough bits (byte by byte) from input */
         long bitsToRead = bitsPerValue;
         long ret        = 0;
@@ -104,10 +107,12 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerVal
     if (bitsPerValue % 8 == 0) {
         /* See ECC-386 */
         int bc;
-        int l    = bitsPerValue / 8;
-        size_t o = 0;
+        int l = bitsPerValue / 8;
+        size_t o;
 
-        for (i = 0; i < n_vals; i++) {
+        i = decode_array_simd(p, 0, bitsPerValue, reference_value, s, d, n_vals, val, NULL);
+        o = i * l;
+        for (; i < n_vals; i++) {
             lvalue = 0;
             lvalue <<= 8;
             lvalue |= p[o++];
@@ -123,14 +128,19 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerVal
     }
     else {
         unsigned long mask = BIT_MASK1(bitsPerValue);
+        long pi;
+        int usefulBitsInByte;
+
+        i = decode_array_simd(p, *bitp, bitsPerValue, reference_value, s, d, n_vals, val, NULL);
+        *bitp += i * bitsPerValue;
 
         /* pi: position of bitp in p[]. >>3 == /8 */
-        long pi = *bitp / 8;
+        pi = *bitp / 8;
         /* some bits might of the current byte at pi might be used */
         /* by the previous number usefulBitsInByte gives remaining unused bits */
         /* number of useful bits in current byte */
-        int usefulBitsInByte = 8 - (*bitp & 7);
-        for (i = 0; i < n_vals; i++) {
+        usefulBitsInByte = 8 - (*bitp & 7);
+        for (; i < n_vals; i++) {
             /* value read as long */
             long bitsToRead = 0;
             lvalue          = 0;
@@ -164,6 +174,88 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerVal
     return 0;
 }
 
+/**
+ * Same as grib_decode_double_array but the values are written as float,
+ * the scaling itself is still done in double precision
+ */
+int grib_decode_float_array(const unsigned char* p, long* bitp, long bitsPerValue,
+                            double reference_value, double s, double d,
+                            size_t n_vals, float* val)
+{
+    long i               = 0;
+    unsigned long lvalue = 0;
+    double x;
+
+    if (bitsPerValue % 8 == 0) {
+        /* See ECC-386 */
+        int bc;
+        int l = bitsPerValue / 8;
+        size_t o;
+
+        i = decode_array_simd(p, 0, bitsPerValue, reference_value, s, d, n_vals, NULL, val);
+        o = i * l;
+        for (; i < n_vals; i++) {
+            lvalue = 0;
+            lvalue <<= 8;
+            lvalue |= p[o++];
+
+            for (bc = 1; bc < l; bc++) {
+                lvalue <<= 8;
+                lvalue |= p[o++];
+            }
+            x      = ((lvalue * s) + reference_value) * d;
+            val[i] = (float)x;
+            /*  *bitp += bitsPerValue * n_vals; */
+        }
+    }
+    else {
+        unsigned long mask = BIT_MASK1(bitsPerValue);
+        long pi;
+        int usefulBitsInByte;
+
+        i = decode_array_simd(p, *bitp, bitsPerValue, reference_value, s, d, n_vals, NULL, val);
+        *bitp += i * bitsPerValue;
+
+        /* pi: position of bitp in p[]. >>3 == /8 */
+        pi = *bitp / 8;
+        /* some bits might of the current byte at pi might be used */
+        /* by the previous number usefulBitsInByte gives remaining unused bits */
+        /* number of useful bits in current byte */
+        usefulBitsInByte = 8 - (*bitp & 7);
+        for (; i < n_vals; i++) {
+            /* value read as long */
+            long bitsToRead = 0;
+            lvalue          = 0;
+            bitsToRead      = bitsPerValue;
+            /* read one byte after the other to lvalue until >= bitsPerValue are read */
+            while (bitsToRead > 0) {
+                lvalue <<= 8;
+                lvalue += p[pi];
+                pi++;
+                bitsToRead -= usefulBitsInByte;
+                usefulBitsInByte = 8;
+            }
+            *bitp += bitsPerValue;
+            /* bitsToRead is now <= 0, remove the last bits */
+            lvalue >>= -1 * bitsToRead;
+            /* set leading bits to 0 - removing bits used for previous number */
+            lvalue &= mask;
+
+            usefulBitsInByte = -1 * bitsToRead; /* prepare for next round */
+            if (usefulBitsInByte > 0) {
+                pi--; /* reread the current byte */
+            }
+            else {
+                usefulBitsInByte = 8; /* start with next full byte */
+            }
+            /* scaling and move value to output */
+            x      = ((lvalue * s) + reference_value) * d;
+            val[i] = (float)x;
+        }
+    }
+    return 0;
+}
+
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* d, size_t size, double* val)
 {
     return GRIB_NOT_IMPLEMENTED;
@@ -203,14 +295,19 @@ int grib_encode_double_array(size_t n_vals, const double* val, long bits_per_val
     unsigned char* encoded     = p;
     double x;
     if (bits_per_value % 8) {
-        for (i = 0; i < n_vals; i++) {
+        i = encode_array_simd(val, n_vals, bits_per_value, reference_value, d, divisor, encoded, *off);
+        *off += i * bits_per_value;
+        for (; i < n_vals; i++) {
             x            = (((val[i] * d) - reference_value) * divisor) + 0.5;
             unsigned_val = (unsigned long)x;
             grib_encode_unsigned_longb(encoded, unsigned_val, off, bits_per_value);
         }
     }
     else {
-        for (i = 0; i < n_vals; i++) {
+        i = encode_array_simd(val, n_vals, bits_per_value, reference_value, d, divisor, encoded, 0);
+        encoded += i * (bits_per_value / 8);
+        *off += i * bits_per_value;
+        for (; i < n_vals; i++) {
             int blen     = 0;
             blen         = bits_per_value;
             x            = ((((val[i] * d) - reference_value) * divisor) + 0.5);
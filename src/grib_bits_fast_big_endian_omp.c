@@ -151,6 +151,75 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long nbits, dou
     return GRIB_SUCCESS;
 }
 
+int grib_decode_float_array(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double d, size_t size, float* val)
+{
+    long i                   = 0;
+    long countOfLeftmostBits = 0, leftmostBits = 0;
+    long startBit, startByte;
+    long remainingBits = nbits;
+    long* pp           = (long*)p;
+    int inited         = 0;
+    unsigned long uval = 0;
+    double fact        = s * d;
+    double bias        = reference_value * d;
+
+    if ((max_nbits % nbits == 0) && (*bitp % nbits == 0)) {
+#pragma omp parallel for schedule(static) firstprivate(inited, pp) private(startBit, countOfLeftmostBits, remainingBits, leftmostBits)
+        for (i = 0; i < size; i++) {
+            if (!inited) {
+                startBit      = *bitp + i * nbits;
+                remainingBits = nbits;
+                if (startBit >= max_nbits) {
+                    pp += startBit / max_nbits;
+                    startBit %= max_nbits;
+                }
+                inited = 1;
+            }
+
+            if (startBit == max_nbits) {
+                startBit = 0;
+                pp++;
+            }
+
+            val[i] = (float)(VALUE(*pp, startBit, remainingBits) * fact + bias);
+            startBit += remainingBits;
+            remainingBits = nbits;
+        }
+    }
+    else {
+#pragma omp parallel for schedule(static) firstprivate(inited, pp) private(startBit, countOfLeftmostBits, remainingBits, leftmostBits)
+        for (i = 0; i < size; i++) {
+            if (!inited) {
+                startBit      = *bitp + i * nbits;
+                remainingBits = nbits;
+                if (startBit >= max_nbits) {
+                    pp += startBit / max_nbits;
+                    startBit %= max_nbits;
+                }
+                inited = 1;
+            }
+
+            countOfLeftmostBits = startBit + remainingBits;
+            if (countOfLeftmostBits > max_nbits) {
+                countOfLeftmostBits = max_nbits - startBit;
+                remainingBits -= countOfLeftmostBits;
+                leftmostBits = (VALUE(*(pp++), startBit, countOfLeftmostBits)) << remainingBits;
+                startBit     = 0;
+            }
+            else
+                leftmostBits = 0;
+
+            val[i] = (float)((leftmostBits + (VALUE(*pp, startBit, remainingBits))) * fact + bias);
+            startBit += remainingBits;
+            remainingBits = nbits;
+        }
+    }
+
+    *bitp += size * nbits;
+
+    return GRIB_SUCCESS;
+}
+
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* d, size_t size, double* val)
 {
     long i                   = 0;
@@ -209,6 +209,104 @@ b:nbits
     return GRIB_SUCCESS;
 }
 
+int grib_decode_float_array(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double d, size_t size, float* val)
+{
+    long countOfLeftmostBits = 0, leftmostBits = 0;
+    long startBit[size], startByte, off;
+    long remainingBits = nbits;
+    long bitpv         = *bitp;
+    int inited         = 0;
+    unsigned long uval = 0;
+    double fact        = s * d;
+    double bias        = reference_value * d;
+    long i             = 0, n;
+    unsigned long* pp  = (unsigned long*)p;
+    unsigned long* x;
+    size_t sizel = (size * nbits) / max_nbits;
+    long vaux[size], vaux2[size], vaux3[size];
+    long imax, j;
+
+    /* (void) ftrace_region_begin("gdda-1"); */
+    if (size * nbits % max_nbits)
+        sizel++;
+
+    x = malloc(sizel * sizeof(unsigned long));
+    Assert(x);
+    memcpy(x, p + bitpv / 8, sizel * sizeof(*x));
+    /* (void) ftrace_region_end  ("gdda-1"); */
+
+    if ((max_nbits % nbits == 0) && (bitpv % nbits == 0)) {
+        /* long GRIB_MASK = -1;        Mask of sword bits
+
+p:x[startBit/max_nbits]
+q:startBit%max_nbits
+b:nbits
+ define VALUE(p,q,b) \
+ (((b)==max_nbits ? GRIB_MASK : ~(GRIB_MASK<<(b))) & ((p)>>(max_nbits-((q)+(b))))) */
+
+        /* (void) ftrace_region_begin("gdda-2"); */
+        for (i = 0; i < size; i++) {
+            /*    startBit=i*nbits ;
+      val[i]=VALUE(x[startBit/max_nbits],startBit%max_nbits,nbits);  */
+            if (nbits == max_nbits)
+                vaux[i] = GRIB_MASK;
+            else
+                vaux[i] = ~(GRIB_MASK << nbits);
+            startBit[i] = i * nbits;
+            vaux3[i]    = max_nbits - (startBit[i] % max_nbits + nbits);
+            vaux2[i]    = x[startBit[i] / max_nbits];
+        }
+        imax = 0;
+        for (i = 0; i < size; i++) {
+            if (vaux3[i] > imax)
+                imax = vaux3[i];
+        }
+        for (j = 1; j <= imax; j++) {
+            for (i = 0; i < size; i++) {
+                if (j <= vaux3[i])
+                    vaux2[i] = vaux2[i] >> 1;
+                /*      vaux2[i]=vaux5[i]>>vaux3[i];
+        vaux2[i]=x[startBit[i]/max_nbits]>>(max_nbits-(startBit[i]%max_nbits+nbits)); */
+            }
+        }
+        for (i = 0; i < size; i++) {
+            val[i] = (float)((vaux[i] & vaux2[i]) * fact + bias);
+        }
+        /* (void) ftrace_region_end  ("gdda-2"); */
+    }
+    else {
+        /* (void) ftrace_region_begin("gdda-3"); */
+        for (i = 0; i < size; i++) {
+            startBit[i] = i * nbits;
+
+            off = startBit[i] / max_nbits;
+            startBit[i] %= max_nbits;
+
+            remainingBits       = nbits;
+            countOfLeftmostBits = startBit[i] + nbits;
+            if (countOfLeftmostBits > max_nbits) {
+                countOfLeftmostBits = max_nbits - startBit[i];
+                remainingBits -= countOfLeftmostBits;
+                leftmostBits = (VALUE(x[off], startBit[i], countOfLeftmostBits)) << remainingBits;
+                off++;
+                startBit[i] = 0;
+            }
+            else
+                leftmostBits = 0;
+
+            val[i] = (float)((leftmostBits + (VALUE(x[off], startBit[i], remainingBits))) * fact + bias);
+        }
+        /* (void) ftrace_region_end  ("gdda-3"); */
+    }
+    /* (void) ftrace_region_begin("gdda-4"); */
+    free(x);
+
+    *bitp += size * nbits;
+    /* (void) ftrace_region_end  ("gdda-4"); */
+
+    return GRIB_SUCCESS;
+}
+
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* restrict d, size_t size, double* restrict val)
 {
     long i                   = 0;
@@ -93,6 +93,50 @@ int grib_decode_double_array(const unsigned char* p, long* bitp, long bitsPerVal
     return 0;
 }
 
+int grib_decode_float_array(const unsigned char* p, long* bitp, long bitsPerValue,
+                            double reference_value, double s, double d,
+                            size_t n_vals, float* val)
+{
+    long i               = 0;
+    unsigned long lvalue = 0;
+    double x;
+
+    if (bitsPerValue % 8) {
+        int j = 0;
+        for (i = 0; i < n_vals; i++) {
+            lvalue = 0;
+            for (j = 0; j < bitsPerValue; j++) {
+                lvalue <<= 1;
+                if (grib_get_bit(p, *bitp))
+                    lvalue += 1;
+                *bitp += 1;
+            }
+            x      = ((lvalue * s) + reference_value) * d;
+            val[i] = (float)x;
+        }
+    }
+    else {
+        int bc;
+        int l    = bitsPerValue / 8;
+        size_t o = 0;
+
+        for (i = 0; i < n_vals; i++) {
+            lvalue = 0;
+            lvalue <<= 8;
+            lvalue |= p[o++];
+
+            for (bc = 1; bc < l; bc++) {
+                lvalue <<= 8;
+                lvalue |= p[o++];
+            }
+            x      = ((lvalue * s) + reference_value) * d;
+            val[i] = (float)x;
+        }
+    }
+
+    return 0;
+}
+
 /* code from grib_bits_fast_big_endian_simple.c */
 int grib_decode_double_array_complex(const unsigned char* p, long* bitp, long nbits, double reference_value, double s, double* d, size_t size, double* val)
 {
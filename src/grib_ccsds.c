@@ -0,0 +1,571 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Decoding of parts of a CCSDS (Adaptive Entropy Coding, CCSDS 121.0-B) stream
+ * as written by libaec, for data_ccsds_packing.
+ *
+ * The stream is a sequence of reference sample intervals (RSIs) of 'rsi'
+ * blocks of 'block_size' samples, each decodable on its own, but which start
+ * at any bit. Where they start is
+ * found by reading the coded blocks without decoding them, and kept in a
+ * grib_ccsds_rsi_index, so that the samples of one RSI can then be decoded
+ * without decoding those before it, and RSIs can be decoded in parallel.
+ *
+ * Only unsigned samples are supported, as in GRIB, and not streams with
+ * padded RSIs (AEC_PAD_RSI), which GRIB does not use: libaec decodes them.
+ */
+
+#include "grib_api_internal.h"
+
+/* The libaec flags, see libaec.h */
+#define CCSDS_DATA_SIGNED 1
+#define CCSDS_DATA_MSB 4
+#define CCSDS_DATA_PREPROCESS 8
+#define CCSDS_RESTRICTED 16
+#define CCSDS_PAD_RSI 32
+
+#define CCSDS_ROS 5      /* zero blocks up to the end of the segment or RSI */
+#define CCSDS_SE_MAX 90  /* largest second extension code */
+
+typedef struct bit_reader
+{
+    const unsigned char* data;
+    size_t len;   /* in bytes */
+    size_t next;  /* next byte to load */
+    uint64_t acc; /* the bits to read, most significant first */
+    int avail;    /* number of bits in acc */
+} bit_reader;
+
+static void refill(bit_reader* br)
+{
+    while (br->avail <= 56) {
+        uint64_t byte = br->next < br->len ? br->data[br->next] : 0;
+        br->acc |= byte << (56 - br->avail);
+        br->next++;
+        br->avail += 8;
+    }
+}
+
+static void reader_init(bit_reader* br, const unsigned char* data, size_t len, size_t bit_offset)
+{
+    br->data  = data;
+    br->len   = len;
+    br->next  = bit_offset / 8;
+    br->acc   = 0;
+    br->avail = 0;
+    refill(br);
+    br->acc <<= bit_offset % 8;
+    br->avail -= (int)(bit_offset % 8);
+}
+
+static size_t reader_position(const bit_reader* br)
+{
+    return br->next * 8 - br->avail;
+}
+
+static int reader_overrun(const bit_reader* br)
+{
+    return reader_position(br) > br->len * 8;
+}
+
+/* n bits, n <= 32 */
+static uint32_t get_bits(bit_reader* br, int n)
+{
+    uint32_t v;
+    if (n == 0)
+        return 0;
+    if (br->avail < n)
+        refill(br);
+    v = (uint32_t)(br->acc >> (64 - n));
+    br->acc <<= n;
+    br->avail -= n;
+    return v;
+}
+
+static void skip_bits(bit_reader* br, size_t n)
+{
+    if (n < (size_t)br->avail) {
+        br->acc <<= n;
+        br->avail -= (int)n;
+        return;
+    }
+    n -= br->avail;
+    br->next += n / 8;
+    br->acc   = 0;
+    br->avail = 0;
+    refill(br);
+    br->acc <<= n % 8;
+    br->avail -= (int)(n % 8);
+}
+
+static int leading_zeros(uint64_t x)
+{
+#ifdef __GNUC__
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while (!(x & ((uint64_t)1 << 63))) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/* A fundamental sequence code: the number of 0s before a 1. -1 past the end of the data */
+static long get_fs(bit_reader* br)
+{
+    long count = 0;
+    for (;;) {
+        if (br->acc) {
+            int z = leading_zeros(br->acc);
+            br->acc <<= z;
+            br->acc <<= 1;
+            br->avail -= z + 1;
+            count += z;
+            if (br->avail <= 0)
+                refill(br);
+            return count;
+        }
+        count += br->avail;
+        br->acc   = 0;
+        br->avail = 0;
+        if (reader_overrun(br))
+            return -1;
+        refill(br);
+    }
+}
+
+static int id_length(const grib_ccsds_params* p)
+{
+    if (p->bits_per_sample > 16)
+        return 5;
+    if (p->bits_per_sample > 8)
+        return 4;
+    if ((p->flags & CCSDS_RESTRICTED) && p->bits_per_sample <= 4)
+        return p->bits_per_sample <= 2 ? 1 : 2;
+    return 3;
+}
+
+/* Samples given in little-endian bytes are decoded as big-endian ones by the
+ * accessor, so such streams are only decoded by libaec, as a whole */
+static int check_params(const grib_ccsds_params* p)
+{
+    if (p->bits_per_sample < 1 || p->bits_per_sample > 32 || p->block_size < 1 || p->block_size > 64 ||
+        p->rsi < 1 || (p->flags & (CCSDS_DATA_SIGNED | CCSDS_PAD_RSI)) || !(p->flags & CCSDS_DATA_MSB))
+        return GRIB_NOT_IMPLEMENTED;
+    return GRIB_SUCCESS;
+}
+
+/* Second extension codes: the sum of the pair, and the code of the first pair with that sum */
+static void se_pair(long m, long* sum, long* first)
+{
+    long i = 0, k = 0;
+    while (k + i + 1 <= m) {
+        k += i + 1;
+        i++;
+    }
+    *sum   = i;
+    *first = k;
+}
+
+/*
+ * Read the coded samples of the RSI starting at the reader, at most 'n' of
+ * them. The mapped samples, before the preprocessing is undone, go to 'out'
+ * unless it is NULL, to only skip them. A zero block can cover the blocks
+ * after 'n' samples, so more than 'n' can be read, but not written.
+ */
+static int read_rsi(bit_reader* br, const grib_ccsds_params* p, size_t n, uint32_t* out)
+{
+    const int id_len      = id_length(p);
+    const uint32_t uncomp = (1u << id_len) - 1;
+    const int pp          = (p->flags & CCSDS_DATA_PREPROCESS) != 0;
+    const long J          = p->block_size;
+    const int nbits       = (int)p->bits_per_sample;
+    long fs[64];
+    size_t blocks = (n + J - 1) / J;
+    size_t b      = 0;
+    size_t o      = 0; /* samples read */
+
+    while (b < blocks) {
+        int ref     = pp && b == 0;
+        uint32_t id = get_bits(br, id_len);
+        long i;
+
+        if (id == 0) {
+            uint32_t second_extension = get_bits(br, 1);
+            if (ref) {
+                uint32_t r = get_bits(br, nbits);
+                if (out && o < n)
+                    out[o] = r;
+                o++;
+            }
+            if (!second_extension) {
+                long fsz = get_fs(br), zb = 0;
+                size_t z = 0;
+                if (fsz < 0)
+                    return GRIB_DECODING_ERROR;
+                zb = fsz + 1;
+                if (zb == CCSDS_ROS) {
+                    long rest = p->rsi - (long)b;
+                    zb        = 64 - (long)(b % 64);
+                    if (rest < zb)
+                        zb = rest;
+                }
+                else if (zb > CCSDS_ROS) {
+                    zb--;
+                }
+                z = (size_t)zb * J - ref;
+                for (; z > 0; z--, o++) {
+                    if (out && o < n)
+                        out[o] = 0;
+                }
+                b += zb;
+                continue;
+            }
+            for (i = ref; i < J;) {
+                long m = get_fs(br), sum = 0, first = 0, d1 = 0;
+                if (m < 0 || m > CCSDS_SE_MAX)
+                    return GRIB_DECODING_ERROR;
+                se_pair(m, &sum, &first);
+                d1 = m - first;
+                if ((i & 1) == 0) {
+                    if (out && o < n)
+                        out[o] = (uint32_t)(sum - d1);
+                    o++;
+                    i++;
+                }
+                if (out && o < n)
+                    out[o] = (uint32_t)d1;
+                o++;
+                i++;
+            }
+        }
+        else if (id == uncomp) {
+            if (!out) {
+                skip_bits(br, (size_t)J * nbits);
+                o += J;
+            }
+            else {
+                for (i = 0; i < J; i++, o++) {
+                    uint32_t v = get_bits(br, nbits);
+                    if (o < n)
+                        out[o] = v;
+                }
+            }
+        }
+        else {
+            int k = (int)id - 1;
+            if (ref) {
+                uint32_t r = get_bits(br, nbits);
+                if (out && o < n)
+                    out[o] = r;
+                o++;
+            }
+            for (i = ref; i < J; i++) {
+                if ((fs[i] = get_fs(br)) < 0)
+                    return GRIB_DECODING_ERROR;
+            }
+            if (!out) {
+                skip_bits(br, (size_t)(J - ref) * k);
+                o += J - ref;
+            }
+            else {
+                for (i = ref; i < J; i++, o++) {
+                    uint32_t v = ((uint32_t)fs[i] << k) | get_bits(br, k);
+                    if (o < n)
+                        out[o] = v;
+                }
+            }
+        }
+        b++;
+    }
+
+    if (reader_overrun(br))
+        return GRIB_DECODING_ERROR;
+    return GRIB_SUCCESS;
+}
+
+/* Undo the unit delay predictor and the mapping of the samples of an RSI */
+static void postprocess(const grib_ccsds_params* p, uint32_t* x, size_t n)
+{
+    const int64_t xmax = (int64_t)(((uint64_t)1 << p->bits_per_sample) - 1);
+    int64_t last       = 0;
+    size_t i;
+
+    if (!(p->flags & CCSDS_DATA_PREPROCESS) || n == 0)
+        return;
+
+    last = x[0];
+    for (i = 1; i < n; i++) {
+        int64_t d     = x[i];
+        int64_t theta = last < xmax - last ? last : xmax - last;
+        if (d <= 2 * theta)
+            last += (d & 1) ? -((d + 1) >> 1) : (d >> 1);
+        else if (last <= xmax - last)
+            last = d;
+        else
+            last = xmax - d;
+        x[i] = (uint32_t)last;
+    }
+}
+
+static size_t rsi_samples(const grib_ccsds_params* p)
+{
+    return (size_t)p->rsi * p->block_size;
+}
+
+void grib_ccsds_rsi_index_delete(grib_context* c, grib_ccsds_rsi_index* index)
+{
+    if (!index)
+        return;
+    grib_context_free(c, index->offsets);
+    grib_context_free(c, index->samples);
+    grib_context_free(c, index);
+}
+
+/*
+ * Find where the RSI holding sample 'i' starts, reading on from the last
+ * RSI found. The index is started again if the stream is not the one it was
+ * made for.
+ */
+static int find_rsi(grib_context* c, grib_ccsds_rsi_index** pindex, const grib_ccsds_params* p,
+                    const unsigned char* data, size_t len, size_t n_vals, size_t i, size_t* rsi)
+{
+    grib_ccsds_rsi_index* index = *pindex;
+    size_t per_rsi              = rsi_samples(p);
+    size_t count                = (n_vals + per_rsi - 1) / per_rsi;
+    int err                     = 0;
+
+    if (index && (memcmp(&index->params, p, sizeof(*p)) != 0 || index->data != data || index->len != len ||
+                  index->n_vals != n_vals)) {
+        grib_ccsds_rsi_index_delete(c, index);
+        index = *pindex = NULL;
+    }
+    if (!index) {
+        index = (grib_ccsds_rsi_index*)grib_context_malloc_clear(c, sizeof(grib_ccsds_rsi_index));
+        if (!index)
+            return GRIB_OUT_OF_MEMORY;
+        index->offsets = (size_t*)grib_context_malloc(c, count * sizeof(size_t));
+        if (!index->offsets) {
+            grib_context_free(c, index);
+            return GRIB_OUT_OF_MEMORY;
+        }
+        index->params     = *p;
+        index->data       = data;
+        index->len        = len;
+        index->n_vals     = n_vals;
+        index->offsets[0] = 0;
+        index->count      = 1;
+        index->decoded    = (size_t)-1;
+        *pindex           = index;
+    }
+
+    *rsi = i / per_rsi;
+    while (index->count <= *rsi) {
+        bit_reader br;
+        size_t r     = index->count - 1;
+        size_t first = r * per_rsi;
+        reader_init(&br, data, len, index->offsets[r]);
+        if ((err = read_rsi(&br, p, n_vals - first < per_rsi ? n_vals - first : per_rsi, NULL)) != GRIB_SUCCESS)
+            return err;
+        index->offsets[index->count++] = reader_position(&br);
+    }
+    return GRIB_SUCCESS;
+}
+
+/* Make sure the index has where every RSI of the stream starts, for grib_ccsds_decode_rsi */
+int grib_ccsds_index_rsis(grib_context* c, grib_ccsds_rsi_index** pindex, const grib_ccsds_params* p,
+                          const unsigned char* data, size_t len, size_t n_vals)
+{
+    size_t rsi = 0;
+    int err    = 0;
+
+    if ((err = check_params(p)) != GRIB_SUCCESS)
+        return err;
+    if (n_vals == 0)
+        return GRIB_INVALID_ARGUMENT;
+    return find_rsi(c, pindex, p, data, len, n_vals, n_vals - 1, &rsi);
+}
+
+/*
+ * The 'n' samples of RSI 'r' of the stream of the index, which must hold
+ * where it starts. The index is only read, so that the RSIs of a stream can
+ * be decoded by several threads at once.
+ */
+int grib_ccsds_decode_rsi(const grib_ccsds_rsi_index* index, size_t r, uint32_t* samples, size_t* n)
+{
+    size_t per_rsi = rsi_samples(&index->params);
+    size_t first   = r * per_rsi;
+    bit_reader br;
+    int err = 0;
+
+    if (r >= index->count || first >= index->n_vals)
+        return GRIB_INVALID_ARGUMENT;
+
+    *n = index->n_vals - first < per_rsi ? index->n_vals - first : per_rsi;
+    reader_init(&br, index->data, index->len, index->offsets[r]);
+    if ((err = read_rsi(&br, &index->params, *n, samples)) != GRIB_SUCCESS)
+        return err;
+    postprocess(&index->params, samples, *n);
+    return GRIB_SUCCESS;
+}
+
+/*
+ * The integer sample 'i' of the 'n_vals' samples of the stream of 'len'
+ * bytes at 'data'. The RSI holding it is decoded and kept in the index with
+ * the places of the RSIs before it, for the next samples.
+ * Streams ending before their last sample are left to libaec, which decodes
+ * them up to where they end: GRIB_NOT_IMPLEMENTED if the RSI is past it.
+ */
+int grib_ccsds_decode_sample(grib_context* c, grib_ccsds_rsi_index** pindex, const grib_ccsds_params* p,
+                             const unsigned char* data, size_t len, size_t n_vals, size_t i, uint32_t* sample)
+{
+    grib_ccsds_rsi_index* index = NULL;
+    size_t per_rsi              = rsi_samples(p);
+    size_t rsi = 0, n = 0;
+    int err = 0;
+
+    if ((err = check_params(p)) != GRIB_SUCCESS)
+        return err;
+    if (i >= n_vals)
+        return GRIB_INVALID_ARGUMENT;
+    if ((err = find_rsi(c, pindex, p, data, len, n_vals, i, &rsi)) != GRIB_SUCCESS)
+        return err == GRIB_DECODING_ERROR ? GRIB_NOT_IMPLEMENTED : err;
+
+    index = *pindex;
+    if (index->decoded != rsi) {
+        if (!index->samples) {
+            index->samples = (uint32_t*)grib_context_malloc(c, per_rsi * sizeof(uint32_t));
+            if (!index->samples)
+                return GRIB_OUT_OF_MEMORY;
+        }
+        index->decoded = (size_t)-1;
+        if ((err = grib_ccsds_decode_rsi(index, rsi, index->samples, &n)) != GRIB_SUCCESS)
+            return err == GRIB_DECODING_ERROR ? GRIB_NOT_IMPLEMENTED : err;
+        index->decoded = rsi;
+    }
+    *sample = index->samples[i - rsi * per_rsi];
+    return GRIB_SUCCESS;
+}
+
+/*
+ * Number of bits of the coded 'n_vals' samples of the stream at 'data', which
+ * libaec pads to a whole number of bytes. Streams of whole RSIs coded apart
+ * are joined on these bits into the stream of all their samples.
+ */
+int grib_ccsds_stream_bits(const grib_ccsds_params* p, const unsigned char* data, size_t len, size_t n_vals, size_t* bits)
+{
+    size_t per_rsi = rsi_samples(p);
+    size_t first   = 0;
+    bit_reader br;
+    int err = 0;
+
+    if ((err = check_params(p)) != GRIB_SUCCESS)
+        return err;
+
+    reader_init(&br, data, len, 0);
+    for (first = 0; first < n_vals; first += per_rsi) {
+        if ((err = read_rsi(&br, p, n_vals - first < per_rsi ? n_vals - first : per_rsi, NULL)) != GRIB_SUCCESS)
+            return err;
+    }
+    *bits = reader_position(&br);
+    return GRIB_SUCCESS;
+}
+
+/* Sample i of the samples given to libaec, of nbytes bytes each */
+static uint32_t get_sample(const unsigned char* samples, size_t nbytes, size_t i)
+{
+    const unsigned char* s = samples + i * nbytes;
+    uint32_t x             = 0;
+    size_t j;
+    for (j = 0; j < nbytes; j++)
+        x = (x << 8) | s[j];
+    return x;
+}
+
+/* Whether exactly one k codes the block of n mapped samples in the fewest bits */
+static int has_one_best_k(const uint32_t* mapped, size_t n, int kmax)
+{
+    uint64_t best = 0;
+    int count     = 0;
+    int k         = 0;
+    size_t i;
+
+    for (k = 0; k <= kmax; k++) {
+        uint64_t bits = (uint64_t)k * n;
+        for (i = 0; i < n; i++)
+            bits += (mapped[i] >> k) + 1;
+        if (k == 0 || bits < best) {
+            best  = bits;
+            count = 1;
+        }
+        else if (bits == best) {
+            count++;
+        }
+    }
+    return count == 1;
+}
+
+/*
+ * Where libaec is to start coding the samples given to it, of nbytes bytes
+ * each, for the RSIs from sample 'first' on to be coded as in the stream of
+ * all the samples. It is the start of an RSI.
+ *
+ * libaec codes an RSI on its own but for the k of the split sample option:
+ * the best k of a block is searched from that of the last block assessed,
+ * and when two k are as good the one found depends on where the search
+ * started. From a block with a single best k on, libaec finds the same k
+ * wherever it started coding.
+ */
+size_t grib_ccsds_encode_start(const grib_ccsds_params* p, const unsigned char* samples, size_t nbytes, size_t first)
+{
+    const size_t J       = p->block_size;
+    const size_t per_rsi = rsi_samples(p);
+    const int pp         = (p->flags & CCSDS_DATA_PREPROCESS) != 0;
+    const int64_t xmax   = (int64_t)(((uint64_t)1 << p->bits_per_sample) - 1);
+    uint32_t mapped[64];
+    size_t b, i;
+
+    if (check_params(p) != GRIB_SUCCESS)
+        return 0;
+    /* Without the split sample option, nothing is carried over */
+    if (id_length(p) == 1)
+        return first;
+
+    for (b = first / J; b-- > 0;) {
+        const size_t start = b * J;
+        int nonzero        = 0;
+        /* The first block of an RSI holds the reference sample */
+        if (pp && start % per_rsi == 0)
+            continue;
+        for (i = 0; i < J; i++) {
+            int64_t x = get_sample(samples, nbytes, start + i);
+            if (pp) {
+                int64_t last  = get_sample(samples, nbytes, start + i - 1);
+                int64_t d     = x - last;
+                int64_t theta = last < xmax - last ? last : xmax - last;
+                if (d >= 0 && d <= theta)
+                    x = 2 * d;
+                else if (d < 0 && -d <= theta)
+                    x = -2 * d - 1;
+                else
+                    x = theta + (d < 0 ? -d : d);
+            }
+            mapped[i] = (uint32_t)x;
+            nonzero |= mapped[i] != 0;
+        }
+        /* Zero blocks are not assessed */
+        if (nonzero && has_one_best_k(mapped, J, (1 << id_length(p)) - 3))
+            return start / per_rsi * per_rsi;
+    }
+    return 0;
+}
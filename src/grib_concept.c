@@ -21,6 +21,7 @@ grib_concept_value* grib_concept_value_new(grib_context* c, const char* name, gr
 void grib_concept_value_delete(grib_context* c, grib_concept_value* v)
 {
     grib_concept_condition* e = v->conditions;
+    grib_concept_index_delete(c, v->conditions_index);
     while (e) {
         grib_concept_condition* n = e->next;
         grib_concept_condition_delete(c, e);
@@ -11,162 +11,490 @@
 /*
  * Description: concept index
  *
+ * Decision index over the conditions of a concept (paramId, shortName,
+ * typeOfLevel, ...). Every key used in a condition is fetched at most once
+ * per evaluation, and the values are split on the most discriminating long
+ * key so that only the values with a matching condition on that key, plus
+ * those with no condition on it, are tested.
+ *
+ * The result is the same as a linear walk of the concept: the value with
+ * the most conditions, all true, and the last one in the list for a tie.
+ * Conditions which are not constants (e.g. missing()) are evaluated for
+ * each message as before, and concepts with integer array conditions are
+ * not indexed.
  */
 
 #include "grib_api_internal.h"
 
-static grib_concept_index_entry* index_entry_new(grib_context* c, grib_concept_index_keys* keys)
+#define MAX_CONCEPT_INDEX_KEYS 64
+#define CONCEPT_STRING_LEN 80
+
+#if GRIB_PTHREADS
+static pthread_once_t once   = PTHREAD_ONCE_INIT;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void init()
 {
-    grib_concept_index_entry* entry = NULL;
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+#elif GRIB_OMP_THREADS
+static int once = 0;
+static omp_nest_lock_t mutex;
 
-    Assert(keys);
+static void init()
+{
+    GRIB_OMP_CRITICAL(lock_grib_concept_index_c)
+    {
+        if (once == 0) {
+            omp_init_nest_lock(&mutex);
+            once = 1;
+        }
+    }
+}
+#endif
 
-    if (!c)
-        c = grib_context_get_default();
+typedef struct grib_concept_index_key
+{
+    const char* name;
+    int type;
+} grib_concept_index_key;
 
-    entry = grib_context_malloc_clear(c, sizeof(grib_concept_index_entry));
-    if (!entry)
-        grib_context_log(c, GRIB_LOG_FATAL, "grib_concept_index_entry unable to allocate");
-    e = entry;
+typedef struct grib_concept_index_test
+{
+    int key;
+    grib_expression* expression; /* if not a constant */
+    long lval;
+    double dval;
+    const char* sval;
+} grib_concept_index_test;
+
+typedef struct grib_concept_index_entry
+{
+    const char* name;
+    size_t ntests;
+    grib_concept_index_test* tests;
+} grib_concept_index_entry;
 
-    while (keys && keys->name) {
-        e->name = grib_context_strdup(c, keys->name);
-        e->type = keys->type;
-        e->next = grib_context_malloc_clear(c, sizeof(grib_concept_index_entry));
-        if (!e->next)
-            grib_context_log(c, GRIB_LOG_FATAL, "grib_concept_index_entry unable to allocate");
+struct grib_concept_index
+{
+    grib_context* context;
+    size_t nkeys;
+    grib_concept_index_key keys[MAX_CONCEPT_INDEX_KEYS];
+    size_t nentries;
+    grib_concept_index_entry* entries; /* in the order of the concept */
+    grib_concept_index_test* tests;
+
+    int split_key;        /* -1 if the values are not split */
+    size_t nbuckets;
+    size_t* bucket_start; /* nbuckets+1 offsets into members */
+    size_t* members;      /* entries by bucket of their split key value */
+    size_t nrest;
+    size_t* rest; /* entries without a condition on the split key */
+};
+
+/* Values of the keys fetched during one evaluation */
+typedef struct concept_fetched
+{
+    int state; /* 0: not fetched, 1: fetched, -1: error */
+    long lval;
+    double dval;
+    char sval[CONCEPT_STRING_LEN];
+} concept_fetched;
 
-        e    = e->next;
-        keys = keys->next;
+static int find_key(const grib_concept_index* index, const char* name, int type)
+{
+    size_t i;
+    for (i = 0; i < index->nkeys; i++) {
+        if (index->keys[i].type == type && strcmp(index->keys[i].name, name) == 0)
+            return i;
     }
+    return -1;
+}
 
-    return entry;
+static int key_slot(grib_concept_index* index, const char* name, int type)
+{
+    int k = find_key(index, name, type);
+    if (k >= 0)
+        return k;
+    if (index->nkeys == MAX_CONCEPT_INDEX_KEYS)
+        return -1;
+    index->keys[index->nkeys].name = name;
+    index->keys[index->nkeys].type = type;
+    return index->nkeys++;
 }
 
-static void index_entry_delete(grib_context* c, grib_concept_index_entry* entry)
+/*
+ * Constant conditions are turned into tests on a value. Other expressions
+ * are kept, with slots for the key in any of the types they may evaluate to.
+ */
+static int make_test(grib_concept_index* index, grib_concept_condition* c, grib_concept_index_test* t)
 {
-    grib_concept_index_entry* e;
-    while (entry) {
-        e     = entry;
-        entry = entry->next;
-        grib_context_free(c, e->name);
-        grib_context_free(c, e->value);
-        grib_context_free(c, e);
+    const char* cname = NULL;
+    int type          = 0;
+    int err           = 0;
+
+    if (c->expression == NULL)
+        return GRIB_NOT_IMPLEMENTED;
+    cname = c->expression->cclass->name;
+    if (strcmp(cname, "long") && strcmp(cname, "double") && strcmp(cname, "string")) {
+        t->expression = c->expression;
+        if (key_slot(index, c->name, GRIB_TYPE_DOUBLE) < 0 || key_slot(index, c->name, GRIB_TYPE_STRING) < 0)
+            return GRIB_NOT_IMPLEMENTED;
+        t->key = key_slot(index, c->name, GRIB_TYPE_LONG);
+        return t->key < 0 ? GRIB_NOT_IMPLEMENTED : GRIB_SUCCESS;
+    }
+
+    type = grib_expression_native_type(NULL, c->expression);
+    switch (type) {
+        case GRIB_TYPE_LONG:
+            err = grib_expression_evaluate_long(NULL, c->expression, &t->lval);
+            break;
+        case GRIB_TYPE_DOUBLE:
+            err = grib_expression_evaluate_double(NULL, c->expression, &t->dval);
+            break;
+        case GRIB_TYPE_STRING: {
+            char tmp[CONCEPT_STRING_LEN];
+            size_t size = sizeof(tmp);
+            t->sval     = grib_expression_evaluate_string(NULL, c->expression, tmp, &size, &err);
+            if (t->sval == tmp)
+                return GRIB_NOT_IMPLEMENTED;
+            break;
+        }
+        default:
+            return GRIB_NOT_IMPLEMENTED;
     }
+    if (err)
+        return err;
+
+    t->key = key_slot(index, c->name, type);
+    return t->key < 0 ? GRIB_NOT_IMPLEMENTED : GRIB_SUCCESS;
+}
+
+static size_t bucket_of(long value, size_t nbuckets)
+{
+    return (size_t)((unsigned long)value % nbuckets);
+}
+
+static int compare_longs(const void* a, const void* b)
+{
+    long x = *(const long*)a;
+    long y = *(const long*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* Constant test on key k of an entry, if it has one */
+static const grib_concept_index_test* entry_test(const grib_concept_index_entry* e, int k)
+{
+    size_t i;
+    for (i = 0; i < e->ntests; i++) {
+        if (e->tests[i].key == k && !e->tests[i].expression)
+            return &e->tests[i];
+    }
+    return NULL;
 }
 
-static int index_insert_entry(grib_concept_index* index, grib_concept_index_entry* entry, void* object)
+/*
+ * Choose the long key which leaves the fewest values to test on average:
+ * the values without a condition on it plus, for a message, those sharing
+ * its value of the key.
+ */
+static int choose_split_key(grib_concept_index* index)
 {
-    int err                       = 0;
-    int found                     = 0;
-    grib_conditions_tree* cur     = index->conditions;
-    grib_conditions_tree* prev    = index->conditions;
-    grib_concept_index_keys* keys = index->keys;
+    long* values = (long*)grib_context_malloc(index->context, (index->nentries + 1) * sizeof(long));
+    double best  = (double)index->nentries;
+    int split    = -1;
+    size_t k, i;
+
+    if (!values)
+        return -1;
+
+    for (k = 0; k < index->nkeys; k++) {
+        size_t n = 0, run = 1;
+        double cost = 0;
+        if (index->keys[k].type != GRIB_TYPE_LONG)
+            continue;
+        for (i = 0; i < index->nentries; i++) {
+            const grib_concept_index_test* t = entry_test(&index->entries[i], k);
+            if (t)
+                values[n++] = t->lval;
+        }
+        if (n == 0)
+            continue;
+        qsort(values, n, sizeof(long), compare_longs);
+        for (i = 1; i <= n; i++) {
+            if (i < n && values[i] == values[i - 1]) {
+                run++;
+            }
+            else {
+                cost += (double)run * run / n;
+                run = 1;
+            }
+        }
+        cost += index->nentries - n;
+        if (cost < best) {
+            best  = cost;
+            split = k;
+        }
+    }
 
-    while (keys->name) {
-        if (!cur) {
-            cur = grib_context_malloc_clear_persistent(index->context, sizeof(grib_conditions_tree));
-            if (!cur)
-                grib_context_log(index->context, GRIB_LOG_FATAL, "index_insert_entry unable to allocate");
-            prev->next = cur;
+    grib_context_free(index->context, values);
+    return split;
+}
+
+static int build_buckets(grib_concept_index* index)
+{
+    grib_context* c = index->context;
+    size_t i;
+
+    index->nbuckets     = index->nentries * 2 + 1;
+    index->bucket_start = (size_t*)grib_context_malloc_clear_persistent(c, (index->nbuckets + 1) * sizeof(size_t));
+    index->members      = (size_t*)grib_context_malloc_clear_persistent(c, (index->nentries + 1) * sizeof(size_t));
+    index->rest         = (size_t*)grib_context_malloc_clear_persistent(c, (index->nentries + 1) * sizeof(size_t));
+    if (!index->bucket_start || !index->members || !index->rest)
+        return GRIB_OUT_OF_MEMORY;
+
+    /* Count, then place the entries of each bucket */
+    for (i = 0; i < index->nentries; i++) {
+        const grib_concept_index_test* t = entry_test(&index->entries[i], index->split_key);
+        if (t)
+            index->bucket_start[bucket_of(t->lval, index->nbuckets) + 1]++;
+        else
+            index->rest[index->nrest++] = i;
+    }
+    for (i = 0; i < index->nbuckets; i++)
+        index->bucket_start[i + 1] += index->bucket_start[i];
+    {
+        size_t* fill = (size_t*)grib_context_malloc(c, index->nbuckets * sizeof(size_t));
+        if (!fill)
+            return GRIB_OUT_OF_MEMORY;
+        memcpy(fill, index->bucket_start, index->nbuckets * sizeof(size_t));
+        for (i = 0; i < index->nentries; i++) {
+            const grib_concept_index_test* t = entry_test(&index->entries[i], index->split_key);
+            if (t)
+                index->members[fill[bucket_of(t->lval, index->nbuckets)]++] = i;
         }
-        value = entry->value ? entry->value : "*";
-        while (cur && (!cur->value || (found = !strcmp(cur->value, value)) == 0))
-            cur = cur->next;
-
-        if (!found) {
-            cur->next = grib_context_malloc_clear_persistent(index->context, sizeof(grib_conditions_tree));
-            if (!cur->next)
-                grib_context_log(index->context, GRIB_LOG_FATAL, "index_insert_entry unable to allocate");
-            cur = cur->next;
+        grib_context_free(c, fill);
+    }
+    return GRIB_SUCCESS;
+}
+
+static grib_concept_index* concept_index_new(grib_context* c, grib_concept_value* concept)
+{
+    grib_concept_index* index = NULL;
+    grib_concept_value* v     = NULL;
+    size_t ntests = 0, i = 0, t = 0;
+
+    index = (grib_concept_index*)grib_context_malloc_clear_persistent(c, sizeof(grib_concept_index));
+    if (!index)
+        return NULL;
+    index->context   = c;
+    index->split_key = -1;
+
+    for (v = concept; v; v = v->next) {
+        grib_concept_condition* e;
+        index->nentries++;
+        for (e = v->conditions; e; e = e->next)
+            ntests++;
+    }
+    index->entries = (grib_concept_index_entry*)grib_context_malloc_clear_persistent(c, (index->nentries + 1) * sizeof(grib_concept_index_entry));
+    index->tests   = (grib_concept_index_test*)grib_context_malloc_clear_persistent(c, (ntests + 1) * sizeof(grib_concept_index_test));
+    if (!index->entries || !index->tests)
+        goto fail;
+
+    for (v = concept, i = 0; v; v = v->next, i++) {
+        grib_concept_condition* e;
+        index->entries[i].name  = v->name;
+        index->entries[i].tests = &index->tests[t];
+        for (e = v->conditions; e; e = e->next) {
+            if (make_test(index, e, &index->tests[t]) != GRIB_SUCCESS)
+                goto fail;
+            t++;
+            index->entries[i].ntests++;
         }
+    }
+
+    index->split_key = choose_split_key(index);
+    if (index->split_key >= 0 && build_buckets(index) != GRIB_SUCCESS)
+        goto fail;
 
-        cur->value = grib_context_strdup(index->context, value);
-        entry      = entry->next;
-        keys       = keys->next;
-        prev       = cur;
-        cur        = cur->next_key;
+    return index;
+
+fail:
+    grib_concept_index_delete(c, index);
+    return NULL;
+}
+
+/*
+ * Index of a concept, built on first use and kept with the concept values.
+ * Returns NULL if the concept can't be indexed.
+ */
+grib_concept_index* grib_concept_index_get(grib_context* c, grib_concept_value* concept)
+{
+    grib_concept_index* index = NULL;
+
+    if (!concept)
+        return NULL;
+
+    /* Published once built, so only the first use of a concept locks */
+    if (GRIB_LOCK_FREE_READS) {
+        if ((index = GRIB_PUBLISHED(concept->conditions_index)) != NULL || GRIB_PUBLISHED(concept->conditions_index_failed))
+            return index;
     }
 
-    while (cur) {
-        prev = cur;
-        cur  = cur->next_key;
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    if (!concept->conditions_index && !concept->conditions_index_failed) {
+        index = concept_index_new(c, concept);
+        if (index)
+            GRIB_PUBLISH(concept->conditions_index, index);
+        else
+            GRIB_PUBLISH(concept->conditions_index_failed, 1);
     }
+    index = concept->conditions_index;
+    GRIB_MUTEX_UNLOCK(&mutex);
 
-    prev->object = object;
+    return index;
+}
 
-    return err;
+void grib_concept_index_delete(grib_context* c, grib_concept_index* index)
+{
+    if (!index)
+        return;
+    grib_context_free_persistent(c, index->entries);
+    grib_context_free_persistent(c, index->tests);
+    grib_context_free_persistent(c, index->bucket_start);
+    grib_context_free_persistent(c, index->members);
+    grib_context_free_persistent(c, index->rest);
+    grib_context_free_persistent(c, index);
 }
 
-static void index_add_conditions(grib_concept_index* index, grib_concept_condition* condition)
+/* Value of key slot k for the message, fetched on first use */
+static const concept_fetched* fetch(grib_handle* h, const grib_concept_index* index, concept_fetched* fetched, int k)
 {
-    grib_concept_condition* c = condition;
-    char s[512]               = {0,};
-    grib_concept_index_entry* e;
-    grib_concept_index_entry* entry = index_entry_new(index->context, index->keys);
+    concept_fetched* f = &fetched[k];
 
-    while (c) {
-        size_t size = 512;
-        int type;
-        e    = entry;
-        type = grib_expression_native_type(0, c->expression);
-        switch (type) {
+    if (f->state == 0) {
+        const grib_concept_index_key* key = &index->keys[k];
+        size_t len                        = sizeof(f->sval);
+        int err                           = 0;
+        switch (key->type) {
             case GRIB_TYPE_LONG:
-                grib_expression_evaluate_long(0, c->expression, &lres);
-                sprintf(s, "%ld", lres);
+                err = grib_get_long(h, key->name, &f->lval);
                 break;
-
             case GRIB_TYPE_DOUBLE:
-                grib_expression_evaluate_double(0, c->expression, &dres);
-                sprintf(s, "%g", dres);
+                err = grib_get_double(h, key->name, &f->dval);
                 break;
-
-            case GRIB_TYPE_STRING:
-                grib_expression_evaluate_string(0, c->expression, s, &size, &err);
-                break;
-
             default:
-                Assert(0);
+                err = grib_get_string(h, key->name, f->sval, &len);
                 break;
         }
+        f->state = err ? -1 : 1;
+    }
+    return f->state > 0 ? f : NULL;
+}
 
-        while (e->name && strcmp(e->name, c->name))
-            e = e->next;
-
-        e->type  = type;
-        e->value = grib_context_strdup(index->context, s);
-        if (!e->name) {
-            e->name = grib_context_strdup(index->context, c->name);
-            e->next = grib_context_malloc_clear_persistent(index->context, sizeof(grib_concept_index_entry));
-            if (!e->next)
-                grib_context_log(index->context, GRIB_LOG_FATAL, "index_add_conditions unable to allocate");
+/* Same as the evaluation of the condition by the concept accessor */
+static int expression_true(grib_handle* h, const grib_concept_index* index, concept_fetched* fetched, const grib_concept_index_test* t)
+{
+    const int type           = grib_expression_native_type(h, t->expression);
+    const char* name         = index->keys[t->key].name;
+    const concept_fetched* f = NULL;
+    int k                    = 0;
+
+    switch (type) {
+        case GRIB_TYPE_LONG: {
+            long lres = 0;
+            grib_expression_evaluate_long(h, t->expression, &lres);
+            f = fetch(h, index, fetched, t->key);
+            return f && f->lval == lres;
         }
-
-        c = c->next;
+        case GRIB_TYPE_DOUBLE: {
+            double dres = 0.0;
+            grib_expression_evaluate_double(h, t->expression, &dres);
+            k = find_key(index, name, GRIB_TYPE_DOUBLE);
+            f = fetch(h, index, fetched, k);
+            return f && f->dval == dres;
+        }
+        case GRIB_TYPE_STRING: {
+            const char* cval = NULL;
+            char tmp[CONCEPT_STRING_LEN];
+            size_t size = sizeof(tmp);
+            int err     = 0;
+            k           = find_key(index, name, GRIB_TYPE_STRING);
+            f           = fetch(h, index, fetched, k);
+            return f && (cval = grib_expression_evaluate_string(h, t->expression, tmp, &size, &err)) != NULL &&
+                   err == 0 && strcmp(f->sval, cval) == 0;
+        }
+        default:
+            return 0;
     }
+}
 
-    index_insert_entry(index, entry, condition->name);
-
-    index_entry_delete(index->context, entry);
+static int test_true(grib_handle* h, const grib_concept_index* index, concept_fetched* fetched, const grib_concept_index_test* t)
+{
+    const concept_fetched* f = NULL;
+
+    if (t->expression)
+        return expression_true(h, index, fetched, t);
+
+    f = fetch(h, index, fetched, t->key);
+    if (!f)
+        return 0;
+    switch (index->keys[t->key].type) {
+        case GRIB_TYPE_LONG:
+            return f->lval == t->lval;
+        case GRIB_TYPE_DOUBLE:
+            return f->dval == t->dval;
+        default:
+            return strcmp(f->sval, t->sval) == 0;
+    }
 }
 
-grib_concept_index* grib_concept_index_new_from_concept(grib_context* c, grib_concept_value* concept, int* err)
+static void consider(grib_handle* h, grib_concept_index* index, concept_fetched* fetched,
+                     size_t i, size_t* best_count, long* best)
 {
-    grib_concept_index* index;
+    const grib_concept_index_entry* e = &index->entries[i];
+    size_t j;
+
+    if (e->ntests < *best_count || (e->ntests == *best_count && (long)i < *best))
+        return;
+    for (j = 0; j < e->ntests; j++) {
+        if (!test_true(h, index, fetched, &e->tests[j]))
+            return;
+    }
+    *best_count = e->ntests;
+    *best       = i;
+}
 
-    if (!c)
-        c = grib_context_get_default();
+const char* grib_concept_index_evaluate(grib_handle* h, grib_concept_index* index)
+{
+    concept_fetched fetched[MAX_CONCEPT_INDEX_KEYS];
+    size_t best_count = 0;
+    long best         = -1;
+    size_t i;
 
-    index             = grib_context_malloc_clear_persistent(c, sizeof(grib_concept_index));
-    index->keys       = grib_context_malloc_clear_persistent(c, sizeof(grib_concept_index_key));
-    index->conditions = grib_context_malloc_clear_persistent(c, sizeof(grib_conditions_tree));
-    index->conditions = grib_context_malloc_clear_persistent(c, sizeof(grib_conditions_tree));
-    index->context    = c;
+    for (i = 0; i < index->nkeys; i++)
+        fetched[i].state = 0;
 
-    while (concept) {
-        index_add_conditions(index, concept->conditions, err);
-        concept = concept->next;
+    if (index->split_key < 0) {
+        for (i = 0; i < index->nentries; i++)
+            consider(h, index, fetched, i, &best_count, &best);
+    }
+    else {
+        /* With no value for the split key only the rest can match */
+        const concept_fetched* f = fetch(h, index, fetched, index->split_key);
+        if (f) {
+            size_t b = bucket_of(f->lval, index->nbuckets);
+            for (i = index->bucket_start[b]; i < index->bucket_start[b + 1]; i++)
+                consider(h, index, fetched, index->members[i], &best_count, &best);
+        }
+        for (i = 0; i < index->nrest; i++)
+            consider(h, index, fetched, index->rest[i], &best_count, &best);
     }
 
-    return index;
+    return best < 0 ? NULL : index->entries[best].name;
 }
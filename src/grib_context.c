@@ -281,6 +281,7 @@ const char* grib_get_package_name()
 }
 
 #define DEFAULT_FILE_POOL_MAX_OPENED_FILES 0
+#define DEFAULT_THREADS_MIN_VALUES 1000000
 
 static grib_context default_grib_context = {
     0,               /* inited                     */
@@ -364,7 +365,15 @@ static grib_context default_grib_context = {
     0,                                 /* classes                    */
     0,                                 /* lists                      */
     0,                                 /* expanded_descriptors       */
-    DEFAULT_FILE_POOL_MAX_OPENED_FILES /* file_pool_max_opened_files */
+    DEFAULT_FILE_POOL_MAX_OPENED_FILES, /* file_pool_max_opened_files */
+    1,                                  /* threads                    */
+    DEFAULT_THREADS_MIN_VALUES,         /* threads_min_values         */
+    0,                                  /* thread_pool                */
+    1,                                  /* handle_arena               */
+    0,                                  /* values_cache_size          */
+    0,                                  /* values_cache               */
+    0,                                  /* offset_indexes             */
+    0                                   /* definitions_snapshot       */
 #if GRIB_PTHREADS
     ,
     PTHREAD_MUTEX_INITIALIZER /* mutex                      */
@@ -374,8 +383,15 @@ static grib_context default_grib_context = {
 /* Hopefully big enough. Note: Definitions and samples path environment variables can contain SEVERAL colon-separated directories */
 #define ECC_PATH_MAXLEN 8192
 
+/* Set once the default context is fully set up. Its 'inited' is set early,
+ * for the calls made while setting it up */
+static int default_grib_context_ready = 0;
+
 grib_context* grib_context_get_default()
 {
+    if (GRIB_LOCK_FREE_READS && GRIB_PUBLISHED(default_grib_context_ready))
+        return &default_grib_context;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init);
     GRIB_MUTEX_LOCK(&mutex_c);
 
@@ -396,6 +412,11 @@ grib_context* grib_context_get_default()
         const char* bufr_multi_element_constant_arrays  = NULL;
         const char* grib_data_quality_checks            = NULL;
         const char* file_pool_max_opened_files          = NULL;
+        const char* threads                             = NULL;
+        const char* threads_min_values                  = NULL;
+        const char* handle_arena                        = NULL;
+        const char* values_cache_size                   = NULL;
+        const char* definitions_snapshot                = NULL;
 
 #ifdef ENABLE_FLOATING_POINT_EXCEPTIONS
         feenableexcept(FE_ALL_EXCEPT & ~FE_INEXACT);
@@ -417,6 +438,11 @@ grib_context* grib_context_get_default()
         no_spd                              = codes_getenv("ECCODES_GRIB_NO_SPD");
         keep_matrix                         = codes_getenv("ECCODES_GRIB_KEEP_MATRIX");
         file_pool_max_opened_files          = getenv("ECCODES_FILE_POOL_MAX_OPENED_FILES");
+        threads                             = getenv("ECCODES_THREADS");
+        threads_min_values                  = getenv("ECCODES_THREADS_MIN_VALUES");
+        handle_arena                        = getenv("ECCODES_HANDLE_ARENA");
+        values_cache_size                   = getenv("ECCODES_VALUES_CACHE_SIZE");
+        definitions_snapshot                = getenv("ECCODES_DEFINITIONS_SNAPSHOT");
 
         /* On UNIX, when we read from a file we get exactly what is in the file on disk.
          * But on Windows a file can be opened in binary or text mode. In binary mode the system behaves exactly as in UNIX.
@@ -550,6 +576,14 @@ grib_context* grib_context_get_default()
         default_grib_context.bufr_multi_element_constant_arrays = bufr_multi_element_constant_arrays ? atoi(bufr_multi_element_constant_arrays) : 0;
         default_grib_context.grib_data_quality_checks = grib_data_quality_checks ? atoi(grib_data_quality_checks) : 0;
         default_grib_context.file_pool_max_opened_files = file_pool_max_opened_files ? atoi(file_pool_max_opened_files) : DEFAULT_FILE_POOL_MAX_OPENED_FILES;
+        default_grib_context.threads = threads ? atoi(threads) : 1;
+        default_grib_context.threads_min_values = threads_min_values ? (size_t)atol(threads_min_values) : DEFAULT_THREADS_MIN_VALUES;
+        default_grib_context.handle_arena = handle_arena ? atoi(handle_arena) : 1;
+        default_grib_context.values_cache_size = values_cache_size ? (size_t)atol(values_cache_size) : 0;
+        if (definitions_snapshot)
+            default_grib_context.definitions_snapshot = grib_definitions_snapshot_open(&default_grib_context, definitions_snapshot);
+
+        GRIB_PUBLISH(default_grib_context_ready, 1);
     }
 
     GRIB_MUTEX_UNLOCK(&mutex_c);
@@ -692,9 +726,8 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
         return (char*)basename;
     }
     else {
-        GRIB_MUTEX_LOCK(&mutex_c); /* See ECC-604 */
+        /* Lookups take no lock, see grib_trie_get */
         fullpath = (grib_string_list*)grib_trie_get(c->def_files, basename);
-        GRIB_MUTEX_UNLOCK(&mutex_c);
         if (fullpath != NULL) {
             return fullpath->value;
         }
@@ -713,14 +746,20 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
         while (dir) {
             sprintf(full, "%s/%s", dir->value, basename);
             if (!codes_access(full, F_OK)) {
+                grib_string_list* found = NULL;
                 fullpath = (grib_string_list*)grib_context_malloc_clear_persistent(c, sizeof(grib_string_list));
                 Assert(fullpath);
                 fullpath->value = grib_context_strdup(c, full);
+                /* Another thread may have found it first: its path, which others may hold, is kept */
                 GRIB_MUTEX_LOCK(&mutex_c);
-                grib_trie_insert(c->def_files, basename, fullpath);
+                found = (grib_string_list*)grib_trie_insert_no_replace(c->def_files, basename, fullpath);
                 grib_context_log(c, GRIB_LOG_DEBUG, "Found def file %s", full);
                 GRIB_MUTEX_UNLOCK(&mutex_c);
-                return fullpath->value;
+                if (found != fullpath) {
+                    grib_context_free(c, fullpath->value);
+                    grib_context_free_persistent(c, fullpath);
+                }
+                return found->value;
             }
             dir = dir->next;
         }
@@ -728,7 +767,7 @@ char* grib_context_full_defs_path(grib_context* c, const char* basename)
 
     GRIB_MUTEX_LOCK(&mutex_c);
     /* Store missing files so we don't check for them again and again */
-    grib_trie_insert(c->def_files, basename, &grib_file_not_found);
+    grib_trie_insert_no_replace(c->def_files, basename, &grib_file_not_found);
     /*grib_context_log(c,GRIB_LOG_ERROR,"Def file \"%s\" not found",basename);*/
     GRIB_MUTEX_UNLOCK(&mutex_c);
     full[0] = 0;
@@ -814,6 +853,10 @@ void grib_context_delete(grib_context* c)
 
     grib_hash_keys_delete(c->keys);
     grib_trie_delete(c->def_files);
+    grib_thread_pool_delete(c);
+    grib_values_cache_delete(c);
+    grib_offset_index_forget(c);
+    grib_definitions_snapshot_close(c);
 
     grib_context_reset(c);
     if (c != &default_grib_context)
@@ -859,6 +902,27 @@ void grib_context_set_samples_path(grib_context* c, const char* path)
 
     GRIB_MUTEX_UNLOCK(&mutex_c);
 }
+void grib_context_set_threads(grib_context* c, int threads)
+{
+    if (!c)
+        c = grib_context_get_default();
+    if (threads < 1)
+        threads = 1;
+    if (threads != c->threads) {
+        /* The pool is started again with the new size when next needed */
+        grib_thread_pool_delete(c);
+        c->threads = threads;
+    }
+    grib_context_log(c, GRIB_LOG_DEBUG, "Threads per field changed to: %d", threads);
+}
+
+void grib_context_set_values_cache_size(grib_context* c, size_t size)
+{
+    if (!c)
+        c = grib_context_get_default();
+    grib_values_cache_resize(c, size);
+    grib_context_log(c, GRIB_LOG_DEBUG, "Values cache size changed to: %lu", (unsigned long)size);
+}
 
 void* grib_context_malloc_persistent(const grib_context* c, size_t size)
 {
@@ -0,0 +1,1058 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ *
+ * Description: definitions snapshot
+ * The definition files parsed in advance, so that a process can build the trees of
+ * the files it needs without running the parser. The snapshot is written by the
+ * codes_definitions_snapshot tool and used when ECCODES_DEFINITIONS_SNAPSHOT names it.
+ *
+ * Layout (all integers big-endian, no pointers, so the file can be mapped anywhere):
+ *   header : "ECDS", version (4), count (8), ecCodes version (string),
+ *            definitions path (string)
+ *   record : offset of file name (8), kind (4), offset of tree (8), size of tree (8),
+ *            checksum of tree (4), one per file, sorted by file name
+ *   string : size (4, 0xffffffff for NULL), characters and a terminating NUL
+ *
+ * A tree is the sequence of constructor calls which make it: each action and
+ * expression is written as the index of its class followed by the arguments of its
+ * constructor (see the write_snapshot and read_snapshot methods of the classes).
+ * Replaying them rebuilds the names, tries and indexes the constructors derive.
+ *
+ * The snapshot is only used if it was written by the same version of ecCodes for the
+ * same definitions path. It must be written again after editing the definition files.
+ * A tree whose checksum does not match is not used: the file is parsed instead. If a
+ * tree turns out to be malformed while it is read, the nodes already built are not freed.
+ *
+ */
+
+#include "grib_api_internal.h"
+
+#ifndef ECCODES_ON_WINDOWS
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
+#define SNAPSHOT_MAGIC "ECDS"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_RECORD_SIZE 32
+#define SNAPSHOT_NULL_STRING 0xffffffff
+
+#define SNAPSHOT_ACTIONS 1
+#define SNAPSHOT_CONCEPT 2
+#define SNAPSHOT_HASH_ARRAY 3
+
+extern grib_action_class* grib_action_class_alias;
+extern grib_action_class* grib_action_class_assert;
+extern grib_action_class* grib_action_class_close;
+extern grib_action_class* grib_action_class_concept;
+extern grib_action_class* grib_action_class_gen;
+extern grib_action_class* grib_action_class_hash_array;
+extern grib_action_class* grib_action_class_if;
+extern grib_action_class* grib_action_class_include;
+extern grib_action_class* grib_action_class_list;
+extern grib_action_class* grib_action_class_meta;
+extern grib_action_class* grib_action_class_modify;
+extern grib_action_class* grib_action_class_noop;
+extern grib_action_class* grib_action_class_print;
+extern grib_action_class* grib_action_class_put;
+extern grib_action_class* grib_action_class_remove;
+extern grib_action_class* grib_action_class_rename;
+extern grib_action_class* grib_action_class_set;
+extern grib_action_class* grib_action_class_set_darray;
+extern grib_action_class* grib_action_class_set_iarray;
+extern grib_action_class* grib_action_class_set_missing;
+extern grib_action_class* grib_action_class_set_sarray;
+extern grib_action_class* grib_action_class_switch;
+extern grib_action_class* grib_action_class_template;
+extern grib_action_class* grib_action_class_transient_darray;
+extern grib_action_class* grib_action_class_trigger;
+extern grib_action_class* grib_action_class_variable;
+extern grib_action_class* grib_action_class_when;
+extern grib_action_class* grib_action_class_while;
+extern grib_action_class* grib_action_class_write;
+
+extern grib_expression_class* grib_expression_class_accessor;
+extern grib_expression_class* grib_expression_class_binop;
+extern grib_expression_class* grib_expression_class_double;
+extern grib_expression_class* grib_expression_class_functor;
+extern grib_expression_class* grib_expression_class_is_in_dict;
+extern grib_expression_class* grib_expression_class_is_in_list;
+extern grib_expression_class* grib_expression_class_is_integer;
+extern grib_expression_class* grib_expression_class_length;
+extern grib_expression_class* grib_expression_class_logical_and;
+extern grib_expression_class* grib_expression_class_logical_or;
+extern grib_expression_class* grib_expression_class_long;
+extern grib_expression_class* grib_expression_class_string;
+extern grib_expression_class* grib_expression_class_string_compare;
+extern grib_expression_class* grib_expression_class_sub_string;
+extern grib_expression_class* grib_expression_class_true;
+extern grib_expression_class* grib_expression_class_unop;
+
+/* The index of a class in these tables is what identifies it in a snapshot.
+ * Only append to them, and bump SNAPSHOT_VERSION if an entry has to change */
+static grib_action_class** action_classes[] = {
+    &grib_action_class_alias,
+    &grib_action_class_assert,
+    &grib_action_class_close,
+    &grib_action_class_concept,
+    &grib_action_class_gen,
+    &grib_action_class_hash_array,
+    &grib_action_class_if,
+    &grib_action_class_include,
+    &grib_action_class_list,
+    &grib_action_class_meta,
+    &grib_action_class_modify,
+    &grib_action_class_noop,
+    &grib_action_class_print,
+    &grib_action_class_put,
+    &grib_action_class_remove,
+    &grib_action_class_rename,
+    &grib_action_class_set,
+    &grib_action_class_set_darray,
+    &grib_action_class_set_iarray,
+    &grib_action_class_set_missing,
+    &grib_action_class_set_sarray,
+    &grib_action_class_switch,
+    &grib_action_class_template,
+    &grib_action_class_transient_darray,
+    &grib_action_class_trigger,
+    &grib_action_class_variable,
+    &grib_action_class_when,
+    &grib_action_class_while,
+    &grib_action_class_write,
+};
+
+static grib_expression_class** expression_classes[] = {
+    &grib_expression_class_accessor,
+    &grib_expression_class_binop,
+    &grib_expression_class_double,
+    &grib_expression_class_functor,
+    &grib_expression_class_is_in_dict,
+    &grib_expression_class_is_in_list,
+    &grib_expression_class_is_integer,
+    &grib_expression_class_length,
+    &grib_expression_class_logical_and,
+    &grib_expression_class_logical_or,
+    &grib_expression_class_long,
+    &grib_expression_class_string,
+    &grib_expression_class_string_compare,
+    &grib_expression_class_sub_string,
+    &grib_expression_class_true,
+    &grib_expression_class_unop,
+};
+
+#define NUMBER(x) (sizeof(x) / sizeof(x[0]))
+
+static void put_uint(unsigned char* p, unsigned long long val, int nbytes)
+{
+    int i;
+    for (i = nbytes - 1; i >= 0; i--) {
+        p[i] = (unsigned char)(val & 0xff);
+        val >>= 8;
+    }
+}
+
+static unsigned long long get_uint(const unsigned char* p, int nbytes)
+{
+    unsigned long long val = 0;
+    int i;
+    for (i = 0; i < nbytes; i++)
+        val = (val << 8) | p[i];
+    return val;
+}
+
+/* FNV-1a, to detect a damaged tree before using it */
+static unsigned long checksum(const unsigned char* p, size_t len)
+{
+    unsigned long h = 2166136261UL;
+    size_t i;
+    for (i = 0; i < len; i++)
+        h = ((h ^ p[i]) * 16777619UL) & 0xffffffffUL;
+    return h;
+}
+
+/* ---------------------------------------------------------------------------- */
+/* Writing trees                                                                */
+/* ---------------------------------------------------------------------------- */
+
+static void write_uint(grib_snapshot_writer* w, unsigned long long val, int nbytes)
+{
+    grib_buffer* b = w->buffer;
+    grib_grow_buffer(w->context, b, b->ulength + nbytes);
+    put_uint(b->data + b->ulength, val, nbytes);
+    b->ulength += nbytes;
+}
+
+void grib_snapshot_write_long(grib_snapshot_writer* w, long val)
+{
+    write_uint(w, (unsigned long long)(long long)val, 8);
+}
+
+void grib_snapshot_write_double(grib_snapshot_writer* w, double val)
+{
+    unsigned long long bits = 0;
+    Assert(sizeof(double) == sizeof(bits));
+    memcpy(&bits, &val, sizeof(bits));
+    write_uint(w, bits, 8);
+}
+
+void grib_snapshot_write_string(grib_snapshot_writer* w, const char* val)
+{
+    grib_buffer* b = w->buffer;
+    size_t len     = 0;
+    if (!val) {
+        write_uint(w, SNAPSHOT_NULL_STRING, 4);
+        return;
+    }
+    len = strlen(val);
+    write_uint(w, len, 4);
+    grib_grow_buffer(w->context, b, b->ulength + len + 1);
+    memcpy(b->data + b->ulength, val, len + 1);
+    b->ulength += len + 1;
+}
+
+static long action_class_index(grib_action_class* c)
+{
+    size_t i;
+    for (i = 0; i < NUMBER(action_classes); i++) {
+        if (*action_classes[i] == c)
+            return i;
+    }
+    return -1;
+}
+
+static long expression_class_index(grib_expression_class* c)
+{
+    size_t i;
+    for (i = 0; i < NUMBER(expression_classes); i++) {
+        if (*expression_classes[i] == c)
+            return i;
+    }
+    return -1;
+}
+
+void grib_snapshot_write_expression(grib_snapshot_writer* w, grib_expression* e)
+{
+    long i = 0;
+    if (!e) {
+        grib_snapshot_write_long(w, -1);
+        return;
+    }
+    i = expression_class_index(e->cclass);
+    if (i < 0 || !e->cclass->write_snapshot) {
+        grib_context_log(w->context, GRIB_LOG_ERROR, "grib_snapshot_write_expression: Expression class %s cannot be saved", e->cclass->name);
+        w->err = GRIB_NOT_IMPLEMENTED;
+        return;
+    }
+    grib_snapshot_write_long(w, i);
+    e->cclass->write_snapshot(e, w);
+}
+
+void grib_snapshot_write_arguments(grib_snapshot_writer* w, grib_arguments* args)
+{
+    long n             = 0;
+    grib_arguments* an = args;
+    while (an) {
+        n++;
+        an = an->next;
+    }
+    grib_snapshot_write_long(w, n);
+    for (an = args; an; an = an->next)
+        grib_snapshot_write_expression(w, an->expression);
+}
+
+static void write_action(grib_snapshot_writer* w, grib_action* a)
+{
+    long i = action_class_index(a->cclass);
+    if (i < 0 || !a->cclass->write_snapshot) {
+        grib_context_log(w->context, GRIB_LOG_ERROR, "grib_snapshot_write_actions: Action class %s cannot be saved", a->cclass->name);
+        w->err = GRIB_NOT_IMPLEMENTED;
+        return;
+    }
+    grib_snapshot_write_long(w, i);
+    a->cclass->write_snapshot(a, w);
+}
+
+void grib_snapshot_write_actions(grib_snapshot_writer* w, grib_action* actions)
+{
+    long n         = 0;
+    grib_action* a = actions;
+    while (a) {
+        n++;
+        a = a->next;
+    }
+    grib_snapshot_write_long(w, n);
+    for (a = actions; a; a = a->next)
+        write_action(w, a);
+}
+
+void grib_snapshot_write_cases(grib_snapshot_writer* w, grib_case* cases)
+{
+    long n       = 0;
+    grib_case* c = cases;
+    while (c) {
+        n++;
+        c = c->next;
+    }
+    grib_snapshot_write_long(w, n);
+    for (c = cases; c; c = c->next) {
+        grib_snapshot_write_arguments(w, c->values);
+        grib_snapshot_write_actions(w, c->action);
+    }
+}
+
+void grib_snapshot_write_iarray(grib_snapshot_writer* w, grib_iarray* v)
+{
+    size_t i = 0;
+    size_t n = v ? grib_iarray_used_size(v) : 0;
+    grib_snapshot_write_long(w, n);
+    for (i = 0; i < n; i++)
+        grib_snapshot_write_long(w, v->v[i]);
+}
+
+void grib_snapshot_write_darray(grib_snapshot_writer* w, grib_darray* v)
+{
+    size_t i = 0;
+    size_t n = v ? v->n : 0;
+    grib_snapshot_write_long(w, n);
+    for (i = 0; i < n; i++)
+        grib_snapshot_write_double(w, v->v[i]);
+}
+
+void grib_snapshot_write_sarray(grib_snapshot_writer* w, grib_sarray* v)
+{
+    size_t i = 0;
+    size_t n = v ? v->n : 0;
+    grib_snapshot_write_long(w, n);
+    for (i = 0; i < n; i++)
+        grib_snapshot_write_string(w, v->v[i]);
+}
+
+void grib_snapshot_write_concept(grib_snapshot_writer* w, grib_concept_value* concept)
+{
+    long n                  = 0;
+    grib_concept_value* cv = concept;
+    while (cv) {
+        n++;
+        cv = cv->next;
+    }
+    grib_snapshot_write_long(w, n);
+    for (cv = concept; cv; cv = cv->next) {
+        grib_concept_condition* cc = cv->conditions;
+        grib_snapshot_write_string(w, cv->name);
+        for (n = 0; cc; cc = cc->next)
+            n++;
+        grib_snapshot_write_long(w, n);
+        for (cc = cv->conditions; cc; cc = cc->next) {
+            grib_snapshot_write_string(w, cc->name);
+            grib_snapshot_write_expression(w, cc->expression);
+            grib_snapshot_write_iarray(w, cc->iarray);
+        }
+    }
+}
+
+void grib_snapshot_write_hash_array(grib_snapshot_writer* w, grib_hash_array_value* hash_array)
+{
+    long n                    = 0;
+    grib_hash_array_value* ha = hash_array;
+    while (ha) {
+        n++;
+        ha = ha->next;
+    }
+    grib_snapshot_write_long(w, n);
+    for (ha = hash_array; ha; ha = ha->next) {
+        grib_snapshot_write_string(w, ha->name);
+        grib_snapshot_write_long(w, ha->type);
+        if (ha->type == GRIB_HASH_ARRAY_TYPE_INTEGER)
+            grib_snapshot_write_iarray(w, ha->iarray);
+        else
+            grib_snapshot_write_darray(w, ha->darray);
+    }
+}
+
+/* ---------------------------------------------------------------------------- */
+/* Reading trees                                                                */
+/* ---------------------------------------------------------------------------- */
+
+static int read_available(grib_snapshot_reader* r, size_t nbytes)
+{
+    if (r->err)
+        return 0;
+    if ((size_t)(r->end - r->p) < nbytes) {
+        r->err = GRIB_INVALID_FILE;
+        return 0;
+    }
+    return 1;
+}
+
+int grib_snapshot_read_failed(const grib_snapshot_reader* r)
+{
+    return r->err != GRIB_SUCCESS;
+}
+
+long grib_snapshot_read_long(grib_snapshot_reader* r)
+{
+    long val = 0;
+    if (!read_available(r, 8))
+        return 0;
+    val = (long)(long long)get_uint(r->p, 8);
+    r->p += 8;
+    return val;
+}
+
+double grib_snapshot_read_double(grib_snapshot_reader* r)
+{
+    unsigned long long bits = 0;
+    double val              = 0;
+    if (!read_available(r, 8))
+        return 0;
+    bits = get_uint(r->p, 8);
+    memcpy(&val, &bits, sizeof(val));
+    r->p += 8;
+    return val;
+}
+
+/* The string points into the snapshot: the constructors take their own copy */
+const char* grib_snapshot_read_string(grib_snapshot_reader* r)
+{
+    const char* val = NULL;
+    size_t len      = 0;
+    if (!read_available(r, 4))
+        return NULL;
+    len = (size_t)get_uint(r->p, 4);
+    r->p += 4;
+    if (len == SNAPSHOT_NULL_STRING)
+        return NULL;
+    if (!read_available(r, len + 1) || r->p[len] != 0) {
+        r->err = GRIB_INVALID_FILE;
+        return NULL;
+    }
+    val = (const char*)r->p;
+    r->p += len + 1;
+    return val;
+}
+
+/* A count of items which each take at least one octet */
+static long read_count(grib_snapshot_reader* r)
+{
+    long n = grib_snapshot_read_long(r);
+    if (n < 0 || (size_t)n > (size_t)(r->end - r->p)) {
+        if (!r->err)
+            r->err = GRIB_INVALID_FILE;
+        return 0;
+    }
+    return n;
+}
+
+grib_expression* grib_snapshot_read_expression(grib_snapshot_reader* r)
+{
+    grib_expression_class* c = NULL;
+    grib_expression* e       = NULL;
+    long i                   = grib_snapshot_read_long(r);
+    if (r->err || i == -1)
+        return NULL;
+    if (i < 0 || i >= (long)NUMBER(expression_classes) || !(*expression_classes[i])->read_snapshot) {
+        r->err = GRIB_INVALID_FILE;
+        return NULL;
+    }
+    c = *expression_classes[i];
+    e = c->read_snapshot(r->context, r);
+    if (!e && !r->err)
+        r->err = GRIB_INVALID_FILE;
+    return e;
+}
+
+grib_arguments* grib_snapshot_read_arguments(grib_snapshot_reader* r)
+{
+    grib_arguments* first = NULL;
+    grib_arguments* last  = NULL;
+    long n                = read_count(r);
+    long i                = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        grib_arguments* an = grib_arguments_new(r->context, grib_snapshot_read_expression(r), NULL);
+        if (last)
+            last->next = an;
+        else
+            first = an;
+        last = an;
+    }
+    return first;
+}
+
+static grib_action* read_action(grib_snapshot_reader* r)
+{
+    grib_action_class* c = NULL;
+    grib_action* a       = NULL;
+    long i               = grib_snapshot_read_long(r);
+    if (r->err)
+        return NULL;
+    if (i < 0 || i >= (long)NUMBER(action_classes) || !(*action_classes[i])->read_snapshot) {
+        r->err = GRIB_INVALID_FILE;
+        return NULL;
+    }
+    c = *action_classes[i];
+    a = c->read_snapshot(r->context, r);
+    if (!a && !r->err)
+        r->err = GRIB_INVALID_FILE;
+    return a;
+}
+
+grib_action* grib_snapshot_read_actions(grib_snapshot_reader* r)
+{
+    grib_action* first = NULL;
+    grib_action* last  = NULL;
+    long n             = read_count(r);
+    long i             = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        grib_action* a = read_action(r);
+        if (!a)
+            break;
+        if (last)
+            last->next = a;
+        else
+            first = a;
+        last = a;
+    }
+    return first;
+}
+
+grib_case* grib_snapshot_read_cases(grib_snapshot_reader* r)
+{
+    grib_case* first = NULL;
+    grib_case* last  = NULL;
+    long n           = read_count(r);
+    long i           = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        grib_arguments* values = grib_snapshot_read_arguments(r);
+        grib_action* action    = grib_snapshot_read_actions(r);
+        grib_case* c           = grib_case_new(r->context, values, action);
+        if (last)
+            last->next = c;
+        else
+            first = c;
+        last = c;
+    }
+    return first;
+}
+
+grib_iarray* grib_snapshot_read_iarray(grib_snapshot_reader* r)
+{
+    grib_iarray* v = NULL;
+    long n         = read_count(r);
+    long i         = 0;
+    for (i = 0; i < n && !r->err; i++)
+        v = grib_iarray_push(v, grib_snapshot_read_long(r));
+    return v;
+}
+
+grib_darray* grib_snapshot_read_darray(grib_snapshot_reader* r)
+{
+    grib_darray* v = NULL;
+    long n         = read_count(r);
+    long i         = 0;
+    for (i = 0; i < n && !r->err; i++)
+        v = grib_darray_push(r->context, v, grib_snapshot_read_double(r));
+    return v;
+}
+
+/* The strings are allocated like those of the parser */
+grib_sarray* grib_snapshot_read_sarray(grib_snapshot_reader* r)
+{
+    grib_sarray* v = NULL;
+    long n         = read_count(r);
+    long i         = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        const char* s = grib_snapshot_read_string(r);
+        if (s)
+            v = grib_sarray_push(r->context, v, strdup(s));
+    }
+    return v;
+}
+
+grib_concept_value* grib_snapshot_read_concept(grib_snapshot_reader* r)
+{
+    grib_concept_value* first = NULL;
+    grib_concept_value* last  = NULL;
+    long n                    = read_count(r);
+    long i                    = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        grib_concept_condition* conditions = NULL;
+        grib_concept_condition* lastc      = NULL;
+        grib_concept_value* cv             = NULL;
+        const char* name                   = grib_snapshot_read_string(r);
+        long nc                            = read_count(r);
+        long j                             = 0;
+        for (j = 0; j < nc && !r->err; j++) {
+            const char* cname          = grib_snapshot_read_string(r);
+            grib_expression* e         = grib_snapshot_read_expression(r);
+            grib_iarray* iarray        = grib_snapshot_read_iarray(r);
+            grib_concept_condition* cc = grib_concept_condition_new(r->context, cname, e, iarray);
+            if (lastc)
+                lastc->next = cc;
+            else
+                conditions = cc;
+            lastc = cc;
+        }
+        if (r->err)
+            break;
+        cv = grib_concept_value_new(r->context, name, conditions);
+        if (last)
+            last->next = cv;
+        else
+            first = cv;
+        last = cv;
+    }
+    return first;
+}
+
+grib_hash_array_value* grib_snapshot_read_hash_array(grib_snapshot_reader* r)
+{
+    grib_hash_array_value* first = NULL;
+    grib_hash_array_value* last  = NULL;
+    long n                       = read_count(r);
+    long i                       = 0;
+    for (i = 0; i < n && !r->err; i++) {
+        grib_hash_array_value* ha = NULL;
+        const char* name          = grib_snapshot_read_string(r);
+        long type                 = grib_snapshot_read_long(r);
+        if (type == GRIB_HASH_ARRAY_TYPE_INTEGER)
+            ha = grib_integer_hash_array_value_new(r->context, name, grib_snapshot_read_iarray(r));
+        else
+            ha = grib_double_hash_array_value_new(r->context, name, grib_snapshot_read_darray(r));
+        if (r->err)
+            break;
+        if (last)
+            last->next = ha;
+        else
+            first = ha;
+        last = ha;
+    }
+    return first;
+}
+
+/* ---------------------------------------------------------------------------- */
+/* Snapshot files                                                               */
+/* ---------------------------------------------------------------------------- */
+
+/* A string of the header. Returns NULL if it does not fit in the snapshot */
+static const char* header_string(const unsigned char* data, size_t size, size_t* pos)
+{
+    size_t len = 0;
+    if (size - *pos < 4)
+        return NULL;
+    len = (size_t)get_uint(data + *pos, 4);
+    if (len == SNAPSHOT_NULL_STRING || size - *pos - 4 < len + 1 || data[*pos + 4 + len] != 0)
+        return NULL;
+    *pos += 4 + len + 1;
+    return (const char*)data + *pos - len - 1;
+}
+
+/* Check what a lookup relies on: the header and that every record points into the snapshot */
+static int snapshot_is_valid(grib_context* c, grib_definitions_snapshot* ds, const char* filename)
+{
+    const unsigned char* data = ds->data;
+    size_t size               = ds->size;
+    size_t pos                = 16;
+    const char* version       = NULL;
+    long i                    = 0;
+
+    if (size < pos || memcmp(data, SNAPSHOT_MAGIC, 4) != 0 || get_uint(data + 4, 4) != SNAPSHOT_VERSION)
+        return 0;
+    ds->count = (long)get_uint(data + 8, 8);
+    version   = header_string(data, size, &pos);
+    if (!version || strcmp(version, ECCODES_VERSION_STR) != 0) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "grib_definitions_snapshot_open: %s was not written by ecCodes %s",
+                         filename, ECCODES_VERSION_STR);
+        return 0;
+    }
+    ds->definitions_path = header_string(data, size, &pos);
+    if (!ds->definitions_path || ds->count < 0 || (size - pos) / SNAPSHOT_RECORD_SIZE < (size_t)ds->count)
+        return 0;
+    ds->records = data + pos;
+
+    for (i = 0; i < ds->count; i++) {
+        const unsigned char* rec = ds->records + i * SNAPSHOT_RECORD_SIZE;
+        unsigned long long name  = get_uint(rec, 8);
+        unsigned long long tree  = get_uint(rec + 12, 8);
+        unsigned long long len   = get_uint(rec + 20, 8);
+        if (name >= size || !memchr(data + name, 0, size - name))
+            return 0;
+        if (tree > size || len > size - tree)
+            return 0;
+    }
+    return 1;
+}
+
+static void snapshot_release(grib_context* c, grib_definitions_snapshot* ds)
+{
+#ifndef ECCODES_ON_WINDOWS
+    if (ds->mapped)
+        munmap(ds->data, ds->size);
+    else
+#endif
+        grib_context_free(c, ds->data);
+    grib_context_free(c, ds->filename);
+    grib_context_free(c, ds);
+}
+
+/* Map (or read) a snapshot. Returns NULL if there is none or it cannot be used */
+grib_definitions_snapshot* grib_definitions_snapshot_open(grib_context* c, const char* filename)
+{
+    grib_definitions_snapshot* ds = NULL;
+    unsigned char* data           = NULL;
+    size_t size                   = 0;
+    int mapped                    = 0;
+#ifndef ECCODES_ON_WINDOWS
+    struct stat st;
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "grib_definitions_snapshot_open: Unable to open %s", filename);
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    size = st.st_size;
+    data = (unsigned char*)mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+    mapped = 1;
+#else
+    FILE* f = fopen(filename, "rb");
+    if (!f) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "grib_definitions_snapshot_open: Unable to open %s", filename);
+        return NULL;
+    }
+    fseeko(f, 0, SEEK_END);
+    size = ftello(f);
+    fseeko(f, 0, SEEK_SET);
+    data = (unsigned char*)grib_context_malloc(c, size);
+    if (!data || fread(data, 1, size, f) != size) {
+        grib_context_free(c, data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+#endif
+
+    ds           = (grib_definitions_snapshot*)grib_context_malloc_clear(c, sizeof(grib_definitions_snapshot));
+    ds->data     = data;
+    ds->size     = size;
+    ds->mapped   = mapped;
+    ds->filename = grib_context_strdup(c, filename);
+
+    if (!snapshot_is_valid(c, ds, filename)) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "grib_definitions_snapshot_open: Ignoring invalid snapshot %s", filename);
+        snapshot_release(c, ds);
+        return NULL;
+    }
+    grib_context_log(c, GRIB_LOG_DEBUG, "grib_definitions_snapshot_open: Using %s (%ld files)", filename, ds->count);
+    return ds;
+}
+
+void grib_definitions_snapshot_close(grib_context* c)
+{
+    if (c->definitions_snapshot) {
+        snapshot_release(c, c->definitions_snapshot);
+        c->definitions_snapshot = NULL;
+    }
+}
+
+static void snapshot_damaged(grib_context* c, const char* filename)
+{
+    grib_context_log(c, GRIB_LOG_WARNING, "Definitions snapshot %s is damaged: parsing %s",
+                     c->definitions_snapshot->filename, filename);
+}
+
+/* The tree of a file, if the snapshot of the context has one of that kind */
+static int snapshot_find(grib_context* c, const char* filename, int kind, grib_snapshot_reader* r)
+{
+    grib_definitions_snapshot* ds = c->definitions_snapshot;
+    long lo                       = 0;
+    long hi                       = 0;
+
+    if (!ds)
+        return 0;
+    if (!c->grib_definition_files_path || strcmp(ds->definitions_path, c->grib_definition_files_path) != 0) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "Ignoring definitions snapshot %s written for definitions path %s",
+                         ds->filename, ds->definitions_path);
+        return 0;
+    }
+
+    hi = ds->count - 1;
+    while (lo <= hi) {
+        long mid                 = lo + (hi - lo) / 2;
+        const unsigned char* rec = ds->records + mid * SNAPSHOT_RECORD_SIZE;
+        int cmp                  = strcmp((const char*)ds->data + get_uint(rec, 8), filename);
+        if (cmp < 0) {
+            lo = mid + 1;
+        }
+        else if (cmp > 0) {
+            hi = mid - 1;
+        }
+        else {
+            if (get_uint(rec + 8, 4) != (unsigned long long)kind)
+                return 0;
+            r->context = c;
+            r->p       = ds->data + get_uint(rec + 12, 8);
+            r->end     = r->p + get_uint(rec + 20, 8);
+            r->err     = GRIB_SUCCESS;
+            if (checksum(r->p, r->end - r->p) != get_uint(rec + 28, 4)) {
+                snapshot_damaged(c, filename);
+                return 0;
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+grib_action* grib_definitions_snapshot_actions(grib_context* c, const char* filename)
+{
+    grib_snapshot_reader r;
+    grib_action* a = NULL;
+    if (!snapshot_find(c, filename, SNAPSHOT_ACTIONS, &r))
+        return NULL;
+    a = grib_snapshot_read_actions(&r);
+    if (r.err || !a || r.p != r.end) {
+        snapshot_damaged(c, filename);
+        return NULL;
+    }
+    grib_context_log(c, GRIB_LOG_DEBUG, "Loading %s from the definitions snapshot", filename);
+    return a;
+}
+
+grib_concept_value* grib_definitions_snapshot_concept(grib_context* c, const char* filename)
+{
+    grib_snapshot_reader r;
+    grib_concept_value* concept = NULL;
+    if (!snapshot_find(c, filename, SNAPSHOT_CONCEPT, &r))
+        return NULL;
+    concept = grib_snapshot_read_concept(&r);
+    if (r.err || !concept || r.p != r.end) {
+        snapshot_damaged(c, filename);
+        return NULL;
+    }
+    grib_context_log(c, GRIB_LOG_DEBUG, "Loading %s from the definitions snapshot", filename);
+    return concept;
+}
+
+grib_hash_array_value* grib_definitions_snapshot_hash_array(grib_context* c, const char* filename)
+{
+    grib_snapshot_reader r;
+    grib_hash_array_value* hash_array = NULL;
+    if (!snapshot_find(c, filename, SNAPSHOT_HASH_ARRAY, &r))
+        return NULL;
+    hash_array = grib_snapshot_read_hash_array(&r);
+    if (r.err || !hash_array || r.p != r.end) {
+        snapshot_damaged(c, filename);
+        return NULL;
+    }
+    grib_context_log(c, GRIB_LOG_DEBUG, "Loading %s from the definitions snapshot", filename);
+    return hash_array;
+}
+
+/* ---------------------------------------------------------------------------- */
+/* Writing snapshots                                                            */
+/* ---------------------------------------------------------------------------- */
+
+grib_snapshot_writer* grib_snapshot_writer_new(grib_context* c)
+{
+    grib_snapshot_writer* w = NULL;
+    if (!c)
+        c = grib_context_get_default();
+    w          = (grib_snapshot_writer*)grib_context_malloc_clear(c, sizeof(grib_snapshot_writer));
+    w->context = c;
+    w->buffer  = grib_create_growable_buffer(c);
+    if (!w->buffer) {
+        grib_context_free(c, w);
+        return NULL;
+    }
+    return w;
+}
+
+void grib_snapshot_writer_delete(grib_snapshot_writer* w)
+{
+    long i = 0;
+    if (!w)
+        return;
+    for (i = 0; i < w->count; i++)
+        grib_context_free(w->context, w->files[i].filename);
+    grib_context_free(w->context, w->files);
+    grib_buffer_delete(w->context, w->buffer);
+    grib_context_free(w->context, w);
+}
+
+/* Parse a definition file (a name relative to the definitions path, as in an include)
+ * and add its tree. A file found twice in the definitions path is added once */
+int grib_snapshot_writer_add_file(grib_snapshot_writer* w, const char* filename)
+{
+    grib_context* c                   = w->context;
+    grib_action* actions              = NULL;
+    grib_concept_value* concept       = NULL;
+    grib_hash_array_value* hash_array = NULL;
+    grib_snapshot_file* file          = NULL;
+    const char* full                  = grib_context_full_defs_path(c, filename);
+    size_t start                      = w->buffer->ulength;
+    int err                           = 0;
+    long i                            = 0;
+
+    if (!full)
+        return GRIB_FILE_NOT_FOUND;
+    for (i = 0; i < w->count; i++) {
+        if (strcmp(w->files[i].filename, full) == 0)
+            return GRIB_SUCCESS;
+    }
+
+    err = grib_parse_definition_file(c, full, &actions, &concept, &hash_array);
+    if (err)
+        return err;
+
+    w->err = GRIB_SUCCESS;
+    if (concept) {
+        grib_snapshot_write_concept(w, concept);
+        while (concept) {
+            grib_concept_value* next = concept->next;
+            grib_concept_value_delete(c, concept);
+            concept = next;
+        }
+        i = SNAPSHOT_CONCEPT;
+    }
+    else if (hash_array) {
+        grib_snapshot_write_hash_array(w, hash_array);
+        while (hash_array) {
+            grib_hash_array_value* next = hash_array->next;
+            grib_hash_array_value_delete(c, hash_array);
+            hash_array = next;
+        }
+        i = SNAPSHOT_HASH_ARRAY;
+    }
+    else {
+        grib_snapshot_write_actions(w, actions);
+        while (actions) {
+            grib_action* next = actions->next;
+            grib_action_delete(c, actions);
+            actions = next;
+        }
+        i = SNAPSHOT_ACTIONS;
+    }
+    if (w->err) {
+        w->buffer->ulength = start;
+        return w->err;
+    }
+
+    if (w->count == w->size) {
+        w->size  = w->size ? 2 * w->size : 256;
+        w->files = (grib_snapshot_file*)grib_context_realloc(c, w->files, w->size * sizeof(grib_snapshot_file));
+        if (!w->files)
+            return GRIB_OUT_OF_MEMORY;
+    }
+    file           = &w->files[w->count++];
+    file->filename = grib_context_strdup(c, full);
+    file->kind     = (int)i;
+    file->offset   = start;
+    file->length   = w->buffer->ulength - start;
+    return GRIB_SUCCESS;
+}
+
+static int compare_files(const void* a, const void* b)
+{
+    return strcmp(((const grib_snapshot_file*)a)->filename, ((const grib_snapshot_file*)b)->filename);
+}
+
+static size_t put_string(unsigned char* p, const char* s)
+{
+    size_t len = strlen(s);
+    put_uint(p, len, 4);
+    memcpy(p + 4, s, len + 1);
+    return 4 + len + 1;
+}
+
+/* Write to a temporary file first so that readers never see a partial snapshot */
+int grib_snapshot_writer_save(grib_snapshot_writer* w, const char* filename)
+{
+    grib_context* c      = w->context;
+    const char* defspath = c->grib_definition_files_path ? c->grib_definition_files_path : "";
+    unsigned char* data  = NULL;
+    size_t records       = 0;
+    size_t names         = 0;
+    size_t trees         = 0;
+    size_t size          = 0;
+    size_t pos           = 0;
+    char* tmpname        = NULL;
+    FILE* f              = NULL;
+    int err              = GRIB_SUCCESS;
+    long i               = 0;
+
+    qsort(w->files, w->count, sizeof(grib_snapshot_file), &compare_files);
+
+    records = 16 + 4 + strlen(ECCODES_VERSION_STR) + 1 + 4 + strlen(defspath) + 1;
+    names   = records + w->count * SNAPSHOT_RECORD_SIZE;
+    trees   = names;
+    for (i = 0; i < w->count; i++)
+        trees += strlen(w->files[i].filename) + 1;
+    size = trees + w->buffer->ulength;
+
+    data = (unsigned char*)grib_context_malloc_clear(c, size);
+    if (!data)
+        return GRIB_OUT_OF_MEMORY;
+    memcpy(data, SNAPSHOT_MAGIC, 4);
+    put_uint(data + 4, SNAPSHOT_VERSION, 4);
+    put_uint(data + 8, w->count, 8);
+    pos = 16;
+    pos += put_string(data + pos, ECCODES_VERSION_STR);
+    pos += put_string(data + pos, defspath);
+    Assert(pos == records);
+
+    pos = names;
+    for (i = 0; i < w->count; i++) {
+        unsigned char* rec = data + records + i * SNAPSHOT_RECORD_SIZE;
+        size_t len         = strlen(w->files[i].filename);
+        put_uint(rec, pos, 8);
+        put_uint(rec + 8, w->files[i].kind, 4);
+        put_uint(rec + 12, trees + w->files[i].offset, 8);
+        put_uint(rec + 20, w->files[i].length, 8);
+        put_uint(rec + 28, checksum(w->buffer->data + w->files[i].offset, w->files[i].length), 4);
+        memcpy(data + pos, w->files[i].filename, len + 1);
+        pos += len + 1;
+    }
+    memcpy(data + trees, w->buffer->data, w->buffer->ulength);
+
+    tmpname = (char*)grib_context_malloc(c, strlen(filename) + 32);
+#ifndef ECCODES_ON_WINDOWS
+    sprintf(tmpname, "%s.%ld", filename, (long)getpid());
+#else
+    strcpy(tmpname, filename);
+#endif
+    f = fopen(tmpname, "wb");
+    if (!f) {
+        grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "grib_snapshot_writer_save: Unable to create %s", tmpname);
+        grib_context_free(c, tmpname);
+        grib_context_free(c, data);
+        return GRIB_IO_PROBLEM;
+    }
+    if (fwrite(data, 1, size, f) != size)
+        err = GRIB_IO_PROBLEM;
+    if (fclose(f) != 0)
+        err = GRIB_IO_PROBLEM;
+#ifndef ECCODES_ON_WINDOWS
+    if (err == GRIB_SUCCESS && rename(tmpname, filename) != 0)
+        err = GRIB_IO_PROBLEM;
+    if (err)
+        unlink(tmpname);
+#endif
+    grib_context_free(c, tmpname);
+    grib_context_free(c, data);
+    return err;
+}
@@ -42,11 +42,47 @@ static grib_handle* handle_of(grib_accessor* observed)
     return h;
 }
 
+/*
+ * Dependencies are kept in a list, in the order they were added, and are
+ * also indexed by observer/observed pair so that adding one does not need a
+ * scan of the whole list. Removing an accessor only clears its pointers in
+ * the entries, which then never match again.
+ */
+#define DEPENDENCIES_INDEX_MIN_SIZE 128
+
+static unsigned long dependency_hash(const grib_accessor* observer, const grib_accessor* observed)
+{
+    unsigned long a = (unsigned long)(size_t)observer;
+    unsigned long b = (unsigned long)(size_t)observed;
+    return (a >> 4) * 31 + (b >> 4);
+}
+
+static int dependencies_index_grow(grib_handle* h)
+{
+    size_t size             = h->dependencies_index_size ? h->dependencies_index_size * 2 : DEPENDENCIES_INDEX_MIN_SIZE;
+    grib_dependency** index = (grib_dependency**)grib_context_malloc_clear(h->context, size * sizeof(grib_dependency*));
+    grib_dependency* d      = h->dependencies;
+
+    if (!index)
+        return GRIB_OUT_OF_MEMORY;
+
+    while (d) {
+        size_t i     = d->hash % size;
+        d->hash_next = index[i];
+        index[i]     = d;
+        d            = d->next;
+    }
+    grib_context_free(h->context, h->dependencies_index);
+    h->dependencies_index      = index;
+    h->dependencies_index_size = size;
+    return GRIB_SUCCESS;
+}
+
 void grib_dependency_add(grib_accessor* observer, grib_accessor* observed)
 {
-    grib_handle* h        = handle_of(observed);
-    grib_dependency* d    = h->dependencies;
-    grib_dependency* last = 0;
+    grib_handle* h     = NULL;
+    grib_dependency* d = NULL;
+    unsigned long hash = 0;
 
     /*printf("observe %p %p %s %s\n",(void*)observed,(void*)observer, observed?observed->name:"NULL",
     observer?observer->name:"NULL");*/
@@ -55,43 +91,50 @@ void grib_dependency_add(grib_accessor* observer, grib_accessor* observed)
         return;
     }
 
+    h = handle_of(observed);
     /* Assert(h == handle_of(observer)); */
 
+    if (h->dependencies_count >= h->dependencies_index_size / 2)
+        dependencies_index_grow(h);
+
     /* Check if already in list */
-    while (d) {
-        if (d->observer == observer && d->observed == observed)
-            return;
-        last = d;
-        d    = d->next;
+    hash = dependency_hash(observer, observed);
+    if (h->dependencies_index) {
+        d = h->dependencies_index[hash % h->dependencies_index_size];
+        while (d) {
+            if (d->observer == observer && d->observed == observed)
+                return;
+            d = d->hash_next;
+        }
     }
-
-#if 0
-    d = h->dependencies;
-    while(d)
-    {
-        last = d;
-        d = d->next;
+    else {
+        for (d = h->dependencies; d; d = d->next) {
+            if (d->observer == observer && d->observed == observed)
+                return;
+        }
     }
 
-#endif
-
-    d = (grib_dependency*)grib_context_malloc_clear(h->context, sizeof(grib_dependency));
+    d = (grib_dependency*)grib_handle_malloc_clear(h, sizeof(grib_dependency));
     Assert(d);
 
     d->observed = observed;
     d->observer = observer;
     d->next     = 0;
+    d->hash     = hash;
 
     /*printf("observe %p %p %s %s\n",(void*)observed,(void*)observer, observed->name,observer->name);*/
-#if 0
-    d->next     = h->dependencies;
-    h->dependencies = d;
-#endif
-
-    if (last)
-        last->next = d;
+    if (h->dependencies_last)
+        h->dependencies_last->next = d;
     else
         h->dependencies = d;
+    h->dependencies_last = d;
+    h->dependencies_count++;
+
+    if (h->dependencies_index) {
+        size_t i                 = hash % h->dependencies_index_size;
+        d->hash_next             = h->dependencies_index[i];
+        h->dependencies_index[i] = d;
+    }
 }
 
 void grib_dependency_remove_observed(grib_accessor* observed)
@@ -137,6 +180,19 @@ int grib_dependency_notify_change(grib_accessor* observed)
 
 /* This version takes in the handle so does not need to work it out from the 'observed' */
 /* See ECC-778 */
+/* Whether a change of 'observed' rebuilds a section */
+int grib_dependency_triggers_reparse(grib_accessor* observed)
+{
+    grib_dependency* d = handle_of(observed)->dependencies;
+
+    while (d) {
+        if (d->observed == observed && d->observer && d->observer->sub_section)
+            return 1;
+        d = d->next;
+    }
+    return 0;
+}
+
 int _grib_dependency_notify_change(grib_handle* h, grib_accessor* observed)
 {
     grib_dependency* d = h->dependencies;
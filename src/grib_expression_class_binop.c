@@ -21,6 +21,7 @@
    IMPLEMENTS = evaluate_double
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *left
    MEMBERS = grib_expression *right
    MEMBERS = grib_binop_long_proc    long_func
@@ -54,6 +55,9 @@ static int native_type(grib_expression*, grib_handle*);
 static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_binop
 {
     grib_expression base;
@@ -83,6 +87,9 @@ static grib_expression_class _grib_expression_class_binop = {
     &evaluate_long,
     &evaluate_double,
     0,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_binop = &_grib_expression_class_binop;
@@ -211,3 +218,24 @@ static int native_type(grib_expression* g, grib_handle* h)
     }
     return e->long_func ? GRIB_TYPE_LONG : GRIB_TYPE_DOUBLE;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_binop* e = (grib_expression_binop*)g;
+    grib_snapshot_write_string(w, grib_binop_long_proc_name(e->long_func));
+    grib_snapshot_write_string(w, grib_binop_double_proc_name(e->double_func));
+    grib_snapshot_write_expression(w, e->left);
+    grib_snapshot_write_expression(w, e->right);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* long_func   = grib_snapshot_read_string(r);
+    const char* double_func = grib_snapshot_read_string(r);
+    grib_expression* left   = grib_snapshot_read_expression(r);
+    grib_expression* right  = grib_snapshot_read_expression(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_binop_expression(c, grib_binop_long_proc_by_name(long_func), grib_binop_double_proc_by_name(double_func), left, right);
+}
@@ -21,6 +21,7 @@
    IMPLEMENTS = evaluate_double
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = double value
    END_CLASS_DEF
 
@@ -50,6 +51,9 @@ static int native_type(grib_expression*, grib_handle*);
 static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_double
 {
     grib_expression base;
@@ -75,6 +79,9 @@ static grib_expression_class _grib_expression_class_double = {
     &evaluate_long,
     &evaluate_double,
     0,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_double = &_grib_expression_class_double;
@@ -127,3 +134,18 @@ static int native_type(grib_expression* g, grib_handle* h)
 {
     return GRIB_TYPE_DOUBLE;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_double* e = (grib_expression_double*)g;
+    grib_snapshot_write_double(w, e->value);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    double value = grib_snapshot_read_double(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_double_expression(c, value);
+}
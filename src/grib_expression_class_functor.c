@@ -20,6 +20,7 @@
    IMPLEMENTS = evaluate_long
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char *name
    MEMBERS    = grib_arguments *args
    END_CLASS_DEF
@@ -49,6 +50,9 @@ static int native_type(grib_expression*, grib_handle*);
 
 static int evaluate_long(grib_expression*, grib_handle*, long*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_functor
 {
     grib_expression base;
@@ -75,6 +79,9 @@ static grib_expression_class _grib_expression_class_functor = {
     &evaluate_long,
     0,
     0,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_functor = &_grib_expression_class_functor;
@@ -182,3 +189,20 @@ static int native_type(grib_expression* g, grib_handle* h)
 {
     return GRIB_TYPE_LONG;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_functor* e = (grib_expression_functor*)g;
+    grib_snapshot_write_string(w, e->name);
+    grib_snapshot_write_arguments(w, e->args);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* name     = grib_snapshot_read_string(r);
+    grib_arguments* args = grib_snapshot_read_arguments(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_func_expression(c, name, args);
+}
@@ -22,6 +22,7 @@
    IMPLEMENTS = evaluate_double
    IMPLEMENTS = evaluate_string
    IMPLEMENTS = print
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = const char *key
    MEMBERS    = const char *dictionary
    END_CLASS_DEF
@@ -53,6 +54,9 @@ static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 static string evaluate_string(grib_expression*, grib_handle*, char*, size_t*, int*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_is_in_dict
 {
     grib_expression base;
@@ -79,6 +83,9 @@ static grib_expression_class _grib_expression_class_is_in_dict = {
     &evaluate_long,
     &evaluate_double,
     &evaluate_string,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_is_in_dict = &_grib_expression_class_is_in_dict;
@@ -257,3 +264,20 @@ static void add_dependency(grib_expression* g, grib_accessor* observer)
 
     grib_dependency_add(observer, observed);
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_is_in_dict* e = (grib_expression_is_in_dict*)g;
+    grib_snapshot_write_string(w, e->key);
+    grib_snapshot_write_string(w, e->dictionary);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* key        = grib_snapshot_read_string(r);
+    const char* dictionary = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_is_in_dict_expression(c, key, dictionary);
+}
@@ -23,6 +23,7 @@
    IMPLEMENTS = evaluate_string
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = const char *name
    MEMBERS    = const char *list
    END_CLASS_DEF
@@ -55,6 +56,9 @@ static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 static string evaluate_string(grib_expression*, grib_handle*, char*, size_t*, int*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_is_in_list
 {
     grib_expression base;
@@ -81,6 +85,9 @@ static grib_expression_class _grib_expression_class_is_in_list = {
     &evaluate_long,
     &evaluate_double,
     &evaluate_string,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_is_in_list = &_grib_expression_class_is_in_list;
@@ -266,3 +273,20 @@ static int native_type(grib_expression* g, grib_handle* h)
                          "Error in native_type %s : %s", e->name, grib_get_error_message(err));
     return type;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_is_in_list* e = (grib_expression_is_in_list*)g;
+    grib_snapshot_write_string(w, e->name);
+    grib_snapshot_write_string(w, e->list);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* name = grib_snapshot_read_string(r);
+    const char* list = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_is_in_list_expression(c, name, list);
+}
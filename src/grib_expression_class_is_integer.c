@@ -23,6 +23,7 @@
    IMPLEMENTS = evaluate_string
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char *name
    MEMBERS    = size_t start
    MEMBERS    = size_t length
@@ -56,6 +57,9 @@ static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 static string evaluate_string(grib_expression*, grib_handle*, char*, size_t*, int*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_is_integer
 {
     grib_expression base;
@@ -83,6 +87,9 @@ static grib_expression_class _grib_expression_class_is_integer = {
     &evaluate_long,
     &evaluate_double,
     &evaluate_string,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_is_integer = &_grib_expression_class_is_integer;
@@ -204,3 +211,22 @@ static int native_type(grib_expression* g, grib_handle* h)
 {
     return GRIB_TYPE_LONG;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_is_integer* e = (grib_expression_is_integer*)g;
+    grib_snapshot_write_string(w, e->name);
+    grib_snapshot_write_long(w, e->start);
+    grib_snapshot_write_long(w, e->length);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* name = grib_snapshot_read_string(r);
+    long start       = grib_snapshot_read_long(r);
+    long length      = grib_snapshot_read_long(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_is_integer_expression(c, name, start, length);
+}
@@ -22,6 +22,7 @@
    IMPLEMENTS = evaluate_double
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *left
    MEMBERS = grib_expression *right
    END_CLASS_DEF
@@ -52,6 +53,9 @@ static int native_type(grib_expression*, grib_handle*);
 static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_logical_and
 {
     grib_expression base;
@@ -78,6 +82,9 @@ static grib_expression_class _grib_expression_class_logical_and = {
     &evaluate_long,
     &evaluate_double,
     0,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_logical_and = &_grib_expression_class_logical_and;
@@ -189,3 +196,20 @@ static int native_type(grib_expression* g, grib_handle* h)
 {
     return GRIB_TYPE_LONG;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_logical_and* e = (grib_expression_logical_and*)g;
+    grib_snapshot_write_expression(w, e->left);
+    grib_snapshot_write_expression(w, e->right);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    grib_expression* left  = grib_snapshot_read_expression(r);
+    grib_expression* right = grib_snapshot_read_expression(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_logical_and_expression(c, left, right);
+}
@@ -20,6 +20,7 @@
    IMPLEMENTS = evaluate_string
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = char* value
    END_CLASS_DEF
 
@@ -48,6 +49,9 @@ static int native_type(grib_expression*, grib_handle*);
 
 static string evaluate_string(grib_expression*, grib_handle*, char*, size_t*, int*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_string
 {
     grib_expression base;
@@ -73,6 +77,9 @@ static grib_expression_class _grib_expression_class_string = {
     0,
     0,
     &evaluate_string,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_string = &_grib_expression_class_string;
@@ -119,3 +126,18 @@ static int native_type(grib_expression* g, grib_handle* h)
 {
     return GRIB_TYPE_STRING;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_string* e = (grib_expression_string*)g;
+    grib_snapshot_write_string(w, e->value);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* value = grib_snapshot_read_string(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_string_expression(c, value);
+}
@@ -21,6 +21,7 @@
    IMPLEMENTS = evaluate_double
    IMPLEMENTS = print
    IMPLEMENTS = add_dependency
+   IMPLEMENTS = write_snapshot;read_snapshot
    MEMBERS    = grib_expression *exp
    MEMBERS = grib_unop_long_proc  long_func
    MEMBERS = grib_unop_double_proc  double_func
@@ -52,6 +53,9 @@ static int native_type(grib_expression*, grib_handle*);
 static int evaluate_long(grib_expression*, grib_handle*, long*);
 static int evaluate_double(grib_expression*, grib_handle*, double*);
 
+static void write_snapshot(grib_expression*, grib_snapshot_writer*);
+static grib_expression* read_snapshot(grib_context*, grib_snapshot_reader*);
+
 typedef struct grib_expression_unop
 {
     grib_expression base;
@@ -79,6 +83,9 @@ static grib_expression_class _grib_expression_class_unop = {
     &evaluate_long,
     &evaluate_double,
     0,
+
+    &write_snapshot,
+    &read_snapshot,
 };
 
 grib_expression_class* grib_expression_class_unop = &_grib_expression_class_unop;
@@ -152,3 +159,22 @@ static int native_type(grib_expression* g, grib_handle* h)
     grib_expression_unop* e = (grib_expression_unop*)g;
     return e->long_func ? GRIB_TYPE_LONG : GRIB_TYPE_DOUBLE;
 }
+
+static void write_snapshot(grib_expression* g, grib_snapshot_writer* w)
+{
+    grib_expression_unop* e = (grib_expression_unop*)g;
+    grib_snapshot_write_string(w, grib_unop_long_proc_name(e->long_func));
+    grib_snapshot_write_string(w, grib_unop_double_proc_name(e->double_func));
+    grib_snapshot_write_expression(w, e->exp);
+}
+
+static grib_expression* read_snapshot(grib_context* c, grib_snapshot_reader* r)
+{
+    const char* long_func   = grib_snapshot_read_string(r);
+    const char* double_func = grib_snapshot_read_string(r);
+    grib_expression* exp    = grib_snapshot_read_expression(r);
+
+    if (grib_snapshot_read_failed(r))
+        return NULL;
+    return new_unop_expression(c, grib_unop_long_proc_by_name(long_func), grib_unop_double_proc_by_name(double_func), exp);
+}
@@ -70,11 +70,11 @@ static GRIB_INLINE int grib_inline_strcmp(const char* a, const char* b)
 
 grib_section* grib_section_create(grib_handle* h, grib_accessor* owner)
 {
-    grib_section* s = (grib_section*)grib_context_malloc_clear(h->context, sizeof(grib_section));
+    grib_section* s = (grib_section*)grib_handle_malloc_clear(h, sizeof(grib_section));
     s->owner        = owner;
     s->aclength     = NULL;
     s->h            = h;
-    s->block        = (grib_block_of_accessors*)grib_context_malloc_clear(h->context, sizeof(grib_block_of_accessors));
+    s->block        = (grib_block_of_accessors*)grib_handle_malloc_clear(h, sizeof(grib_block_of_accessors));
     return s;
 }
 
@@ -144,9 +144,9 @@ void grib_section_delete(grib_context* c, grib_section* b)
         return;
 
     grib_empty_section(c, b);
-    grib_context_free(c, b->block);
+    grib_handle_free(c, b->block);
     /* printf("++++ deleted %p\n",b); */
-    grib_context_free(c, b);
+    grib_handle_free(c, b);
 }
 
 int grib_handle_delete(grib_handle* h)
@@ -161,14 +161,22 @@ int grib_handle_delete(grib_handle* h)
 
         while (d) {
             n = d->next;
-            grib_context_free(ct, d);
+            grib_handle_free(ct, d);
             d = n;
         }
-        h->dependencies = 0;
+        h->dependencies      = 0;
+        h->dependencies_last = 0;
+        grib_context_free(ct, h->dependencies_index);
+        h->dependencies_index = 0;
 
+        action_section_free_deferred_reparses(h);
+        grib_values_cache_clear(h);
         grib_buffer_delete(ct, h->buffer);
         grib_section_delete(ct, h->root);
+        grib_arena_delete(h->arena);
+        grib_handle_delete_accessors_table(h);
         grib_context_free(ct, h->gts_header);
+        grib_mapped_file_release(h->mapped_file);
 
         grib_context_log(ct, GRIB_LOG_DEBUG, "grib_handle_delete: deleting handle %p", (void*)h);
         grib_context_free(ct, h);
@@ -205,8 +213,7 @@ static grib_handle* grib_handle_create(grib_handle* gl, grib_context* c, const v
     if (gl == NULL)
         return NULL;
 
-    gl->use_trie     = 1;
-    gl->trie_invalid = 0;
+    gl->use_trie = 1;
     gl->buffer       = grib_new_buffer(gl->context, (const unsigned char*)data, buflen);
 
     if (gl->buffer == NULL) {
@@ -334,7 +341,11 @@ int grib_write_message(const grib_handle* h, const char* file, const char* mode)
 
 grib_handle* grib_handle_clone(const grib_handle* h)
 {
-    grib_handle* result  = grib_handle_new_from_message_copy(h->context, h->buffer->data, h->buffer->ulength);
+    grib_handle* result = grib_handle_clone_shared(h);
+    if (result)
+        return result;
+
+    result               = grib_handle_new_from_message_copy(h->context, h->buffer->data, h->buffer->ulength);
     result->product_kind = h->product_kind;
     return result;
 }
@@ -373,6 +384,43 @@ grib_handle* codes_gts_handle_new_from_file(grib_context* c, FILE* f, int* error
     return gts_new_from_file(c, f, error);
 }
 
+/* The handle's buffer points straight into the mapping until the first key stored in
+ * the message is set, when it is copied and the mapping released (see before_pack) */
+grib_handle* codes_handle_new_from_mapped_file(grib_context* c, grib_mapped_file* mf, ProductKind product, int* error)
+{
+    unsigned char* msg = NULL;
+    size_t size        = 0;
+    off_t offset       = 0;
+    grib_handle* h     = NULL;
+
+    if (c == NULL)
+        c = grib_context_get_default();
+
+    *error = grib_mapped_file_next_message(mf, product, &msg, &size, &offset);
+    if (*error != GRIB_SUCCESS) {
+        if (*error == GRIB_END_OF_FILE)
+            *error = GRIB_SUCCESS;
+        return NULL;
+    }
+
+    h = grib_handle_new_from_message(c, msg, size);
+    if (!h) {
+        *error = GRIB_DECODING_ERROR;
+        grib_context_log(c, GRIB_LOG_ERROR, "codes_handle_new_from_mapped_file: cannot create handle");
+        return NULL;
+    }
+
+    grib_mapped_file_acquire(mf);
+    h->mapped_file = mf;
+    h->offset      = offset;
+    if (product == PRODUCT_GRIB || product == PRODUCT_BUFR)
+        h->product_kind = product;
+    grib_context_increment_handle_file_count(c);
+    grib_context_increment_handle_total_count(c);
+
+    return h;
+}
+
 static int determine_product_kind(grib_handle* h, ProductKind* prod_kind)
 {
     int err    = 0;
@@ -1289,9 +1337,13 @@ int grib_get_partial_message_copy(grib_handle* h, void* message, size_t* len,
 
 int grib_get_message_copy(const grib_handle* h, void* message, size_t* len)
 {
+    int err = 0;
     if (!h)
         return GRIB_NOT_FOUND;
 
+    if (h->deferred_reparses && (err = action_section_apply_deferred_reparses((grib_handle*)h)) != GRIB_SUCCESS)
+        return err;
+
     if (*len < h->buffer->ulength)
         return GRIB_BUFFER_TOO_SMALL;
 
@@ -1369,8 +1421,14 @@ int grib_get_message(const grib_handle* ch, const void** msg, size_t* size)
     long totalLength = 0;
     int ret          = 0;
     grib_handle* h   = (grib_handle*)ch;
-    *msg             = h->buffer->data;
-    *size            = h->buffer->ulength;
+
+    /* The message is only complete once the sections left to rebuild by
+     * an update in progress are rebuilt */
+    if (h->deferred_reparses && (ret = action_section_apply_deferred_reparses(h)) != GRIB_SUCCESS)
+        return ret;
+
+    *msg  = h->buffer->data;
+    *size = h->buffer->ulength;
 
     ret = grib_get_long(h, "totalLength", &totalLength);
     if (!ret)
@@ -1384,6 +1442,29 @@ int grib_get_message(const grib_handle* ch, const void** msg, size_t* size)
     return 0;
 }
 
+/* Until the matching grib_handle_commit_update, the sections which a set
+ * should rebuild (e.g. a new template) are rebuilt once, at the commit */
+int grib_handle_begin_update(grib_handle* h)
+{
+    if (!h)
+        return GRIB_NULL_HANDLE;
+    h->updating++;
+    return GRIB_SUCCESS;
+}
+
+int grib_handle_commit_update(grib_handle* h)
+{
+    if (!h)
+        return GRIB_NULL_HANDLE;
+    if (h->updating == 0) {
+        grib_context_log(h->context, GRIB_LOG_ERROR, "grib_handle_commit_update: no update in progress");
+        return GRIB_INVALID_ARGUMENT;
+    }
+    if (--h->updating > 0)
+        return GRIB_SUCCESS;
+    return action_section_apply_deferred_reparses(h);
+}
+
 int grib_get_message_headers(grib_handle* h, const void** msg, size_t* size)
 {
     int ret = 0;
@@ -0,0 +1,161 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Arena owned by a handle for its accessors, sections and dependencies.
+ *
+ * Objects are carved out of large blocks and the blocks are all released
+ * when the handle is deleted. Every object starts with a small header naming
+ * its arena and size class, so grib_handle_free needs no handle: freed
+ * objects go on a free list of their size class and are reused by later
+ * allocations of the handle (e.g. when a section is reparsed).
+ *
+ * Objects too big for a size class, and all objects when the arena is
+ * disabled (ECCODES_HANDLE_ARENA=0, useful with memory checkers), are
+ * allocated from the context and carry a header without arena.
+ */
+
+#include "grib_api_internal.h"
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_GRAIN 16
+#define ARENA_CLASSES 128 /* objects up to ARENA_CLASSES*ARENA_GRAIN bytes */
+
+typedef union grib_arena_header
+{
+    struct
+    {
+        grib_arena* arena; /* NULL if allocated from the context */
+        size_t size_class;
+    } h;
+    double align[2];
+} grib_arena_header;
+
+typedef struct grib_arena_block
+{
+    struct grib_arena_block* next;
+} grib_arena_block;
+
+typedef struct grib_arena_free
+{
+    struct grib_arena_free* next;
+} grib_arena_free;
+
+struct grib_arena
+{
+    grib_context* context;
+    grib_arena_block* blocks;
+    char* next;
+    char* end;
+    grib_arena_free* free_list[ARENA_CLASSES + 1];
+};
+
+static grib_arena* arena_new(grib_context* c)
+{
+    grib_arena* arena = (grib_arena*)grib_context_malloc_clear(c, sizeof(grib_arena));
+    if (arena)
+        arena->context = c;
+    return arena;
+}
+
+static void* arena_alloc(grib_arena* arena, size_t size_class)
+{
+    size_t size = size_class * ARENA_GRAIN;
+    char* p     = NULL;
+
+    if (arena->free_list[size_class]) {
+        grib_arena_free* f           = arena->free_list[size_class];
+        arena->free_list[size_class] = f->next;
+        return f;
+    }
+
+    if ((size_t)(arena->end - arena->next) < size) {
+        /* The block header is padded to keep objects aligned */
+        grib_arena_block* b = (grib_arena_block*)grib_context_malloc(arena->context, ARENA_BLOCK_SIZE);
+        if (!b)
+            return NULL;
+        b->next       = arena->blocks;
+        arena->blocks = b;
+        arena->next   = (char*)b + sizeof(grib_arena_header);
+        arena->end    = (char*)b + ARENA_BLOCK_SIZE;
+    }
+    p = arena->next;
+    arena->next += size;
+    return p;
+}
+
+/* The arena of the handle, created on first use. Temporary handles used
+ * while reparsing a section allocate from their main handle, which takes
+ * over the accessors they create */
+static grib_arena* handle_arena(grib_handle* h)
+{
+    while (h->main)
+        h = h->main;
+    if (!h->arena && h->context->handle_arena)
+        h->arena = arena_new(h->context);
+    return h->arena;
+}
+
+void* grib_handle_malloc_clear(grib_handle* h, size_t size)
+{
+    grib_arena* arena      = handle_arena(h);
+    size_t size_class      = (size + sizeof(grib_arena_header) + ARENA_GRAIN - 1) / ARENA_GRAIN;
+    grib_arena_header* hdr = NULL;
+
+    if (arena && size_class <= ARENA_CLASSES) {
+        hdr = (grib_arena_header*)arena_alloc(arena, size_class);
+        if (hdr) {
+            memset(hdr, 0, size_class * ARENA_GRAIN);
+            hdr->h.arena      = arena;
+            hdr->h.size_class = size_class;
+            return hdr + 1;
+        }
+    }
+
+    hdr = (grib_arena_header*)grib_context_malloc_clear(h->context, size + sizeof(grib_arena_header));
+    if (!hdr)
+        return NULL;
+    return hdr + 1;
+}
+
+void grib_handle_free(grib_context* c, void* p)
+{
+    grib_arena_header* hdr = NULL;
+    grib_arena* arena      = NULL;
+    grib_arena_free* f     = NULL;
+    size_t size_class      = 0;
+
+    if (!p)
+        return;
+    hdr   = (grib_arena_header*)p - 1;
+    arena = hdr->h.arena;
+    if (!arena) {
+        grib_context_free(c, hdr);
+        return;
+    }
+    size_class                   = hdr->h.size_class;
+    f                            = (grib_arena_free*)hdr;
+    f->next                      = arena->free_list[size_class];
+    arena->free_list[size_class] = f;
+}
+
+void grib_arena_delete(grib_arena* arena)
+{
+    grib_arena_block* b = NULL;
+    if (!arena)
+        return;
+    b = arena->blocks;
+    while (b) {
+        grib_arena_block* next = b->next;
+        grib_context_free(arena->context, b);
+        b = next;
+    }
+    grib_context_free(arena->context, arena);
+}
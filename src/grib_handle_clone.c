@@ -0,0 +1,290 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Cloning a handle without parsing its message again.
+ *
+ * The clone shares the message of the handle until either of them packs a
+ * key (see before_pack), and gets a copy of its tree of sections
+ * and accessors: every accessor is copied byte for byte and its links to
+ * other accessors are pointed at their copies. Nothing is evaluated or
+ * unpacked, so the cost is a copy of the tree.
+ *
+ * A copy of the bytes of an accessor is only valid if the memory it owns is
+ * copied too. Accessor classes free that memory in their destroy method, so
+ * every class with one must be listed in destroying_classes. A handle with
+ * an accessor of any other class with a destroy method is cloned by parsing
+ * its message. So are BUFR handles, whose accessors point at each other
+ * through their members.
+ */
+
+#include "grib_api_internal.h"
+#include "grib_accessor_class.h"
+
+#define NUMBER(x) (sizeof(x) / sizeof(x[0]))
+
+typedef int (*clone_state_proc)(grib_accessor* a, grib_accessor* clone);
+
+static const struct
+{
+    grib_accessor_class** cclass;
+    clone_state_proc clone_state; /* NULL if the class only frees the virtual value or the sub section */
+} destroying_classes[] = {
+    { &grib_accessor_class_gen, NULL },
+    { &grib_accessor_class_unsigned, NULL },
+    { &grib_accessor_class_codetable, NULL },
+    { &grib_accessor_class_section, NULL },
+    { &grib_accessor_class_variable, &accessor_variable_clone_state },
+    { &grib_accessor_class_concept, NULL },
+    { &grib_accessor_class_missing, NULL },
+    { &grib_accessor_class_smart_table_column, NULL },
+    { &grib_accessor_class_md5, &accessor_md5_clone_state },
+    { &grib_accessor_class_statistics, &accessor_abstract_vector_clone_state },
+    { &grib_accessor_class_statistics_spectral, &accessor_abstract_vector_clone_state },
+    { &grib_accessor_class_g1end_of_interval_monthly, &accessor_abstract_vector_clone_state },
+    { &grib_accessor_class_g1step_range, &accessor_abstract_long_vector_clone_state },
+    { &grib_accessor_class_data_ccsds_packing, &accessor_data_ccsds_packing_clone_state },
+};
+
+/* Accessors of the handle and their copies, by open addressing */
+typedef struct accessor_map
+{
+    const grib_accessor** from;
+    grib_accessor** to;
+    size_t size; /* a power of 2 */
+} accessor_map;
+
+static size_t map_slot(const accessor_map* m, const grib_accessor* a)
+{
+    size_t mask = m->size - 1;
+    size_t i    = (((size_t)a >> 4) * 2654435761u) & mask;
+    while (m->from[i] && m->from[i] != a)
+        i = (i + 1) & mask;
+    return i;
+}
+
+static grib_accessor* map_get(void* data, const grib_accessor* a)
+{
+    accessor_map* m = (accessor_map*)data;
+    size_t i        = map_slot(m, a);
+    return m->from[i] ? m->to[i] : NULL;
+}
+
+static int find_destroying_class(const grib_accessor_class* c)
+{
+    size_t i;
+    for (i = 0; i < NUMBER(destroying_classes); i++) {
+        if (*destroying_classes[i].cclass == c)
+            return (int)i;
+    }
+    return -1;
+}
+
+/* Whether the accessors of the section can all be copied. Counts them */
+static int can_clone_section(const grib_section* s, size_t* count)
+{
+    grib_accessor* a = s->block->first;
+
+    while (a) {
+        grib_accessor_class* c = a->cclass;
+        if (a->attributes[0] || a->parent_as_attribute)
+            return 0;
+        for (; c; c = c->super ? *(c->super) : NULL) {
+            if (c->destroy && find_destroying_class(c) < 0)
+                return 0;
+        }
+        (*count)++;
+        if (a->sub_section && !can_clone_section(a->sub_section, count))
+            return 0;
+        a = a->next;
+    }
+    return 1;
+}
+
+/* A copy of 'a' owning its own memory, but not yet linked to the other copies */
+static grib_accessor* clone_accessor(grib_handle* h, accessor_map* m, grib_accessor* a, grib_section* parent, int* err)
+{
+    grib_accessor* b       = (grib_accessor*)grib_handle_malloc_clear(h, a->cclass->size);
+    grib_accessor_class* c = NULL;
+    size_t i               = 0;
+
+    if (!b) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    memcpy(b, a, a->cclass->size);
+    b->h           = a->h ? h : NULL;
+    b->parent      = parent;
+    b->next        = NULL;
+    b->previous    = NULL;
+    b->sub_section = NULL;
+    b->vvalue      = NULL;
+
+    for (c = a->cclass; c; c = c->super ? *(c->super) : NULL) {
+        clone_state_proc clone_state = NULL;
+        if (c->destroy)
+            clone_state = destroying_classes[find_destroying_class(c)].clone_state;
+        if (clone_state && (*err = clone_state(a, b)) != GRIB_SUCCESS) {
+            grib_handle_free(h->context, b);
+            return NULL;
+        }
+    }
+
+    i          = map_slot(m, a);
+    m->from[i] = a;
+    m->to[i]   = b;
+    return b;
+}
+
+static grib_section* clone_section(grib_handle* h, accessor_map* m, const grib_section* s, grib_accessor* owner, int* err)
+{
+    grib_section* copy = (grib_section*)grib_handle_malloc_clear(h, sizeof(grib_section));
+    grib_accessor* a   = s->block->first;
+
+    if (!copy) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    *copy       = *s;
+    copy->h     = h;
+    copy->owner = owner;
+    copy->block = (grib_block_of_accessors*)grib_handle_malloc_clear(h, sizeof(grib_block_of_accessors));
+    if (!copy->block) {
+        grib_handle_free(h->context, copy);
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+
+    /* Each copy is linked in before anything else can fail, so that
+     * deleting the partial clone frees it */
+    for (; a && !*err; a = a->next) {
+        grib_accessor* b = clone_accessor(h, m, a, copy, err);
+        if (!b)
+            break;
+        b->previous = copy->block->last;
+        if (copy->block->last)
+            copy->block->last->next = b;
+        else
+            copy->block->first = b;
+        copy->block->last = b;
+
+        if (a->vvalue) {
+            b->vvalue = (grib_virtual_value*)grib_context_malloc(h->context, sizeof(grib_virtual_value));
+            if (!b->vvalue) {
+                *err = GRIB_OUT_OF_MEMORY;
+                break;
+            }
+            *b->vvalue = *a->vvalue;
+        }
+        if (a->sub_section)
+            b->sub_section = clone_section(h, m, a->sub_section, b, err);
+    }
+    return copy;
+}
+
+/* Point the links between accessors which are not parent or sibling at the copies */
+static void relink_section(accessor_map* m, grib_section* s)
+{
+    grib_accessor* a = s->block->first;
+
+    if (s->aclength)
+        s->aclength = map_get(m, s->aclength);
+    while (a) {
+        if (a->same)
+            a->same = map_get(m, a->same);
+        if (a->sub_section)
+            relink_section(m, a->sub_section);
+        a = a->next;
+    }
+}
+
+/* The message is held as a mapping is, by the handle and its clones, which
+ * copy it before writing to it. Pointers to it stay valid until then.
+ * A message belonging to the user, who may free it before the clone, is copied */
+static grib_buffer* clone_buffer(grib_handle* clone, const grib_handle* ch)
+{
+    grib_handle* h  = (grib_handle*)ch;
+    grib_context* c = h->context;
+    grib_buffer* b  = grib_new_buffer(c, h->buffer->data, h->buffer->ulength);
+
+    if (!b)
+        return NULL;
+    if (!h->mapped_file)
+        h->mapped_file = grib_mapped_file_hold_buffer(c, h->buffer);
+    if (h->mapped_file) {
+        grib_mapped_file_acquire(h->mapped_file);
+        clone->mapped_file = h->mapped_file;
+    }
+    else {
+        grib_get_buffer_ownership(c, b);
+    }
+    return b;
+}
+
+/* A clone of the handle sharing its message and not parsing it again. NULL
+ * if the handle has to be cloned by parsing its message (see above) */
+grib_handle* grib_handle_clone_shared(const grib_handle* h)
+{
+    grib_handle* clone = NULL;
+    grib_dependency* d = NULL;
+    accessor_map m     = {0,};
+    size_t count       = 0;
+    int err            = 0;
+
+    if (h->product_kind != PRODUCT_GRIB || !h->root || h->partial || h->header_mode ||
+        h->main || h->kid || h->loader || h->values_stack || h->deferred_reparses)
+        return NULL;
+    if (!can_clone_section(h->root, &count))
+        return NULL;
+
+    if ((clone = grib_new_handle(h->context)) == NULL)
+        return NULL;
+    if ((clone->buffer = clone_buffer(clone, h)) == NULL) {
+        grib_context_free(h->context, clone);
+        return NULL;
+    }
+
+    for (m.size = 64; m.size < 2 * count; m.size *= 2)
+        ;
+    m.from = (const grib_accessor**)grib_context_malloc_clear(h->context, m.size * sizeof(grib_accessor*));
+    m.to   = (grib_accessor**)grib_context_malloc(h->context, m.size * sizeof(grib_accessor*));
+    if (!m.from || !m.to)
+        err = GRIB_OUT_OF_MEMORY;
+
+    if (!err)
+        clone->root = clone_section(clone, &m, h->root, NULL, &err);
+    if (!err) {
+        relink_section(&m, clone->root);
+        for (d = h->dependencies; d; d = d->next) {
+            if (d->observer && d->observed)
+                grib_dependency_add(map_get(&m, d->observer), map_get(&m, d->observed));
+        }
+        err = grib_handle_copy_accessors_table(clone, h, &map_get, &m);
+    }
+    grib_context_free(h->context, m.from);
+    grib_context_free(h->context, m.to);
+
+    if (err) {
+        grib_context_log(h->context, GRIB_LOG_ERROR, "grib_handle_clone: %s", grib_get_error_message(err));
+        grib_handle_delete(clone);
+        return NULL;
+    }
+
+    /* Not the offset in the file: like a parsed copy, the clone has none */
+    clone->product_kind   = h->product_kind;
+    clone->use_trie       = h->use_trie;
+    clone->sections_count = h->sections_count;
+    memcpy(clone->section_offset, h->section_offset, sizeof(h->section_offset));
+    memcpy(clone->section_length, h->section_length, sizeof(h->section_length));
+    clone->missingValueLong   = h->missingValueLong;
+    clone->missingValueDouble = h->missingValueDouble;
+
+    return clone;
+}
@@ -9873,13 +9873,19 @@ static int grib_hash_keys_insert(grib_itrie* t, const char* key)
     if (*k != 0) {
         t = last;
         while (*k) {
-            int j      = mapping[(int)*k++];
-            t->next[j] = grib_hash_keys_new(t->context, count);
-            t          = t->next[j];
+            int j         = mapping[(int)*k++];
+            grib_itrie* n = grib_hash_keys_new(t->context, count);
+            GRIB_PUBLISH(t->next[j], n);
+            t = n;
         }
     }
+    if (t->id != -1) {
+        /* Inserted by another thread since it was looked up */
+        GRIB_MUTEX_UNLOCK(&mutex);
+        return t->id;
+    }
     if (*(t->count) + TOTAL_KEYWORDS < ACCESSORS_ARRAY_SIZE) {
-        t->id = *(t->count);
+        GRIB_PUBLISH(t->id, *(t->count));
         (*(t->count))++;
     }
     else {
@@ -9905,25 +9911,31 @@ int grib_hash_keys_get_id(grib_itrie* t, const char* key)
     }
 
     /* printf("+++ \"%s\"\n",key); */
+    /* Keys seen before are found without the mutex, as in grib_itrie_get_id */
     {
         const char* k    = key;
         grib_itrie* last = t;
+        int ret          = -1;
 
+#if !GRIB_LOCK_FREE_READS
         GRIB_MUTEX_INIT_ONCE(&once, &init);
         GRIB_MUTEX_LOCK(&mutex);
-
+#endif
         while (*k && t)
-            t = t->next[mapping[(int)*k++]];
-
-        if (t != NULL && t->id != -1) {
-            GRIB_MUTEX_UNLOCK(&mutex);
-            return t->id + TOTAL_KEYWORDS + 1;
-        }
-        else {
-            int ret = grib_hash_keys_insert(last, key);
-            GRIB_MUTEX_UNLOCK(&mutex);
+            t = GRIB_PUBLISHED(t->next[mapping[(int)*k++]]);
+        if (t != NULL)
+            ret = GRIB_PUBLISHED(t->id);
+#if !GRIB_LOCK_FREE_READS
+        GRIB_MUTEX_UNLOCK(&mutex);
+#endif
+        if (ret != -1)
             return ret + TOTAL_KEYWORDS + 1;
-        }
+
+        GRIB_MUTEX_INIT_ONCE(&once, &init);
+        GRIB_MUTEX_LOCK(&mutex);
+        ret = grib_hash_keys_insert(last, key);
+        GRIB_MUTEX_UNLOCK(&mutex);
+        return ret + TOTAL_KEYWORDS + 1;
     }
 }
 
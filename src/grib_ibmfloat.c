@@ -73,13 +73,17 @@ static void init_ibm_table()
         }
         ibm_table.vmin   = ibm_table.v[0];
         ibm_table.vmax   = ibm_table.e[127] * mmax;
-        ibm_table.inited = 1;
+        GRIB_PUBLISH(ibm_table.inited, 1);
         /*for (i=0;i<128;i++) printf("++++ ibm_table.v[%d]=%g\n",i,ibm_table.v[i]);*/
     }
 }
 
 static void init_table_if_needed()
 {
+    /* Called for every conversion: only the first one locks */
+    if (GRIB_LOCK_FREE_READS && GRIB_PUBLISHED(ibm_table.inited))
+        return;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init)
     GRIB_MUTEX_LOCK(&mutex)
 
@@ -79,13 +79,17 @@ static void init_ieee_table()
         }
         ieee_table.vmin   = ieee_table.v[1];
         ieee_table.vmax   = ieee_table.e[254] * mmax;
-        ieee_table.inited = 1;
+        GRIB_PUBLISH(ieee_table.inited, 1);
         /*for (i=0;i<128;i++) printf("++++ ieee_table.v[%d]=%g\n",i,ieee_table.v[i]);*/
     }
 }
 
 static void init_table_if_needed()
 {
+    /* Called for every conversion: only the first one locks */
+    if (GRIB_LOCK_FREE_READS && GRIB_PUBLISHED(ieee_table.inited))
+        return;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init)
     GRIB_MUTEX_LOCK(&mutex)
 
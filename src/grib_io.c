@@ -10,6 +10,11 @@
 
 #include "grib_api_internal.h"
 
+#ifndef ECCODES_ON_WINDOWS
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
 #if GRIB_PTHREADS
 static pthread_once_t once    = PTHREAD_ONCE_INIT;
 static pthread_mutex_t mutex1 = PTHREAD_MUTEX_INITIALIZER;
@@ -81,9 +86,37 @@ typedef struct reader
     off_t offset;
 
     size_t message_size;
+    int scan_only; /* locate the message but do not copy it: used for memory-mapped files */
 
 } reader;
 
+/* Move past the rest of the message without reading it. Only the final 7777 is read to validate the length */
+static int skip_the_rest(reader* r, size_t message_length, int already_read, int check7777)
+{
+    int err = GRIB_SUCCESS;
+    unsigned char end[4];
+    grib_context* c = grib_context_get_default();
+
+    r->message_size = message_length;
+
+    if (!check7777 || r->headers_only || message_length < already_read + 4)
+        return r->seek(r->read_data, message_length - already_read);
+
+    if ((err = r->seek(r->read_data, message_length - already_read - 4)) != GRIB_SUCCESS)
+        return err;
+
+    if ((r->read(r->read_data, end, 4, &err) != 4) || err)
+        return err;
+
+    if (end[0] != '7' || end[1] != '7' || end[2] != '7' || end[3] != '7') {
+        if (c->debug)
+            fprintf(stderr, "ECCODES DEBUG: skip_the_rest: No final 7777 at expected location (Coded length=%lu)\n", message_length);
+        return GRIB_WRONG_LENGTH;
+    }
+
+    return GRIB_SUCCESS;
+}
+
 static int read_the_rest(reader* r, size_t message_length, unsigned char* tmp, int already_read, int check7777)
 {
     int err = GRIB_SUCCESS;
@@ -95,6 +128,9 @@ static int read_the_rest(reader* r, size_t message_length, unsigned char* tmp, i
     if (message_length == 0)
         return GRIB_BUFFER_TOO_SMALL;
 
+    if (r->scan_only)
+        return skip_the_rest(r, message_length, already_read, check7777);
+
     buffer_size     = message_length;
     rest            = message_length - already_read;
     r->message_size = message_length;
@@ -144,6 +180,69 @@ static int read_the_rest(reader* r, size_t message_length, unsigned char* tmp, i
 
 #define UINT3(a, b, c) (size_t)((a << 16) + (b << 8) + c);
 
+/* Read sections 1 to 6 of a GRIB2 message and skip the bitmap and the data.
+ * On return the buffer holds a partial message terminated by 7777 and the
+ * reader is positioned at the end of the message */
+static int read_GRIB2_headers(reader* r, grib_buffer* buf, int* pi, size_t total_length)
+{
+    grib_context* c    = grib_context_get_default();
+    unsigned char* tmp = buf->data;
+    int i              = *pi;
+    size_t consumed    = i; /* bytes of the message read or skipped so far */
+    size_t seclen      = 0;
+    int secnum         = 0;
+    int err            = 0;
+
+    for (;;) {
+        GROW_BUF_IF_REQUIRED(i + 6);
+        if (r->read(r->read_data, &tmp[i], 4, &err) != 4 || err)
+            return err;
+        if (tmp[i] == '7' && tmp[i + 1] == '7' && tmp[i + 2] == '7' && tmp[i + 3] == '7') {
+            /* No data section: the whole message has been read */
+            *pi = i + 4;
+            return GRIB_SUCCESS;
+        }
+        seclen = ((size_t)tmp[i] << 24) + ((size_t)tmp[i + 1] << 16) + ((size_t)tmp[i + 2] << 8) + tmp[i + 3];
+        if (seclen < 5 || consumed + seclen + 4 > total_length)
+            return GRIB_WRONG_LENGTH;
+
+        if (r->read(r->read_data, &tmp[i + 4], 1, &err) != 1 || err)
+            return err;
+        secnum = tmp[i + 4];
+
+        if (secnum == 7)
+            break;
+
+        if (secnum == 6 && seclen > 6) {
+            /* Keep the bitmap indicator but not the bitmap itself */
+            if (r->read(r->read_data, &tmp[i + 5], 1, &err) != 1 || err)
+                return err;
+            if ((err = r->seek(r->read_data, seclen - 6)) != GRIB_SUCCESS)
+                return err;
+            i += 6;
+        }
+        else {
+            GROW_BUF_IF_REQUIRED(i + seclen + 4);
+            if (r->read(r->read_data, &tmp[i + 5], seclen - 5, &err) != seclen - 5 || err)
+                return err;
+            i += seclen;
+        }
+        consumed += seclen;
+    }
+
+    /* Skip the rest of the message, starting with the data section */
+    if ((err = r->seek(r->read_data, total_length - consumed - 5)) != GRIB_SUCCESS)
+        return err;
+
+    tmp[i++] = '7';
+    tmp[i++] = '7';
+    tmp[i++] = '7';
+    tmp[i++] = '7';
+
+    *pi = i;
+    return GRIB_SUCCESS;
+}
+
 static int read_GRIB(reader* r)
 {
     unsigned char* tmp  = NULL;
@@ -404,6 +503,17 @@ static int read_GRIB(reader* r)
                     i++;
                 }
             }
+
+            if (r->headers_only && edition == 2) {
+                err = read_GRIB2_headers(r, buf, &i, length);
+                if (err) {
+                    r->seek_from_start(r->read_data, r->offset + 4);
+                    grib_buffer_delete(c, buf);
+                    return err;
+                }
+                tmp    = buf->data;
+                length = i;
+            }
             break;
 
         default:
@@ -1170,6 +1280,7 @@ static int _wmo_read_any_from_file(FILE* f, void* buffer, size_t* len, int grib_
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any(&r, grib_ok, bufr_ok, hdf5_ok, wrap_ok);
     *len = r.message_size;
@@ -1210,6 +1321,7 @@ int wmo_read_gts_from_file(FILE* f, void* buffer, size_t* len)
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any_gts(&r);
     *len = r.message_size;
@@ -1234,6 +1346,7 @@ int wmo_read_taf_from_file(FILE* f, void* buffer, size_t* len)
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any_taf(&r);
     *len = r.message_size;
@@ -1258,6 +1371,7 @@ int wmo_read_metar_from_file(FILE* f, void* buffer, size_t* len)
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any_metar(&r);
     *len = r.message_size;
@@ -1339,6 +1453,7 @@ int wmo_read_any_from_stream(void* stream_data, long (*stream_proc)(void*, void*
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any(&r, 1, 1, 1, 1);
     *len = r.message_size;
@@ -1368,6 +1483,7 @@ void* wmo_read_any_from_stream_malloc(void* stream_data, long (*stream_proc)(voi
     r.alloc_data      = &u;
     r.alloc           = &allocate_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     *err  = read_any(&r, 1, 1, 1, 1);
     *size = r.message_size;
@@ -1395,6 +1511,7 @@ void* wmo_read_gts_from_file_malloc(FILE* f, int headers_only, size_t* size, off
     r.alloc_data      = &u;
     r.alloc           = &allocate_buffer;
     r.headers_only    = headers_only;
+    r.scan_only       = 0;
 
     *err    = read_any_gts(&r);
     *size   = r.message_size;
@@ -1421,6 +1538,7 @@ void* wmo_read_taf_from_file_malloc(FILE* f, int headers_only, size_t* size, off
     r.alloc_data      = &u;
     r.alloc           = &allocate_buffer;
     r.headers_only    = headers_only;
+    r.scan_only       = 0;
 
     *err    = read_any_taf(&r);
     *size   = r.message_size;
@@ -1447,6 +1565,7 @@ void* wmo_read_metar_from_file_malloc(FILE* f, int headers_only, size_t* size, o
     r.alloc_data      = &u;
     r.alloc           = &allocate_buffer;
     r.headers_only    = headers_only;
+    r.scan_only       = 0;
 
     *err    = read_any_metar(&r);
     *size   = r.message_size;
@@ -1474,6 +1593,7 @@ static void* _wmo_read_any_from_file_malloc(FILE* f, int* err, size_t* size, off
     r.alloc_data      = &u;
     r.alloc           = &allocate_buffer;
     r.headers_only    = headers_only;
+    r.scan_only       = 0;
     r.offset          = 0;
 
     *err = read_any(&r, grib_ok, bufr_ok, hdf5_ok, wrap_ok);
@@ -1538,6 +1658,7 @@ int grib_read_any_headers_only_from_file(grib_context* ctx, FILE* f, void* buffe
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 1;
+    r.scan_only       = 0;
 
     err = read_any(&r, 1, ECCODES_READS_BUFR, ECCODES_READS_HDF5, ECCODES_READS_WRAP);
 
@@ -1565,6 +1686,7 @@ int grib_read_any_from_file(grib_context* ctx, FILE* f, void* buffer, size_t* le
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     offset = ftello(f);
 
@@ -1637,6 +1759,7 @@ int grib_read_any_from_memory_alloc(grib_context* ctx, unsigned char** data, siz
     r.alloc_data      = &u;
     r.alloc           = &context_allocate_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err     = read_any(&r, 1, ECCODES_READS_BUFR, ECCODES_READS_HDF5, ECCODES_READS_WRAP);
     *buffer = u.buffer;
@@ -1670,6 +1793,7 @@ int grib_read_any_from_memory(grib_context* ctx, unsigned char** data, size_t* d
     r.alloc_data      = &u;
     r.alloc           = &user_provider_buffer;
     r.headers_only    = 0;
+    r.scan_only       = 0;
 
     err  = read_any(&r, 1, ECCODES_READS_BUFR, ECCODES_READS_HDF5, ECCODES_READS_WRAP);
     *len = r.message_size;
@@ -1680,6 +1804,635 @@ int grib_read_any_from_memory(grib_context* ctx, unsigned char** data, size_t* d
     return err;
 }
 
+/* ======================================= */
+/* Memory-mapped files: messages are located in place and never copied */
+
+static off_t mapped_tell(void* data)
+{
+    grib_mapped_file* mf = (grib_mapped_file*)data;
+    return (off_t)mf->position;
+}
+
+static int mapped_seek(void* data, off_t len)
+{
+    grib_mapped_file* mf = (grib_mapped_file*)data;
+    if (len < 0 && (size_t)(-len) > mf->position) {
+        mf->position = 0;
+        return GRIB_IO_PROBLEM;
+    }
+    if (len > 0 && (size_t)len > mf->size - mf->position) {
+        mf->position = mf->size;
+        return GRIB_END_OF_FILE;
+    }
+    mf->position += len;
+    return GRIB_SUCCESS;
+}
+
+static int mapped_seek_from_start(void* data, off_t len)
+{
+    grib_mapped_file* mf = (grib_mapped_file*)data;
+    if (len < 0 || (size_t)len > mf->size)
+        return GRIB_IO_PROBLEM;
+    mf->position = len;
+    return GRIB_SUCCESS;
+}
+
+static size_t mapped_read(void* data, void* buf, size_t len, int* err)
+{
+    grib_mapped_file* mf = (grib_mapped_file*)data;
+    size_t n             = mf->size - mf->position;
+
+    if (len == 0)
+        return 0;
+    if (n > len)
+        n = len;
+    memcpy(buf, mf->data + mf->position, n);
+    mf->position += n;
+    if (n != len)
+        *err = GRIB_END_OF_FILE;
+    return n;
+}
+
+grib_mapped_file* codes_mapped_file_open(grib_context* c, const char* filename, int* err)
+{
+#ifdef ECCODES_ON_WINDOWS
+    grib_context_log(c, GRIB_LOG_ERROR, "codes_mapped_file_open: Memory-mapped files are not supported on this platform");
+    *err = GRIB_NOT_IMPLEMENTED;
+    return NULL;
+#else
+    grib_mapped_file* mf = NULL;
+    struct stat st;
+    int fd = -1;
+
+    if (!c)
+        c = grib_context_get_default();
+    *err = GRIB_SUCCESS;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "codes_mapped_file_open: Unable to open file \"%s\"", filename);
+        if (fd >= 0)
+            close(fd);
+        *err = GRIB_IO_PROBLEM;
+        return NULL;
+    }
+
+    mf = (grib_mapped_file*)grib_context_malloc_clear(c, sizeof(grib_mapped_file));
+    if (!mf) {
+        close(fd);
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    mf->context  = c;
+    mf->filename = grib_context_strdup(c, filename);
+    mf->size     = st.st_size;
+    mf->refcount = 1;
+    mf->mapped   = 1;
+
+    if (mf->size > 0) {
+        /* Handles copy their message before packing any key. The mapping is private
+         * so that the file itself can never be written to */
+        void* addr = mmap(NULL, mf->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "codes_mapped_file_open: Unable to map file \"%s\"", filename);
+            close(fd);
+            grib_context_free(c, mf->filename);
+            grib_context_free(c, mf);
+            *err = GRIB_IO_PROBLEM;
+            return NULL;
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise(addr, mf->size, MADV_SEQUENTIAL);
+#endif
+        mf->data = (unsigned char*)addr;
+    }
+    /* The mapping stays valid after the descriptor is closed */
+    close(fd);
+
+    return mf;
+#endif
+}
+
+/* A holder of the message of the buffer, from now on freed with the last
+ * handle holding it, for the handle and its clones to share it */
+grib_mapped_file* grib_mapped_file_hold_buffer(grib_context* c, grib_buffer* b)
+{
+    grib_mapped_file* mf = NULL;
+
+    if (b->property != GRIB_MY_BUFFER)
+        return NULL;
+    mf = (grib_mapped_file*)grib_context_malloc_clear(c, sizeof(grib_mapped_file));
+    if (!mf)
+        return NULL;
+    mf->context  = c;
+    mf->data     = b->data;
+    mf->size     = b->length;
+    mf->refcount = 1;
+    b->property  = GRIB_USER_BUFFER;
+    return mf;
+}
+
+/* Before a handle holding the message of 'mf' writes to its buffer 'b': the
+ * message is handed back to it if no other handle holds it, else copied */
+void grib_mapped_file_unshare_buffer(grib_mapped_file* mf, grib_buffer* b)
+{
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex2);
+    if (!mf->mapped && mf->refcount == 1 && b->data == mf->data) {
+        mf->data    = NULL;
+        b->property = GRIB_MY_BUFFER;
+    }
+    GRIB_MUTEX_UNLOCK(&mutex2);
+
+    grib_get_buffer_ownership(mf->context, b);
+    grib_mapped_file_release(mf);
+}
+
+void grib_mapped_file_acquire(grib_mapped_file* mf)
+{
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex2);
+    mf->refcount++;
+    GRIB_MUTEX_UNLOCK(&mutex2);
+}
+
+void grib_mapped_file_release(grib_mapped_file* mf)
+{
+    int refcount = 0;
+    if (!mf)
+        return;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex2);
+    refcount = --mf->refcount;
+    GRIB_MUTEX_UNLOCK(&mutex2);
+
+    if (refcount > 0)
+        return;
+
+    if (!mf->mapped)
+        grib_context_free(mf->context, mf->data);
+#ifndef ECCODES_ON_WINDOWS
+    else if (mf->data)
+        munmap(mf->data, mf->size);
+#endif
+    grib_context_free(mf->context, mf->filename);
+    grib_context_free(mf->context, mf);
+}
+
+/* Handles created from the file keep the mapping alive until they are deleted */
+void codes_mapped_file_close(grib_mapped_file* mf)
+{
+    grib_mapped_file_release(mf);
+}
+
+void codes_mapped_file_rewind(grib_mapped_file* mf)
+{
+    mf->position = 0;
+}
+
+/* Locate the next message of the given kind. On success 'msg' points into the mapping */
+int grib_mapped_file_next_message(grib_mapped_file* mf, ProductKind product, unsigned char** msg, size_t* size, off_t* offset)
+{
+    int err     = 0;
+    int grib_ok = 0, bufr_ok = 0, hdf5_ok = 0, wrap_ok = 0;
+    reader r;
+
+    switch (product) {
+        case PRODUCT_GRIB:
+            grib_ok = 1;
+            break;
+        case PRODUCT_BUFR:
+            bufr_ok = 1;
+            break;
+        case PRODUCT_ANY:
+            grib_ok = 1;
+            bufr_ok = ECCODES_READS_BUFR;
+            hdf5_ok = ECCODES_READS_HDF5;
+            wrap_ok = ECCODES_READS_WRAP;
+            break;
+        default:
+            grib_context_log(mf->context, GRIB_LOG_ERROR, "grib_mapped_file_next_message: Product kind not supported for memory-mapped files");
+            return GRIB_NOT_IMPLEMENTED;
+    }
+
+    r.message_size    = 0;
+    r.offset          = 0;
+    r.read_data       = mf;
+    r.read            = &mapped_read;
+    r.seek            = &mapped_seek;
+    r.seek_from_start = &mapped_seek_from_start;
+    r.tell            = &mapped_tell;
+    r.alloc_data      = NULL;
+    r.alloc           = NULL;
+    r.headers_only    = 0;
+    r.scan_only       = 1;
+
+    *msg  = NULL;
+    *size = 0;
+
+    err = read_any(&r, grib_ok, bufr_ok, hdf5_ok, wrap_ok);
+    if (err)
+        return err;
+    if (r.message_size == 0)
+        return GRIB_END_OF_FILE;
+
+    *size   = r.message_size;
+    *offset = (off_t)(mf->position - r.message_size);
+    *msg    = mf->data + *offset;
+
+    return GRIB_SUCCESS;
+}
+
+/* ======================================= */
+/* Parallel scanner: locate all the messages of a file using several threads.
+ *
+ * The mapped file is cut into chunks. Each worker looks for a magic from the
+ * start of its chunk, validates the candidate with the normal readers (length
+ * fields and 7777) and then jumps from message to message, remembering where
+ * each search started. The chains are then stitched in order: from the end of
+ * a message, if the next chunk's worker searched from exactly that position,
+ * its result is the one a sequential read would give and is reused. Otherwise
+ * (e.g. the worker was misled by a magic inside the data) the gap is read
+ * sequentially until the two agree again.
+ */
+
+typedef struct scan_node
+{
+    size_t scan_from; /* where the search for this message started */
+    size_t offset;
+    size_t length;
+    int err; /* GRIB_END_OF_FILE: no magic in [scan_from, end of chunk) */
+} scan_node;
+
+typedef struct scan_chunk
+{
+    const grib_mapped_file* mf;
+    size_t start;
+    size_t end;
+    const int* ok; /* grib_ok, bufr_ok, hdf5_ok, wrap_ok */
+    scan_node* nodes;
+    size_t count;
+    size_t capacity;
+    int err;
+} scan_chunk;
+
+#define SCAN_ONES 0x0101010101010101ULL
+#define SCAN_HIGHS 0x8080808080808080ULL
+#define SCAN_HAS_BYTE(v, b) ((((v) ^ ((b)*SCAN_ONES)) - SCAN_ONES) & ~((v) ^ ((b)*SCAN_ONES)) & SCAN_HIGHS)
+
+static int is_magic(const unsigned char* p, const int* ok)
+{
+    unsigned long magic = ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) | ((unsigned long)p[2] << 8) | p[3];
+    switch (magic) {
+        case GRIB:
+        case BUDG:
+        case DIAG:
+        case TIDE:
+            return ok[0];
+        case BUFR:
+            return ok[1];
+        case HDF5:
+            return ok[2];
+        case WRAP:
+            return ok[3];
+    }
+    return 0;
+}
+
+/* First position in [from, end) where a wanted magic starts, or end if there is none.
+ * Eight bytes are tested at a time for the first letter of any of the magics */
+static size_t find_magic(const unsigned char* data, size_t size, size_t from, size_t end, const int* ok)
+{
+    size_t i    = from;
+    size_t last = end; /* a magic must start before last and fit in the file */
+    if (size < 4)
+        return end;
+    if (last > size - 3)
+        last = size - 3;
+
+    while (i + 8 <= last) {
+        unsigned long long v;
+        memcpy(&v, data + i, 8);
+        if (SCAN_HAS_BYTE(v, 'G') | SCAN_HAS_BYTE(v, 'B') | SCAN_HAS_BYTE(v, 'D') |
+            SCAN_HAS_BYTE(v, 'T') | SCAN_HAS_BYTE(v, 'W') | SCAN_HAS_BYTE(v, 0x89)) {
+            size_t j;
+            for (j = i; j < i + 8; j++)
+                if (is_magic(data + j, ok))
+                    return j;
+        }
+        i += 8;
+    }
+    for (; i < last; i++)
+        if (is_magic(data + i, ok))
+            return i;
+    return end;
+}
+
+/* Validate the message starting at 'offset' using a private cursor on the mapping */
+static int scan_message_at(const grib_mapped_file* mf, size_t offset, const int* ok, size_t* length)
+{
+    grib_mapped_file cursor = *mf;
+    reader r;
+    int err = 0;
+
+    cursor.position   = offset;
+    r.message_size    = 0;
+    r.offset          = 0;
+    r.read_data       = &cursor;
+    r.read            = &mapped_read;
+    r.seek            = &mapped_seek;
+    r.seek_from_start = &mapped_seek_from_start;
+    r.tell            = &mapped_tell;
+    r.alloc_data      = NULL;
+    r.alloc           = NULL;
+    r.headers_only    = 0;
+    r.scan_only       = 1;
+
+    /* No lock: the cursor belongs to this thread */
+    err     = _read_any(&r, ok[0], ok[1], ok[2], ok[3]);
+    *length = r.message_size;
+    return err;
+}
+
+static int scan_chunk_add(scan_chunk* chunk, size_t scan_from, size_t offset, size_t length, int err)
+{
+    if (chunk->count == chunk->capacity) {
+        size_t capacity  = chunk->capacity ? 2 * chunk->capacity : 256;
+        scan_node* nodes = (scan_node*)realloc(chunk->nodes, capacity * sizeof(scan_node));
+        if (!nodes)
+            return GRIB_OUT_OF_MEMORY;
+        chunk->nodes    = nodes;
+        chunk->capacity = capacity;
+    }
+    chunk->nodes[chunk->count].scan_from = scan_from;
+    chunk->nodes[chunk->count].offset    = offset;
+    chunk->nodes[chunk->count].length    = length;
+    chunk->nodes[chunk->count].err       = err;
+    chunk->count++;
+    return GRIB_SUCCESS;
+}
+
+static void* scan_chunk_worker(void* arg)
+{
+    scan_chunk* chunk = (scan_chunk*)arg;
+    size_t from       = chunk->start;
+
+    while (from < chunk->end && !chunk->err) {
+        size_t length = 0;
+        size_t offset = find_magic(chunk->mf->data, chunk->mf->size, from, chunk->end, chunk->ok);
+        int err       = 0;
+
+        if (offset == chunk->end) {
+            chunk->err = scan_chunk_add(chunk, from, offset, 0, GRIB_END_OF_FILE);
+            break;
+        }
+        err        = scan_message_at(chunk->mf, offset, chunk->ok, &length);
+        chunk->err = scan_chunk_add(chunk, from, offset, length, err);
+        /* After a bad candidate keep looking just past it */
+        from = err ? offset + 1 : offset + length;
+    }
+    return NULL;
+}
+
+static size_t scan_default_threads(size_t size)
+{
+    size_t n = 1;
+#if GRIB_PTHREADS && defined(_SC_NPROCESSORS_ONLN)
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu > 1)
+        n = ncpu;
+#endif
+    /* Not worth it for small files */
+    if (n > size / (16 * 1024 * 1024))
+        n = size / (16 * 1024 * 1024);
+    return n > 0 ? n : 1;
+}
+
+/* Locate all the messages of a mapped file. Offsets and lengths are allocated with the context
+ * and hold as many messages as could be read before the first error, which is returned */
+int grib_mapped_file_scan(grib_mapped_file* mf, ProductKind product, int nthreads, off_t** offsets, size_t** lengths, long* count)
+{
+    grib_context* c    = mf->context;
+    scan_chunk* chunks = NULL;
+    size_t nchunks     = nthreads > 0 ? (size_t)nthreads : scan_default_threads(mf->size);
+    size_t capacity    = 0;
+    size_t pos         = 0;
+    size_t k = 0, j = 0;
+    int ok[4] = {0,};
+    int err   = GRIB_SUCCESS;
+
+    *offsets = NULL;
+    *lengths = NULL;
+    *count   = 0;
+
+    switch (product) {
+        case PRODUCT_GRIB:
+            ok[0] = 1;
+            break;
+        case PRODUCT_BUFR:
+            ok[1] = 1;
+            break;
+        case PRODUCT_ANY:
+            ok[0] = ok[1] = ok[2] = ok[3] = 1;
+            break;
+        default:
+            grib_context_log(c, GRIB_LOG_ERROR, "grib_mapped_file_scan: Product kind not supported");
+            return GRIB_NOT_IMPLEMENTED;
+    }
+
+    if (nchunks > mf->size)
+        nchunks = mf->size > 0 ? mf->size : 1;
+    chunks = (scan_chunk*)grib_context_malloc_clear(c, nchunks * sizeof(scan_chunk));
+    if (!chunks)
+        return GRIB_OUT_OF_MEMORY;
+    for (k = 0; k < nchunks; k++) {
+        chunks[k].mf    = mf;
+        chunks[k].ok    = ok;
+        chunks[k].start = mf->size / nchunks * k;
+        chunks[k].end   = (k == nchunks - 1) ? mf->size : mf->size / nchunks * (k + 1);
+    }
+
+#if GRIB_PTHREADS
+    if (nchunks > 1) {
+        pthread_t* workers = (pthread_t*)grib_context_malloc(c, nchunks * sizeof(pthread_t));
+        int* started       = (int*)grib_context_malloc_clear(c, nchunks * sizeof(int));
+        for (k = 1; k < nchunks; k++) {
+            /* If a thread cannot be created, do its chunk here */
+            started[k] = pthread_create(&workers[k], NULL, &scan_chunk_worker, &chunks[k]) == 0;
+            if (!started[k])
+                scan_chunk_worker(&chunks[k]);
+        }
+        scan_chunk_worker(&chunks[0]);
+        for (k = 1; k < nchunks; k++)
+            if (started[k])
+                pthread_join(workers[k], NULL);
+        grib_context_free(c, started);
+        grib_context_free(c, workers);
+    }
+    else
+#endif
+    {
+        for (k = 0; k < nchunks; k++)
+            scan_chunk_worker(&chunks[k]);
+    }
+
+    /* Stitch the chains together */
+    k = 0;
+    j = 0;
+    while (pos < mf->size && err == GRIB_SUCCESS) {
+        scan_node node;
+        scan_node* found = NULL;
+
+        while (k < nchunks && pos >= chunks[k].end) {
+            k++;
+            j = 0;
+        }
+        if (k == nchunks)
+            break;
+        if (chunks[k].err) {
+            err = chunks[k].err;
+            break;
+        }
+        while (j < chunks[k].count && chunks[k].nodes[j].scan_from < pos)
+            j++;
+        if (j < chunks[k].count && chunks[k].nodes[j].scan_from == pos)
+            found = &chunks[k].nodes[j];
+
+        if (found) {
+            node = *found;
+        }
+        else {
+            /* The worker took another path: read from here as a sequential reader would */
+            node.scan_from = pos;
+            node.offset    = find_magic(mf->data, mf->size, pos, mf->size, ok);
+            node.length    = 0;
+            node.err       = node.offset == mf->size ? GRIB_END_OF_FILE : scan_message_at(mf, node.offset, ok, &node.length);
+        }
+
+        if (node.err == GRIB_END_OF_FILE && node.length == 0) {
+            pos = found ? chunks[k].end : mf->size;
+            continue;
+        }
+        if (node.err) {
+            err = node.err;
+            break;
+        }
+
+        if ((size_t)*count == capacity) {
+            capacity = capacity ? 2 * capacity : 1024;
+            *offsets = (off_t*)grib_context_realloc(c, *offsets, capacity * sizeof(off_t));
+            *lengths = (size_t*)grib_context_realloc(c, *lengths, capacity * sizeof(size_t));
+            if (!*offsets || !*lengths) {
+                err = GRIB_OUT_OF_MEMORY;
+                break;
+            }
+        }
+        (*offsets)[*count] = (off_t)node.offset;
+        (*lengths)[*count] = node.length;
+        (*count)++;
+        pos = node.offset + node.length;
+    }
+
+    for (k = 0; k < nchunks; k++)
+        free(chunks[k].nodes);
+    grib_context_free(c, chunks);
+
+    return err;
+}
+
+static int scan_from_file(FILE* f, off_t* offset, size_t* length, const int* ok)
+{
+    int err = 0;
+    reader r;
+
+    r.message_size    = 0;
+    r.offset          = 0;
+    r.read_data       = f;
+    r.read            = &stdio_read;
+    r.seek            = &stdio_seek;
+    r.seek_from_start = &stdio_seek_from_start;
+    r.tell            = &stdio_tell;
+    r.alloc_data      = NULL;
+    r.alloc           = NULL;
+    r.headers_only    = 0;
+    r.scan_only       = 1;
+
+    err     = read_any(&r, ok[0], ok[1], ok[2], ok[3]);
+    *length = r.message_size;
+    /* Not all the readers set r.offset but they all stop at the end of the message */
+    *offset = ftello(f) - r.message_size;
+
+    if (err == GRIB_SUCCESS && r.message_size == 0)
+        err = GRIB_END_OF_FILE;
+
+    return err;
+}
+
+/* Locate the next message without reading its body into memory */
+int grib_scan_any_from_file(FILE* f, off_t* offset, size_t* length)
+{
+    int ok[4] = { 1, 1, 1, 1 };
+    return scan_from_file(f, offset, length, ok);
+}
+
+/* Locate all the messages of a file, in parallel when it can be mapped into memory.
+ * nthreads <= 0 means a number of threads suited to the size of the file */
+int grib_scan_file(grib_context* c, const char* filename, ProductKind product, int nthreads, off_t** offsets, size_t** lengths, long* count)
+{
+    int err         = 0;
+    int ok[4]       = {0,};
+    size_t capacity = 0, length = 0;
+    off_t offset    = 0;
+    FILE* f         = NULL;
+
+    if (!c)
+        c = grib_context_get_default();
+
+#ifndef ECCODES_ON_WINDOWS
+    if (path_is_regular_file(filename)) {
+        grib_mapped_file* mf = codes_mapped_file_open(c, filename, &err);
+        if (!mf)
+            return err;
+        err = grib_mapped_file_scan(mf, product, nthreads, offsets, lengths, count);
+        codes_mapped_file_close(mf);
+        return err;
+    }
+#endif
+
+    /* Pipes etc. are read sequentially */
+    *offsets = NULL;
+    *lengths = NULL;
+    *count   = 0;
+
+    ok[0] = (product == PRODUCT_GRIB || product == PRODUCT_ANY);
+    ok[1] = (product == PRODUCT_BUFR || product == PRODUCT_ANY);
+    ok[2] = ok[3] = (product == PRODUCT_ANY);
+
+    f = fopen(filename, "rb");
+    if (!f) {
+        grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "grib_scan_file: Unable to read file \"%s\"", filename);
+        return GRIB_IO_PROBLEM;
+    }
+    while ((err = scan_from_file(f, &offset, &length, ok)) == GRIB_SUCCESS) {
+        if ((size_t)*count == capacity) {
+            capacity = capacity ? 2 * capacity : 1024;
+            *offsets = (off_t*)grib_context_realloc(c, *offsets, capacity * sizeof(off_t));
+            *lengths = (size_t*)grib_context_realloc(c, *lengths, capacity * sizeof(size_t));
+            if (!*offsets || !*lengths) {
+                err = GRIB_OUT_OF_MEMORY;
+                break;
+            }
+        }
+        (*offsets)[*count] = offset;
+        (*lengths)[*count] = length;
+        (*count)++;
+    }
+    fclose(f);
+
+    return err == GRIB_END_OF_FILE ? GRIB_SUCCESS : err;
+}
+
 int grib_count_in_file(grib_context* c, FILE* f, int* n)
 {
     int err = 0;
@@ -1696,11 +2449,9 @@ int grib_count_in_file(grib_context* c, FILE* f, int* n)
         }
     }
     else {
-        void* mesg   = NULL;
         size_t size  = 0;
         off_t offset = 0;
-        while ((mesg = wmo_read_any_from_file_malloc(f, 0, &size, &offset, &err)) != NULL && err == GRIB_SUCCESS) {
-            grib_context_free(c, mesg);
+        while ((err = grib_scan_any_from_file(f, &offset, &size)) == GRIB_SUCCESS) {
             (*n)++;
         }
     }
@@ -1716,6 +2467,25 @@ int grib_count_in_filename(grib_context* c, const char* filename, int* n)
     FILE* fp = NULL;
     if (!c)
         c = grib_context_get_default();
+    if (!c->multi_support_on) {
+        /* A valid offset index already knows the answer */
+        grib_offset_index* oi = grib_offset_index_new(c, filename, 0, &err);
+        if (oi) {
+            *n = (int)grib_offset_index_count(oi);
+            grib_offset_index_delete(oi);
+            return GRIB_SUCCESS;
+        }
+        else {
+            off_t* offsets  = NULL;
+            size_t* lengths = NULL;
+            long count      = 0;
+            err             = grib_scan_file(c, filename, PRODUCT_ANY, 0, &offsets, &lengths, &count);
+            grib_context_free(c, offsets);
+            grib_context_free(c, lengths);
+            *n = (int)count;
+            return err;
+        }
+    }
     fp = fopen(filename, "rb");
     if (!fp) {
         grib_context_log(c, GRIB_LOG_ERROR, "grib_count_in_filename: Unable to read file \"%s\"", filename);
@@ -334,32 +334,41 @@ void grib_itrie_delete(grib_itrie* t)
     GRIB_MUTEX_UNLOCK(&mutex);
 }
 
+/* Known keys are found without the mutex where GRIB_PUBLISHED allows it:
+ * nodes are linked once filled and a node gets its id only once. New keys
+ * are inserted under the mutex */
 int grib_itrie_get_id(grib_itrie* t, const char* key)
 {
     const char* k    = key;
     grib_itrie* last = t;
+    int ret          = -1;
     if (!t) {
         Assert(!"grib_itrie_get_id: grib_trie==NULL");
         return -1;
     }
 
+#if !GRIB_LOCK_FREE_READS
     GRIB_MUTEX_INIT_ONCE(&once, &init);
     GRIB_MUTEX_LOCK(&mutex);
-
+#endif
     while (*k && t)
-        t = t->next[mapping[(int)*k++]];
-
-    if (t != NULL && t->id != -1) {
-        GRIB_MUTEX_UNLOCK(&mutex);
-        return t->id;
-    }
-    else {
-        int ret = grib_itrie_insert(last, key);
-        GRIB_MUTEX_UNLOCK(&mutex);
+        t = GRIB_PUBLISHED(t->next[mapping[(int)*k++]]);
+    if (t != NULL)
+        ret = GRIB_PUBLISHED(t->id);
+#if !GRIB_LOCK_FREE_READS
+    GRIB_MUTEX_UNLOCK(&mutex);
+#endif
+    if (ret != -1)
         return ret;
-    }
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    ret = grib_itrie_insert(last, key);
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return ret;
 }
 
+/* Id of key, given one if it has none yet */
 int grib_itrie_insert(grib_itrie* t, const char* key)
 {
     const char* k    = key;
@@ -386,13 +395,19 @@ int grib_itrie_insert(grib_itrie* t, const char* key)
     if (*k != 0) {
         t = last;
         while (*k) {
-            int j      = mapping[(int)*k++];
-            t->next[j] = grib_itrie_new(t->context, count);
-            t          = t->next[j];
+            int j         = mapping[(int)*k++];
+            grib_itrie* n = grib_itrie_new(t->context, count);
+            GRIB_PUBLISH(t->next[j], n);
+            t = n;
         }
     }
+    if (t->id != -1) {
+        /* Inserted by another thread since it was looked up */
+        GRIB_MUTEX_UNLOCK(&mutex);
+        return t->id;
+    }
     if (*(t->count) < MAX_NUM_CONCEPTS) {
-        t->id = *(t->count);
+        GRIB_PUBLISH(t->id, *(t->count));
         (*(t->count))++;
     }
     else {
@@ -0,0 +1,213 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Key plans: a list of keys with their types, compiled once and then
+ * extracted from many handles into columns supplied by the caller (one
+ * array per key, one row per message).
+ *
+ * Each key is a compiled key (see grib_key_compile). When a plan is run on
+ * a handle the accessors of all the keys are found first, so keys naming
+ * the same accessor (e.g. "paramId" and "mars.param", or "dataDate" and
+ * "date") are decoded only once per message. A plan holds the state of the
+ * handle it is running on, so it must be used by one thread at a time.
+ */
+
+#include "grib_api_internal.h"
+
+struct grib_key_plan
+{
+    grib_context* context;
+    size_t nkeys;
+    size_t string_length; /* width of a row in the string columns */
+    grib_key_id** keys;
+    int* types;
+    grib_accessor** accessors; /* accessors found for the current handle */
+    int* errors;               /* errors of the keys for the current handle */
+};
+
+void grib_key_plan_delete(grib_key_plan* p)
+{
+    size_t i = 0;
+    if (!p)
+        return;
+    if (p->keys) {
+        for (i = 0; i < p->nkeys; i++)
+            grib_key_delete(p->keys[i]);
+    }
+    grib_context_free(p->context, p->keys);
+    grib_context_free(p->context, p->types);
+    grib_context_free(p->context, p->accessors);
+    grib_context_free(p->context, p->errors);
+    grib_context_free(p->context, p);
+}
+
+grib_key_plan* grib_key_plan_new(grib_context* c, const char** keys, const int* types, size_t nkeys, size_t string_length, int* err)
+{
+    grib_key_plan* p = NULL;
+    size_t i         = 0;
+
+    if (!c)
+        c = grib_context_get_default();
+    *err = GRIB_SUCCESS;
+
+    if (!keys || nkeys == 0) {
+        *err = GRIB_INVALID_ARGUMENT;
+        return NULL;
+    }
+    for (i = 0; i < nkeys; i++) {
+        int type = types ? types[i] : GRIB_TYPE_STRING;
+        if (type != GRIB_TYPE_LONG && type != GRIB_TYPE_DOUBLE && type != GRIB_TYPE_STRING) {
+            grib_context_log(c, GRIB_LOG_ERROR, "grib_key_plan_new: %s: type must be long, double or string", keys[i]);
+            *err = GRIB_INVALID_TYPE;
+            return NULL;
+        }
+        if (type == GRIB_TYPE_STRING && string_length == 0) {
+            grib_context_log(c, GRIB_LOG_ERROR, "grib_key_plan_new: %s: no room for string values", keys[i]);
+            *err = GRIB_INVALID_ARGUMENT;
+            return NULL;
+        }
+    }
+
+    p = (grib_key_plan*)grib_context_malloc_clear(c, sizeof(grib_key_plan));
+    if (!p) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    p->context       = c;
+    p->nkeys         = nkeys;
+    p->string_length = string_length;
+    p->keys          = (grib_key_id**)grib_context_malloc_clear(c, nkeys * sizeof(grib_key_id*));
+    p->types         = (int*)grib_context_malloc_clear(c, nkeys * sizeof(int));
+    p->accessors     = (grib_accessor**)grib_context_malloc_clear(c, nkeys * sizeof(grib_accessor*));
+    p->errors        = (int*)grib_context_malloc_clear(c, nkeys * sizeof(int));
+    if (!p->keys || !p->types || !p->accessors || !p->errors) {
+        grib_key_plan_delete(p);
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+
+    for (i = 0; i < nkeys; i++) {
+        p->types[i] = types ? types[i] : GRIB_TYPE_STRING;
+        p->keys[i]  = grib_key_compile(c, keys[i], err);
+        if (!p->keys[i]) {
+            grib_key_plan_delete(p);
+            return NULL;
+        }
+    }
+    return p;
+}
+
+size_t grib_key_plan_size(const grib_key_plan* p)
+{
+    return p->nkeys;
+}
+
+/* Value of key i in its column, from the handle or from an earlier key of the same accessor */
+static int get_value(grib_key_plan* p, const grib_handle* h, size_t i, void** columns, size_t row)
+{
+    grib_accessor* a = p->accessors[i];
+    size_t j         = 0;
+    size_t len       = 1;
+
+    if (a) {
+        for (j = 0; j < i; j++) {
+            if (p->accessors[j] == a && p->types[j] == p->types[i])
+                break;
+        }
+        if (j < i && p->errors[j])
+            return p->errors[j];
+    }
+    else {
+        j = i;
+    }
+
+    switch (p->types[i]) {
+        case GRIB_TYPE_LONG: {
+            long* v = (long*)columns[i] + row;
+            if (j < i) {
+                *v = ((long*)columns[j])[row];
+                return GRIB_SUCCESS;
+            }
+            if (!a)
+                return grib_get_long_by_id(h, p->keys[i], v);
+            return grib_unpack_long(a, v, &len);
+        }
+        case GRIB_TYPE_DOUBLE: {
+            double* v = (double*)columns[i] + row;
+            if (j < i) {
+                *v = ((double*)columns[j])[row];
+                return GRIB_SUCCESS;
+            }
+            if (!a)
+                return grib_get_double_by_id(h, p->keys[i], v);
+            return grib_unpack_double(a, v, &len);
+        }
+        default: {
+            char* v = (char*)columns[i] + row * p->string_length;
+            if (j < i) {
+                memcpy(v, (char*)columns[j] + row * p->string_length, p->string_length);
+                return GRIB_SUCCESS;
+            }
+            len = p->string_length;
+            if (!a)
+                return grib_get_string_by_id(h, p->keys[i], v, &len);
+            return grib_unpack_string(a, v, &len);
+        }
+    }
+}
+
+/*
+ * Extract the keys of the plan from the handle into row 'row' of the
+ * columns: columns[i] is an array of long, double or of string_length chars
+ * according to the type of key i. A key which cannot be extracted gets a
+ * missing value (an empty string for strings) and its error in errors[i],
+ * if errors is not NULL. The last of these errors is returned.
+ */
+int grib_key_plan_execute(grib_key_plan* p, const grib_handle* h, void** columns, size_t row, int* errors)
+{
+    int ret  = GRIB_SUCCESS;
+    size_t i = 0;
+
+    if (!p || !h || !columns)
+        return GRIB_INVALID_ARGUMENT;
+
+    /* Names with a rank, a condition or an attribute are left to the gets by name */
+    for (i = 0; i < p->nkeys; i++)
+        p->accessors[i] = p->keys[i]->id >= 0 ? grib_find_accessor_by_key_id(h, p->keys[i]) : NULL;
+
+    for (i = 0; i < p->nkeys; i++) {
+        int err = GRIB_SUCCESS;
+
+        if (p->keys[i]->id >= 0 && !p->accessors[i])
+            err = GRIB_NOT_FOUND;
+        else
+            err = get_value(p, h, i, columns, row);
+
+        if (err) {
+            switch (p->types[i]) {
+                case GRIB_TYPE_LONG:
+                    ((long*)columns[i])[row] = GRIB_MISSING_LONG;
+                    break;
+                case GRIB_TYPE_DOUBLE:
+                    ((double*)columns[i])[row] = GRIB_MISSING_DOUBLE;
+                    break;
+                default:
+                    ((char*)columns[i])[row * p->string_length] = 0;
+                    break;
+            }
+            ret = err;
+        }
+        p->errors[i] = err;
+        if (errors)
+            errors[i] = err;
+    }
+    return ret;
+}
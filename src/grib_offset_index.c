@@ -0,0 +1,507 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ *
+ * Description: offset index
+ * A sidecar file "<file>.offsets" giving the position of every message in a file,
+ * so that message N can be reached without scanning the N-1 messages before it.
+ *
+ * Layout (all integers big-endian so the file can be shared between hosts):
+ *   header : "ECOI", version (4), size of data file (8), mtime of data file in
+ *            seconds (8) and nanoseconds (8), inode of data file (8), count (8)
+ *   record : offset (8), length (8), edition (4), product kind (4)
+ * The index is only used if the size, mtime and inode of the data file still match.
+ *
+ * An index which cannot be saved (e.g. read-only directory) is kept in memory
+ * by the context instead, so that the file is not scanned again on every access.
+ *
+ */
+
+#include "grib_api_internal.h"
+
+#ifndef ECCODES_ON_WINDOWS
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
+#define OFFSET_INDEX_MAGIC "ECOI"
+#define OFFSET_INDEX_VERSION 2
+#define OFFSET_INDEX_SUFFIX ".offsets"
+#define OFFSET_INDEX_STAMP_SIZE 32 /* size, mtime and inode of the data file */
+#define OFFSET_INDEX_HEADER_SIZE 48
+#define OFFSET_INDEX_RECORD_SIZE 24
+
+#if GRIB_PTHREADS
+static pthread_once_t once   = PTHREAD_ONCE_INIT;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void init()
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+#elif GRIB_OMP_THREADS
+static int once = 0;
+static omp_nest_lock_t mutex;
+
+static void init()
+{
+    GRIB_OMP_CRITICAL(lock_grib_offset_index_c)
+    {
+        if (once == 0) {
+            omp_init_nest_lock(&mutex);
+            once = 1;
+        }
+    }
+}
+#endif
+
+static void put_uint(unsigned char* p, unsigned long long val, int nbytes)
+{
+    int i;
+    for (i = nbytes - 1; i >= 0; i--) {
+        p[i] = (unsigned char)(val & 0xff);
+        val >>= 8;
+    }
+}
+
+static unsigned long long get_uint(const unsigned char* p, int nbytes)
+{
+    unsigned long long val = 0;
+    int i;
+    for (i = 0; i < nbytes; i++)
+        val = (val << 8) | p[i];
+    return val;
+}
+
+static unsigned long long mtime_nsec(const struct stat* st)
+{
+#if defined(__APPLE__)
+    return st->st_mtimespec.tv_nsec;
+#elif defined(st_mtime) && !defined(ECCODES_ON_WINDOWS)
+    /* st_mtime is a macro where struct stat has a struct timespec st_mtim */
+    return st->st_mtim.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+/* What identifies the version of the data file the index was built from */
+static void offset_index_stamp(unsigned char* p, const struct stat* st)
+{
+    put_uint(p, st->st_size, 8);
+    put_uint(p + 8, st->st_mtime, 8);
+    put_uint(p + 16, mtime_nsec(st), 8);
+    put_uint(p + 24, st->st_ino, 8);
+}
+
+static char* offset_index_filename(grib_context* c, const char* filename)
+{
+    char* result = (char*)grib_context_malloc(c, strlen(filename) + strlen(OFFSET_INDEX_SUFFIX) + 1);
+    if (result) {
+        strcpy(result, filename);
+        strcat(result, OFFSET_INDEX_SUFFIX);
+    }
+    return result;
+}
+
+static int offset_index_is_valid(const unsigned char* data, size_t size, const struct stat* st)
+{
+    unsigned long long count                      = 0;
+    unsigned char stamp[OFFSET_INDEX_STAMP_SIZE] = {0,};
+
+    if (size < OFFSET_INDEX_HEADER_SIZE || memcmp(data, OFFSET_INDEX_MAGIC, 4) != 0)
+        return 0;
+    if (get_uint(data + 4, 4) != OFFSET_INDEX_VERSION)
+        return 0;
+    offset_index_stamp(stamp, st);
+    if (memcmp(data + 8, stamp, OFFSET_INDEX_STAMP_SIZE) != 0)
+        return 0;
+    count = get_uint(data + 40, 8);
+    return size == OFFSET_INDEX_HEADER_SIZE + count * OFFSET_INDEX_RECORD_SIZE;
+}
+
+/* Map (or read) an existing index file. Returns NULL if there is none or it is stale */
+static grib_offset_index* offset_index_load(grib_context* c, const char* index_filename, const struct stat* st)
+{
+    grib_offset_index* oi = NULL;
+    unsigned char* data   = NULL;
+    size_t size           = 0;
+    int mapped            = 0;
+#ifndef ECCODES_ON_WINDOWS
+    struct stat ist;
+    int fd = open(index_filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &ist) != 0 || ist.st_size < OFFSET_INDEX_HEADER_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    size = ist.st_size;
+    data = (unsigned char*)mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+    mapped = 1;
+#else
+    FILE* f = fopen(index_filename, "rb");
+    if (!f)
+        return NULL;
+    fseeko(f, 0, SEEK_END);
+    size = ftello(f);
+    fseeko(f, 0, SEEK_SET);
+    data = (unsigned char*)grib_context_malloc(c, size);
+    if (!data || fread(data, 1, size, f) != size) {
+        grib_context_free(c, data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+#endif
+
+    if (!offset_index_is_valid(data, size, st)) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "offset_index_load: Ignoring stale index file %s", index_filename);
+#ifndef ECCODES_ON_WINDOWS
+        munmap(data, size);
+#else
+        grib_context_free(c, data);
+#endif
+        return NULL;
+    }
+
+    oi          = (grib_offset_index*)grib_context_malloc_clear(c, sizeof(grib_offset_index));
+    oi->context = c;
+    oi->data    = data;
+    oi->size    = size;
+    oi->count   = (long)get_uint(data + 40, 8);
+    oi->mapped  = mapped;
+    oi->refs    = 1;
+    return oi;
+}
+
+/* Scan the data file and build the index in memory */
+static grib_offset_index* offset_index_build(grib_context* c, const char* filename, const struct stat* st, int* err)
+{
+    grib_offset_index* oi = NULL;
+    unsigned char* data   = NULL;
+    unsigned char* rec    = NULL;
+    off_t* offsets        = NULL;
+    size_t* lengths       = NULL;
+    size_t size           = 0;
+    long count            = 0;
+    long i                = 0;
+    FILE* f               = NULL;
+
+    *err = grib_scan_file(c, filename, PRODUCT_ANY, 0, &offsets, &lengths, &count);
+    if (*err) {
+        grib_context_log(c, GRIB_LOG_ERROR, "offset_index_build: Unable to index file \"%s\" (%s)", filename, grib_get_error_message(*err));
+        grib_context_free(c, offsets);
+        grib_context_free(c, lengths);
+        return NULL;
+    }
+
+    size = OFFSET_INDEX_HEADER_SIZE + count * OFFSET_INDEX_RECORD_SIZE;
+    data = (unsigned char*)grib_context_malloc_clear(c, size);
+    f    = fopen(filename, "rb");
+    if (!data || !f) {
+        *err = data ? GRIB_IO_PROBLEM : GRIB_OUT_OF_MEMORY;
+        if (f)
+            fclose(f);
+        grib_context_free(c, data);
+        grib_context_free(c, offsets);
+        grib_context_free(c, lengths);
+        return NULL;
+    }
+    /* Only a few octets are read per message */
+    setvbuf(f, NULL, _IONBF, 0);
+
+    for (i = 0; i < count; i++) {
+        unsigned char ident[8] = {0,};
+        long edition           = 0;
+        ProductKind product    = PRODUCT_ANY;
+
+        /* Identify each message from its first 8 octets */
+        if (fseeko(f, offsets[i], SEEK_SET) == 0 && fread(ident, 1, 8, f) == 8) {
+            if (memcmp(ident, "GRIB", 4) == 0) {
+                product = PRODUCT_GRIB;
+                edition = ident[7];
+            }
+            else if (memcmp(ident, "BUFR", 4) == 0) {
+                product = PRODUCT_BUFR;
+                edition = ident[7];
+            }
+        }
+        rec = data + OFFSET_INDEX_HEADER_SIZE + i * OFFSET_INDEX_RECORD_SIZE;
+        put_uint(rec, offsets[i], 8);
+        put_uint(rec + 8, lengths[i], 8);
+        put_uint(rec + 16, edition, 4);
+        put_uint(rec + 20, product, 4);
+    }
+    fclose(f);
+    grib_context_free(c, offsets);
+    grib_context_free(c, lengths);
+
+    memcpy(data, OFFSET_INDEX_MAGIC, 4);
+    put_uint(data + 4, OFFSET_INDEX_VERSION, 4);
+    offset_index_stamp(data + 8, st);
+    put_uint(data + 40, count, 8);
+
+    oi          = (grib_offset_index*)grib_context_malloc_clear(c, sizeof(grib_offset_index));
+    oi->context = c;
+    oi->data    = data;
+    oi->size    = size;
+    oi->count   = count;
+    oi->mapped  = 0;
+    oi->refs    = 1;
+    return oi;
+}
+
+/* Write to a temporary file first so that readers never see a partial index */
+static int offset_index_save(grib_context* c, const grib_offset_index* oi, const char* index_filename)
+{
+    FILE* f       = NULL;
+    char* tmpname = (char*)grib_context_malloc(c, strlen(index_filename) + 32);
+    int err       = GRIB_SUCCESS;
+
+#ifndef ECCODES_ON_WINDOWS
+    sprintf(tmpname, "%s.%ld", index_filename, (long)getpid());
+#else
+    strcpy(tmpname, index_filename);
+#endif
+    f = fopen(tmpname, "wb");
+    if (!f) {
+        grib_context_log(c, GRIB_LOG_DEBUG, "offset_index_save: Unable to create %s", tmpname);
+        grib_context_free(c, tmpname);
+        return GRIB_IO_PROBLEM;
+    }
+    if (fwrite(oi->data, 1, oi->size, f) != oi->size)
+        err = GRIB_IO_PROBLEM;
+    if (fclose(f) != 0)
+        err = GRIB_IO_PROBLEM;
+#ifndef ECCODES_ON_WINDOWS
+    if (err == GRIB_SUCCESS && rename(tmpname, index_filename) != 0)
+        err = GRIB_IO_PROBLEM;
+    if (err)
+        unlink(tmpname);
+#endif
+    grib_context_free(c, tmpname);
+    return err;
+}
+
+static void offset_index_release(grib_offset_index* oi)
+{
+    if (--oi->refs > 0)
+        return;
+#ifndef ECCODES_ON_WINDOWS
+    if (oi->mapped)
+        munmap(oi->data, oi->size);
+    else
+#endif
+        grib_context_free(oi->context, oi->data);
+    grib_context_free(oi->context, oi->filename);
+    grib_context_free(oi->context, oi);
+}
+
+/* The index kept in memory for the file, if still valid. Stale ones are dropped */
+static grib_offset_index* offset_index_find_kept(grib_context* c, const char* filename, const struct stat* st)
+{
+    grib_offset_index** p = NULL;
+    grib_offset_index* oi = NULL;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    p = &c->offset_indexes;
+    while (*p) {
+        grib_offset_index* kept = *p;
+        if (strcmp(kept->filename, filename) != 0) {
+            p = &kept->next;
+            continue;
+        }
+        if (offset_index_is_valid(kept->data, kept->size, st)) {
+            kept->refs++;
+            oi = kept;
+            break;
+        }
+        *p = kept->next;
+        offset_index_release(kept);
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return oi;
+}
+
+static void offset_index_keep(grib_context* c, grib_offset_index* oi, const char* filename)
+{
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    oi->filename = grib_context_strdup(c, filename);
+    if (oi->filename) {
+        oi->refs++;
+        oi->next          = c->offset_indexes;
+        c->offset_indexes = oi;
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+/* Drop the indexes kept in memory by the context */
+void grib_offset_index_forget(grib_context* c)
+{
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    while (c->offset_indexes) {
+        grib_offset_index* oi = c->offset_indexes;
+        c->offset_indexes     = oi->next;
+        offset_index_release(oi);
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+grib_offset_index* grib_offset_index_new(grib_context* c, const char* filename, int build, int* err)
+{
+    grib_offset_index* oi = NULL;
+    char* index_filename  = NULL;
+    struct stat st;
+
+    if (!c)
+        c = grib_context_get_default();
+    *err = GRIB_SUCCESS;
+
+    if (stat(filename, &st) != 0) {
+        if (build)
+            grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "grib_offset_index_new: Unable to read file \"%s\"", filename);
+        *err = GRIB_IO_PROBLEM;
+        return NULL;
+    }
+
+    index_filename = offset_index_filename(c, filename);
+    oi             = offset_index_load(c, index_filename, &st);
+    if (!oi)
+        oi = offset_index_find_kept(c, filename, &st);
+    if (!oi && build) {
+        oi = offset_index_build(c, filename, &st, err);
+        /* Not being able to save the index (e.g. read-only directory) is not an error */
+        if (oi && offset_index_save(c, oi, index_filename) != GRIB_SUCCESS)
+            offset_index_keep(c, oi, filename);
+    }
+    else if (!oi) {
+        *err = GRIB_FILE_NOT_FOUND;
+    }
+    grib_context_free(c, index_filename);
+
+    return oi;
+}
+
+long grib_offset_index_count(const grib_offset_index* oi)
+{
+    return oi->count;
+}
+
+/* Messages are numbered from 1 like the 'count' key */
+int grib_offset_index_get(const grib_offset_index* oi, long n, off_t* offset, size_t* length, long* edition, ProductKind* product)
+{
+    const unsigned char* rec = NULL;
+    if (n < 1 || n > oi->count)
+        return GRIB_INVALID_ARGUMENT;
+
+    rec     = oi->data + OFFSET_INDEX_HEADER_SIZE + (n - 1) * OFFSET_INDEX_RECORD_SIZE;
+    *offset = (off_t)get_uint(rec, 8);
+    *length = (size_t)get_uint(rec + 8, 8);
+    if (edition)
+        *edition = (long)get_uint(rec + 16, 4);
+    if (product)
+        *product = (ProductKind)get_uint(rec + 20, 4);
+    return GRIB_SUCCESS;
+}
+
+void grib_offset_index_delete(grib_offset_index* oi)
+{
+    if (!oi)
+        return;
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    offset_index_release(oi);
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+int codes_offset_index_build(grib_context* c, const char* filename)
+{
+    grib_offset_index* oi = NULL;
+    char* index_filename  = NULL;
+    int err               = 0;
+    struct stat st;
+
+    if (!c)
+        c = grib_context_get_default();
+
+    if (stat(filename, &st) != 0) {
+        grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "codes_offset_index_build: Unable to read file \"%s\"", filename);
+        return GRIB_IO_PROBLEM;
+    }
+
+    index_filename = offset_index_filename(c, filename);
+    oi             = offset_index_load(c, index_filename, &st);
+    if (!oi) {
+        oi = offset_index_build(c, filename, &st, &err);
+        if (oi && (err = offset_index_save(c, oi, index_filename)) != GRIB_SUCCESS)
+            grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "codes_offset_index_build: Unable to write \"%s\"", index_filename);
+    }
+    grib_offset_index_delete(oi);
+    grib_context_free(c, index_filename);
+
+    return err;
+}
+
+grib_handle* codes_handle_new_from_file_at(grib_context* c, const char* filename, long n, int* error)
+{
+    grib_offset_index* oi = NULL;
+    grib_handle* h        = NULL;
+    ProductKind product   = PRODUCT_ANY;
+    off_t offset          = 0;
+    size_t length         = 0;
+    FILE* f               = NULL;
+
+    if (!c)
+        c = grib_context_get_default();
+
+    oi = grib_offset_index_new(c, filename, 1, error);
+    if (!oi)
+        return NULL;
+
+    *error = grib_offset_index_get(oi, n, &offset, &length, NULL, &product);
+    grib_offset_index_delete(oi);
+    if (*error) {
+        grib_context_log(c, GRIB_LOG_ERROR, "codes_handle_new_from_file_at: No message number %ld in \"%s\"", n, filename);
+        return NULL;
+    }
+
+    f = fopen(filename, "rb");
+    if (!f || fseeko(f, offset, SEEK_SET) != 0) {
+        grib_context_log(c, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "codes_handle_new_from_file_at: Unable to read file \"%s\"", filename);
+        if (f)
+            fclose(f);
+        *error = GRIB_IO_PROBLEM;
+        return NULL;
+    }
+
+    h = codes_handle_new_from_file(c, f, product, error);
+    fclose(f);
+    if (h) {
+        /* Keep the 'count' key consistent with a sequential read */
+        grib_context_set_handle_file_count(c, (int)n);
+    }
+    else if (*error == GRIB_SUCCESS) {
+        *error = GRIB_END_OF_FILE;
+    }
+
+    return h;
+}
@@ -542,24 +542,37 @@ GRIB_INLINE static int grib_inline_strcmp(const char* a, const char* b)
     return (*a == 0 && *b == 0) ? 0 : 1;
 }
 
+static size_t action_file_index(const char* fname)
+{
+    const unsigned char* p = (const unsigned char*)fname;
+    unsigned long h        = 5381;
+    while (*p)
+        h = h * 33 + *p++;
+    return h % ACTION_FILE_INDEX_SIZE;
+}
+
 grib_action_file* grib_find_action_file(const char* fname, grib_action_file_list* afl)
 {
-    grib_action_file* act = afl->first;
+    grib_action_file* act = GRIB_PUBLISHED(afl->index[action_file_index(fname)]);
     while (act) {
         if (grib_inline_strcmp(act->filename, fname) == 0)
             return act;
-        act = act->next;
+        act = act->hash_next;
     }
     return 0;
 }
 
 static void grib_push_action_file(grib_action_file* af, grib_action_file_list* afl)
 {
+    size_t i = action_file_index(af->filename);
     if (!afl->first)
-        afl->first = afl->last = af;
+        GRIB_PUBLISH(afl->first, af); /* boot.def: the root section waits for it */
     else
         afl->last->next = af;
-    afl->last = af;
+    afl->last     = af;
+    af->hash_next = afl->index[i];
+    /* Published last: grib_parse_file looks files up without the mutex */
+    GRIB_PUBLISH(afl->index[i], af);
 }
 
 #define MAXINCLUDE 10
@@ -577,6 +590,15 @@ static int top = 0;
 extern FILE* grib_yyin;
 extern int grib_yylineno;
 extern void grib_yyrestart(FILE*);
+extern int grib_yylex_destroy(void);
+
+/* Flex buffers, one per file on the include stack */
+typedef struct grib_yy_buffer_state* YY_BUFFER_STATE;
+extern YY_BUFFER_STATE grib_yy_create_buffer(FILE* file, int size);
+extern void grib_yypush_buffer_state(YY_BUFFER_STATE new_buffer);
+extern void grib_yypop_buffer_state(void);
+#define INCLUDE_BUFFER_SIZE 16384
+
 static int error = 0;
 
 int grib_yywrap()
@@ -597,7 +619,8 @@ int grib_yywrap()
         grib_yyin  = stack[top - 1].file;
         Assert(parse_file);
         Assert(grib_yyin);
-        /* grib_yyrestart(grib_yyin); */
+        /* Carry on with what is left in the buffer of the includer */
+        grib_yypop_buffer_state();
 
         /* for(i = 0; i < top ; i++) printf("   "); */
         /* printf("BACK TO %s\n",parse_file); */
@@ -697,8 +720,10 @@ void grib_parser_include(const char* included_fname)
         parse_file           = stack[top].name;
         stack[top].line      = grib_yylineno;
         grib_yylineno        = 0;
+        /* The top file is read with the scanner's own buffer, created on the first token */
+        if (top > 0)
+            grib_yypush_buffer_state(grib_yy_create_buffer(f, INCLUDE_BUFFER_SIZE));
         top++;
-        /* grib_yyrestart(f); */
     }
 }
 
@@ -731,6 +756,8 @@ static int parse(grib_context* gc, const char* filename)
     }
     err        = grib_yyparse();
     parse_file = 0;
+    /* Drop the buffers, including those left by a syntax error */
+    grib_yylex_destroy();
 
     if (err)
         grib_context_log(gc, GRIB_LOG_ERROR, "Parsing error: %s, file: %s\n",
@@ -772,6 +799,14 @@ grib_concept_value* grib_parse_concept_file(grib_context* gc, const char* filena
     gc                  = gc ? gc : grib_context_get_default();
     grib_parser_context = gc;
 
+    if (gc->definitions_snapshot) {
+        grib_concept_value* c = grib_definitions_snapshot_concept(gc, filename);
+        if (c) {
+            GRIB_MUTEX_UNLOCK(&mutex_file);
+            return c;
+        }
+    }
+
     if (parse(gc, filename) == 0) {
         GRIB_MUTEX_UNLOCK(&mutex_file);
         return grib_parser_concept;
@@ -790,6 +825,14 @@ grib_hash_array_value* grib_parse_hash_array_file(grib_context* gc, const char*
     gc                  = gc ? gc : grib_context_get_default();
     grib_parser_context = gc;
 
+    if (gc->definitions_snapshot) {
+        grib_hash_array_value* ha = grib_definitions_snapshot_hash_array(gc, filename);
+        if (ha) {
+            GRIB_MUTEX_UNLOCK(&mutex_file);
+            return ha;
+        }
+    }
+
     if (parse(gc, filename) == 0) {
         GRIB_MUTEX_UNLOCK(&mutex_file);
         return grib_parser_hash_array;
@@ -825,17 +868,24 @@ grib_action* grib_parse_file(grib_context* gc, const char* filename)
 {
     grib_action_file* af;
 
+    gc = gc ? gc : grib_context_get_default();
+
+    /* Files already parsed are found without the mutex */
+    if (GRIB_LOCK_FREE_READS && GRIB_PUBLISHED(gc->grib_reader) &&
+        (af = grib_find_action_file(filename, gc->grib_reader)) != NULL)
+        return af->root;
+
     GRIB_MUTEX_INIT_ONCE(&once, &init);
     GRIB_MUTEX_LOCK(&mutex_file);
 
     af = 0;
 
-    gc = gc ? gc : grib_context_get_default();
-
     grib_parser_context = gc;
 
-    if (!gc->grib_reader)
-        gc->grib_reader = (grib_action_file_list*)grib_context_malloc_clear_persistent(gc, sizeof(grib_action_file_list));
+    if (!gc->grib_reader) {
+        grib_action_file_list* afl = (grib_action_file_list*)grib_context_malloc_clear_persistent(gc, sizeof(grib_action_file_list));
+        GRIB_PUBLISH(gc->grib_reader, afl);
+    }
     else {
         af = grib_find_action_file(filename, gc->grib_reader);
     }
@@ -844,7 +894,9 @@ grib_action* grib_parse_file(grib_context* gc, const char* filename)
         grib_action* a;
         grib_context_log(gc, GRIB_LOG_DEBUG, "Loading %s", filename);
 
-        a = grib_parse_stream(gc, filename);
+        a = gc->definitions_snapshot ? grib_definitions_snapshot_actions(gc, filename) : NULL;
+        if (!a)
+            a = grib_parse_stream(gc, filename);
 
         if (error) {
             if (a)
@@ -867,6 +919,41 @@ grib_action* grib_parse_file(grib_context* gc, const char* filename)
     return af->root;
 }
 
+/* Parse a definition file of any kind, for the definitions snapshot. A file with no
+ * statements gives a noop action, as in grib_parse_file */
+int grib_parse_definition_file(grib_context* gc, const char* filename,
+                               grib_action** actions, grib_concept_value** concept, grib_hash_array_value** hash_array)
+{
+    int err = 0;
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex_file);
+
+    gc                      = gc ? gc : grib_context_get_default();
+    grib_parser_context     = gc;
+    grib_parser_all_actions = 0;
+    grib_parser_concept     = 0;
+    grib_parser_hash_array  = 0;
+    grib_parser_rules       = 0;
+    error                   = 0;
+
+    err = parse(gc, filename);
+    if (err != GRIB_FILE_NOT_FOUND && (err || error))
+        err = GRIB_INVALID_FILE;
+    if (!err && grib_parser_rules) {
+        grib_context_log(gc, GRIB_LOG_ERROR, "%s: Rules cannot be saved", filename);
+        err = GRIB_NOT_IMPLEMENTED;
+    }
+    *actions    = err ? NULL : grib_parser_all_actions;
+    *concept    = err ? NULL : grib_parser_concept;
+    *hash_array = err ? NULL : grib_parser_hash_array;
+    if (!err && !*actions && !*concept && !*hash_array)
+        *actions = grib_action_create_noop(gc, filename);
+    error = 0;
+
+    GRIB_MUTEX_UNLOCK(&mutex_file);
+    return err;
+}
+
 int grib_type_to_int(char id)
 {
     switch (id) {
@@ -69,35 +69,175 @@ static grib_accessor* search(grib_section* s, const char* name, const char* name
     return match;
 }
 
-static void rebuild_hash_keys(grib_handle* h, grib_section* s)
+/*
+ * Accessors of a handle by key id (see grib_hash_keys.c), in an open
+ * addressing table. The entry of a key is the last accessor created with
+ * that name, the target of an alias or the result of a search; a NULL entry
+ * is searched again.
+ */
+#define ACCESSORS_TABLE_MIN_SIZE 256
+
+struct grib_accessors_table_entry
+{
+    int id; /* -1 if the entry is free */
+    grib_accessor* accessor;
+};
+
+static size_t accessors_table_probe(const grib_handle* h, int id)
+{
+    size_t mask = h->accessors_table_size - 1;
+    size_t i    = ((size_t)id * 2654435761UL) & mask;
+    while (h->accessors_table[i].id != id && h->accessors_table[i].id != -1)
+        i = (i + 1) & mask;
+    return i;
+}
+
+static int accessors_table_grow(grib_handle* h)
+{
+    grib_accessors_table_entry* old = h->accessors_table;
+    size_t old_size                 = h->accessors_table_size;
+    size_t size                     = old_size ? old_size * 2 : ACCESSORS_TABLE_MIN_SIZE;
+    size_t i;
+
+    h->accessors_table = (grib_accessors_table_entry*)grib_context_malloc(h->context, size * sizeof(grib_accessors_table_entry));
+    if (!h->accessors_table) {
+        h->accessors_table = old;
+        return GRIB_OUT_OF_MEMORY;
+    }
+    h->accessors_table_size = size;
+    for (i = 0; i < size; i++) {
+        h->accessors_table[i].id       = -1;
+        h->accessors_table[i].accessor = NULL;
+    }
+    for (i = 0; i < old_size; i++) {
+        if (old[i].id != -1)
+            h->accessors_table[accessors_table_probe(h, old[i].id)] = old[i];
+    }
+    grib_context_free(h->context, old);
+    return GRIB_SUCCESS;
+}
+
+grib_accessor* grib_handle_get_accessor_by_id(const grib_handle* h, int id)
+{
+    if (!h->accessors_table)
+        return NULL;
+    return h->accessors_table[accessors_table_probe(h, id)].accessor;
+}
+
+void grib_handle_set_accessor_by_id(grib_handle* h, int id, grib_accessor* a)
+{
+    size_t i;
+
+    if (!h->accessors_table) {
+        if (!a || accessors_table_grow(h) != GRIB_SUCCESS)
+            return;
+    }
+    i = accessors_table_probe(h, id);
+    if (h->accessors_table[i].id == -1) {
+        if (!a)
+            return;
+        if (2 * (h->accessors_table_count + 1) > h->accessors_table_size) {
+            if (accessors_table_grow(h) != GRIB_SUCCESS)
+                return;
+            i = accessors_table_probe(h, id);
+        }
+        h->accessors_table[i].id = id;
+        h->accessors_table_count++;
+    }
+    h->accessors_table[i].accessor = a;
+}
+
+/* Give a handle cloned from 'src' the entries of its table, 'map' giving the
+ * accessor of the clone for each accessor of 'src' (see grib_handle_clone.c) */
+int grib_handle_copy_accessors_table(grib_handle* h, const grib_handle* src,
+                                     grib_accessor* (*map)(void*, const grib_accessor*), void* data)
+{
+    size_t i;
+
+    if (!src->accessors_table)
+        return GRIB_SUCCESS;
+    h->accessors_table = (grib_accessors_table_entry*)grib_context_malloc(h->context,
+                                                                          src->accessors_table_size * sizeof(grib_accessors_table_entry));
+    if (!h->accessors_table)
+        return GRIB_OUT_OF_MEMORY;
+    h->accessors_table_size  = src->accessors_table_size;
+    h->accessors_table_count = src->accessors_table_count;
+    for (i = 0; i < src->accessors_table_size; i++) {
+        const grib_accessor* a         = src->accessors_table[i].accessor;
+        h->accessors_table[i].id       = src->accessors_table[i].id;
+        h->accessors_table[i].accessor = a ? map(data, a) : NULL;
+    }
+    return GRIB_SUCCESS;
+}
+
+void grib_handle_delete_accessors_table(grib_handle* h)
+{
+    grib_context_free(h->context, h->accessors_table);
+    h->accessors_table       = NULL;
+    h->accessors_table_size  = 0;
+    h->accessors_table_count = 0;
+}
+
+#define DIRTY(d, id) ((d)[(id) >> 3] & (1 << ((id)&7)))
+
+/* Mark the ids of all the names of the accessors in the section */
+static void mark_names(grib_section* s, unsigned char* dirty)
 {
     grib_accessor* a = s ? s->block->first : NULL;
 
     while (a) {
-        grib_section* sub = a->sub_section;
-        int i             = 0;
-        int id            = -1;
+        int i = 0;
         const char* p;
-        DebugAssert(h == grib_handle_of_accessor(a));
-
         while (i < MAX_ACCESSOR_NAMES && ((p = a->all_names[i]) != NULL)) {
             if (*p != '_') {
-                id = grib_hash_keys_get_id(a->context->keys, p);
-
-                if (a->same != a && i == 0) {
-                    grib_handle* hand   = grib_handle_of_accessor(a);
-                    a->same             = hand->accessors[id];
-                    hand->accessors[id] = a;
-                    DebugAssert(a->same != a);
-                }
+                int id = (i == 0 && a->name_id >= 0) ? a->name_id : grib_hash_keys_get_id(a->context->keys, p);
+                dirty[id >> 3] |= 1 << (id & 7);
             }
             i++;
         }
-        rebuild_hash_keys(h, sub);
+        mark_names(a->sub_section, dirty);
         a = a->next;
     }
 }
 
+/* Redo the entries and the chains of accessors with the same name for the marked ids */
+static void relink_names(grib_handle* h, grib_section* s, const unsigned char* dirty)
+{
+    grib_accessor* a = s ? s->block->first : NULL;
+
+    while (a) {
+        DebugAssert(h == grib_handle_of_accessor(a));
+        if (a->name_id >= 0 && DIRTY(dirty, a->name_id) && a->same != a) {
+            a->same = grib_handle_get_accessor_by_id(h, a->name_id);
+            grib_handle_set_accessor_by_id(h, a->name_id, a);
+            DebugAssert(a->same != a);
+        }
+        relink_names(h, a->sub_section, dirty);
+        a = a->next;
+    }
+}
+
+/*
+ * A section of the handle has been reparsed: the accessors of section
+ * 'removed' are about to be deleted and those of 'added' have taken their
+ * place. Only the entries for the names of these accessors are redone.
+ */
+void grib_handle_update_accessors_table(grib_handle* h, grib_section* removed, grib_section* added)
+{
+    unsigned char dirty[ACCESSORS_ARRAY_SIZE / 8 + 1] = {0,};
+    size_t i;
+
+    mark_names(removed, dirty);
+    mark_names(added, dirty);
+
+    for (i = 0; i < h->accessors_table_size; i++) {
+        int id = h->accessors_table[i].id;
+        if (id != -1 && DIRTY(dirty, id))
+            h->accessors_table[i].accessor = NULL;
+    }
+    relink_names(h, h->root, dirty);
+}
+
 static grib_accessor* search_and_cache(grib_handle* h, const char* name, const char* the_namespace);
 
 static grib_accessor* _search_and_cache(grib_handle* h, const char* name, const char* the_namespace)
@@ -106,27 +246,14 @@ static grib_accessor* _search_and_cache(grib_handle* h, const char* name, const
         grib_accessor* a = NULL;
         int id           = -1;
 
-        if (h->trie_invalid && h->kid == NULL) {
-            int i = 0;
-            for (i = 0; i < ACCESSORS_ARRAY_SIZE; i++)
-                h->accessors[i] = NULL;
-
-            if (h->root)
-                rebuild_hash_keys(h, h->root);
-
-            h->trie_invalid = 0;
-            id              = grib_hash_keys_get_id(h->context->keys, name);
-        }
-        else {
-            id = grib_hash_keys_get_id(h->context->keys, name);
+        id = grib_hash_keys_get_id(h->context->keys, name);
 
-            if ((a = h->accessors[id]) != NULL &&
-                (the_namespace == NULL || matching(a, name, the_namespace)))
-                return a;
-        }
+        if ((a = grib_handle_get_accessor_by_id(h, id)) != NULL &&
+            (the_namespace == NULL || matching(a, name, the_namespace)))
+            return a;
 
-        a                = search(h->root, name, the_namespace);
-        h->accessors[id] = a;
+        a = search(h->root, name, the_namespace);
+        grib_handle_set_accessor_by_id(h, id, a);
 
         return a;
     }
@@ -548,6 +675,98 @@ static grib_accessor* _grib_find_accessor(const grib_handle* ch, const char* nam
     return a;
 }
 
+/*
+ * Compile a key name for grib_find_accessor_by_key_id. The key id and the
+ * namespace are worked out once, so finding the accessor in a handle is a
+ * single table lookup. Names with a rank (#n#), a condition (/k=v/) or an
+ * attribute (->) keep going through grib_find_accessor.
+ */
+grib_key_id* grib_key_compile(grib_context* c, const char* name, int* err)
+{
+    grib_key_id* k = NULL;
+    char* p        = NULL;
+
+    if (!c)
+        c = grib_context_get_default();
+    *err = GRIB_SUCCESS;
+    if (!name || !*name) {
+        *err = GRIB_INVALID_ARGUMENT;
+        return NULL;
+    }
+
+    k = (grib_key_id*)grib_context_malloc_clear(c, sizeof(grib_key_id));
+    if (!k) {
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    k->context  = c;
+    k->name     = grib_context_strdup(c, name);
+    k->basename = k->name;
+    k->id       = -1;
+    if (!k->name) {
+        grib_key_delete(k);
+        *err = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+
+    if (name[0] == '#' || name[0] == '/' || strstr(name, "->"))
+        return k;
+
+    p = strchr(name, '.');
+    if (p) {
+        size_t len = p - name;
+        if (len >= MAX_NAMESPACE_LEN)
+            return k;
+        k->name_space = (char*)grib_context_malloc_clear(c, len + 1);
+        if (!k->name_space) {
+            grib_key_delete(k);
+            *err = GRIB_OUT_OF_MEMORY;
+            return NULL;
+        }
+        memcpy(k->name_space, name, len);
+        k->basename = k->name + len + 1;
+    }
+    k->id = grib_hash_keys_get_id(c->keys, k->basename);
+
+    return k;
+}
+
+void grib_key_delete(grib_key_id* k)
+{
+    if (!k)
+        return;
+    grib_context_free(k->context, k->name_space);
+    grib_context_free(k->context, k->name);
+    grib_context_free(k->context, k);
+}
+
+/* Same result as grib_find_accessor(h, k->name) */
+grib_accessor* grib_find_accessor_by_key_id(const grib_handle* ch, const grib_key_id* k)
+{
+    grib_handle* h   = (grib_handle*)ch;
+    grib_accessor* a = NULL;
+
+    if (k->id < 0 || h->context->keys != k->context->keys)
+        return grib_find_accessor(h, k->name);
+    if (h->deferred_reparses)
+        action_section_apply_deferred_reparses(h);
+
+    while (h) {
+        if (!h->use_trie) {
+            a = search(h->root, k->basename, k->name_space);
+        }
+        else if ((a = grib_handle_get_accessor_by_id(h, k->id)) == NULL ||
+                 (k->name_space && !matching(a, k->basename, k->name_space))) {
+            a = search(h->root, k->basename, k->name_space);
+            grib_handle_set_accessor_by_id(h, k->id, a);
+        }
+        if (a)
+            return a;
+        h = h->main;
+    }
+    return NULL;
+}
+
 char* grib_split_name_attribute(grib_context* c, const char* name, char* attribute_name)
 {
     /*returns accessor name and attribute*/
@@ -566,7 +785,9 @@ char* grib_split_name_attribute(grib_context* c, const char* name, char* attribu
     return accessor_name;
 }
 
-grib_accessor* grib_find_accessor(const grib_handle* h, const char* name)
+/* The accessor of the key in the structure built so far, which may still
+ * have sections to rebuild for an update in progress (see grib_handle_begin_update) */
+grib_accessor* grib_find_accessor_as_built(const grib_handle* h, const char* name)
 {
     grib_accessor* aret = NULL;
     Assert(h);
@@ -592,6 +813,15 @@ grib_accessor* grib_find_accessor(const grib_handle* h, const char* name)
     return aret;
 }
 
+/* Keys are found in the structure of the message as it will be once updated */
+grib_accessor* grib_find_accessor(const grib_handle* h, const char* name)
+{
+    Assert(h);
+    if (h->deferred_reparses)
+        action_section_apply_deferred_reparses((grib_handle*)h);
+    return grib_find_accessor_as_built(h, name);
+}
+
 grib_accessor* grib_find_attribute(grib_handle* h, const char* name, const char* attr_name, int* err)
 {
     grib_accessor* a   = NULL;
@@ -628,12 +858,12 @@ grib_accessor* grib_find_accessor_fast(grib_handle* h, const char* name)
 
         name_space[len] = '\0';
 
-        a = h->accessors[grib_hash_keys_get_id(h->context->keys, name)];
+        a = grib_handle_get_accessor_by_id(h, grib_hash_keys_get_id(h->context->keys, name));
         if (a && !matching(a, name, name_space))
             a = NULL;
     }
     else {
-        a = h->accessors[grib_hash_keys_get_id(h->context->keys, name)];
+        a = grib_handle_get_accessor_by_id(h, grib_hash_keys_get_id(h->context->keys, name));
     }
 
     if (a == NULL && h->main)
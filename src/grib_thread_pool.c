@@ -0,0 +1,241 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Thread pool used to split the decoding and encoding of one large field
+ * across cores. The number of threads is a property of the context
+ * (see grib_context_set_threads) and fields with fewer values than the
+ * context threshold are always done by the calling thread.
+ *
+ * A run hands out tasks 0..ntasks-1; the calling thread takes tasks too and
+ * returns when all of them are finished. Only one run uses the pool at a
+ * time: a thread finding the pool busy runs its tasks itself.
+ */
+
+#include "grib_api_internal.h"
+
+#if GRIB_PTHREADS
+
+struct grib_thread_pool
+{
+    int nworkers;
+    pthread_t* workers;
+    pthread_mutex_t busy;  /* held for the whole of a run */
+    pthread_mutex_t mutex; /* protects the fields below */
+    pthread_cond_t start;  /* a run has started or the pool is stopping */
+    pthread_cond_t done;   /* the last task of a run has finished */
+    unsigned long run;
+    int stop;
+    grib_thread_pool_proc proc;
+    void* data;
+    int ntasks;
+    int next;
+    int pending;
+};
+
+static pthread_once_t once        = PTHREAD_ONCE_INIT;
+static pthread_mutex_t mutex_pool = PTHREAD_MUTEX_INITIALIZER;
+
+static void init()
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex_pool, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+/* Called with pool->mutex held */
+static void take_tasks(grib_thread_pool* pool)
+{
+    while (pool->next < pool->ntasks) {
+        int k = pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
+        pool->proc(pool->data, k, pool->ntasks);
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->pending == 0)
+            pthread_cond_signal(&pool->done);
+    }
+}
+
+static void* worker(void* arg)
+{
+    grib_thread_pool* pool = (grib_thread_pool*)arg;
+    unsigned long seen     = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    seen = pool->run;
+    for (;;) {
+        while (!pool->stop && pool->run == seen)
+            pthread_cond_wait(&pool->start, &pool->mutex);
+        if (pool->stop)
+            break;
+        seen = pool->run;
+        take_tasks(pool);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+static void pool_delete(grib_thread_pool* pool)
+{
+    int i;
+    pthread_mutex_lock(&pool->busy);
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+    for (i = 0; i < pool->nworkers; i++)
+        pthread_join(pool->workers[i], NULL);
+    pthread_mutex_unlock(&pool->busy);
+
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_mutex_destroy(&pool->busy);
+    free(pool->workers);
+    free(pool);
+}
+
+static grib_thread_pool* pool_new(grib_context* c, int nworkers)
+{
+    grib_thread_pool* pool = (grib_thread_pool*)calloc(1, sizeof(grib_thread_pool));
+    int i;
+
+    if (!pool)
+        return NULL;
+    pool->workers = (pthread_t*)calloc(nworkers, sizeof(pthread_t));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->busy, NULL);
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i < nworkers; i++) {
+        if (pthread_create(&pool->workers[i], NULL, worker, pool) != 0) {
+            grib_context_log(c, GRIB_LOG_WARNING, "Unable to start thread %d of the thread pool", i + 1);
+            break;
+        }
+        pool->nworkers++;
+    }
+    return pool;
+}
+
+static grib_thread_pool* get_pool(grib_context* c)
+{
+    grib_thread_pool* pool = NULL;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex_pool);
+    if (!c->thread_pool && c->threads > 1)
+        c->thread_pool = pool_new(c, c->threads - 1);
+    pool = c->thread_pool;
+    GRIB_MUTEX_UNLOCK(&mutex_pool);
+    return pool;
+}
+
+void grib_thread_pool_run(grib_context* c, int ntasks, grib_thread_pool_proc proc, void* data)
+{
+    grib_thread_pool* pool = NULL;
+    int k;
+
+    if (!c)
+        c = grib_context_get_default();
+    if (ntasks > 1)
+        pool = get_pool(c);
+
+    if (!pool || pthread_mutex_trylock(&pool->busy) != 0) {
+        for (k = 0; k < ntasks; k++)
+            proc(data, k, ntasks);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->proc    = proc;
+    pool->data    = data;
+    pool->ntasks  = ntasks;
+    pool->next    = 0;
+    pool->pending = ntasks;
+    pool->run++;
+    pthread_cond_broadcast(&pool->start);
+    take_tasks(pool);
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+    pthread_mutex_unlock(&pool->busy);
+}
+
+void grib_thread_pool_delete(grib_context* c)
+{
+    grib_thread_pool* pool = NULL;
+
+    if (!c)
+        c = grib_context_get_default();
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex_pool);
+    pool           = c->thread_pool;
+    c->thread_pool = NULL;
+    GRIB_MUTEX_UNLOCK(&mutex_pool);
+    if (pool)
+        pool_delete(pool);
+}
+
+#else
+
+void grib_thread_pool_run(grib_context* c, int ntasks, grib_thread_pool_proc proc, void* data)
+{
+    int k;
+    if (!c)
+        c = grib_context_get_default();
+#if GRIB_OMP_THREADS
+#pragma omp parallel for schedule(dynamic, 1) num_threads(c->threads > 1 ? c->threads : 1)
+#endif
+    for (k = 0; k < ntasks; k++)
+        proc(data, k, ntasks);
+}
+
+void grib_thread_pool_delete(grib_context* c)
+{
+}
+
+#endif
+
+/*
+ * Number of tasks to split a field of n_vals values into: one per thread
+ * of the context, or just one if the field is below the threshold.
+ */
+int grib_thread_pool_ntasks(grib_context* c, size_t n_vals)
+{
+    if (!c)
+        c = grib_context_get_default();
+    if (c->threads <= 1 || n_vals < c->threads_min_values)
+        return 1;
+    return c->threads;
+}
+
+/*
+ * Values [*begin, *end) of the n_vals for task k of ntasks. Tasks start on a
+ * multiple of grain values; with a grain of 8, tasks working on the same
+ * packed data never share a byte.
+ */
+void grib_thread_pool_range(size_t n_vals, size_t grain, int k, int ntasks, size_t* begin, size_t* end)
+{
+    size_t chunk = (n_vals + ntasks - 1) / ntasks;
+    chunk        = (chunk + grain - 1) / grain * grain;
+    *begin       = chunk * k;
+    *end         = *begin + chunk;
+    if (*begin > n_vals)
+        *begin = n_vals;
+    if (*end > n_vals)
+        *end = n_vals;
+}
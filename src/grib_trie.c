@@ -388,6 +388,39 @@ void grib_trie_clear(grib_trie* t)
     }
 }
 
+/* The nodes missing for the rest of key k, built apart and linked to t last,
+ * once filled, as lookups are done without the mutex (see grib_trie_get) */
+static grib_trie* link_new_nodes(grib_trie* t, const char* key, const char* k, void* data)
+{
+    grib_trie* first = NULL;
+    grib_trie* last  = NULL;
+    int j0           = 0;
+
+    DebugCheckBounds((int)*k, key);
+    j0    = mapping[(int)*k++];
+    first = last = grib_trie_new(t->context);
+    while (*k) {
+        int j = 0;
+        DebugCheckBounds((int)*k, key);
+        j = mapping[(int)*k++];
+        if (j < last->first)
+            last->first = j;
+        if (j > last->last)
+            last->last = j;
+        last = last->next[j] = grib_trie_new(t->context);
+    }
+    last->data = data;
+
+    if (j0 < t->first)
+        t->first = j0;
+    if (j0 > t->last)
+        t->last = j0;
+    GRIB_PUBLISH(t->next[j0], first);
+    return last;
+}
+
+/* The data replaced is returned. It is not to be freed while the trie is in
+ * use, as lookups may still hold it (see grib_trie_get) */
 void* grib_trie_insert(grib_trie* t, const char* key, void* data)
 {
     grib_trie* last = t;
@@ -411,28 +444,17 @@ void* grib_trie_insert(grib_trie* t, const char* key, void* data)
     }
 
     if (*k == 0) {
-        old     = t->data;
-        t->data = data;
+        old = t->data;
+        GRIB_PUBLISH(t->data, data);
     }
     else {
-        t = last;
-        while (*k) {
-            int j = 0;
-            DebugCheckBounds((int)*k, key);
-            j = mapping[(int)*k++];
-            if (j < t->first)
-                t->first = j;
-            if (j > t->last)
-                t->last = j;
-            t = t->next[j] = grib_trie_new(t->context);
-        }
-        old     = t->data;
-        t->data = data;
+        link_new_nodes(last, key, k, data);
     }
     GRIB_MUTEX_UNLOCK(&mutex);
     return data == old ? NULL : old;
 }
 
+/* The data of the key: that already there if any, else the data given */
 void* grib_trie_insert_no_replace(grib_trie* t, const char* key, void* data)
 {
     grib_trie* last = t;
@@ -443,6 +465,9 @@ void* grib_trie_insert_no_replace(grib_trie* t, const char* key, void* data)
         return NULL;
     }
 
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+
     while (*k && t) {
         last = t;
         DebugCheckBounds((int)*k, key);
@@ -451,43 +476,38 @@ void* grib_trie_insert_no_replace(grib_trie* t, const char* key, void* data)
             k++;
     }
 
-    if (*k != 0) {
-        t = last;
-        while (*k) {
-            int j = 0;
-            DebugCheckBounds((int)*k, key);
-            j = mapping[(int)*k++];
-            if (j < t->first)
-                t->first = j;
-            if (j > t->last)
-                t->last = j;
-            t = t->next[j] = grib_trie_new(t->context);
-        }
-    }
-
-    if (!t->data)
-        t->data = data;
+    if (*k != 0)
+        t = link_new_nodes(last, key, k, data);
+    else if (!t->data)
+        GRIB_PUBLISH(t->data, data);
+    data = t->data;
 
-    return t->data;
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return data;
 }
 
+/* Inserts link nodes and data once filled, and nothing is removed while the
+ * trie is in use, so lookups take no lock where GRIB_PUBLISHED allows it */
 void* grib_trie_get(grib_trie* t, const char* key)
 {
     const char* k = key;
+    void* data    = NULL;
+
+#if !GRIB_LOCK_FREE_READS
     GRIB_MUTEX_INIT_ONCE(&once, &init);
     GRIB_MUTEX_LOCK(&mutex);
-
+#endif
     while (*k && t) {
         DebugCheckBounds((int)*k, key);
-        t = t->next[mapping[(int)*k++]];
+        t = GRIB_PUBLISHED(t->next[mapping[(int)*k++]]);
     }
 
-    if (*k == 0 && t != NULL && t->data != NULL) {
-        GRIB_MUTEX_UNLOCK(&mutex);
-        return t->data;
-    }
+    if (*k == 0 && t != NULL)
+        data = GRIB_PUBLISHED(t->data);
+#if !GRIB_LOCK_FREE_READS
     GRIB_MUTEX_UNLOCK(&mutex);
-    return NULL;
+#endif
+    return data;
 }
 
 /*
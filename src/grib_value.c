@@ -27,6 +27,22 @@ GRIB_INLINE static int grib_inline_strcmp(const char* a, const char* b)
     return (*a == 0 && *b == 0) ? 0 : 1;
 }
 
+/* The accessor of a key set by the user in an update (see grib_handle_begin_update).
+ * Sections waiting to be rebuilt are rebuilt first, so that the key is set in the
+ * new structure, unless the key itself rebuilds a section */
+static grib_accessor* find_accessor_to_set(grib_handle* h, const char* name, int* err)
+{
+    grib_accessor* a = grib_find_accessor_as_built(h, name);
+
+    *err = GRIB_SUCCESS;
+    if (h->deferred_reparses && (!a || !grib_dependency_triggers_reparse(a))) {
+        if ((*err = action_section_apply_deferred_reparses(h)) != GRIB_SUCCESS)
+            return NULL;
+        a = grib_find_accessor_as_built(h, name);
+    }
+    return a;
+}
+
 int grib_set_expression(grib_handle* h, const char* name, grib_expression* e)
 {
     grib_accessor* a = grib_find_accessor(h, name);
@@ -93,7 +109,9 @@ int grib_set_long(grib_handle* h, const char* name, long val)
     grib_accessor* a = NULL;
     size_t l         = 1;
 
-    a = grib_find_accessor(h, name);
+    a = find_accessor_to_set(h, name, &ret);
+    if (ret != GRIB_SUCCESS)
+        return ret;
 
     if (h->context->debug)
         fprintf(stderr, "ECCODES DEBUG grib_set_long %s=%ld\n", name, (long)val);
@@ -316,7 +334,9 @@ int grib_set_double(grib_handle* h, const char* name, double val)
     grib_accessor* a = NULL;
     size_t l         = 1;
 
-    a = grib_find_accessor(h, name);
+    a = find_accessor_to_set(h, name, &ret);
+    if (ret != GRIB_SUCCESS)
+        return ret;
 
     if (h->context->debug)
         fprintf(stderr, "ECCODES DEBUG grib_set_double %s=%g\n", name, val);
@@ -390,7 +410,9 @@ int grib_set_string(grib_handle* h, const char* name, const char* val, size_t* l
         }
     }
 
-    a = grib_find_accessor(h, name);
+    a = find_accessor_to_set(h, name, &ret);
+    if (ret != GRIB_SUCCESS)
+        return ret;
 
     if (h->context->debug)
         fprintf(stderr, "ECCODES DEBUG grib_set_string %s=|%s|\n", name, val);
@@ -413,7 +435,9 @@ int grib_set_string_array(grib_handle* h, const char* name, const char** val, si
     int ret = 0;
     grib_accessor* a;
 
-    a = grib_find_accessor(h, name);
+    a = find_accessor_to_set(h, name, &ret);
+    if (ret != GRIB_SUCCESS)
+        return ret;
 
     if (h->context->debug) {
         fprintf(stderr, "ECCODES DEBUG grib_set_string_array key=%s %ld values\n", name, (long)length);
@@ -457,8 +481,10 @@ int grib_set_bytes_internal(grib_handle* h, const char* name, const unsigned cha
 int grib_set_bytes(grib_handle* h, const char* name, const unsigned char* val, size_t* length)
 {
     int ret          = 0;
-    grib_accessor* a = grib_find_accessor(h, name);
+    grib_accessor* a = find_accessor_to_set(h, name, &ret);
 
+    if (ret != GRIB_SUCCESS)
+        return ret;
     if (a) {
         /* if(a->flags & GRIB_ACCESSOR_FLAG_READ_ONLY) */
         /* return GRIB_READ_ONLY; */
@@ -522,7 +548,9 @@ int grib_set_missing(grib_handle* h, const char* name)
     int ret          = 0;
     grib_accessor* a = NULL;
 
-    a = grib_find_accessor(h, name);
+    a = find_accessor_to_set(h, name, &ret);
+    if (ret != GRIB_SUCCESS)
+        return ret;
 
     if (a) {
         if (a->flags & GRIB_ACCESSOR_FLAG_READ_ONLY)
@@ -706,6 +734,10 @@ static int __grib_set_double_array(grib_handle* h, const char* name, const doubl
 {
     double v = 0;
     size_t i = 0;
+    int err  = 0;
+
+    if (h->deferred_reparses && (err = action_section_apply_deferred_reparses(h)) != GRIB_SUCCESS)
+        return err;
 
     if (h->context->debug) {
         size_t N = 5;
@@ -799,6 +831,22 @@ int grib_set_double_array(grib_handle* h, const char* name, const double* val, s
     return __grib_set_double_array(h, name, val, length, /*check=*/1);
 }
 
+int grib_set_float_array(grib_handle* h, const char* name, const float* val, size_t length)
+{
+    /* The packers work out the scaling from the range of the values in double
+     * precision, so the values are widened once here */
+    size_t i     = 0;
+    int ret      = 0;
+    double* dval = (double*)grib_context_malloc(h->context, (length ? length : 1) * sizeof(double));
+    if (!dval)
+        return GRIB_OUT_OF_MEMORY;
+    for (i = 0; i < length; i++)
+        dval[i] = val[i];
+    ret = __grib_set_double_array(h, name, dval, length, /*check=*/1);
+    grib_context_free(h->context, dval);
+    return ret;
+}
+
 static int _grib_set_long_array_internal(grib_handle* h, grib_accessor* a, const long* val, size_t buffer_len, size_t* encoded_length, int check)
 {
     if (a) {
@@ -878,6 +926,9 @@ int grib_set_long_array_internal(grib_handle* h, const char* name, const long* v
 
 int grib_set_long_array(grib_handle* h, const char* name, const long* val, size_t length)
 {
+    int err = 0;
+    if (h->deferred_reparses && (err = action_section_apply_deferred_reparses(h)) != GRIB_SUCCESS)
+        return err;
     return _grib_set_long_array(h, name, val, length, 1);
 }
 
@@ -991,11 +1042,22 @@ int grib_get_double_element(const grib_handle* h, const char* name, int i, doubl
     grib_accessor* act = grib_find_accessor(h, name);
 
     if (act) {
+        if (i >= 0 && grib_values_cache_get_element(act, i, val) == GRIB_SUCCESS)
+            return GRIB_SUCCESS;
         return grib_unpack_double_element(act, i, val);
     }
     return GRIB_NOT_FOUND;
 }
 
+int grib_get_double_element_set(const grib_handle* h, const char* name, const size_t* index_array, size_t len, double* val_array)
+{
+    grib_accessor* act = grib_find_accessor(h, name);
+
+    if (act)
+        return grib_unpack_double_element_set(act, index_array, len, val_array);
+    return GRIB_NOT_FOUND;
+}
+
 int grib_points_get_values(grib_handle* h, grib_points* points, double* val)
 {
     int i, ret;
@@ -1012,10 +1074,14 @@ int grib_points_get_values(grib_handle* h, grib_points* points, double* val)
     return GRIB_SUCCESS;
 }
 
+/* Up to one value in ELEMENTS_RATIO is got element by element, more by decoding the whole field */
+#define ELEMENTS_RATIO 8
+
 int grib_get_double_elements(const grib_handle* h, const char* name, int* index_array, long len, double* val_array)
 {
-    double* values = 0;
-    int err        = 0;
+    double* values    = 0;
+    size_t* index_set = NULL;
+    int err           = 0;
     size_t size = 0, num_bytes = 0;
     long j             = 0;
     grib_accessor* act = NULL;
@@ -1041,6 +1107,29 @@ int grib_get_double_elements(const grib_handle* h, const char* name, int* index_
         }
     }
 
+    /* The values cached, else only the elements asked for when they are few
+     * and the accessor can decode them without decoding the whole field */
+    for (j = 0; j < len; j++) {
+        if (grib_values_cache_get_element(act, index_array[j], &val_array[j]) != GRIB_SUCCESS)
+            break;
+    }
+    if (j == len)
+        return GRIB_SUCCESS;
+
+    if (len <= size / ELEMENTS_RATIO) {
+        index_set = (size_t*)grib_context_malloc(h->context, len * sizeof(size_t));
+        if (!index_set) {
+            grib_context_log(h->context, GRIB_LOG_ERROR, "grib_get_double_elements: unable to allocate %ld bytes\n", len * sizeof(size_t));
+            return GRIB_OUT_OF_MEMORY;
+        }
+        for (j = 0; j < len; j++)
+            index_set[j] = index_array[j];
+        err = grib_unpack_double_element_set(act, index_set, len, val_array);
+        grib_context_free(h->context, index_set);
+        if (err != GRIB_NOT_IMPLEMENTED)
+            return err;
+    }
+
     num_bytes = size * sizeof(double);
     values    = (double*)grib_context_malloc(h->context, num_bytes);
     if (!values) {
@@ -1050,6 +1139,7 @@ int grib_get_double_elements(const grib_handle* h, const char* name, int* index_
 
     err = grib_unpack_double(act, values, &size);
     if (!err) {
+        grib_values_cache_put(act, values, size);
         for (j = 0; j < len; j++) {
             val_array[j] = values[index_array[j]];
         }
@@ -1201,8 +1291,67 @@ int grib_get_double_array(const grib_handle* h, const char* name, double* val, s
             return grib_unpack_double(a, val, length);
         }
         else {
+            if (grib_values_cache_get(a, val, length) == GRIB_SUCCESS)
+                return GRIB_SUCCESS;
+            *length = 0;
+            ret     = _grib_get_double_array_internal(h, a, val, len, length);
+            if (ret == GRIB_SUCCESS)
+                grib_values_cache_put(a, val, *length);
+            return ret;
+        }
+    }
+}
+
+static int _grib_get_float_array_internal(const grib_handle* h, grib_accessor* a, float* val, size_t buffer_len, size_t* decoded_length)
+{
+    if (a) {
+        int err = _grib_get_float_array_internal(h, a->same, val, buffer_len, decoded_length);
+
+        if (err == GRIB_SUCCESS) {
+            size_t len = buffer_len - *decoded_length;
+            err        = grib_unpack_float(a, val + *decoded_length, &len);
+            *decoded_length += len;
+        }
+
+        return err;
+    }
+    else {
+        return GRIB_SUCCESS;
+    }
+}
+
+int grib_get_float_array(const grib_handle* h, const char* name, float* val, size_t* length)
+{
+    size_t len       = *length;
+    grib_accessor* a = NULL;
+
+    if (name[0] == '/') {
+        /* Attribute queries have no float decoders: go through doubles */
+        size_t i     = 0;
+        int ret      = 0;
+        double* dval = (double*)grib_context_malloc(h->context, (len ? len : 1) * sizeof(double));
+        if (!dval)
+            return GRIB_OUT_OF_MEMORY;
+        ret = grib_get_double_array(h, name, dval, length);
+        if (ret == GRIB_SUCCESS) {
+            for (i = 0; i < *length; i++)
+                val[i] = (float)dval[i];
+        }
+        grib_context_free(h->context, dval);
+        return ret;
+    }
+    else {
+        a = grib_find_accessor(h, name);
+        if (!a)
+            return GRIB_NOT_FOUND;
+        if (name[0] == '#') {
+            return grib_unpack_float(a, val, length);
+        }
+        else {
+            if (grib_values_cache_get_float(a, val, length) == GRIB_SUCCESS)
+                return GRIB_SUCCESS;
             *length = 0;
-            return _grib_get_double_array_internal(h, a, val, len, length);
+            return _grib_get_float_array_internal(h, a, val, len, length);
         }
     }
 }
@@ -1433,6 +1582,112 @@ int grib_get_long_array(const grib_handle* h, const char* name, long* val, size_
     return ret;
 }
 
+/*
+ * Gets through a key compiled with grib_key_compile: same results as the
+ * gets by name, without parsing and hashing the name on every call.
+ */
+int grib_get_long_by_id(const grib_handle* h, const grib_key_id* k, long* val)
+{
+    size_t length    = 1;
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_long(h, k->name, val);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    return grib_unpack_long(a, val, &length);
+}
+
+int grib_get_double_by_id(const grib_handle* h, const grib_key_id* k, double* val)
+{
+    size_t length    = 1;
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_double(h, k->name, val);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    return grib_unpack_double(a, val, &length);
+}
+
+int grib_get_string_by_id(const grib_handle* h, const grib_key_id* k, char* val, size_t* length)
+{
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_string(h, k->name, val, length);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    return grib_unpack_string(a, val, length);
+}
+
+int grib_get_size_by_id(const grib_handle* h, const grib_key_id* k, size_t* size)
+{
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_size(h, k->name, size);
+    *size = 0;
+    a     = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    return _grib_get_size(h, a, size);
+}
+
+int grib_get_long_array_by_id(const grib_handle* h, const grib_key_id* k, long* val, size_t* length)
+{
+    size_t len       = *length;
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_long_array(h, k->name, val, length);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    *length = 0;
+    return _grib_get_long_array_internal(h, a, val, len, length);
+}
+
+int grib_get_double_array_by_id(const grib_handle* h, const grib_key_id* k, double* val, size_t* length)
+{
+    size_t len       = *length;
+    grib_accessor* a = NULL;
+
+    int ret          = 0;
+
+    if (k->id < 0)
+        return grib_get_double_array(h, k->name, val, length);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    if (grib_values_cache_get(a, val, length) == GRIB_SUCCESS)
+        return GRIB_SUCCESS;
+    *length = 0;
+    ret     = _grib_get_double_array_internal(h, a, val, len, length);
+    if (ret == GRIB_SUCCESS)
+        grib_values_cache_put(a, val, *length);
+    return ret;
+}
+
+int grib_get_float_array_by_id(const grib_handle* h, const grib_key_id* k, float* val, size_t* length)
+{
+    size_t len       = *length;
+    grib_accessor* a = NULL;
+
+    if (k->id < 0)
+        return grib_get_float_array(h, k->name, val, length);
+    a = grib_find_accessor_by_key_id(h, k);
+    if (!a)
+        return GRIB_NOT_FOUND;
+    if (grib_values_cache_get_float(a, val, length) == GRIB_SUCCESS)
+        return GRIB_SUCCESS;
+    *length = 0;
+    return _grib_get_float_array_internal(h, a, val, len, length);
+}
+
 static void grib_clean_key_value(grib_context* c, grib_key_value_list* kv)
 {
     if (kv->long_value)
@@ -0,0 +1,287 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Decoded values of GRIB handles (the "values" key), kept so that getting
+ * them again, or after max, average and the other statistics, does not
+ * decode the data section again.
+ *
+ * There is no cache unless the context has a budget in bytes (see
+ * grib_context_set_values_cache_size). The values of all the handles of the
+ * context share it: the least recently used are dropped to make room for
+ * new ones. A handle drops its values before any of its keys is packed (see
+ * grib_accessor.c) and when it is deleted.
+ *
+ * A handle is used by one thread at a time, but its values can be dropped
+ * to make room for those of a handle of another thread, so the entries are
+ * only looked at with the lock held.
+ */
+
+#include "grib_api_internal.h"
+
+#if GRIB_PTHREADS
+static pthread_once_t once   = PTHREAD_ONCE_INIT;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void init()
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+#elif GRIB_OMP_THREADS
+static int once = 0;
+static omp_nest_lock_t mutex;
+
+static void init()
+{
+    GRIB_OMP_CRITICAL(lock_grib_values_cache_c)
+    {
+        if (once == 0) {
+            omp_init_nest_lock(&mutex);
+            once = 1;
+        }
+    }
+}
+#endif
+
+struct grib_values_cache_entry
+{
+    grib_handle* handle;
+    const grib_accessor* accessor;
+    double* values;
+    size_t count;
+    grib_values_cache_entry* next; /* of the same handle */
+    grib_values_cache_entry* older;
+    grib_values_cache_entry* newer;
+};
+
+struct grib_values_cache
+{
+    size_t used; /* bytes of values */
+    grib_values_cache_entry* oldest;
+    grib_values_cache_entry* newest;
+};
+
+/* Whether the values of the accessor are kept: only the values of the
+ * field, not those it is decoded from (e.g. codedValues), which would take
+ * as much memory again */
+static int is_cached(const grib_accessor* a)
+{
+    return a->context->values_cache_size > 0 && a->same == NULL &&
+           strcmp(a->name, "values") == 0 &&
+           grib_handle_of_accessor(a)->product_kind == PRODUCT_GRIB;
+}
+
+static void unlink_lru(grib_values_cache* vc, grib_values_cache_entry* e)
+{
+    if (e->older)
+        e->older->newer = e->newer;
+    else
+        vc->oldest = e->newer;
+    if (e->newer)
+        e->newer->older = e->older;
+    else
+        vc->newest = e->older;
+    e->older = e->newer = NULL;
+}
+
+static void link_newest(grib_values_cache* vc, grib_values_cache_entry* e)
+{
+    e->older = vc->newest;
+    e->newer = NULL;
+    if (vc->newest)
+        vc->newest->newer = e;
+    else
+        vc->oldest = e;
+    vc->newest = e;
+}
+
+static void delete_entry(grib_context* c, grib_values_cache_entry* e)
+{
+    grib_values_cache_entry** p = &e->handle->values_cache;
+
+    while (*p != e)
+        p = &(*p)->next;
+    *p = e->next;
+
+    unlink_lru(c->values_cache, e);
+    c->values_cache->used -= e->count * sizeof(double);
+    grib_context_free(c, e->values);
+    grib_context_free(c, e);
+}
+
+/* Drop the least recently used values until 'size' more bytes fit */
+static void make_room(grib_context* c, size_t size)
+{
+    grib_values_cache* vc = c->values_cache;
+    while (vc->oldest && vc->used + size > c->values_cache_size)
+        delete_entry(c, vc->oldest);
+}
+
+static grib_values_cache_entry* find_entry(const grib_accessor* a)
+{
+    grib_handle* h             = grib_handle_of_accessor(a);
+    grib_values_cache_entry* e = h->values_cache;
+    while (e && e->accessor != a)
+        e = e->next;
+    return e;
+}
+
+/* The values of 'a' if they are cached and fit in 'len', the most recently used then */
+static grib_values_cache_entry* lookup(const grib_accessor* a, size_t len)
+{
+    grib_values_cache_entry* e = find_entry(a);
+    if (!e || e->count > len)
+        return NULL;
+    unlink_lru(a->context->values_cache, e);
+    link_newest(a->context->values_cache, e);
+    return e;
+}
+
+int grib_values_cache_get(const grib_accessor* a, double* val, size_t* len)
+{
+    grib_values_cache_entry* e = NULL;
+    int err                    = GRIB_NOT_FOUND;
+
+    if (!a->context->values_cache || !is_cached(a))
+        return GRIB_NOT_FOUND;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    if ((e = lookup(a, *len)) != NULL) {
+        memcpy(val, e->values, e->count * sizeof(double));
+        *len = e->count;
+        err  = GRIB_SUCCESS;
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return err;
+}
+
+int grib_values_cache_get_float(const grib_accessor* a, float* val, size_t* len)
+{
+    grib_values_cache_entry* e = NULL;
+    size_t i                   = 0;
+    int err                    = GRIB_NOT_FOUND;
+
+    if (!a->context->values_cache || !is_cached(a))
+        return GRIB_NOT_FOUND;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    if ((e = lookup(a, *len)) != NULL) {
+        for (i = 0; i < e->count; i++)
+            val[i] = (float)e->values[i];
+        *len = e->count;
+        err  = GRIB_SUCCESS;
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return err;
+}
+
+int grib_values_cache_get_element(const grib_accessor* a, size_t i, double* val)
+{
+    grib_values_cache_entry* e = NULL;
+    int err                    = GRIB_NOT_FOUND;
+
+    if (!a->context->values_cache || !is_cached(a))
+        return GRIB_NOT_FOUND;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    if ((e = lookup(a, (size_t)-1)) != NULL && i < e->count) {
+        *val = e->values[i];
+        err  = GRIB_SUCCESS;
+    }
+    GRIB_MUTEX_UNLOCK(&mutex);
+    return err;
+}
+
+/* Keep a copy of the values just decoded from 'a', if they fit in the budget */
+void grib_values_cache_put(const grib_accessor* a, const double* val, size_t len)
+{
+    grib_context* c            = a->context;
+    grib_handle* h             = grib_handle_of_accessor(a);
+    grib_values_cache_entry* e = NULL;
+    size_t size                = len * sizeof(double);
+
+    if (!is_cached(a) || len == 0 || size > c->values_cache_size)
+        return;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+
+    if (!c->values_cache)
+        c->values_cache = (grib_values_cache*)grib_context_malloc_clear_persistent(c, sizeof(grib_values_cache));
+    if (!c->values_cache || find_entry(a)) {
+        GRIB_MUTEX_UNLOCK(&mutex);
+        return;
+    }
+
+    make_room(c, size);
+    e = (grib_values_cache_entry*)grib_context_malloc_clear(c, sizeof(grib_values_cache_entry));
+    if (e && (e->values = (double*)grib_context_malloc(c, size)) != NULL) {
+        memcpy(e->values, val, size);
+        e->handle       = h;
+        e->accessor     = a;
+        e->count        = len;
+        e->next         = h->values_cache;
+        h->values_cache = e;
+        link_newest(c->values_cache, e);
+        c->values_cache->used += size;
+    }
+    else {
+        grib_context_free(c, e);
+    }
+
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+/* Drop the values of the handle */
+void grib_values_cache_clear(grib_handle* h)
+{
+    grib_context* c = h->context;
+
+    /* Once created, the cache of the context stays */
+    if (!c->values_cache)
+        return;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    while (h->values_cache)
+        delete_entry(c, h->values_cache);
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+void grib_values_cache_resize(grib_context* c, size_t size)
+{
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    c->values_cache_size = size;
+    if (c->values_cache)
+        make_room(c, 0);
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
+
+void grib_values_cache_delete(grib_context* c)
+{
+    if (!c->values_cache)
+        return;
+
+    GRIB_MUTEX_INIT_ONCE(&once, &init);
+    GRIB_MUTEX_LOCK(&mutex);
+    while (c->values_cache->oldest)
+        delete_entry(c, c->values_cache->oldest);
+    grib_context_free_persistent(c, c->values_cache);
+    c->values_cache = NULL;
+    GRIB_MUTEX_UNLOCK(&mutex);
+}
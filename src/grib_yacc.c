@@ -150,121 +150,122 @@ extern int grib_yydebug;
     UNSIGNED = 264,
     TEMPLATE = 265,
     TEMPLATE_NOFAIL = 266,
-    TRIGGER = 267,
-    ASCII = 268,
-    GROUP = 269,
-    NON_ALPHA = 270,
-    KSEC1EXPVER = 271,
-    LABEL = 272,
-    LIST = 273,
-    IS_IN_LIST = 274,
-    IS_IN_DICT = 275,
-    IS_INTEGER = 276,
-    TO_INTEGER = 277,
-    TO_STRING = 278,
-    SEX2DEC = 279,
-    WHILE = 280,
-    IBMFLOAT = 281,
-    SIGNED = 282,
-    UINT8 = 283,
-    INT8 = 284,
-    UINT16 = 285,
-    INT16 = 286,
-    UINT16_LITTLE_ENDIAN = 287,
-    INT16_LITTLE_ENDIAN = 288,
-    UINT32 = 289,
-    INT32 = 290,
-    UINT32_LITTLE_ENDIAN = 291,
-    INT32_LITTLE_ENDIAN = 292,
-    UINT64 = 293,
-    INT64 = 294,
-    UINT64_LITTLE_ENDIAN = 295,
-    INT64_LITTLE_ENDIAN = 296,
-    BLOB = 297,
-    BYTE = 298,
-    CODETABLE = 299,
-    SMART_TABLE = 300,
-    DICTIONARY = 301,
-    COMPLEX_CODETABLE = 302,
-    LOOKUP = 303,
-    ALIAS = 304,
-    UNALIAS = 305,
-    META = 306,
-    POS = 307,
-    INTCONST = 308,
-    TRANS = 309,
-    FLAGBIT = 310,
-    CONCEPT = 311,
-    GETENV = 312,
-    HASH_ARRAY = 313,
-    CONCEPT_NOFAIL = 314,
-    NIL = 315,
-    DUMMY = 316,
-    MODIFY = 317,
-    READ_ONLY = 318,
-    STRING_TYPE = 319,
-    LONG_TYPE = 320,
-    DOUBLE_TYPE = 321,
-    NO_COPY = 322,
-    DUMP = 323,
-    JSON = 324,
-    XML = 325,
-    NO_FAIL = 326,
-    EDITION_SPECIFIC = 327,
-    OVERRIDE = 328,
-    HIDDEN = 329,
-    CAN_BE_MISSING = 330,
-    MISSING = 331,
-    CONSTRAINT = 332,
-    COPY_OK = 333,
-    WHEN = 334,
-    SET = 335,
-    SET_NOFAIL = 336,
-    WRITE = 337,
-    APPEND = 338,
-    PRINT = 339,
-    EXPORT = 340,
-    REMOVE = 341,
-    RENAME = 342,
-    SKIP = 343,
-    PAD = 344,
-    SECTION_PADDING = 345,
-    MESSAGE = 346,
-    MESSAGE_COPY = 347,
-    PADTO = 348,
-    PADTOEVEN = 349,
-    PADTOMULTIPLE = 350,
-    G1_HALF_BYTE = 351,
-    G1_MESSAGE_LENGTH = 352,
-    G1_SECTION4_LENGTH = 353,
-    SECTION_LENGTH = 354,
-    LENGTH = 355,
-    FLAG = 356,
-    ITERATOR = 357,
-    NEAREST = 358,
-    BOX = 359,
-    KSEC = 360,
-    ASSERT = 361,
-    SUBSTR = 362,
-    CASE = 363,
-    SWITCH = 364,
-    DEFAULT = 365,
-    EQ = 366,
-    NE = 367,
-    GE = 368,
-    LE = 369,
-    LT = 370,
-    GT = 371,
-    BIT = 372,
-    BITOFF = 373,
-    AND = 374,
-    OR = 375,
-    NOT = 376,
-    IS = 377,
-    IDENT = 378,
-    STRING = 379,
-    INTEGER = 380,
-    FLOAT = 381
+    INCLUDE = 267,
+    TRIGGER = 268,
+    ASCII = 269,
+    GROUP = 270,
+    NON_ALPHA = 271,
+    KSEC1EXPVER = 272,
+    LABEL = 273,
+    LIST = 274,
+    IS_IN_LIST = 275,
+    IS_IN_DICT = 276,
+    IS_INTEGER = 277,
+    TO_INTEGER = 278,
+    TO_STRING = 279,
+    SEX2DEC = 280,
+    WHILE = 281,
+    IBMFLOAT = 282,
+    SIGNED = 283,
+    UINT8 = 284,
+    INT8 = 285,
+    UINT16 = 286,
+    INT16 = 287,
+    UINT16_LITTLE_ENDIAN = 288,
+    INT16_LITTLE_ENDIAN = 289,
+    UINT32 = 290,
+    INT32 = 291,
+    UINT32_LITTLE_ENDIAN = 292,
+    INT32_LITTLE_ENDIAN = 293,
+    UINT64 = 294,
+    INT64 = 295,
+    UINT64_LITTLE_ENDIAN = 296,
+    INT64_LITTLE_ENDIAN = 297,
+    BLOB = 298,
+    BYTE = 299,
+    CODETABLE = 300,
+    SMART_TABLE = 301,
+    DICTIONARY = 302,
+    COMPLEX_CODETABLE = 303,
+    LOOKUP = 304,
+    ALIAS = 305,
+    UNALIAS = 306,
+    META = 307,
+    POS = 308,
+    INTCONST = 309,
+    TRANS = 310,
+    FLAGBIT = 311,
+    CONCEPT = 312,
+    GETENV = 313,
+    HASH_ARRAY = 314,
+    CONCEPT_NOFAIL = 315,
+    NIL = 316,
+    DUMMY = 317,
+    MODIFY = 318,
+    READ_ONLY = 319,
+    STRING_TYPE = 320,
+    LONG_TYPE = 321,
+    DOUBLE_TYPE = 322,
+    NO_COPY = 323,
+    DUMP = 324,
+    JSON = 325,
+    XML = 326,
+    NO_FAIL = 327,
+    EDITION_SPECIFIC = 328,
+    OVERRIDE = 329,
+    HIDDEN = 330,
+    CAN_BE_MISSING = 331,
+    MISSING = 332,
+    CONSTRAINT = 333,
+    COPY_OK = 334,
+    WHEN = 335,
+    SET = 336,
+    SET_NOFAIL = 337,
+    WRITE = 338,
+    APPEND = 339,
+    PRINT = 340,
+    EXPORT = 341,
+    REMOVE = 342,
+    RENAME = 343,
+    SKIP = 344,
+    PAD = 345,
+    SECTION_PADDING = 346,
+    MESSAGE = 347,
+    MESSAGE_COPY = 348,
+    PADTO = 349,
+    PADTOEVEN = 350,
+    PADTOMULTIPLE = 351,
+    G1_HALF_BYTE = 352,
+    G1_MESSAGE_LENGTH = 353,
+    G1_SECTION4_LENGTH = 354,
+    SECTION_LENGTH = 355,
+    LENGTH = 356,
+    FLAG = 357,
+    ITERATOR = 358,
+    NEAREST = 359,
+    BOX = 360,
+    KSEC = 361,
+    ASSERT = 362,
+    SUBSTR = 363,
+    CASE = 364,
+    SWITCH = 365,
+    DEFAULT = 366,
+    EQ = 367,
+    NE = 368,
+    GE = 369,
+    LE = 370,
+    LT = 371,
+    GT = 372,
+    BIT = 373,
+    BITOFF = 374,
+    AND = 375,
+    OR = 376,
+    NOT = 377,
+    IS = 378,
+    IDENT = 379,
+    STRING = 380,
+    INTEGER = 381,
+    FLOAT = 382
   };
 #endif
 /* Tokens.  */
@@ -277,121 +278,122 @@ extern int grib_yydebug;
 #define UNSIGNED 264
 #define TEMPLATE 265
 #define TEMPLATE_NOFAIL 266
-#define TRIGGER 267
-#define ASCII 268
-#define GROUP 269
-#define NON_ALPHA 270
-#define KSEC1EXPVER 271
-#define LABEL 272
-#define LIST 273
-#define IS_IN_LIST 274
-#define IS_IN_DICT 275
-#define IS_INTEGER 276
-#define TO_INTEGER 277
-#define TO_STRING 278
-#define SEX2DEC 279
-#define WHILE 280
-#define IBMFLOAT 281
-#define SIGNED 282
-#define UINT8 283
-#define INT8 284
-#define UINT16 285
-#define INT16 286
-#define UINT16_LITTLE_ENDIAN 287
-#define INT16_LITTLE_ENDIAN 288
-#define UINT32 289
-#define INT32 290
-#define UINT32_LITTLE_ENDIAN 291
-#define INT32_LITTLE_ENDIAN 292
-#define UINT64 293
-#define INT64 294
-#define UINT64_LITTLE_ENDIAN 295
-#define INT64_LITTLE_ENDIAN 296
-#define BLOB 297
-#define BYTE 298
-#define CODETABLE 299
-#define SMART_TABLE 300
-#define DICTIONARY 301
-#define COMPLEX_CODETABLE 302
-#define LOOKUP 303
-#define ALIAS 304
-#define UNALIAS 305
-#define META 306
-#define POS 307
-#define INTCONST 308
-#define TRANS 309
-#define FLAGBIT 310
-#define CONCEPT 311
-#define GETENV 312
-#define HASH_ARRAY 313
-#define CONCEPT_NOFAIL 314
-#define NIL 315
-#define DUMMY 316
-#define MODIFY 317
-#define READ_ONLY 318
-#define STRING_TYPE 319
-#define LONG_TYPE 320
-#define DOUBLE_TYPE 321
-#define NO_COPY 322
-#define DUMP 323
-#define JSON 324
-#define XML 325
-#define NO_FAIL 326
-#define EDITION_SPECIFIC 327
-#define OVERRIDE 328
-#define HIDDEN 329
-#define CAN_BE_MISSING 330
-#define MISSING 331
-#define CONSTRAINT 332
-#define COPY_OK 333
-#define WHEN 334
-#define SET 335
-#define SET_NOFAIL 336
-#define WRITE 337
-#define APPEND 338
-#define PRINT 339
-#define EXPORT 340
-#define REMOVE 341
-#define RENAME 342
-#define SKIP 343
-#define PAD 344
-#define SECTION_PADDING 345
-#define MESSAGE 346
-#define MESSAGE_COPY 347
-#define PADTO 348
-#define PADTOEVEN 349
-#define PADTOMULTIPLE 350
-#define G1_HALF_BYTE 351
-#define G1_MESSAGE_LENGTH 352
-#define G1_SECTION4_LENGTH 353
-#define SECTION_LENGTH 354
-#define LENGTH 355
-#define FLAG 356
-#define ITERATOR 357
-#define NEAREST 358
-#define BOX 359
-#define KSEC 360
-#define ASSERT 361
-#define SUBSTR 362
-#define CASE 363
-#define SWITCH 364
-#define DEFAULT 365
-#define EQ 366
-#define NE 367
-#define GE 368
-#define LE 369
-#define LT 370
-#define GT 371
-#define BIT 372
-#define BITOFF 373
-#define AND 374
-#define OR 375
-#define NOT 376
-#define IS 377
-#define IDENT 378
-#define STRING 379
-#define INTEGER 380
-#define FLOAT 381
+#define INCLUDE 267
+#define TRIGGER 268
+#define ASCII 269
+#define GROUP 270
+#define NON_ALPHA 271
+#define KSEC1EXPVER 272
+#define LABEL 273
+#define LIST 274
+#define IS_IN_LIST 275
+#define IS_IN_DICT 276
+#define IS_INTEGER 277
+#define TO_INTEGER 278
+#define TO_STRING 279
+#define SEX2DEC 280
+#define WHILE 281
+#define IBMFLOAT 282
+#define SIGNED 283
+#define UINT8 284
+#define INT8 285
+#define UINT16 286
+#define INT16 287
+#define UINT16_LITTLE_ENDIAN 288
+#define INT16_LITTLE_ENDIAN 289
+#define UINT32 290
+#define INT32 291
+#define UINT32_LITTLE_ENDIAN 292
+#define INT32_LITTLE_ENDIAN 293
+#define UINT64 294
+#define INT64 295
+#define UINT64_LITTLE_ENDIAN 296
+#define INT64_LITTLE_ENDIAN 297
+#define BLOB 298
+#define BYTE 299
+#define CODETABLE 300
+#define SMART_TABLE 301
+#define DICTIONARY 302
+#define COMPLEX_CODETABLE 303
+#define LOOKUP 304
+#define ALIAS 305
+#define UNALIAS 306
+#define META 307
+#define POS 308
+#define INTCONST 309
+#define TRANS 310
+#define FLAGBIT 311
+#define CONCEPT 312
+#define GETENV 313
+#define HASH_ARRAY 314
+#define CONCEPT_NOFAIL 315
+#define NIL 316
+#define DUMMY 317
+#define MODIFY 318
+#define READ_ONLY 319
+#define STRING_TYPE 320
+#define LONG_TYPE 321
+#define DOUBLE_TYPE 322
+#define NO_COPY 323
+#define DUMP 324
+#define JSON 325
+#define XML 326
+#define NO_FAIL 327
+#define EDITION_SPECIFIC 328
+#define OVERRIDE 329
+#define HIDDEN 330
+#define CAN_BE_MISSING 331
+#define MISSING 332
+#define CONSTRAINT 333
+#define COPY_OK 334
+#define WHEN 335
+#define SET 336
+#define SET_NOFAIL 337
+#define WRITE 338
+#define APPEND 339
+#define PRINT 340
+#define EXPORT 341
+#define REMOVE 342
+#define RENAME 343
+#define SKIP 344
+#define PAD 345
+#define SECTION_PADDING 346
+#define MESSAGE 347
+#define MESSAGE_COPY 348
+#define PADTO 349
+#define PADTOEVEN 350
+#define PADTOMULTIPLE 351
+#define G1_HALF_BYTE 352
+#define G1_MESSAGE_LENGTH 353
+#define G1_SECTION4_LENGTH 354
+#define SECTION_LENGTH 355
+#define LENGTH 356
+#define FLAG 357
+#define ITERATOR 358
+#define NEAREST 359
+#define BOX 360
+#define KSEC 361
+#define ASSERT 362
+#define SUBSTR 363
+#define CASE 364
+#define SWITCH 365
+#define DEFAULT 366
+#define EQ 367
+#define NE 368
+#define GE 369
+#define LE 370
+#define LT 371
+#define GT 372
+#define BIT 373
+#define BITOFF 374
+#define AND 375
+#define OR 376
+#define NOT 377
+#define IS 378
+#define IDENT 379
+#define STRING 380
+#define INTEGER 381
+#define FLOAT 382
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -415,7 +417,7 @@ union YYSTYPE
   grib_rule               *rules;
   grib_rule_entry         *rule_entry;
 
-#line 419 "y.tab.c"
+#line 421 "y.tab.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -732,21 +734,21 @@ union grib_yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  214
+#define YYFINAL  216
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1892
+#define YYLAST   1876
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  144
+#define YYNTOKENS  145
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  50
+#define YYNNTS  51
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  267
+#define YYNRULES  269
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  903
+#define YYNSTATES  905
 
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   381
+#define YYMAXUTOK   382
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -761,16 +763,16 @@ static const grib_yytype_uint8 grib_yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,   142,     2,     2,
-     131,   132,   140,   143,   127,   138,   134,   141,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   137,   128,
-       2,   133,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,   143,     2,     2,
+     132,   133,   141,   144,   128,   139,   135,   142,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   138,   129,
+       2,   134,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,   129,     2,   130,   139,     2,     2,     2,     2,     2,
+       2,   130,     2,   131,   140,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   135,     2,   136,     2,     2,     2,     2,
+       2,     2,     2,   136,     2,   137,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -796,40 +798,40 @@ static const grib_yytype_uint8 grib_yytranslate[] =
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
      105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126
+     125,   126,   127
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const grib_yytype_int16 grib_yyrline[] =
 {
-       0,   262,   262,   264,   265,   266,   267,   269,   273,   276,
-     277,   278,   279,   282,   283,   287,   288,   291,   292,   293,
-     294,   297,   298,   299,   300,   301,   302,   303,   304,   305,
-     309,   310,   313,   314,   317,   318,   321,   325,   328,   331,
-     334,   337,   340,   343,   346,   349,   352,   355,   359,   362,
-     365,   368,   371,   374,   377,   380,   383,   386,   397,   401,
+       0,   264,   264,   266,   267,   268,   269,   271,   275,   278,
+     279,   280,   281,   284,   285,   289,   290,   293,   294,   295,
+     296,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   312,   313,   316,   317,   320,   321,   324,   328,   331,
+     334,   337,   340,   343,   346,   349,   352,   355,   358,   362,
+     365,   368,   371,   374,   377,   380,   383,   386,   389,   400,
      404,   407,   410,   413,   416,   419,   422,   425,   428,   431,
-     434,   438,   441,   444,   447,   450,   453,   456,   459,   462,
-     465,   468,   471,   474,   477,   480,   484,   487,   490,   493,
-     496,   498,   501,   504,   507,   510,   513,   516,   519,   522,
-     525,   528,   531,   534,   537,   540,   543,   545,   547,   550,
-     553,   556,   560,   564,   567,   570,   582,   594,   606,   609,
-     612,   614,   617,   620,   621,   622,   623,   625,   628,   629,
-     630,   631,   632,   633,   634,   635,   637,   638,   639,   640,
-     641,   645,   646,   647,   648,   652,   653,   654,   657,   658,
-     661,   662,   666,   667,   670,   671,   674,   675,   678,   679,
-     680,   681,   682,   683,   684,   685,   686,   687,   688,   689,
-     690,   691,   694,   697,   700,   703,   704,   705,   706,   707,
-     708,   709,   710,   711,   712,   713,   714,   715,   716,   717,
-     718,   719,   723,   724,   727,   728,   731,   732,   735,   736,
-     739,   743,   744,   745,   748,   750,   752,   754,   758,   759,
-     762,   763,   767,   769,   773,   774,   775,   776,   779,   780,
-     781,   783,   784,   785,   786,   787,   788,   792,   793,   796,
-     797,   798,   799,   800,   801,   802,   803,   804,   805,   806,
-     807,   810,   811,   812,   815,   817,   818,   819,   820,   821,
-     822,   827,   828,   831,   832,   835,   836,   839,   845,   846,
-     849,   850,   853,   854,   857,   861,   864,   865
+     434,   437,   441,   444,   447,   450,   453,   456,   459,   462,
+     465,   468,   471,   474,   477,   480,   483,   487,   490,   493,
+     496,   499,   501,   504,   507,   510,   513,   516,   519,   522,
+     525,   528,   531,   534,   537,   540,   543,   546,   548,   550,
+     553,   556,   559,   563,   567,   570,   573,   585,   597,   609,
+     612,   615,   617,   620,   623,   624,   625,   626,   628,   631,
+     632,   633,   634,   635,   636,   637,   638,   640,   641,   642,
+     643,   644,   648,   649,   650,   651,   655,   656,   657,   660,
+     661,   664,   665,   669,   670,   673,   674,   677,   678,   681,
+     682,   683,   684,   685,   686,   687,   688,   689,   690,   691,
+     692,   693,   694,   697,   700,   703,   707,   710,   711,   712,
+     713,   714,   715,   716,   717,   718,   719,   720,   721,   722,
+     723,   724,   725,   726,   730,   731,   734,   735,   738,   739,
+     742,   743,   746,   750,   751,   752,   755,   757,   759,   761,
+     765,   766,   769,   770,   774,   776,   780,   781,   782,   783,
+     786,   787,   788,   790,   791,   792,   793,   794,   795,   799,
+     800,   803,   804,   805,   806,   807,   808,   809,   810,   811,
+     812,   813,   814,   817,   818,   819,   822,   824,   825,   826,
+     827,   828,   829,   834,   835,   838,   839,   842,   843,   846,
+     852,   853,   856,   857,   860,   861,   864,   868,   871,   872
 };
 #endif
 
@@ -840,20 +842,20 @@ static const char *const grib_yytname[] =
 {
   "$end", "error", "$undefined", "LOWERCASE", "IF", "IF_TRANSIENT",
   "ELSE", "END", "CLOSE", "UNSIGNED", "TEMPLATE", "TEMPLATE_NOFAIL",
-  "TRIGGER", "ASCII", "GROUP", "NON_ALPHA", "KSEC1EXPVER", "LABEL", "LIST",
-  "IS_IN_LIST", "IS_IN_DICT", "IS_INTEGER", "TO_INTEGER", "TO_STRING",
-  "SEX2DEC", "WHILE", "IBMFLOAT", "SIGNED", "UINT8", "INT8", "UINT16",
-  "INT16", "UINT16_LITTLE_ENDIAN", "INT16_LITTLE_ENDIAN", "UINT32",
-  "INT32", "UINT32_LITTLE_ENDIAN", "INT32_LITTLE_ENDIAN", "UINT64",
-  "INT64", "UINT64_LITTLE_ENDIAN", "INT64_LITTLE_ENDIAN", "BLOB", "BYTE",
-  "CODETABLE", "SMART_TABLE", "DICTIONARY", "COMPLEX_CODETABLE", "LOOKUP",
-  "ALIAS", "UNALIAS", "META", "POS", "INTCONST", "TRANS", "FLAGBIT",
-  "CONCEPT", "GETENV", "HASH_ARRAY", "CONCEPT_NOFAIL", "NIL", "DUMMY",
-  "MODIFY", "READ_ONLY", "STRING_TYPE", "LONG_TYPE", "DOUBLE_TYPE",
-  "NO_COPY", "DUMP", "JSON", "XML", "NO_FAIL", "EDITION_SPECIFIC",
-  "OVERRIDE", "HIDDEN", "CAN_BE_MISSING", "MISSING", "CONSTRAINT",
-  "COPY_OK", "WHEN", "SET", "SET_NOFAIL", "WRITE", "APPEND", "PRINT",
-  "EXPORT", "REMOVE", "RENAME", "SKIP", "PAD", "SECTION_PADDING",
+  "INCLUDE", "TRIGGER", "ASCII", "GROUP", "NON_ALPHA", "KSEC1EXPVER",
+  "LABEL", "LIST", "IS_IN_LIST", "IS_IN_DICT", "IS_INTEGER", "TO_INTEGER",
+  "TO_STRING", "SEX2DEC", "WHILE", "IBMFLOAT", "SIGNED", "UINT8", "INT8",
+  "UINT16", "INT16", "UINT16_LITTLE_ENDIAN", "INT16_LITTLE_ENDIAN",
+  "UINT32", "INT32", "UINT32_LITTLE_ENDIAN", "INT32_LITTLE_ENDIAN",
+  "UINT64", "INT64", "UINT64_LITTLE_ENDIAN", "INT64_LITTLE_ENDIAN", "BLOB",
+  "BYTE", "CODETABLE", "SMART_TABLE", "DICTIONARY", "COMPLEX_CODETABLE",
+  "LOOKUP", "ALIAS", "UNALIAS", "META", "POS", "INTCONST", "TRANS",
+  "FLAGBIT", "CONCEPT", "GETENV", "HASH_ARRAY", "CONCEPT_NOFAIL", "NIL",
+  "DUMMY", "MODIFY", "READ_ONLY", "STRING_TYPE", "LONG_TYPE",
+  "DOUBLE_TYPE", "NO_COPY", "DUMP", "JSON", "XML", "NO_FAIL",
+  "EDITION_SPECIFIC", "OVERRIDE", "HIDDEN", "CAN_BE_MISSING", "MISSING",
+  "CONSTRAINT", "COPY_OK", "WHEN", "SET", "SET_NOFAIL", "WRITE", "APPEND",
+  "PRINT", "EXPORT", "REMOVE", "RENAME", "SKIP", "PAD", "SECTION_PADDING",
   "MESSAGE", "MESSAGE_COPY", "PADTO", "PADTOEVEN", "PADTOMULTIPLE",
   "G1_HALF_BYTE", "G1_MESSAGE_LENGTH", "G1_SECTION4_LENGTH",
   "SECTION_LENGTH", "LENGTH", "FLAG", "ITERATOR", "NEAREST", "BOX", "KSEC",
@@ -865,12 +867,13 @@ static const char *const grib_yytname[] =
   "instructions", "instruction", "semi", "argument_list", "arguments",
   "argument", "simple", "if_block", "when_block", "set", "set_list",
   "default", "flags", "flag_list", "flag", "list_block", "while_block",
-  "trigger_block", "concept_block", "concept_list", "hash_array_list",
-  "hash_array_block", "case_list", "case_value", "switch_block",
-  "concept_value", "concept_conditions", "concept_condition",
-  "hash_array_value", "string_or_ident", "atom", "power", "factor", "term",
-  "condition", "conjonction", "disjonction", "expression", "rule",
-  "rule_entry", "rule_entries", "fact", "conditional_rule", "rules", YY_NULLPTR
+  "include_block", "trigger_block", "concept_block", "concept_list",
+  "hash_array_list", "hash_array_block", "case_list", "case_value",
+  "switch_block", "concept_value", "concept_conditions",
+  "concept_condition", "hash_array_value", "string_or_ident", "atom",
+  "power", "factor", "term", "condition", "conjonction", "disjonction",
+  "expression", "rule", "rule_entry", "rule_entries", "fact",
+  "conditional_rule", "rules", YY_NULLPTR
 };
 #endif
 
@@ -879,25 +882,25 @@ static const char *const grib_yytname[] =
    (internal) symbol number NUM (which must be that of a token).  */
 static const grib_yytype_int16 grib_yytoknum[] =
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,    44,    59,    91,
-      93,    40,    41,    61,    46,   123,   125,    58,    45,    94,
-      42,    47,    37,    43
+     0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+   265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+   275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+   285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+   295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+   305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+   315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+   325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+   335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+   345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+   355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
+   365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
+   375,   376,   377,   378,   379,   380,   381,   382,    44,    59,
+    91,    93,    40,    41,    61,    46,   123,   125,    58,    45,
+    94,    42,    47,    37,    43
 };
 # endif
 
-#define YYPACT_NINF (-654)
+#define YYPACT_NINF (-656)
 
 #define grib_yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -911,97 +914,97 @@ static const grib_yytype_int16 grib_yytoknum[] =
      STATE-NUM.  */
 static const grib_yytype_int16 grib_yypact[] =
 {
-    1435,  -654,   -24,   -10,     8,    65,   -67,   115,   162,   147,
-     186,   202,   204,    64,   200,   213,    82,   245,   249,   253,
-     264,   277,   281,   282,   284,   285,   287,   288,   289,   290,
-     291,   292,   293,   295,   294,   300,   303,   296,   297,   298,
-     308,   311,   312,   315,   316,   318,   319,   320,   258,   321,
-     322,   -16,   -12,    61,   323,   847,   305,   324,   325,   327,
-     326,   328,   333,   334,   335,   337,   332,   347,   348,   349,
-     356,   357,   358,   361,   354,   355,     7,   283,   314,   -79,
-     487,  -654,  -654,  1538,   360,  -654,  -654,  -654,  -654,  -654,
-    -654,   256,   128,  -654,  -654,  -654,  -654,    18,  -654,  -654,
-    -654,  -654,   847,   847,   366,   365,   367,   369,   370,   847,
-     371,   157,   362,   372,  -654,  -654,   847,    38,   373,   374,
-     362,   362,   362,   362,   362,   362,   362,   362,   362,   362,
-     362,   362,   362,   362,   380,   375,   187,   379,   376,   386,
-     221,   381,   -47,  -654,   383,   387,   382,   193,   -94,   195,
-     377,   847,   390,   398,  -654,   394,  -654,   413,  -654,   251,
-     411,   414,   418,   419,  -654,  -654,   420,   422,   847,   423,
-    -654,  -654,  -654,   847,   109,  -654,  -654,  -654,   364,   433,
-     405,  -654,   -75,   -20,   149,   437,   441,  -654,   434,  -654,
-     431,   377,   438,   377,   435,   436,   442,  -654,   439,   443,
-     444,   449,   447,   448,   450,   847,   847,   847,   454,   235,
-     -76,   445,    66,   451,  -654,   459,     9,   468,  1766,  -654,
-    -654,   460,   462,   463,  -654,   464,   469,  -654,   461,   470,
-    -654,   473,   474,   481,   471,   485,  -654,  -654,   491,   500,
-     847,   847,  -654,   377,   377,   501,   502,   847,   509,   377,
-     503,   505,   377,   377,   377,   377,   377,   377,   377,   377,
-     377,   377,   377,   377,   377,   377,   847,   510,   512,   527,
-     847,   528,   529,   538,   543,   546,   504,   548,   847,   539,
-     847,   549,   550,   256,   553,   128,   555,   556,   256,   544,
-    -654,  -654,   535,   302,   847,   551,   552,   558,   563,   847,
-     557,   559,   575,   578,   260,   149,   568,   570,  -654,  -654,
-     847,   -84,   109,   109,   109,   109,   109,   109,    84,    84,
-      84,    84,    84,    84,    84,    84,   847,   847,   554,   847,
-    -654,   574,  -654,   847,   847,   847,   577,   579,   580,   595,
-     847,   847,   847,  -654,   573,   594,   847,   596,   597,   598,
-     599,   600,   607,   610,   606,   607,   610,   610,   847,   612,
-     377,   610,   847,    11,  -654,   601,   602,   615,   616,   847,
-     847,   611,   614,  -654,   624,   627,   617,   262,   619,  -654,
-    -654,  -654,   630,   620,   626,   362,  -654,   634,   635,  -654,
-    -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,
-    -654,  -654,  -654,   629,   637,   638,   640,   633,   643,   644,
-     377,   639,  -654,   847,   645,   377,   266,   377,   641,    41,
-     -11,   -78,   647,   -54,    87,    55,   -74,  -654,  -654,  -654,
-    -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,
-    -654,   648,  -654,   -49,  -654,   -36,  -654,  -654,   646,   652,
-     653,   654,   649,   655,   656,    94,   658,   657,   665,  -654,
-     663,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,  -654,
-    -654,   -75,   -75,   -20,   -20,   -20,   -20,   -20,   -20,   149,
-     437,   673,   667,   674,   668,   669,   670,   681,   682,   683,
-     687,   679,   680,   685,  -654,   636,   686,   847,   847,   847,
-     847,   847,  -654,   -56,   690,   677,   610,  -654,    93,   678,
-     688,   650,   362,  -654,   689,   694,   695,  1663,  1766,   108,
-     215,  1766,   362,   362,   362,   362,  1766,   362,   377,   224,
-     236,   362,   238,   847,   946,   362,  1036,   697,  -654,   696,
-     699,   698,  -654,  -654,  -654,   -52,  -654,   362,   709,   703,
-     717,   256,   377,   719,   377,   722,   706,   727,   256,   377,
-     544,   729,   730,   313,   651,  -654,   -35,   -34,  -654,  -654,
-    -654,  -654,  -654,   732,   733,   737,  -654,  -654,   739,   740,
-    -654,   726,  -654,   377,  -654,  -654,  -654,   723,   738,   362,
-     847,  -654,  -654,  -654,   762,   736,   742,   744,   745,   747,
-     748,   757,  -654,   788,  -654,  -654,  -654,  -654,  -654,   362,
-     377,  -654,   750,   752,    10,   754,   -62,   755,   756,   847,
-     377,   847,   377,   758,   377,   377,   377,   377,   760,   377,
-    -654,   847,   377,   847,   377,   377,   847,   377,   362,   847,
-     362,   377,   847,   362,   847,   377,   362,   847,   271,   377,
-     377,   766,   256,    97,   -45,  -654,   770,  -654,   774,   256,
-     104,   -27,  -654,  -654,   769,   771,   651,   -63,  -654,   775,
-    -654,   759,  -654,   773,   778,   117,   789,   791,  -654,  -654,
-     847,   847,  -654,   362,   847,   -72,  -654,  1766,   377,   377,
-     377,   362,   362,  -654,   607,   787,   377,  -654,  1766,   -62,
-     182,   866,  -654,  -654,   914,   794,  -654,   795,  -654,  -654,
-    -654,  -654,  -654,  -654,  -654,  -654,   797,  -654,   798,  -654,
-    -654,   799,  -654,   377,   800,   570,   -65,  -654,   802,   377,
-     803,  -654,   377,   805,  -654,  -654,  -654,  -654,   807,    39,
-     814,   786,   377,   808,   817,    53,   819,   806,   377,   847,
-     847,   775,   938,   651,  -654,  -654,  -654,  -654,   820,  -654,
-     821,   823,   818,   824,   377,   812,   816,  -654,  -654,   815,
-    -654,  -654,  -654,   377,   377,   100,  -654,  -654,   822,   825,
-     362,   362,   362,   362,   362,  -654,   362,   828,  -654,   362,
-    -654,   377,  -654,   362,   121,   377,   834,   256,  -654,   835,
-     145,   377,   836,   256,  -654,  -654,  -654,   829,   775,   837,
-     843,   845,  -654,  -654,  -654,  1766,  1306,  -654,  -654,  -654,
-     827,  1766,  1766,   377,   377,   377,   377,   377,   377,   856,
-     377,  -654,   377,   857,   377,  -654,   858,    57,   859,   863,
-     377,  -654,   864,   144,   313,  -654,  -654,  -654,  -654,  -654,
-     852,  -654,   853,   854,  -654,  -654,  -654,  -654,  -654,  -654,
-     860,  -654,  -654,   151,  -654,   152,   377,   861,   862,  -654,
-     159,   377,   -51,  -654,  -654,  -654,   377,   868,   377,   872,
-     377,  -654,   377,   377,   873,   377,  -654,  -654,  -654,   865,
-    -654,   867,  -654,  -654,  -654,   870,  -654,   377,   377,   377,
-    -654,  -654,  -654
+    1437,  -656,  -107,   -90,   -61,   -10,    17,    42,  -656,    99,
+      92,   127,   129,   148,    60,   163,   190,    35,   200,   219,
+     233,   240,   246,   252,   267,   277,   278,   280,   282,   289,
+     290,   293,   299,   229,   256,   300,   295,   296,   303,   304,
+     305,   307,   308,   309,   310,   311,   313,   314,   315,   316,
+     317,   318,   -55,    28,    31,   319,   947,   320,   321,   322,
+     323,   306,   325,   329,   330,   333,   334,   332,   348,   349,
+     350,   335,   336,   339,   357,   351,   354,     8,   353,   355,
+      24,   440,  -656,  -656,  1541,   359,  -656,  -656,  -656,  -656,
+    -656,  -656,  -656,   254,    71,  -656,  -656,  -656,  -656,    19,
+    -656,  -656,  -656,  -656,   947,   947,   358,   364,   365,   367,
+     368,   947,   369,    81,   360,   370,  -656,  -656,   947,   -37,
+     371,   372,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   373,   374,   116,   379,
+     375,   376,   177,   377,   -75,  -656,   381,   382,   385,   191,
+     -40,   193,   361,   947,   384,   387,  -656,   396,  -656,   399,
+    -656,   249,   401,   408,   412,   414,  -656,  -656,   415,   417,
+     947,   419,  -656,  -656,  -656,   947,   -44,  -656,  -656,  -656,
+     424,   390,   413,  -656,   -32,    20,   150,   324,   434,  -656,
+     432,  -656,   425,   361,   433,   361,   426,   431,   436,  -656,
+     438,   439,   443,   444,   448,   449,   450,   947,   947,   947,
+     451,   236,   -13,   430,    -9,   435,  -656,   455,    10,   452,
+    1749,  -656,  -656,   441,   454,   459,  -656,   460,   461,  -656,
+     457,   463,  -656,   465,   466,   467,   472,   471,  -656,  -656,
+     474,   477,   947,   947,  -656,   361,   361,   478,   479,   947,
+     481,   361,   480,   482,   361,   361,   361,   361,   361,   361,
+     361,   361,   361,   361,   361,   361,   361,   361,   947,   483,
+     487,   488,   947,   489,   490,   486,   499,   500,   493,   506,
+     947,   570,   947,   509,   510,   254,   511,    71,   512,   513,
+     254,   343,  -656,  -656,   526,   540,   947,   527,   528,   530,
+     535,   947,   515,   518,   520,   545,   258,   150,   789,   537,
+    -656,  -656,   947,   -77,   -44,   -44,   -44,   -44,   -44,   -44,
+      85,    85,    85,    85,    85,    85,    85,    85,   947,   947,
+     485,   947,  -656,   542,  -656,   947,   947,   947,   543,   544,
+     546,   549,   947,   947,   947,  -656,   548,   550,   947,   552,
+     553,   554,   559,   561,   556,   576,   572,   556,   576,   576,
+     947,   579,   361,   576,   947,    15,  -656,   568,   571,   578,
+     581,   947,   947,   592,   593,  -656,   588,   603,   594,   260,
+     598,  -656,  -656,  -656,   608,   597,   604,   360,  -656,   610,
+     612,  -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,
+    -656,  -656,  -656,  -656,  -656,   606,   614,   615,   622,   616,
+     623,   624,   361,   617,  -656,   947,   628,   361,   262,   361,
+     620,    59,    62,   -74,   626,   -79,    69,   156,   -59,  -656,
+    -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,
+    -656,  -656,  -656,   627,  -656,   -62,  -656,   -71,  -656,  -656,
+     632,   633,   634,   635,   629,   637,   639,    88,   630,   640,
+     641,  -656,   642,  -656,  -656,  -656,  -656,  -656,  -656,  -656,
+    -656,  -656,  -656,   -32,   -32,    20,    20,    20,    20,    20,
+      20,   150,   324,   646,   643,   648,   644,   645,   647,   649,
+     650,   655,   657,   651,   652,   653,  -656,   625,   659,   947,
+     947,   947,   947,   947,  -656,    26,   660,   661,   576,  -656,
+     162,   662,   664,   666,   360,  -656,   665,   670,   671,  1645,
+    1749,   220,   221,  1749,   360,   360,   360,   360,  1749,   360,
+     361,   222,   235,   360,   237,   947,  1037,   360,  1046,   674,
+    -656,   658,   675,   680,  -656,  -656,  -656,  -100,  -656,   360,
+     682,   677,   690,   254,   361,   691,   361,   694,   679,   696,
+     254,   361,   343,   697,   701,   312,   654,  -656,   -43,   -38,
+    -656,  -656,  -656,  -656,  -656,   702,   703,   700,  -656,  -656,
+     704,   705,  -656,   707,  -656,   361,  -656,  -656,  -656,   710,
+     711,   360,   947,  -656,  -656,  -656,   720,   699,   712,   715,
+     719,   721,   722,   730,  -656,   872,  -656,  -656,  -656,  -656,
+    -656,   360,   361,  -656,   723,   724,    11,   727,   -65,   729,
+     731,   947,   361,   947,   361,   732,   361,   361,   361,   361,
+     733,   361,  -656,   947,   361,   947,   361,   361,   947,   361,
+     360,   947,   360,   361,   947,   360,   947,   361,   360,   947,
+     269,   361,   361,   739,   254,    90,   -23,  -656,   743,  -656,
+     744,   254,   104,    25,  -656,  -656,   740,   742,   654,   -48,
+    -656,   749,  -656,   708,  -656,   725,   746,   110,   745,   753,
+    -656,  -656,   947,   947,  -656,   360,   947,   -68,  -656,  1749,
+     361,   361,   361,   360,   360,  -656,   556,   755,   361,  -656,
+    1749,   -65,   183,   876,  -656,  -656,   879,   756,  -656,   758,
+    -656,  -656,  -656,  -656,  -656,  -656,  -656,  -656,   764,  -656,
+     765,  -656,  -656,   767,  -656,   361,   766,   537,   -66,  -656,
+     770,   361,   771,  -656,   361,   772,  -656,  -656,  -656,  -656,
+     782,    64,   784,   774,   361,   783,   788,   102,   792,   787,
+     361,   947,   947,   749,   912,   654,  -656,  -656,  -656,  -656,
+     793,  -656,   794,   800,   796,   797,   361,   798,   799,  -656,
+    -656,   790,  -656,  -656,  -656,   361,   361,   204,  -656,  -656,
+     795,   803,   360,   360,   360,   360,   360,  -656,   360,   808,
+    -656,   360,  -656,   361,  -656,   360,   121,   361,   804,   254,
+    -656,   814,   122,   361,   815,   254,  -656,  -656,  -656,   809,
+     749,   813,   816,   817,  -656,  -656,  -656,  1749,  1307,  -656,
+    -656,  -656,   818,  1749,  1749,   361,   361,   361,   361,   361,
+     361,   824,   361,  -656,   361,   827,   361,  -656,   828,   109,
+     829,   831,   361,  -656,   832,   145,   312,  -656,  -656,  -656,
+    -656,  -656,   820,  -656,   821,   822,  -656,  -656,  -656,  -656,
+    -656,  -656,   830,  -656,  -656,   146,  -656,   152,   361,   833,
+     837,  -656,   153,   361,   -46,  -656,  -656,  -656,   361,   838,
+     361,   840,   361,  -656,   361,   361,   841,   361,  -656,  -656,
+    -656,   839,  -656,   842,  -656,  -656,  -656,   844,  -656,   361,
+     361,   361,  -656,  -656,  -656
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1009,117 +1012,119 @@ static const grib_yytype_int16 grib_yypact[] =
      means the default is an error.  */
 static const grib_yytype_int16 grib_yydefact[] =
 {
-       0,     7,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     7,     0,     0,     0,     0,     0,     0,   175,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   129,   133,   140,     0,     8,     0,     0,     0,     0,
+       0,     0,   130,   134,   141,     0,     8,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     2,     5,    17,     0,    22,    28,    23,    24,    25,
-      26,     3,     4,    27,    29,   192,   194,   266,   264,   258,
-     259,     6,     0,     0,     0,     0,     0,     0,     0,     8,
-       0,     8,     8,     0,    68,    69,     0,     8,     0,     0,
-       8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-       8,     8,     8,     8,     0,     0,     0,     0,     0,     0,
-       0,   110,     0,    88,     0,     0,     0,     0,     0,     0,
-       8,     0,     0,     0,   128,     0,   132,     0,   137,     0,
-       0,     0,     0,     0,   221,   222,     0,     0,     0,   215,
-     217,   219,   220,     0,     0,    32,   119,    33,    34,   218,
-     228,   234,   243,   252,   254,   256,   257,    36,     0,   261,
-       0,     8,     0,     8,     0,     0,     0,    95,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     8,     0,     0,
-       0,     0,     8,     0,     1,     0,     0,     0,    20,    18,
-      21,     0,     0,     0,   193,     0,     0,   195,     0,     0,
-     267,     0,     0,     0,     0,     0,   107,   108,     0,     0,
-       8,     8,   152,     8,     8,     0,     0,     0,     0,     8,
+       0,     0,     2,     5,    17,     0,    22,    28,    23,    24,
+      30,    25,    26,     3,     4,    27,    29,   194,   196,   268,
+     266,   260,   261,     6,     0,     0,     0,     0,     0,     0,
+       0,     8,     0,     8,     8,     0,    69,    70,     0,     8,
        0,     0,     8,     8,     8,     8,     8,     8,     8,     8,
-       8,     8,     8,     8,     8,     8,     8,     0,     0,     0,
-       8,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       8,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     154,   122,     0,     0,     0,     0,     0,     0,     0,     8,
-       0,     0,     0,     0,     0,   251,     0,     0,   218,   224,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       8,     8,     8,     8,     8,     8,     0,     0,     0,     0,
+       0,     0,     0,   111,     0,    89,     0,     0,     0,     0,
+       0,     0,     8,     0,     0,     0,   129,     0,   133,     0,
+     138,     0,     0,     0,     0,     0,   223,   224,     0,     0,
+       0,   217,   219,   221,   222,     0,     0,    33,   120,    34,
+      35,   220,   230,   236,   245,   254,   256,   258,   259,    37,
+       0,   263,     0,     8,     0,     8,     0,     0,     0,    96,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     8,
-     106,     0,   105,     8,     8,     8,     0,     0,     0,     0,
-       8,     8,     8,    99,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     8,     0,     1,     0,     0,     0,
+      20,    18,    21,     0,     0,     0,   195,     0,     0,   197,
+       0,     0,   269,     0,     0,     0,     0,     0,   108,   109,
+       0,     0,     8,     8,   153,     8,     8,     0,     0,     0,
+       0,     8,     0,     0,     8,     8,     8,     8,     8,     8,
+       8,     8,     8,     8,     8,     8,     8,     8,     8,     0,
+       0,     0,     8,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     8,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   155,   123,     0,     0,     0,     0,     0,     0,
+       0,     8,     0,     0,     0,     0,     0,   253,     0,     0,
+     220,   226,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       8,     0,     0,     0,    19,     0,     0,     0,     0,     0,
-       0,     0,     0,   136,     0,     0,     0,     0,     0,   153,
-      42,    47,     0,     0,     0,     8,    70,     0,     0,    72,
-      71,    74,    73,    76,    75,    78,    77,    80,    79,    82,
-      81,    84,    83,     0,     0,     0,     0,     0,     0,     0,
-       8,     0,   112,     8,     0,     8,     0,     8,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   159,   168,   158,
-     169,   170,   171,   161,   160,   162,   164,   163,   165,   166,
-     167,   155,   156,     0,   123,     0,   124,   127,   131,   135,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   225,
-       0,   223,    35,   215,   250,   227,   232,   233,   229,   230,
-     231,   242,   241,   245,   249,   247,   248,   246,   244,   253,
-     255,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   121,     0,     0,     8,     8,     8,
-       8,     8,    15,     0,     0,     0,   208,   260,     0,     0,
-       0,     0,     8,    92,     0,     0,     0,     0,     0,     8,
-       8,     0,     8,     8,     8,     8,     0,     8,     8,     8,
-       8,     8,     8,     0,     0,     8,     0,     0,   109,     0,
-       0,     0,    89,    11,     9,     0,    90,     8,     0,     0,
-       0,     0,     8,     0,     8,     0,     0,     0,     0,     8,
-       0,     0,     0,     0,     0,    13,     0,     0,   130,   134,
-     139,   138,   118,     0,     0,     0,   240,   235,     0,     0,
-     226,     0,   100,     8,   101,   102,   103,     0,     0,     8,
-       0,   115,   116,   117,     0,     0,     0,     0,     0,     0,
-       0,     0,   213,     0,   205,   209,   212,   204,   206,     8,
-       8,   207,     0,     0,     0,     0,   262,     0,     0,     8,
-       8,     8,     8,     0,     8,     8,     8,     8,     0,     8,
-      86,     8,     8,     8,     8,     8,     8,     8,     8,     8,
-       8,     8,     8,     8,     8,     8,     8,     8,     0,     8,
-       8,     0,     0,     0,     0,   175,     0,   196,     0,     0,
-       0,     0,   184,   157,     0,     0,     0,     0,    30,   145,
-     125,     0,   126,     0,     0,     0,     0,     0,   120,   104,
-       8,     8,    96,     8,     0,     0,   198,     0,     8,     8,
-       8,     8,     8,    16,     0,     0,     8,    93,     0,     0,
-       0,   141,   263,   265,   143,     0,    37,     0,    39,   174,
-      41,    48,    43,    51,   173,    87,     0,    52,     0,    54,
-      85,     0,    49,     8,     0,    36,     8,    60,     0,     8,
-       0,   111,     8,     0,    12,    10,    91,    67,     0,     0,
-       0,     0,     8,     0,     0,     0,     0,     0,     8,     0,
-       0,   150,   146,     0,    31,    14,   236,   237,     0,   238,
-       0,     0,     0,     0,     8,     0,     0,   203,   199,     0,
-      44,    46,    45,     8,     8,     0,   210,    94,     0,     0,
-       8,     8,     8,     8,     8,    57,     8,     0,    56,     8,
-      63,     8,   113,     8,     0,     8,     0,     0,   182,     0,
-       0,     8,     0,     0,   190,   148,   149,     0,   151,     0,
-       0,     0,    97,    98,    65,     0,     0,   172,    61,    62,
-       0,     0,     0,     8,     8,     8,     8,     8,     8,     0,
-       8,    66,     8,     0,     8,   176,     0,     0,     0,     0,
-       8,   185,     0,     0,     0,   239,   214,   216,   200,   202,
-       0,   211,     0,     0,    38,    40,    53,    55,    50,    59,
-       0,    64,   114,     0,   179,     0,     8,     0,     0,   187,
-       0,     8,     0,   201,   142,   144,     8,     0,     8,     0,
-       8,   183,     8,     8,     0,     8,   191,   147,    58,     0,
-     177,     0,   181,   197,   186,     0,   189,     8,     8,     8,
-     178,   180,   188
+       0,     8,   107,     0,   106,     8,     8,     8,     0,     0,
+       0,     0,     8,     8,     8,   100,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     8,     0,     0,     0,    19,     0,     0,     0,
+       0,     0,     0,     0,     0,   137,     0,     0,     0,     0,
+       0,   154,    43,    48,     0,     0,     0,     8,    71,     0,
+       0,    73,    72,    75,    74,    77,    76,    79,    78,    81,
+      80,    83,    82,    85,    84,     0,     0,     0,     0,     0,
+       0,     0,     8,     0,   113,     8,     0,     8,     0,     8,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   160,
+     169,   159,   170,   171,   172,   162,   161,   163,   165,   164,
+     166,   167,   168,   156,   157,     0,   124,     0,   125,   128,
+     132,   136,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   227,     0,   225,    36,   217,   252,   229,   234,   235,
+     231,   232,   233,   244,   243,   247,   251,   249,   250,   248,
+     246,   255,   257,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,     0,     0,     8,
+       8,     8,     8,     8,    15,     0,     0,     0,   210,   262,
+       0,     0,     0,     0,     8,    93,     0,     0,     0,     0,
+       0,     8,     8,     0,     8,     8,     8,     8,     0,     8,
+       8,     8,     8,     8,     8,     0,     0,     8,     0,     0,
+     110,     0,     0,     0,    90,    11,     9,     0,    91,     8,
+       0,     0,     0,     0,     8,     0,     8,     0,     0,     0,
+       0,     8,     0,     0,     0,     0,     0,    13,     0,     0,
+     131,   135,   140,   139,   119,     0,     0,     0,   242,   237,
+       0,     0,   228,     0,   101,     8,   102,   103,   104,     0,
+       0,     8,     0,   116,   117,   118,     0,     0,     0,     0,
+       0,     0,     0,     0,   215,     0,   207,   211,   214,   206,
+     208,     8,     8,   209,     0,     0,     0,     0,   264,     0,
+       0,     8,     8,     8,     8,     0,     8,     8,     8,     8,
+       0,     8,    87,     8,     8,     8,     8,     8,     8,     8,
+       8,     8,     8,     8,     8,     8,     8,     8,     8,     8,
+       0,     8,     8,     0,     0,     0,     0,   177,     0,   198,
+       0,     0,     0,     0,   186,   158,     0,     0,     0,     0,
+      31,   146,   126,     0,   127,     0,     0,     0,     0,     0,
+     121,   105,     8,     8,    97,     8,     0,     0,   200,     0,
+       8,     8,     8,     8,     8,    16,     0,     0,     8,    94,
+       0,     0,     0,   142,   265,   267,   144,     0,    38,     0,
+      40,   176,    42,    49,    44,    52,   174,    88,     0,    53,
+       0,    55,    86,     0,    50,     8,     0,    37,     8,    61,
+       0,     8,     0,   112,     8,     0,    12,    10,    92,    68,
+       0,     0,     0,     0,     8,     0,     0,     0,     0,     0,
+       8,     0,     0,   151,   147,     0,    32,    14,   238,   239,
+       0,   240,     0,     0,     0,     0,     8,     0,     0,   205,
+     201,     0,    45,    47,    46,     8,     8,     0,   212,    95,
+       0,     0,     8,     8,     8,     8,     8,    58,     8,     0,
+      57,     8,    64,     8,   114,     8,     0,     8,     0,     0,
+     184,     0,     0,     8,     0,     0,   192,   149,   150,     0,
+     152,     0,     0,     0,    98,    99,    66,     0,     0,   173,
+      62,    63,     0,     0,     0,     8,     8,     8,     8,     8,
+       8,     0,     8,    67,     8,     0,     8,   178,     0,     0,
+       0,     0,     8,   187,     0,     0,     0,   241,   216,   218,
+     202,   204,     0,   213,     0,     0,    39,    41,    54,    56,
+      51,    60,     0,    65,   115,     0,   181,     0,     8,     0,
+       0,   189,     0,     8,     0,   203,   143,   145,     8,     0,
+       8,     0,     8,   185,     8,     8,     0,     8,   193,   148,
+      59,     0,   179,     0,   183,   199,   188,     0,   191,     8,
+       8,     8,   180,   182,   190
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const grib_yytype_int16 grib_yypgoto[] =
 {
-    -654,  -654,     5,   564,  -654,  -351,     0,  -654,  -653,   242,
-    -307,  -184,  -654,  -654,  -654,  -442,   154,   591,   210,  -654,
-     440,  -654,  -654,  -654,  -654,  -264,   718,  -654,  -654,   329,
-    -654,   -89,  -345,  -654,   -82,  -165,   830,   -15,    80,    -6,
-    -160,   691,  -654,   -96,  -654,    14,   392,  -654,  -654,   913
+    -656,  -656,     5,    -2,  -656,  -351,     0,  -656,  -655,   242,
+    -309,  -205,  -656,  -656,  -656,  -444,   115,   591,   210,  -656,
+     409,  -656,  -656,  -656,  -656,  -656,  -264,   687,  -656,  -656,
+     292,  -656,   -89,  -347,  -656,   -87,  -144,   805,   -15,    79,
+      -6,  -160,   663,  -656,   -96,  -656,    14,   366,  -656,  -656,
+     883
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const grib_yytype_int16 grib_yydefgoto[] =
 {
-      -1,    80,   290,   545,   567,   503,   615,    83,   669,   176,
-     177,   178,    84,    85,    86,   666,   667,   243,   291,   441,
-     442,    87,    88,    89,    90,    91,    92,    93,   685,   686,
-      94,    95,   505,   506,    96,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,    97,   616,   617,    99,   100,   101
+    -1,    81,   292,   547,   569,   505,   617,    84,   671,   178,
+   179,   180,    85,    86,    87,   668,   669,   245,   293,   443,
+   444,    88,    89,    90,    91,    92,    93,    94,    95,   687,
+   688,    96,    97,   507,   508,    98,   181,   182,   183,   184,
+   185,   186,   187,   188,   189,    99,   618,   619,   101,   102,
+   103
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1127,390 +1132,386 @@ static const grib_yytype_int16 grib_yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const grib_yytype_int16 grib_yytable[] =
 {
-      82,   564,   224,   462,   508,    81,   231,   232,   305,   308,
-     227,   509,   510,   751,    98,   787,   514,   561,   562,   421,
-     246,   343,   228,   167,   426,   208,    57,   208,   208,   561,
-     562,   561,   562,   347,   348,   349,   684,   284,   766,   463,
-     170,   285,   313,   314,   212,   221,   222,    78,   223,   221,
-     222,    78,   223,   355,   213,   292,   107,   350,   552,   356,
-     175,   229,   559,   384,   767,   315,   316,   317,   351,   225,
-     226,   601,   289,   752,   602,   648,   276,   307,   221,   222,
-      78,   223,   554,   219,   649,   887,   563,   277,   565,   543,
-     544,   742,   648,   671,   415,   417,   221,   222,    78,   223,
-     808,   670,   672,   161,   162,   163,    57,   102,   154,   748,
-     344,    98,   156,   354,   175,   155,   242,   242,   318,   157,
-     550,   103,   242,   319,   551,   242,   242,   242,   242,   242,
-     242,   242,   242,   242,   242,   242,   242,   242,   242,   104,
-     209,   229,   363,   700,   164,   165,   464,   308,   308,   308,
-     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
-     308,   605,   221,   222,    78,   223,   479,   247,   548,   164,
-     165,   241,   248,   549,   511,   795,   221,   222,    78,   223,
-     221,   222,    78,   223,   166,   158,   557,   114,   115,   801,
-     558,   167,   159,   866,   105,   358,   106,   446,   447,   241,
-     359,   161,   162,   163,   347,   348,   349,   169,   170,   171,
-     172,   118,   175,   119,   555,   173,   167,   242,   364,   556,
-     601,   575,   174,   606,   740,   753,   576,   601,   350,   741,
-     820,   746,   169,   170,   171,   172,   747,   619,   108,   351,
-     173,   241,   164,   165,   758,   175,   175,   174,   833,   759,
-     496,   225,   226,   834,   161,   162,   163,   347,   348,   349,
-     320,   321,   322,   323,   324,   325,   515,   221,   222,    78,
-     223,   175,   839,   516,   354,   175,   110,   840,   877,   879,
-     871,   350,   166,   878,   880,   175,   884,   654,   240,   167,
-     241,   885,   351,   109,   661,   164,   165,   465,   466,   467,
-     468,   469,   470,   168,   175,   169,   170,   171,   172,   111,
-     268,   175,   269,   173,   473,   474,   475,   476,   477,   478,
-     174,   161,   162,   163,   281,   112,   286,   282,   283,   287,
-     288,   116,   224,   113,   175,   166,   117,   224,   175,   175,
-     175,   227,   167,   775,   621,   175,   175,   175,   241,   638,
-     640,   238,   643,   631,   273,   274,   168,   241,   169,   170,
-     171,   172,   164,   165,   352,   633,   173,   636,   120,   241,
-     353,   241,   121,   174,   297,   298,   122,   765,   444,   221,
-     222,    78,   223,   457,   458,   522,   523,   123,   739,   151,
-     242,   543,   544,   561,   562,   745,   734,   735,   471,   472,
-     124,   330,   166,   332,   125,   126,   683,   127,   128,   167,
-     129,   130,   131,   132,   133,   134,   210,   137,   175,   140,
-     141,   142,   135,   168,   136,   169,   170,   171,   172,   138,
-     753,   143,   139,   173,   144,   145,   188,   445,   146,   147,
-     174,   148,   149,   150,   152,   153,   160,   211,   190,   345,
-     191,   193,   189,   380,   381,   192,   194,   195,   196,   386,
-     197,   198,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,   401,   402,   199,   200,   201,   202,
-     203,   204,   378,   379,   205,   206,   207,   214,   220,   233,
-     234,   310,   235,   236,   237,   241,   239,   245,   250,   251,
-     267,   271,   175,   175,   175,   175,   175,   695,   403,   266,
-     270,   272,   407,   280,   289,   275,   278,   242,   618,   295,
-     279,   623,   418,   293,   242,   242,   628,   242,   242,   242,
-     242,   294,   242,   837,   242,   242,   242,   242,   296,   843,
-     242,   452,   299,   725,   312,   300,   725,   427,   460,   301,
-     302,   303,   242,   304,   306,   311,   326,   328,   161,   162,
-     163,   327,   329,   331,   336,   224,   333,   334,   337,   338,
-     513,   482,   224,   335,   339,   484,   485,   486,   340,   341,
-     357,   342,   491,   492,   493,   346,   361,   161,   162,   163,
-     362,   212,   369,   365,   242,   366,   213,   367,   428,   164,
-     165,   374,   368,   370,   354,   371,   372,   429,   430,   431,
-     432,   433,   434,   373,   242,   435,   436,   375,   437,   438,
-     538,   439,   440,   376,   175,   542,   175,   546,   164,   165,
-     377,   382,   385,   387,   383,   413,   175,   388,   175,   166,
-     404,   175,   405,   242,   175,   242,   167,   175,   242,   175,
-     224,   242,   175,   805,   806,   540,   224,   406,   408,   409,
-     168,   410,   169,   170,   171,   172,   411,   443,   166,   412,
-     173,   414,   419,   420,   416,   167,   422,   174,   424,   425,
-     453,   481,   454,   448,   449,   175,   175,   769,   242,   168,
-     450,   169,   170,   171,   172,   451,   242,   242,   455,   173,
-     459,   456,   461,   244,   483,   494,   174,   487,   249,   488,
-     489,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   490,   495,   497,   498,   499,
-     500,   501,   502,   504,   507,   512,   353,   356,   630,   596,
-     597,   598,   599,   600,   352,   355,   517,   519,   224,   518,
-     520,   524,   521,   525,   224,   526,   527,   529,   530,   531,
-     532,   533,   655,   534,   657,   535,   536,   537,   541,   662,
-     568,   594,   539,   547,   553,   560,   569,   570,   571,   668,
-     609,   572,   573,   574,   578,   242,   242,   242,   242,   242,
-     577,   242,   579,   679,   242,   580,   581,   583,   242,   582,
-     584,   585,   586,   360,   587,   588,   589,   161,   162,   163,
-     590,   591,   592,   604,   607,   848,   850,   593,   595,   645,
-     697,   852,   853,   603,   608,   611,   612,   613,   644,   647,
-     706,   646,   708,   651,   710,   711,   712,   713,   652,   715,
-     653,   659,   717,   656,   719,   720,   658,   722,   164,   165,
-     660,   727,   664,   665,   680,   731,   673,   674,   678,   736,
-     737,   705,   675,   707,   676,   677,   161,   162,   163,   681,
-     684,   687,   778,   716,   688,   718,   689,   690,   721,   691,
-     692,   724,   693,   755,   728,   698,   730,   699,   166,   733,
-     701,   703,   704,   738,   709,   167,   714,   743,   770,   771,
-     772,   744,   749,   754,   750,   756,   777,   164,   165,   168,
-     757,   169,   170,   171,   172,   776,   760,   694,   761,   173,
-     779,   797,   762,   763,   780,   781,   174,   782,   783,   784,
-     794,   799,   786,   785,   789,   791,   788,   793,   796,   790,
-     800,   803,   792,   802,   807,   809,   810,   166,   811,   815,
-     812,   817,   798,   816,   167,   851,   813,   821,   804,   829,
-     822,   836,   838,   842,   844,   161,   162,   163,   168,   845,
-     169,   170,   171,   172,   814,   846,   528,   847,   173,   860,
-     863,   865,   867,   818,   819,   174,   868,   870,   873,   874,
-     875,   889,   876,   882,   883,   891,   895,   897,   872,   898,
-     663,   831,   899,   423,   309,   835,   164,   165,   702,   566,
-     230,   841,     0,     0,   768,     0,     0,     0,   480,     0,
+      83,   566,   345,   464,   226,    82,   510,   229,   233,   234,
+     307,   511,   512,   753,   100,   789,   516,   166,   167,   563,
+     564,   423,   248,   230,    58,   104,   428,   210,   650,   210,
+     210,   169,   310,   563,   564,   563,   564,   651,   349,   350,
+     351,   686,   105,   768,   386,   227,   228,   465,   172,   278,
+     223,   224,    79,   225,   567,   545,   546,   294,   556,   231,
+     279,   177,   352,   554,   169,   223,   224,    79,   225,   769,
+     156,   106,   291,   353,   565,   417,   419,   157,   561,   309,
+     171,   172,   173,   174,   221,   650,   315,   316,   175,   754,
+     673,   889,   286,   249,   672,   176,   287,   243,   250,   674,
+     810,   223,   224,    79,   225,   163,   164,   165,    58,   317,
+     318,   319,   346,   100,   744,   356,   177,   357,   244,   244,
+     107,   360,   108,   358,   244,   243,   361,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   109,   211,   231,   365,   702,   166,   167,   214,   223,
+     224,    79,   225,   158,   603,   513,   160,   604,   215,   320,
+     159,   607,   750,   161,   321,   120,   110,   121,   481,   466,
+     310,   310,   310,   310,   310,   310,   310,   310,   310,   310,
+     310,   310,   310,   310,   116,   117,   168,   550,   223,   224,
+      79,   225,   551,   169,   552,   227,   228,   557,   553,   448,
+     449,   797,   558,   163,   164,   165,   349,   350,   351,   171,
+     172,   173,   174,   242,   177,   243,   577,   175,   742,   244,
+     366,   578,   112,   743,   176,   755,   223,   224,    79,   225,
+     352,   111,   748,   223,   224,    79,   225,   749,   760,   803,
+     270,   353,   271,   761,   166,   167,   868,   177,   177,   835,
+     841,   113,   498,   114,   836,   842,   163,   164,   165,   349,
+     350,   351,   322,   323,   324,   325,   326,   327,   517,   223,
+     224,    79,   225,   177,   879,   518,   356,   177,   115,   880,
+     881,   886,   873,   352,   168,   882,   887,   177,   559,   656,
+     603,   169,   560,   608,   353,   118,   663,   166,   167,   467,
+     468,   469,   470,   471,   472,   170,   177,   171,   172,   173,
+     174,   275,   276,   177,   119,   175,   475,   476,   477,   478,
+     479,   480,   176,   283,   122,   288,   284,   285,   289,   290,
+     640,   642,   603,   645,   226,   822,   177,   168,   229,   226,
+     177,   177,   177,   123,   169,   777,   429,   177,   177,   177,
+     621,   623,   633,   240,   243,   243,   243,   124,   170,   137,
+     171,   172,   173,   174,   125,   635,   354,   638,   175,   243,
+     126,   243,   355,   299,   300,   176,   127,   767,   223,   224,
+      79,   225,   459,   460,   524,   525,   138,   685,   545,   546,
+     741,   128,   244,   563,   564,   736,   737,   747,   430,   473,
+     474,   129,   130,   332,   131,   334,   132,   431,   432,   433,
+     434,   435,   436,   133,   134,   437,   438,   135,   439,   440,
+     177,   441,   442,   136,   139,   140,   141,   142,   143,   144,
+     755,   145,   146,   147,   148,   149,   194,   150,   151,   152,
+     216,   154,   155,   162,   328,   568,   192,   193,   153,   195,
+     191,   347,   190,   196,   197,   382,   383,   198,   199,   204,
+     205,   388,   200,   206,   391,   392,   393,   394,   395,   396,
+     397,   398,   399,   400,   401,   402,   403,   404,   201,   202,
+     203,   207,   235,   208,   380,   381,   209,   212,   222,   213,
+     236,   237,   238,   239,   243,   241,   247,   252,   253,   291,
+     269,   273,   274,   268,   177,   177,   177,   177,   177,   697,
+     405,   272,   277,   313,   409,   280,   281,   282,   295,   244,
+     620,   296,   297,   625,   420,   298,   244,   244,   630,   244,
+     244,   244,   244,   301,   244,   839,   244,   244,   244,   244,
+     302,   845,   244,   454,   303,   727,   304,   305,   727,   306,
+     462,   308,   312,   314,   244,   329,   330,   331,   335,   333,
+     163,   164,   165,   336,   338,   339,   359,   226,   337,   340,
+     341,   363,   515,   484,   226,   367,   214,   486,   487,   488,
+     342,   343,   344,   348,   493,   494,   495,   364,   368,   371,
+     163,   164,   165,   215,   369,   370,   244,   372,   373,   374,
+     375,   166,   167,   376,   377,   387,   356,   378,   379,   384,
+     412,   389,   385,   483,   406,   390,   244,   446,   407,   408,
+     410,   411,   540,   413,   414,   415,   177,   544,   177,   548,
+     416,   166,   167,   421,   422,   424,   426,   427,   177,   455,
+     177,   168,   456,   177,   457,   244,   177,   244,   169,   177,
+     244,   177,   226,   244,   177,   807,   808,   542,   226,   445,
+     450,   451,   170,   452,   171,   172,   173,   174,   453,   458,
+     463,   168,   175,   485,   489,   490,   447,   491,   169,   176,
+     492,   496,   504,   497,   499,   500,   501,   177,   177,   771,
+     244,   502,   170,   503,   171,   172,   173,   174,   244,   244,
+     506,   509,   175,   514,   355,   246,   418,   358,   354,   176,
+     251,   357,   521,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   522,   519,   520,
+     523,   526,   527,   528,   531,   529,   532,   533,   534,   535,
+     632,   598,   599,   600,   601,   602,   536,   538,   539,   537,
+     226,   541,   543,   549,   555,   562,   226,   570,   571,   572,
+     573,   596,   574,   579,   657,   575,   659,   576,   580,   581,
+     583,   664,   585,   589,   590,   582,   584,   586,   587,   591,
+     588,   592,   647,   670,   593,   594,   595,   244,   244,   244,
+     244,   244,   597,   244,   605,   681,   244,   611,   606,   609,
+     244,   610,   613,   614,   615,   362,   646,   653,   648,   163,
+     164,   165,   649,   654,   655,   661,   658,   850,   852,   660,
+     662,   666,   699,   854,   855,   667,   677,   675,   676,   686,
+     678,   679,   708,   757,   710,   689,   712,   713,   714,   715,
+     680,   717,   682,   683,   719,   690,   721,   722,   691,   724,
+     166,   167,   692,   729,   693,   694,   695,   733,   758,   700,
+     701,   738,   739,   707,   703,   709,   705,   740,   706,   711,
+     716,   745,   746,   762,   751,   718,   752,   720,   756,   759,
+     723,   763,   780,   726,   778,   781,   730,   782,   732,   783,
+     168,   735,   163,   164,   165,   784,   785,   169,   786,   788,
+     772,   773,   774,   791,   793,   795,   796,   801,   779,   798,
+     799,   170,   802,   171,   172,   173,   174,   804,   809,   811,
+     812,   175,   461,   805,   764,   765,   813,   819,   176,   814,
+     815,   823,   838,   166,   167,   787,   817,   818,   790,   824,
+     831,   792,   840,   844,   794,   846,   847,   853,   862,   848,
+     849,   865,   867,   869,   800,   870,   872,   875,   876,   877,
+     806,   874,   891,   878,   893,   897,   884,   163,   164,   165,
+     885,   665,   899,   168,   425,   900,   816,   901,   530,   770,
+     169,   311,   232,     0,   704,   820,   821,     0,     0,     0,
+       0,     0,   482,     0,   170,     0,   171,   172,   173,   174,
+       0,     0,   696,   833,   175,     0,     0,   837,   166,   167,
+       0,   176,     0,   843,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   854,   855,   856,   857,   858,   859,     0,
-     861,     0,   862,     0,   864,     0,   166,     0,     0,     0,
-     869,     0,     0,   167,     0,   161,   162,   163,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   168,     0,   169,
-     170,   171,   172,     0,     0,     0,   881,   639,     0,     0,
-       0,   886,     0,     0,   174,     0,   888,     0,   890,     0,
-     892,     0,   893,   894,     0,   896,   164,   165,     0,     0,
-       0,     0,     0,   610,     0,     0,     0,   900,   901,   902,
-     620,   622,     0,   624,   625,   626,   627,     0,   629,     0,
-     632,   634,   635,   637,     0,     0,   641,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   166,     0,   650,     0,
-       0,     0,     0,   167,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   168,     0,   169,
-     170,   171,   172,     0,     0,     0,     0,   642,     0,     0,
-       0,     0,     0,     0,   174,     0,     0,     0,     0,     0,
-     682,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   856,   857,   858,   859,   860,
+     861,     0,   863,     0,   864,     0,   866,     0,   168,     0,
+       0,     0,   871,     0,     0,   169,     0,   163,   164,   165,
+       0,     0,     0,     0,     0,     0,   163,   164,   165,   170,
+       0,   171,   172,   173,   174,     0,     0,     0,   883,   175,
+       0,     0,     0,   888,     0,     0,   176,     0,   890,     0,
+     892,     0,   894,     0,   895,   896,     0,   898,   166,   167,
+       0,     0,     0,     0,     0,   612,     0,   166,   167,   902,
+     903,   904,   622,   624,     0,   626,   627,   628,   629,     0,
+     631,     0,   634,   636,   637,   639,     0,     0,   643,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   168,     0,
+     652,     0,     0,     0,     0,   169,     0,   168,     0,     0,
+       0,     0,     0,     0,   169,     0,     0,     0,     0,   170,
+       0,   171,   172,   173,   174,     0,     0,     0,   170,   641,
+     171,   172,   173,   174,     0,     0,   176,     0,   644,     0,
+       0,     0,   684,     0,     0,   176,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     696,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   698,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   723,
-       0,   726,     0,     0,   729,     0,     0,   732,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   725,     0,   728,     0,     0,   731,     0,     0,   734,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   764,     0,     0,     0,     0,     0,
-       0,     0,   773,   774,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   766,     0,     0,     0,
+       0,     0,     0,     0,   775,   776,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     215,     3,     0,     0,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,     0,     0,     0,     0,     0,     0,
-       0,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,     0,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,     0,    45,    46,     0,     0,    47,     0,
-       0,   823,   824,   825,   826,   827,     0,   828,     0,     0,
-     830,     0,     0,     0,   832,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,     0,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,     0,    69,    70,    71,
-      72,    73,    74,     0,     0,    75,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   216,
-       0,     0,   217,     0,     0,    -8,     1,     0,     0,     2,
-       3,     0,   849,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,     0,     0,     0,     0,     0,     0,     0,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,     0,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,     0,    45,    46,     0,     0,    47,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    67,    68,     0,    69,    70,    71,    72,
-      73,    74,   215,     3,    75,     0,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,     0,     0,    76,    77,
-      78,    79,     0,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,     0,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,     0,    45,    46,     0,     0,
-      47,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,     0,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    67,    68,     0,    69,
-      70,    71,    72,    73,    74,     0,     0,    75,     0,     0,
+       0,   217,     3,     0,     0,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,     0,     0,     0,     0,
+       0,     0,     0,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,     0,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,     0,    46,    47,     0,     0,
+      48,     0,     0,   825,   826,   827,   828,   829,     0,   830,
+       0,     0,   832,     0,     0,     0,   834,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,     0,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,     0,    70,
+      71,    72,    73,    74,    75,     0,     0,    76,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   216,     0,     0,   217,     0,   218,   215,     3,     0,
-       0,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,     0,     0,     0,     0,     0,     0,     0,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,     0,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-       0,    45,    46,     0,     0,    47,     0,     0,     0,     0,
+       0,   218,     0,     0,   219,     0,     0,    -8,     1,     0,
+       0,     2,     3,     0,   851,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,     0,     0,     0,     0,
+       0,     0,     0,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,     0,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,     0,    46,    47,     0,     0,
+      48,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,     0,    70,
+      71,    72,    73,    74,    75,   217,     3,    76,     0,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+       0,    77,    78,    79,    80,     0,     0,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,     0,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,     0,
+      46,    47,     0,     0,    48,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,     0,    69,    70,    71,    72,    73,    74,
-     215,     3,    75,     0,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,     0,     0,   614,     0,     0,   217,
-       0,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,     0,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,     0,    45,    46,     0,     0,    47,     0,
+       0,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+       0,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,     0,    70,    71,    72,    73,    74,    75,   217,
+       3,    76,     0,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,     0,   218,     0,     0,   219,     0,
+     220,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,     0,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,     0,    46,    47,     0,     0,    48,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,     0,    70,    71,    72,
+      73,    74,    75,   217,     3,    76,     0,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,     0,   616,
+       0,     0,   219,     0,     0,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,     0,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,     0,    46,    47,
+       0,     0,    48,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,     0,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+       0,    70,    71,    72,    73,    74,    75,     0,     0,    76,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,     0,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,     0,    69,    70,    71,
-      72,    73,    74,     0,     0,    75,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   216,
-       0,     0,   217
+       0,     0,     0,   218,     0,     0,   219
 };
 
 static const grib_yytype_int16 grib_yycheck[] =
 {
-       0,   443,    91,   310,   355,     0,   102,   103,   168,   174,
-      92,   356,   357,   666,     0,    80,   361,    80,    81,   283,
-     116,   205,     4,   107,   288,    18,    88,    18,    18,    80,
-      81,    80,    81,    22,    23,    24,   108,   131,   110,   123,
-     124,   135,   117,   118,   123,   123,   124,   125,   126,   123,
-     124,   125,   126,   129,   133,   151,   123,    46,   136,   135,
-      55,   123,   136,   247,   136,   140,   141,   142,    57,   123,
-     124,   127,   137,   136,   130,   127,   123,   173,   123,   124,
-     125,   126,   136,    83,   136,   136,   135,   134,   124,   125,
-     126,   136,   127,   127,   278,   279,   123,   124,   125,   126,
-     753,   136,   136,    19,    20,    21,    88,   131,   124,   136,
-     206,    97,   124,   209,   109,   131,   111,   112,   138,   131,
-     131,   131,   117,   143,   135,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   131,
-     133,   123,   133,   133,    60,    61,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   506,   123,   124,   125,   126,   326,   129,   127,    60,
-      61,   133,   134,   132,   358,   136,   123,   124,   125,   126,
-     123,   124,   125,   126,   100,   124,   131,   123,   124,   136,
-     135,   107,   131,   136,   129,   129,   131,   293,   294,   133,
-     134,    19,    20,    21,    22,    23,    24,   123,   124,   125,
-     126,   129,   207,   131,   127,   131,   107,   212,   218,   132,
-     127,   127,   138,   130,   127,   667,   132,   127,    46,   132,
-     130,   127,   123,   124,   125,   126,   132,   129,   123,    57,
-     131,   133,    60,    61,   127,   240,   241,   138,   127,   132,
-     346,   123,   124,   132,    19,    20,    21,    22,    23,    24,
-     111,   112,   113,   114,   115,   116,   362,   123,   124,   125,
-     126,   266,   127,   369,   370,   270,   129,   132,   127,   127,
-     136,    46,   100,   132,   132,   280,   127,   551,   131,   107,
-     133,   132,    57,   131,   558,    60,    61,   312,   313,   314,
-     315,   316,   317,   121,   299,   123,   124,   125,   126,   123,
-     123,   306,   125,   131,   320,   321,   322,   323,   324,   325,
-     138,    19,    20,    21,   131,   123,   131,   134,   135,   134,
-     135,   131,   421,   129,   329,   100,   123,   426,   333,   334,
-     335,   423,   107,   694,   129,   340,   341,   342,   133,   533,
-     534,   109,   536,   129,   133,   134,   121,   133,   123,   124,
-     125,   126,    60,    61,   129,   129,   131,   129,   123,   133,
-     135,   133,   123,   138,   123,   124,   123,   684,    76,   123,
-     124,   125,   126,   123,   124,   123,   124,   123,   652,   131,
-     385,   125,   126,    80,    81,   659,   125,   126,   318,   319,
-     123,   191,   100,   193,   123,   123,   590,   123,   123,   107,
-     123,   123,   123,   123,   123,   123,   133,   123,   413,   123,
-     123,   123,   129,   121,   129,   123,   124,   125,   126,   129,
-     872,   123,   129,   131,   123,   123,   131,   135,   123,   123,
-     138,   123,   123,   123,   123,   123,   123,   133,   123,   207,
-     123,   123,   128,   243,   244,   129,   123,   123,   123,   249,
-     123,   129,   252,   253,   254,   255,   256,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   129,   129,   129,   123,
-     123,   123,   240,   241,   123,   131,   131,     0,   128,   123,
-     125,   127,   125,   124,   124,   133,   125,   125,   125,   125,
-     125,   125,   497,   498,   499,   500,   501,   603,   266,   129,
-     131,   125,   270,   131,   137,   134,   133,   512,   518,   125,
-     133,   521,   280,   133,   519,   520,   526,   522,   523,   524,
-     525,   133,   527,   797,   529,   530,   531,   532,   125,   803,
-     535,   299,   131,   639,   139,   131,   642,     3,   306,   131,
-     131,   131,   547,   131,   131,   122,   119,   123,    19,    20,
-      21,   120,   131,   125,   125,   654,   131,   131,   125,   125,
-     360,   329,   661,   131,   125,   333,   334,   335,   131,   131,
-     135,   131,   340,   341,   342,   131,   135,    19,    20,    21,
-     131,   123,   131,   133,   589,   133,   133,   133,    54,    60,
-      61,   130,   133,   133,   700,   132,   132,    63,    64,    65,
-      66,    67,    68,   132,   609,    71,    72,   132,    74,    75,
-     410,    77,    78,   132,   619,   415,   621,   417,    60,    61,
-     130,   130,   123,   130,   132,   131,   631,   132,   633,   100,
-     130,   636,   130,   638,   639,   640,   107,   642,   643,   644,
-     739,   646,   647,   749,   750,   413,   745,   130,   130,   130,
-     121,   123,   123,   124,   125,   126,   123,   132,   100,   123,
-     131,   123,   123,   123,   135,   107,   123,   138,   123,   123,
-     123,   127,   123,   132,   132,   680,   681,   687,   683,   121,
-     132,   123,   124,   125,   126,   132,   691,   692,   123,   131,
-     132,   123,   132,   112,   130,   132,   138,   130,   117,   130,
-     130,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   130,   132,   131,   131,   131,
-     131,   131,   125,   123,   128,   123,   135,   135,   528,   497,
-     498,   499,   500,   501,   129,   129,   135,   123,   837,   135,
-     123,   132,   135,   123,   843,   135,   130,   123,   123,   130,
-     123,   123,   552,   123,   554,   132,   123,   123,   123,   559,
-     124,   135,   133,   132,   127,   127,   124,   124,   124,   128,
-     130,   132,   127,   127,   127,   780,   781,   782,   783,   784,
-     132,   786,   127,   583,   789,   132,   123,   123,   793,   132,
-     132,   132,   132,   212,   123,   123,   123,    19,    20,    21,
-     123,   132,   132,   136,   136,   815,   816,   132,   132,   123,
-     610,   821,   822,   133,   136,   136,   132,   132,   131,   131,
-     620,   132,   622,   124,   624,   625,   626,   627,   135,   629,
-     123,   135,   632,   124,   634,   635,   124,   637,    60,    61,
-     123,   641,   123,   123,   131,   645,   124,   124,   132,   649,
-     650,   619,   125,   621,   125,   125,    19,    20,    21,   131,
-     108,   135,     6,   631,   132,   633,   132,   132,   636,   132,
-     132,   639,   125,   124,   642,   135,   644,   135,   100,   647,
-     136,   136,   136,   127,   136,   107,   136,   127,   688,   689,
-     690,   127,   133,   128,   133,   132,   696,    60,    61,   121,
-     132,   123,   124,   125,   126,   128,   127,   129,   127,   131,
-       6,   135,   680,   681,   130,   130,   138,   130,   130,   130,
-     123,   123,   132,   723,   132,   132,   726,   132,   124,   729,
-     123,   135,   732,   124,     6,   125,   125,   100,   125,   137,
-     132,   136,   742,   137,   107,   128,   132,   135,   748,   131,
-     135,   127,   127,   127,   135,    19,    20,    21,   121,   132,
-     123,   124,   125,   126,   764,   132,   385,   132,   131,   123,
-     123,   123,   123,   773,   774,   138,   123,   123,   136,   136,
-     136,   123,   132,   132,   132,   123,   123,   132,   844,   132,
-     560,   791,   132,   285,   174,   795,    60,    61,   616,   445,
-      97,   801,    -1,    -1,   685,    -1,    -1,    -1,   327,    -1,
+       0,   445,   207,   312,    93,     0,   357,    94,   104,   105,
+     170,   358,   359,   668,     0,    81,   363,    61,    62,    81,
+      82,   285,   118,     4,    89,   132,   290,    19,   128,    19,
+      19,   108,   176,    81,    82,    81,    82,   137,    23,    24,
+      25,   109,   132,   111,   249,   124,   125,   124,   125,   124,
+     124,   125,   126,   127,   125,   126,   127,   153,   137,   124,
+     135,    56,    47,   137,   108,   124,   125,   126,   127,   137,
+     125,   132,   138,    58,   136,   280,   281,   132,   137,   175,
+     124,   125,   126,   127,    84,   128,   118,   119,   132,   137,
+     128,   137,   132,   130,   137,   139,   136,   134,   135,   137,
+     755,   124,   125,   126,   127,    20,    21,    22,    89,   141,
+     142,   143,   208,    99,   137,   211,   111,   130,   113,   114,
+     130,   130,   132,   136,   119,   134,   135,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   124,   134,   124,   134,   134,    61,    62,   124,   124,
+     125,   126,   127,   125,   128,   360,   125,   131,   134,   139,
+     132,   508,   137,   132,   144,   130,   124,   132,   328,   313,
+     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   124,   125,   101,   128,   124,   125,
+     126,   127,   133,   108,   132,   124,   125,   128,   136,   295,
+     296,   137,   133,    20,    21,    22,    23,    24,    25,   124,
+     125,   126,   127,   132,   209,   134,   128,   132,   128,   214,
+     220,   133,   130,   133,   139,   669,   124,   125,   126,   127,
+      47,   132,   128,   124,   125,   126,   127,   133,   128,   137,
+     124,    58,   126,   133,    61,    62,   137,   242,   243,   128,
+     128,   124,   348,   124,   133,   133,    20,    21,    22,    23,
+      24,    25,   112,   113,   114,   115,   116,   117,   364,   124,
+     125,   126,   127,   268,   128,   371,   372,   272,   130,   133,
+     128,   128,   137,    47,   101,   133,   133,   282,   132,   553,
+     128,   108,   136,   131,    58,   132,   560,    61,    62,   314,
+     315,   316,   317,   318,   319,   122,   301,   124,   125,   126,
+     127,   134,   135,   308,   124,   132,   322,   323,   324,   325,
+     326,   327,   139,   132,   124,   132,   135,   136,   135,   136,
+     535,   536,   128,   538,   423,   131,   331,   101,   425,   428,
+     335,   336,   337,   124,   108,   696,     3,   342,   343,   344,
+     130,   130,   130,   111,   134,   134,   134,   124,   122,   130,
+     124,   125,   126,   127,   124,   130,   130,   130,   132,   134,
+     124,   134,   136,   124,   125,   139,   124,   686,   124,   125,
+     126,   127,   124,   125,   124,   125,   130,   592,   126,   127,
+     654,   124,   387,    81,    82,   126,   127,   661,    55,   320,
+     321,   124,   124,   193,   124,   195,   124,    64,    65,    66,
+      67,    68,    69,   124,   124,    72,    73,   124,    75,    76,
+     415,    78,    79,   124,   124,   130,   130,   124,   124,   124,
+     874,   124,   124,   124,   124,   124,   130,   124,   124,   124,
+       0,   124,   124,   124,   120,   447,   124,   124,   132,   124,
+     129,   209,   132,   124,   124,   245,   246,   124,   124,   124,
+     124,   251,   130,   124,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   130,   130,
+     130,   124,   124,   132,   242,   243,   132,   134,   129,   134,
+     126,   126,   125,   125,   134,   126,   126,   126,   126,   138,
+     126,   126,   126,   130,   499,   500,   501,   502,   503,   605,
+     268,   132,   135,   123,   272,   134,   134,   132,   134,   514,
+     520,   134,   126,   523,   282,   126,   521,   522,   528,   524,
+     525,   526,   527,   132,   529,   799,   531,   532,   533,   534,
+     132,   805,   537,   301,   132,   641,   132,   132,   644,   132,
+     308,   132,   128,   140,   549,   121,   124,   132,   132,   126,
+      20,    21,    22,   132,   126,   126,   136,   656,   132,   126,
+     126,   136,   362,   331,   663,   134,   124,   335,   336,   337,
+     132,   132,   132,   132,   342,   343,   344,   132,   134,   132,
+      20,    21,    22,   134,   134,   134,   591,   134,   133,   133,
+     133,    61,    62,   131,   133,   124,   702,   133,   131,   131,
+     124,   131,   133,   128,   131,   133,   611,    77,   131,   131,
+     131,   131,   412,   124,   124,   132,   621,   417,   623,   419,
+     124,    61,    62,   124,   124,   124,   124,   124,   633,   124,
+     635,   101,   124,   638,   124,   640,   641,   642,   108,   644,
+     645,   646,   741,   648,   649,   751,   752,   415,   747,   133,
+     133,   133,   122,   133,   124,   125,   126,   127,   133,   124,
+     133,   101,   132,   131,   131,   131,   136,   131,   108,   139,
+     131,   133,   126,   133,   132,   132,   132,   682,   683,   689,
+     685,   132,   122,   132,   124,   125,   126,   127,   693,   694,
+     124,   129,   132,   124,   136,   114,   136,   136,   130,   139,
+     119,   130,   124,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   124,   136,   136,
+     136,   133,   124,   136,   124,   131,   124,   131,   124,   124,
+     530,   499,   500,   501,   502,   503,   124,   124,   124,   133,
+     839,   134,   124,   133,   128,   128,   845,   125,   125,   125,
+     125,   136,   133,   133,   554,   128,   556,   128,   128,   128,
+     124,   561,   124,   124,   124,   133,   133,   133,   133,   124,
+     133,   124,   124,   129,   133,   133,   133,   782,   783,   784,
+     785,   786,   133,   788,   134,   585,   791,   131,   137,   137,
+     795,   137,   137,   133,   133,   214,   132,   125,   133,    20,
+      21,    22,   132,   136,   124,   136,   125,   817,   818,   125,
+     124,   124,   612,   823,   824,   124,   126,   125,   125,   109,
+     126,   126,   622,   125,   624,   136,   626,   627,   628,   629,
+     133,   631,   132,   132,   634,   133,   636,   637,   133,   639,
+      61,    62,   133,   643,   133,   133,   126,   647,   133,   136,
+     136,   651,   652,   621,   137,   623,   137,   128,   137,   137,
+     137,   128,   128,   128,   134,   633,   134,   635,   129,   133,
+     638,   128,     6,   641,   129,     6,   644,   131,   646,   131,
+     101,   649,    20,    21,    22,   131,   131,   108,   131,   133,
+     690,   691,   692,   133,   133,   133,   124,   124,   698,   125,
+     136,   122,   124,   124,   125,   126,   127,   125,     6,   126,
+     126,   132,   133,   136,   682,   683,   126,   137,   139,   133,
+     133,   136,   128,    61,    62,   725,   138,   138,   728,   136,
+     132,   731,   128,   128,   734,   136,   133,   129,   124,   133,
+     133,   124,   124,   124,   744,   124,   124,   137,   137,   137,
+     750,   846,   124,   133,   124,   124,   133,    20,    21,    22,
+     133,   562,   133,   101,   287,   133,   766,   133,   387,   687,
+     108,   176,    99,    -1,   618,   775,   776,    -1,    -1,    -1,
+      -1,    -1,   329,    -1,   122,    -1,   124,   125,   126,   127,
+      -1,    -1,   130,   793,   132,    -1,    -1,   797,    61,    62,
+      -1,   139,    -1,   803,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   823,   824,   825,   826,   827,   828,    -1,
-     830,    -1,   832,    -1,   834,    -1,   100,    -1,    -1,    -1,
-     840,    -1,    -1,   107,    -1,    19,    20,    21,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,    -1,   123,
-     124,   125,   126,    -1,    -1,    -1,   866,   131,    -1,    -1,
-      -1,   871,    -1,    -1,   138,    -1,   876,    -1,   878,    -1,
-     880,    -1,   882,   883,    -1,   885,    60,    61,    -1,    -1,
-      -1,    -1,    -1,   512,    -1,    -1,    -1,   897,   898,   899,
-     519,   520,    -1,   522,   523,   524,   525,    -1,   527,    -1,
-     529,   530,   531,   532,    -1,    -1,   535,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,   547,    -1,
-      -1,    -1,    -1,   107,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,    -1,   123,
-     124,   125,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
-      -1,    -1,    -1,    -1,   138,    -1,    -1,    -1,    -1,    -1,
-     589,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   825,   826,   827,   828,   829,
+     830,    -1,   832,    -1,   834,    -1,   836,    -1,   101,    -1,
+      -1,    -1,   842,    -1,    -1,   108,    -1,    20,    21,    22,
+      -1,    -1,    -1,    -1,    -1,    -1,    20,    21,    22,   122,
+      -1,   124,   125,   126,   127,    -1,    -1,    -1,   868,   132,
+      -1,    -1,    -1,   873,    -1,    -1,   139,    -1,   878,    -1,
+     880,    -1,   882,    -1,   884,   885,    -1,   887,    61,    62,
+      -1,    -1,    -1,    -1,    -1,   514,    -1,    61,    62,   899,
+     900,   901,   521,   522,    -1,   524,   525,   526,   527,    -1,
+     529,    -1,   531,   532,   533,   534,    -1,    -1,   537,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   101,    -1,
+     549,    -1,    -1,    -1,    -1,   108,    -1,   101,    -1,    -1,
+      -1,    -1,    -1,    -1,   108,    -1,    -1,    -1,    -1,   122,
+      -1,   124,   125,   126,   127,    -1,    -1,    -1,   122,   132,
+     124,   125,   126,   127,    -1,    -1,   139,    -1,   132,    -1,
+      -1,    -1,   591,    -1,    -1,   139,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     609,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   611,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   638,
-      -1,   640,    -1,    -1,   643,    -1,    -1,   646,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   640,    -1,   642,    -1,    -1,   645,    -1,    -1,   648,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   683,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   691,   692,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   685,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   693,   694,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-       4,     5,    -1,    -1,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    -1,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    -1,    58,    59,    -1,    -1,    62,    -1,
-      -1,   780,   781,   782,   783,   784,    -1,   786,    -1,    -1,
-     789,    -1,    -1,    -1,   793,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    -1,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,    -1,   101,   102,   103,
-     104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   123,
-      -1,    -1,   126,    -1,    -1,     0,     1,    -1,    -1,     4,
-       5,    -1,   136,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    -1,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    -1,    58,    59,    -1,    -1,    62,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,    -1,   101,   102,   103,   104,
-     105,   106,     4,     5,   109,    -1,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    -1,    -1,   123,   124,
-     125,   126,    -1,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    -1,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    -1,    58,    59,    -1,    -1,
-      62,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    -1,    89,    90,    91,
-      92,    93,    94,    95,    96,    97,    98,    99,    -1,   101,
-     102,   103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,
+      -1,     4,     5,    -1,    -1,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    -1,    59,    60,    -1,    -1,
+      63,    -1,    -1,   782,   783,   784,   785,   786,    -1,   788,
+      -1,    -1,   791,    -1,    -1,    -1,   795,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    -1,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,   102,
+     103,   104,   105,   106,   107,    -1,    -1,   110,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   123,    -1,    -1,   126,    -1,   128,     4,     5,    -1,
-      -1,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    -1,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      -1,    58,    59,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,   124,    -1,    -1,   127,    -1,    -1,     0,     1,    -1,
+      -1,     4,     5,    -1,   137,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    -1,    59,    60,    -1,    -1,
+      63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,   102,
+     103,   104,   105,   106,   107,     4,     5,   110,    -1,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      -1,   124,   125,   126,   127,    -1,    -1,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    -1,
+      59,    60,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      -1,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,    -1,   102,   103,   104,   105,   106,   107,     4,
+       5,   110,    -1,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    -1,   124,    -1,    -1,   127,    -1,
+     129,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    -1,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    -1,    59,    60,    -1,    -1,    63,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    79,    80,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,    -1,   101,   102,   103,   104,   105,   106,
-       4,     5,   109,    -1,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    -1,    -1,   123,    -1,    -1,   126,
-      -1,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      44,    45,    -1,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    -1,    58,    59,    -1,    -1,    62,    -1,
+      -1,    -1,    -1,    -1,    -1,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,    -1,   102,   103,   104,
+     105,   106,   107,     4,     5,   110,    -1,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    -1,   124,
+      -1,    -1,   127,    -1,    -1,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    -1,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    -1,    59,    60,
+      -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    -1,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+      -1,   102,   103,   104,   105,   106,   107,    -1,    -1,   110,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    -1,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,    -1,   101,   102,   103,
-     104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   123,
-      -1,    -1,   126
+      -1,    -1,    -1,   124,    -1,    -1,   127
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -1518,128 +1519,128 @@ static const grib_yytype_int16 grib_yycheck[] =
 static const grib_yytype_uint8 grib_yystos[] =
 {
        0,     1,     4,     5,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    25,    26,    27,    28,    29,    30,
+      14,    15,    16,    17,    18,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    58,    59,    62,    79,    80,
+      41,    42,    43,    44,    45,    46,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    59,    60,    63,    80,
       81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,    98,    99,   101,
-     102,   103,   104,   105,   106,   109,   123,   124,   125,   126,
-     145,   146,   150,   151,   156,   157,   158,   165,   166,   167,
-     168,   169,   170,   171,   174,   175,   178,   188,   189,   191,
-     192,   193,   131,   131,   131,   129,   131,   123,   123,   131,
-     129,   123,   123,   129,   123,   124,   131,   123,   129,   131,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   129,   129,   123,   129,   129,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   131,   123,   123,   124,   131,   124,   131,   124,   131,
-     123,    19,    20,    21,    60,    61,   100,   107,   121,   123,
-     124,   125,   126,   131,   138,   146,   153,   154,   155,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   131,   128,
-     123,   123,   129,   123,   123,   123,   123,   123,   129,   129,
-     129,   129,   123,   123,   123,   123,   131,   131,    18,   133,
-     133,   133,   123,   133,     0,     4,   123,   126,   128,   150,
-     128,   123,   124,   126,   175,   123,   124,   178,     4,   123,
-     193,   187,   187,   123,   125,   125,   124,   124,   153,   125,
-     131,   133,   146,   161,   161,   125,   187,   129,   134,   161,
-     125,   125,   161,   161,   161,   161,   161,   161,   161,   161,
-     161,   161,   161,   161,   161,   161,   129,   125,   123,   125,
-     131,   125,   125,   133,   134,   134,   123,   134,   133,   133,
-     131,   131,   134,   135,   131,   135,   131,   134,   135,   137,
-     146,   162,   187,   133,   133,   125,   125,   123,   124,   131,
-     131,   131,   131,   131,   131,   184,   131,   187,   179,   180,
-     127,   122,   139,   117,   118,   140,   141,   142,   138,   143,
-     111,   112,   113,   114,   115,   116,   119,   120,   123,   131,
-     162,   125,   162,   131,   131,   131,   125,   125,   125,   125,
-     131,   131,   131,   155,   187,   153,   131,    22,    23,    24,
-      46,    57,   129,   135,   187,   129,   135,   135,   129,   134,
-     161,   135,   131,   133,   150,   133,   133,   133,   133,   131,
-     133,   132,   132,   132,   130,   132,   132,   130,   153,   153,
-     162,   162,   130,   132,   155,   123,   162,   130,   132,   162,
-     162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
-     162,   162,   162,   153,   130,   130,   130,   153,   130,   130,
-     123,   123,   123,   131,   123,   155,   135,   155,   153,   123,
-     123,   169,   123,   170,   123,   123,   169,     3,    54,    63,
-      64,    65,    66,    67,    68,    71,    72,    74,    75,    77,
-      78,   163,   164,   132,    76,   135,   187,   187,   132,   132,
-     132,   132,   153,   123,   123,   123,   123,   123,   124,   132,
-     153,   132,   154,   123,   179,   181,   181,   181,   181,   181,
-     181,   182,   182,   183,   183,   183,   183,   183,   183,   184,
-     185,   127,   153,   130,   153,   153,   153,   130,   130,   130,
-     130,   153,   153,   153,   132,   132,   187,   131,   131,   131,
-     131,   131,   125,   149,   123,   176,   177,   128,   149,   176,
-     176,   155,   123,   162,   176,   187,   187,   135,   135,   123,
-     123,   135,   123,   124,   132,   123,   135,   130,   161,   123,
-     123,   130,   123,   123,   123,   132,   123,   123,   162,   133,
-     153,   123,   162,   125,   126,   147,   162,   132,   127,   132,
-     131,   135,   136,   127,   136,   127,   132,   131,   135,   136,
-     127,    80,    81,   135,   159,   124,   147,   148,   124,   124,
-     124,   124,   132,   127,   127,   127,   132,   132,   127,   127,
-     132,   123,   132,   123,   132,   132,   132,   123,   123,   123,
-     123,   132,   132,   132,   135,   132,   153,   153,   153,   153,
-     153,   127,   130,   133,   136,   176,   130,   136,   136,   130,
-     161,   136,   132,   132,   123,   150,   189,   190,   150,   129,
-     161,   129,   161,   150,   161,   161,   161,   161,   150,   161,
-     162,   129,   161,   129,   161,   161,   129,   161,   155,   131,
-     155,   161,   131,   155,   131,   123,   132,   131,   127,   136,
-     161,   124,   135,   123,   169,   162,   124,   162,   124,   135,
-     123,   169,   162,   164,   123,   123,   159,   160,   128,   152,
-     136,   127,   136,   124,   124,   125,   125,   125,   132,   162,
-     131,   131,   161,   155,   108,   172,   173,   135,   132,   132,
-     132,   132,   132,   125,   129,   187,   161,   162,   135,   135,
-     133,   136,   190,   136,   136,   153,   162,   153,   162,   136,
-     162,   162,   162,   162,   136,   162,   153,   162,   153,   162,
-     162,   153,   162,   161,   153,   187,   161,   162,   153,   161,
-     153,   162,   161,   153,   125,   126,   162,   162,   127,   169,
-     127,   132,   136,   127,   127,   169,   127,   132,   136,   133,
-     133,   152,   136,   159,   128,   124,   132,   132,   127,   132,
-     127,   127,   153,   153,   161,   154,   110,   136,   173,   150,
-     162,   162,   162,   161,   161,   149,   128,   162,     6,     6,
-     130,   130,   130,   130,   130,   162,   132,    80,   162,   132,
-     162,   132,   162,   132,   123,   136,   124,   135,   162,   123,
-     123,   136,   124,   135,   162,   187,   187,     6,   152,   125,
-     125,   125,   132,   132,   162,   137,   137,   136,   162,   162,
-     130,   135,   135,   161,   161,   161,   161,   161,   161,   131,
-     161,   162,   161,   127,   132,   162,   127,   169,   127,   127,
-     132,   162,   127,   169,   135,   132,   132,   132,   150,   136,
-     150,   128,   150,   150,   162,   162,   162,   162,   162,   162,
-     123,   162,   162,   123,   162,   123,   136,   123,   123,   162,
-     123,   136,   160,   136,   136,   136,   132,   127,   132,   127,
-     132,   162,   132,   132,   127,   132,   162,   136,   162,   123,
-     162,   123,   162,   162,   162,   123,   162,   132,   132,   132,
-     162,   162,   162
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     102,   103,   104,   105,   106,   107,   110,   124,   125,   126,
+     127,   146,   147,   151,   152,   157,   158,   159,   166,   167,
+     168,   169,   170,   171,   172,   173,   176,   177,   180,   190,
+     191,   193,   194,   195,   132,   132,   132,   130,   132,   124,
+     124,   132,   130,   124,   124,   130,   124,   125,   132,   124,
+     130,   132,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   130,   130,   124,
+     130,   130,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   132,   124,   124,   125,   132,   125,   132,
+     125,   132,   124,    20,    21,    22,    61,    62,   101,   108,
+     122,   124,   125,   126,   127,   132,   139,   147,   154,   155,
+     156,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     132,   129,   124,   124,   130,   124,   124,   124,   124,   124,
+     130,   130,   130,   130,   124,   124,   124,   124,   132,   132,
+      19,   134,   134,   134,   124,   134,     0,     4,   124,   127,
+     129,   151,   129,   124,   125,   127,   177,   124,   125,   180,
+       4,   124,   195,   189,   189,   124,   126,   126,   125,   125,
+     154,   126,   132,   134,   147,   162,   162,   126,   189,   130,
+     135,   162,   126,   126,   162,   162,   162,   162,   162,   162,
+     162,   162,   162,   162,   162,   162,   162,   162,   130,   126,
+     124,   126,   132,   126,   126,   134,   135,   135,   124,   135,
+     134,   134,   132,   132,   135,   136,   132,   136,   132,   135,
+     136,   138,   147,   163,   189,   134,   134,   126,   126,   124,
+     125,   132,   132,   132,   132,   132,   132,   186,   132,   189,
+     181,   182,   128,   123,   140,   118,   119,   141,   142,   143,
+     139,   144,   112,   113,   114,   115,   116,   117,   120,   121,
+     124,   132,   163,   126,   163,   132,   132,   132,   126,   126,
+     126,   126,   132,   132,   132,   156,   189,   154,   132,    23,
+      24,    25,    47,    58,   130,   136,   189,   130,   136,   136,
+     130,   135,   162,   136,   132,   134,   151,   134,   134,   134,
+     134,   132,   134,   133,   133,   133,   131,   133,   133,   131,
+     154,   154,   163,   163,   131,   133,   156,   124,   163,   131,
+     133,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+     163,   163,   163,   163,   163,   154,   131,   131,   131,   154,
+     131,   131,   124,   124,   124,   132,   124,   156,   136,   156,
+     154,   124,   124,   171,   124,   172,   124,   124,   171,     3,
+      55,    64,    65,    66,    67,    68,    69,    72,    73,    75,
+      76,    78,    79,   164,   165,   133,    77,   136,   189,   189,
+     133,   133,   133,   133,   154,   124,   124,   124,   124,   124,
+     125,   133,   154,   133,   155,   124,   181,   183,   183,   183,
+     183,   183,   183,   184,   184,   185,   185,   185,   185,   185,
+     185,   186,   187,   128,   154,   131,   154,   154,   154,   131,
+     131,   131,   131,   154,   154,   154,   133,   133,   189,   132,
+     132,   132,   132,   132,   126,   150,   124,   178,   179,   129,
+     150,   178,   178,   156,   124,   163,   178,   189,   189,   136,
+     136,   124,   124,   136,   124,   125,   133,   124,   136,   131,
+     162,   124,   124,   131,   124,   124,   124,   133,   124,   124,
+     163,   134,   154,   124,   163,   126,   127,   148,   163,   133,
+     128,   133,   132,   136,   137,   128,   137,   128,   133,   132,
+     136,   137,   128,    81,    82,   136,   160,   125,   148,   149,
+     125,   125,   125,   125,   133,   128,   128,   128,   133,   133,
+     128,   128,   133,   124,   133,   124,   133,   133,   133,   124,
+     124,   124,   124,   133,   133,   133,   136,   133,   154,   154,
+     154,   154,   154,   128,   131,   134,   137,   178,   131,   137,
+     137,   131,   162,   137,   133,   133,   124,   151,   191,   192,
+     151,   130,   162,   130,   162,   151,   162,   162,   162,   162,
+     151,   162,   163,   130,   162,   130,   162,   162,   130,   162,
+     156,   132,   156,   162,   132,   156,   132,   124,   133,   132,
+     128,   137,   162,   125,   136,   124,   171,   163,   125,   163,
+     125,   136,   124,   171,   163,   165,   124,   124,   160,   161,
+     129,   153,   137,   128,   137,   125,   125,   126,   126,   126,
+     133,   163,   132,   132,   162,   156,   109,   174,   175,   136,
+     133,   133,   133,   133,   133,   126,   130,   189,   162,   163,
+     136,   136,   134,   137,   192,   137,   137,   154,   163,   154,
+     163,   137,   163,   163,   163,   163,   137,   163,   154,   163,
+     154,   163,   163,   154,   163,   162,   154,   189,   162,   163,
+     154,   162,   154,   163,   162,   154,   126,   127,   163,   163,
+     128,   171,   128,   133,   137,   128,   128,   171,   128,   133,
+     137,   134,   134,   153,   137,   160,   129,   125,   133,   133,
+     128,   133,   128,   128,   154,   154,   162,   155,   111,   137,
+     175,   151,   163,   163,   163,   162,   162,   150,   129,   163,
+       6,     6,   131,   131,   131,   131,   131,   163,   133,    81,
+     163,   133,   163,   133,   163,   133,   124,   137,   125,   136,
+     163,   124,   124,   137,   125,   136,   163,   189,   189,     6,
+     153,   126,   126,   126,   133,   133,   163,   138,   138,   137,
+     163,   163,   131,   136,   136,   162,   162,   162,   162,   162,
+     162,   132,   162,   163,   162,   128,   133,   163,   128,   171,
+     128,   128,   133,   163,   128,   171,   136,   133,   133,   133,
+     151,   137,   151,   129,   151,   151,   163,   163,   163,   163,
+     163,   163,   124,   163,   163,   124,   163,   124,   137,   124,
+     124,   163,   124,   137,   161,   137,   137,   137,   133,   128,
+     133,   128,   133,   163,   133,   133,   128,   133,   163,   137,
+     163,   124,   163,   124,   163,   163,   163,   124,   163,   133,
+     133,   133,   163,   163,   163
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const grib_yytype_uint8 grib_yyr1[] =
 {
-       0,   144,   145,   145,   145,   145,   145,   145,   146,   147,
-     147,   147,   147,   148,   148,   149,   149,   150,   150,   150,
-     150,   151,   151,   151,   151,   151,   151,   151,   151,   151,
-     152,   152,   153,   153,   154,   154,   155,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   157,   157,   157,   157,   158,   158,   158,   159,   159,
-     160,   160,   161,   161,   162,   162,   163,   163,   164,   164,
-     164,   164,   164,   164,   164,   164,   164,   164,   164,   164,
-     164,   164,   165,   166,   167,   168,   168,   168,   168,   168,
-     168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
-     168,   168,   169,   169,   170,   170,   171,   171,   172,   172,
-     173,   174,   174,   174,   175,   175,   175,   175,   176,   176,
-     177,   177,   178,   178,   179,   179,   179,   179,   180,   180,
-     180,   180,   180,   180,   180,   180,   180,   181,   181,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-     182,   183,   183,   183,   184,   184,   184,   184,   184,   184,
-     184,   184,   184,   185,   185,   186,   186,   187,   188,   188,
-     189,   189,   190,   190,   191,   192,   193,   193
+       0,   145,   146,   146,   146,   146,   146,   146,   147,   148,
+     148,   148,   148,   149,   149,   150,   150,   151,   151,   151,
+     151,   152,   152,   152,   152,   152,   152,   152,   152,   152,
+     152,   153,   153,   154,   154,   155,   155,   156,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   158,   158,   158,   158,   159,   159,   159,   160,
+     160,   161,   161,   162,   162,   163,   163,   164,   164,   165,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   166,   167,   168,   169,   170,   170,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
+     170,   170,   170,   170,   171,   171,   172,   172,   173,   173,
+     174,   174,   175,   176,   176,   176,   177,   177,   177,   177,
+     178,   178,   179,   179,   180,   180,   181,   181,   181,   181,
+     182,   182,   182,   182,   182,   182,   182,   182,   182,   183,
+     183,   184,   184,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   184,   185,   185,   185,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   187,   187,   188,   188,   189,
+     190,   190,   191,   191,   192,   192,   193,   194,   195,   195
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -1648,30 +1649,30 @@ static const grib_yytype_int8 grib_yyr2[] =
        0,     2,     1,     1,     1,     1,     1,     1,     0,     1,
        3,     1,     3,     1,     3,     1,     3,     1,     2,     3,
        2,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     1,     1,     1,     3,     1,     7,    10,     7,
-      10,     7,     4,     7,     7,     7,     7,     4,     7,     7,
-      10,     7,     7,    10,     7,    10,     8,     8,    12,    10,
-       7,     8,     8,     8,    10,     8,     9,     7,     2,     2,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     7,     6,     7,     2,     5,
-       5,     7,     4,     6,     7,     2,     6,     8,     8,     3,
-       5,     5,     5,     5,     6,     3,     3,     3,     3,     5,
-       2,     7,     4,     8,    10,     5,     5,     5,     5,     2,
-       6,     4,     3,     4,     4,     6,     6,     4,     2,     1,
-       5,     4,     2,     1,     5,     4,     4,     2,     5,     5,
-       1,     7,    11,     7,    11,     6,     7,    11,     4,     4,
-       2,     3,     1,     2,     1,     2,     1,     3,     1,     1,
+       1,     1,     2,     1,     1,     1,     3,     1,     7,    10,
+       7,    10,     7,     4,     7,     7,     7,     7,     4,     7,
+       7,    10,     7,     7,    10,     7,    10,     8,     8,    12,
+      10,     7,     8,     8,     8,    10,     8,     9,     7,     2,
+       2,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     7,     6,     7,     2,
+       5,     5,     7,     4,     6,     7,     2,     6,     8,     8,
+       3,     5,     5,     5,     5,     6,     3,     3,     3,     3,
+       5,     2,     7,     4,     8,    10,     5,     5,     5,     5,
+       2,     6,     4,     3,     4,     4,     6,     6,     4,     2,
+       1,     5,     4,     2,     1,     5,     4,     4,     2,     5,
+       5,     1,     7,    11,     7,    11,     6,     7,    11,     4,
+       4,     2,     3,     1,     2,     1,     2,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     8,     7,     7,     6,     9,    12,    14,    10,
-      14,    12,     8,    11,     6,     9,    12,    10,    14,    12,
-       8,    11,     1,     2,     1,     2,     6,    12,     1,     2,
-       4,    10,     9,     7,     5,     5,     5,     5,     1,     2,
-       4,     6,     5,     5,     8,     1,     8,     1,     1,     1,
-       1,     1,     1,     3,     2,     3,     4,     3,     1,     3,
-       3,     3,     3,     3,     1,     4,     6,     6,     6,     8,
-       4,     3,     3,     1,     3,     3,     3,     3,     3,     3,
-       3,     2,     1,     3,     1,     3,     1,     1,     1,     1,
-       4,     2,     1,     2,     1,     7,     1,     2
+       1,     1,     1,     8,     7,     1,     7,     6,     9,    12,
+      14,    10,    14,    12,     8,    11,     6,     9,    12,    10,
+      14,    12,     8,    11,     1,     2,     1,     2,     6,    12,
+       1,     2,     4,    10,     9,     7,     5,     5,     5,     5,
+       1,     2,     4,     6,     5,     5,     8,     1,     8,     1,
+       1,     1,     1,     1,     1,     3,     2,     3,     4,     3,
+       1,     3,     3,     3,     3,     3,     1,     4,     6,     6,
+       6,     8,     4,     3,     3,     1,     3,     3,     3,     3,
+       3,     3,     3,     2,     1,     3,     1,     3,     1,     1,
+       1,     1,     4,     2,     1,     2,     1,     7,     1,     2
 };
 
 
@@ -2367,249 +2368,249 @@ grib_yyreduce:
   switch (grib_yyn)
     {
   case 2:
-#line 262 "griby.y"
+#line 264 "griby.y"
                           { grib_parser_all_actions = 0;grib_parser_concept=0; 
                             grib_parser_hash_array=0;grib_parser_rules=0; }
-#line 2374 "y.tab.c"
+#line 2375 "y.tab.c"
     break;
 
   case 3:
-#line 264 "griby.y"
+#line 266 "griby.y"
                           { grib_parser_concept     = reverse_concept((grib_yyvsp[0].concept_value)); }
-#line 2380 "y.tab.c"
+#line 2381 "y.tab.c"
     break;
 
   case 4:
-#line 265 "griby.y"
+#line 267 "griby.y"
                              { grib_parser_hash_array     = reverse_hash_array((grib_yyvsp[0].hash_array_value)); }
-#line 2386 "y.tab.c"
+#line 2387 "y.tab.c"
     break;
 
   case 5:
-#line 266 "griby.y"
+#line 268 "griby.y"
                           { grib_parser_all_actions = (grib_yyvsp[0].act); }
-#line 2392 "y.tab.c"
+#line 2393 "y.tab.c"
     break;
 
   case 6:
-#line 267 "griby.y"
+#line 269 "griby.y"
                           { grib_parser_rules       = (grib_yyvsp[0].rules); }
-#line 2398 "y.tab.c"
+#line 2399 "y.tab.c"
     break;
 
   case 7:
-#line 269 "griby.y"
+#line 271 "griby.y"
                       { grib_parser_all_actions = 0; grib_parser_concept=0; 
 	                    grib_parser_hash_array=0; grib_parser_rules=0; }
-#line 2405 "y.tab.c"
+#line 2406 "y.tab.c"
     break;
 
   case 9:
-#line 276 "griby.y"
+#line 278 "griby.y"
                   { (grib_yyval.dvalue)=grib_darray_push(grib_parser_context,0,(grib_yyvsp[0].dval));}
-#line 2411 "y.tab.c"
+#line 2412 "y.tab.c"
     break;
 
   case 10:
-#line 277 "griby.y"
+#line 279 "griby.y"
                          { (grib_yyval.dvalue)=grib_darray_push(grib_parser_context,(grib_yyvsp[-2].dvalue),(grib_yyvsp[0].dval));}
-#line 2417 "y.tab.c"
+#line 2418 "y.tab.c"
     break;
 
   case 11:
-#line 278 "griby.y"
+#line 280 "griby.y"
                { (grib_yyval.dvalue)=grib_darray_push(grib_parser_context,0,(grib_yyvsp[0].lval));}
-#line 2423 "y.tab.c"
+#line 2424 "y.tab.c"
     break;
 
   case 12:
-#line 279 "griby.y"
+#line 281 "griby.y"
                            { (grib_yyval.dvalue)=grib_darray_push(grib_parser_context,(grib_yyvsp[-2].dvalue),(grib_yyvsp[0].lval));}
-#line 2429 "y.tab.c"
+#line 2430 "y.tab.c"
     break;
 
   case 13:
-#line 282 "griby.y"
+#line 284 "griby.y"
                  { (grib_yyval.svalue)=grib_sarray_push(grib_parser_context,0,(grib_yyvsp[0].str));}
-#line 2435 "y.tab.c"
+#line 2436 "y.tab.c"
     break;
 
   case 14:
-#line 283 "griby.y"
+#line 285 "griby.y"
                           { (grib_yyval.svalue)=grib_sarray_push(grib_parser_context,(grib_yyvsp[-2].svalue),(grib_yyvsp[0].str));}
-#line 2441 "y.tab.c"
+#line 2442 "y.tab.c"
     break;
 
   case 15:
-#line 287 "griby.y"
+#line 289 "griby.y"
                           { (grib_yyval.ivalue)=grib_iarray_push(0,(grib_yyvsp[0].lval));}
-#line 2447 "y.tab.c"
+#line 2448 "y.tab.c"
     break;
 
   case 16:
-#line 288 "griby.y"
+#line 290 "griby.y"
                                  { (grib_yyval.ivalue)=grib_iarray_push((grib_yyvsp[-2].ivalue),(grib_yyvsp[0].lval));}
-#line 2453 "y.tab.c"
+#line 2454 "y.tab.c"
     break;
 
   case 18:
-#line 292 "griby.y"
+#line 294 "griby.y"
                                     { (grib_yyvsp[-1].act)->next = (grib_yyvsp[0].act); (grib_yyval.act) = (grib_yyvsp[-1].act); }
-#line 2459 "y.tab.c"
+#line 2460 "y.tab.c"
     break;
 
   case 19:
-#line 293 "griby.y"
+#line 295 "griby.y"
                                          { (grib_yyvsp[-2].act)->next = (grib_yyvsp[0].act); (grib_yyval.act) = (grib_yyvsp[-2].act); }
-#line 2465 "y.tab.c"
+#line 2466 "y.tab.c"
     break;
 
   case 20:
-#line 294 "griby.y"
+#line 296 "griby.y"
                             {  (grib_yyval.act) = (grib_yyvsp[-1].act);}
-#line 2471 "y.tab.c"
+#line 2472 "y.tab.c"
     break;
 
-  case 32:
-#line 313 "griby.y"
+  case 33:
+#line 316 "griby.y"
                            { (grib_yyval.explist) = 0; }
-#line 2477 "y.tab.c"
-    break;
-
-  case 35:
-#line 318 "griby.y"
-                                       { (grib_yyvsp[-2].explist)->next = (grib_yyvsp[0].explist); (grib_yyval.explist) = (grib_yyvsp[-2].explist); }
-#line 2483 "y.tab.c"
+#line 2478 "y.tab.c"
     break;
 
   case 36:
 #line 321 "griby.y"
-                          { (grib_yyval.explist) = grib_arguments_new(grib_parser_context,(grib_yyvsp[0].exp),NULL); }
-#line 2489 "y.tab.c"
+                                       { (grib_yyvsp[-2].explist)->next = (grib_yyvsp[0].explist); (grib_yyval.explist) = (grib_yyvsp[-2].explist); }
+#line 2484 "y.tab.c"
     break;
 
   case 37:
-#line 326 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"unsigned",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-2].str));  }
-#line 2495 "y.tab.c"
+#line 324 "griby.y"
+                          { (grib_yyval.explist) = grib_arguments_new(grib_parser_context,(grib_yyvsp[0].exp),NULL); }
+#line 2490 "y.tab.c"
     break;
 
   case 38:
 #line 329 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"unsigned",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
-#line 2501 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"unsigned",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-2].str));  }
+#line 2496 "y.tab.c"
     break;
 
   case 39:
 #line 332 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"unsigned_bits",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-2].str));  }
-#line 2507 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"unsigned",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
+#line 2502 "y.tab.c"
     break;
 
   case 40:
 #line 335 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"unsigned_bits",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
-#line 2513 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"unsigned_bits",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-2].str));  }
+#line 2508 "y.tab.c"
     break;
 
   case 41:
 #line 338 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ascii",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
-#line 2519 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"unsigned_bits",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
+#line 2514 "y.tab.c"
     break;
 
   case 42:
 #line 341 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"group",0,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
-#line 2525 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ascii",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
+#line 2520 "y.tab.c"
     break;
 
   case 43:
 #line 344 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"group",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-5].str));  }
-#line 2531 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"group",0,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
+#line 2526 "y.tab.c"
     break;
 
   case 44:
 #line 347 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"to_integer",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
-#line 2537 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"group",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-5].str));  }
+#line 2532 "y.tab.c"
     break;
 
   case 45:
 #line 350 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"sexagesimal2decimal",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
-#line 2543 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"to_integer",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
+#line 2538 "y.tab.c"
     break;
 
   case 46:
 #line 353 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"to_string",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
-#line 2549 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"sexagesimal2decimal",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
+#line 2544 "y.tab.c"
     break;
 
   case 47:
 #line 356 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"non_alpha",0,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
-#line 2555 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-6].str),"to_string",0,(grib_yyvsp[-2].explist),0,(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-6].str));  }
+#line 2550 "y.tab.c"
     break;
 
   case 48:
-#line 360 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ascii",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
-#line 2561 "y.tab.c"
+#line 359 "griby.y"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"non_alpha",0,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
+#line 2556 "y.tab.c"
     break;
 
   case 49:
 #line 363 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"bytes",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
-#line 2567 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ascii",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
+#line 2562 "y.tab.c"
     break;
 
   case 50:
 #line 366 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"bytes",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
-#line 2573 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"bytes",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
+#line 2568 "y.tab.c"
     break;
 
   case 51:
 #line 369 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ksec1expver",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
-#line 2579 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"bytes",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
+#line 2574 "y.tab.c"
     break;
 
   case 52:
 #line 372 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"signed",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
-#line 2585 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ksec1expver",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-2].str));  }
+#line 2580 "y.tab.c"
     break;
 
   case 53:
 #line 375 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"signed",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
-#line 2591 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"signed",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
+#line 2586 "y.tab.c"
     break;
 
   case 54:
 #line 378 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"signed_bits",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
-#line 2597 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"signed",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
+#line 2592 "y.tab.c"
     break;
 
   case 55:
 #line 381 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"signed_bits",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
-#line 2603 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"signed_bits",(grib_yyvsp[-4].lval),NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-2].str));  }
+#line 2598 "y.tab.c"
     break;
 
   case 56:
 #line 384 "griby.y"
-    { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"codetable",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-3].str)); }
-#line 2609 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"signed_bits",(grib_yyvsp[-7].lval),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);      free((grib_yyvsp[-5].str));  }
+#line 2604 "y.tab.c"
     break;
 
   case 57:
 #line 387 "griby.y"
+    { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"codetable",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-3].str)); }
+#line 2610 "y.tab.c"
+    break;
+
+  case 58:
+#line 390 "griby.y"
     {
       /* ECC-485: Set length to 0 and prepend the new argument */
       grib_arguments* a = grib_arguments_new(grib_parser_context, new_accessor_expression(grib_parser_context,(grib_yyvsp[-5].str),0,0),NULL);
@@ -2619,358 +2620,358 @@ grib_yyreduce:
                                   (grib_yyvsp[-1].explist), (grib_yyvsp[0].lval), NULL, NULL);
       free((grib_yyvsp[-3].str));
     }
-#line 2623 "y.tab.c"
+#line 2624 "y.tab.c"
     break;
 
-  case 58:
-#line 398 "griby.y"
+  case 59:
+#line 401 "griby.y"
         { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-7].str),"codetable",(grib_yyvsp[-9].lval), (grib_yyvsp[-6].explist),(grib_yyvsp[-5].explist),(grib_yyvsp[0].lval),NULL,(grib_yyvsp[-2].str));
            free((grib_yyvsp[-7].str));free((grib_yyvsp[-2].str)); }
-#line 2630 "y.tab.c"
-    break;
-
-  case 59:
-#line 402 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"codetable",(grib_yyvsp[-7].lval), (grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
-#line 2636 "y.tab.c"
+#line 2631 "y.tab.c"
     break;
 
   case 60:
 #line 405 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"smart_table",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
-#line 2642 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"codetable",(grib_yyvsp[-7].lval), (grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
+#line 2637 "y.tab.c"
     break;
 
   case 61:
 #line 408 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-7].str),"dictionary",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-7].str)); }
-#line 2648 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"smart_table",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
+#line 2643 "y.tab.c"
     break;
 
   case 62:
 #line 411 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-7].str),"getenv",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-7].str)); }
-#line 2654 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-7].str),"dictionary",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-7].str)); }
+#line 2649 "y.tab.c"
     break;
 
   case 63:
 #line 414 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"complex_codetable",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-3].str)); }
-#line 2660 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-7].str),"getenv",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-7].str)); }
+#line 2655 "y.tab.c"
     break;
 
   case 64:
 #line 417 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"complex_codetable",(grib_yyvsp[-7].lval), (grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
-#line 2666 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"complex_codetable",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-3].str)); }
+#line 2661 "y.tab.c"
     break;
 
   case 65:
 #line 420 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"codeflag",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-3].str)); }
-#line 2672 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"complex_codetable",(grib_yyvsp[-7].lval), (grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);    free((grib_yyvsp[-5].str)); }
+#line 2667 "y.tab.c"
     break;
 
   case 66:
 #line 423 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-4].str),"lookup",(grib_yyvsp[-6].lval),(grib_yyvsp[-2].explist),NULL,(grib_yyvsp[0].lval),NULL,NULL); free((grib_yyvsp[-4].str)); }
-#line 2678 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"codeflag",(grib_yyvsp[-5].lval), (grib_yyvsp[-2].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);  free((grib_yyvsp[-3].str)); }
+#line 2673 "y.tab.c"
     break;
 
   case 67:
 #line 426 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"bit",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL); free((grib_yyvsp[-5].str)); }
-#line 2684 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-4].str),"lookup",(grib_yyvsp[-6].lval),(grib_yyvsp[-2].explist),NULL,(grib_yyvsp[0].lval),NULL,NULL); free((grib_yyvsp[-4].str)); }
+#line 2679 "y.tab.c"
     break;
 
   case 68:
 #line 429 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"label",0,NULL,NULL,0,NULL,NULL);   free((grib_yyvsp[0].str));  }
-#line 2690 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"bit",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL); free((grib_yyvsp[-5].str)); }
+#line 2685 "y.tab.c"
     break;
 
   case 69:
 #line 432 "griby.y"
         { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"label",0,NULL,NULL,0,NULL,NULL);   free((grib_yyvsp[0].str));  }
-#line 2696 "y.tab.c"
+#line 2691 "y.tab.c"
     break;
 
   case 70:
 #line 435 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ibmfloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2702 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"label",0,NULL,NULL,0,NULL,NULL);   free((grib_yyvsp[0].str));  }
+#line 2697 "y.tab.c"
     break;
 
   case 71:
-#line 439 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int8",1,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2708 "y.tab.c"
+#line 438 "griby.y"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ibmfloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2703 "y.tab.c"
     break;
 
   case 72:
 #line 442 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint8",1,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2714 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int8",1,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2709 "y.tab.c"
     break;
 
   case 73:
 #line 445 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int16",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2720 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint8",1,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2715 "y.tab.c"
     break;
 
   case 74:
 #line 448 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint16",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2726 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int16",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2721 "y.tab.c"
     break;
 
   case 75:
 #line 451 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int16_little_endian",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2732 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint16",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2727 "y.tab.c"
     break;
 
   case 76:
 #line 454 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint16_little_endian",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2738 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int16_little_endian",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2733 "y.tab.c"
     break;
 
   case 77:
 #line 457 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int32",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2744 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint16_little_endian",2,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2739 "y.tab.c"
     break;
 
   case 78:
 #line 460 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint32",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2750 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int32",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2745 "y.tab.c"
     break;
 
   case 79:
 #line 463 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int32_little_endian",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2756 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint32",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2751 "y.tab.c"
     break;
 
   case 80:
 #line 466 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint32_little_endian",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2762 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int32_little_endian",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2757 "y.tab.c"
     break;
 
   case 81:
 #line 469 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int64",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2768 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint32_little_endian",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2763 "y.tab.c"
     break;
 
   case 82:
 #line 472 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint64",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2774 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int64",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2769 "y.tab.c"
     break;
 
   case 83:
 #line 475 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int64_little_endian",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2780 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint64",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2775 "y.tab.c"
     break;
 
   case 84:
 #line 478 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint64_little_endian",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
-#line 2786 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"int64_little_endian",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2781 "y.tab.c"
     break;
 
   case 85:
 #line 481 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"blob",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
-#line 2792 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"uint64_little_endian",8,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-2].str));  }
+#line 2787 "y.tab.c"
     break;
 
   case 86:
-#line 485 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ibmfloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-4].str),NULL);free((grib_yyvsp[-2].str)); free((grib_yyvsp[-4].str)); }
-#line 2798 "y.tab.c"
+#line 484 "griby.y"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"blob",0,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);        free((grib_yyvsp[-5].str));  }
+#line 2793 "y.tab.c"
     break;
 
   case 87:
 #line 488 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"ibmfloat",4,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-5].str));  }
-#line 2804 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ibmfloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-4].str),NULL);free((grib_yyvsp[-2].str)); free((grib_yyvsp[-4].str)); }
+#line 2799 "y.tab.c"
     break;
 
   case 88:
 #line 491 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"position",0,NULL,NULL,0,NULL,NULL);     free((grib_yyvsp[0].str));  }
-#line 2810 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"ibmfloat",4,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-5].str));  }
+#line 2805 "y.tab.c"
     break;
 
   case 89:
 #line 494 "griby.y"
-        { (grib_yyval.act) = grib_action_create_variable(grib_parser_context,(grib_yyvsp[-3].str),"constant",0,(grib_yyvsp[-1].explist),NULL,(grib_yyvsp[0].lval),NULL);free((grib_yyvsp[-3].str)); }
-#line 2816 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"position",0,NULL,NULL,0,NULL,NULL);     free((grib_yyvsp[0].str));  }
+#line 2811 "y.tab.c"
     break;
 
   case 90:
 #line 497 "griby.y"
-        { (grib_yyval.act) = grib_action_create_variable(grib_parser_context,(grib_yyvsp[-3].str),"transient",0,(grib_yyvsp[-1].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL);   free((grib_yyvsp[-3].str)); }
-#line 2822 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_variable(grib_parser_context,(grib_yyvsp[-3].str),"constant",0,(grib_yyvsp[-1].explist),NULL,(grib_yyvsp[0].lval),NULL);free((grib_yyvsp[-3].str)); }
+#line 2817 "y.tab.c"
     break;
 
   case 91:
-#line 499 "griby.y"
-        { (grib_yyval.act) = grib_action_create_transient_darray(grib_parser_context,(grib_yyvsp[-5].str),(grib_yyvsp[-2].dvalue),(grib_yyvsp[0].lval)); free((grib_yyvsp[-5].str)); }
-#line 2828 "y.tab.c"
+#line 500 "griby.y"
+        { (grib_yyval.act) = grib_action_create_variable(grib_parser_context,(grib_yyvsp[-3].str),"transient",0,(grib_yyvsp[-1].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL);   free((grib_yyvsp[-3].str)); }
+#line 2823 "y.tab.c"
     break;
 
   case 92:
 #line 502 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ieeefloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-2].str));  }
-#line 2834 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_transient_darray(grib_parser_context,(grib_yyvsp[-5].str),(grib_yyvsp[-2].dvalue),(grib_yyvsp[0].lval)); free((grib_yyvsp[-5].str)); }
+#line 2829 "y.tab.c"
     break;
 
   case 93:
 #line 505 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ieeefloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-4].str),NULL);  free((grib_yyvsp[-2].str));free((grib_yyvsp[-4].str));}
-#line 2840 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ieeefloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-2].str));  }
+#line 2835 "y.tab.c"
     break;
 
   case 94:
 #line 508 "griby.y"
-   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"ieeefloat",4,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-5].str));  }
-#line 2846 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-2].str),"ieeefloat",4,NULL,(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-4].str),NULL);  free((grib_yyvsp[-2].str));free((grib_yyvsp[-4].str));}
+#line 2841 "y.tab.c"
     break;
 
   case 95:
 #line 511 "griby.y"
-   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"g1_half_byte_codeflag",0,NULL,NULL,0,NULL,NULL);free((grib_yyvsp[0].str));  }
-#line 2852 "y.tab.c"
+   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-5].str),"ieeefloat",4,(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL,NULL);free((grib_yyvsp[-5].str));  }
+#line 2847 "y.tab.c"
     break;
 
   case 96:
 #line 514 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"section_length",(grib_yyvsp[-3].lval),NULL,(grib_yyvsp[0].explist),0,NULL,NULL);free((grib_yyvsp[-1].str));  }
-#line 2858 "y.tab.c"
+   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[0].str),"g1_half_byte_codeflag",0,NULL,NULL,0,NULL,NULL);free((grib_yyvsp[0].str));  }
+#line 2853 "y.tab.c"
     break;
 
   case 97:
 #line 517 "griby.y"
-   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"g1_message_length",(grib_yyvsp[-5].lval),(grib_yyvsp[-1].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-3].str));  }
-#line 2864 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"section_length",(grib_yyvsp[-3].lval),NULL,(grib_yyvsp[0].explist),0,NULL,NULL);free((grib_yyvsp[-1].str));  }
+#line 2859 "y.tab.c"
     break;
 
   case 98:
 #line 520 "griby.y"
-  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"g1_section4_length",(grib_yyvsp[-5].lval),(grib_yyvsp[-1].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-3].str));  }
-#line 2870 "y.tab.c"
+   { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"g1_message_length",(grib_yyvsp[-5].lval),(grib_yyvsp[-1].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-3].str));  }
+#line 2865 "y.tab.c"
     break;
 
   case 99:
 #line 523 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"ksec",0,(grib_yyvsp[0].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-1].str)); }
-#line 2876 "y.tab.c"
+  { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"g1_section4_length",(grib_yyvsp[-5].lval),(grib_yyvsp[-1].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-3].str));  }
+#line 2871 "y.tab.c"
     break;
 
   case 100:
 #line 526 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"pad",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
-#line 2882 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"ksec",0,(grib_yyvsp[0].explist),NULL,0,NULL,NULL);free((grib_yyvsp[-1].str)); }
+#line 2877 "y.tab.c"
     break;
 
   case 101:
 #line 529 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padto",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
-#line 2888 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"pad",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
+#line 2883 "y.tab.c"
     break;
 
   case 102:
 #line 532 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padtoeven",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
-#line 2894 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padto",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
+#line 2889 "y.tab.c"
     break;
 
   case 103:
 #line 535 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padtomultiple",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
-#line 2900 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padtoeven",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
+#line 2895 "y.tab.c"
     break;
 
   case 104:
 #line 538 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"message",(grib_yyvsp[-3].lval),0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
-#line 2906 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-3].str),"padtomultiple",0,(grib_yyvsp[-1].explist),0,0,NULL,NULL);   free((grib_yyvsp[-3].str)); }
+#line 2901 "y.tab.c"
     break;
 
   case 105:
 #line 541 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"message_copy",0,0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
-#line 2912 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"message",(grib_yyvsp[-3].lval),0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
+#line 2907 "y.tab.c"
     break;
 
   case 106:
 #line 544 "griby.y"
-        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"section_padding",0,0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
-#line 2918 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"message_copy",0,0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
+#line 2913 "y.tab.c"
     break;
 
   case 107:
-#line 546 "griby.y"
-        { (grib_yyval.act) = grib_action_create_template(grib_parser_context,0,(grib_yyvsp[-1].str),(grib_yyvsp[0].str)); free((grib_yyvsp[-1].str)); free((grib_yyvsp[0].str));}
-#line 2924 "y.tab.c"
+#line 547 "griby.y"
+        { (grib_yyval.act) = grib_action_create_gen(grib_parser_context,(grib_yyvsp[-1].str),"section_padding",0,0,0,(grib_yyvsp[0].lval),NULL,NULL);   free((grib_yyvsp[-1].str));  }
+#line 2919 "y.tab.c"
     break;
 
   case 108:
-#line 548 "griby.y"
-    { (grib_yyval.act) = grib_action_create_template(grib_parser_context,1,(grib_yyvsp[-1].str),(grib_yyvsp[0].str)); free((grib_yyvsp[-1].str)); free((grib_yyvsp[0].str));}
-#line 2930 "y.tab.c"
+#line 549 "griby.y"
+        { (grib_yyval.act) = grib_action_create_template(grib_parser_context,0,(grib_yyvsp[-1].str),(grib_yyvsp[0].str)); free((grib_yyvsp[-1].str)); free((grib_yyvsp[0].str));}
+#line 2925 "y.tab.c"
     break;
 
   case 109:
 #line 551 "griby.y"
-        { (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str),NULL,(grib_yyvsp[0].lval));  free((grib_yyvsp[-3].str)); free((grib_yyvsp[-1].str)); }
-#line 2936 "y.tab.c"
+    { (grib_yyval.act) = grib_action_create_template(grib_parser_context,1,(grib_yyvsp[-1].str),(grib_yyvsp[0].str)); free((grib_yyvsp[-1].str)); free((grib_yyvsp[0].str));}
+#line 2931 "y.tab.c"
     break;
 
   case 110:
 #line 554 "griby.y"
-        { (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[0].str),NULL,NULL,0);  free((grib_yyvsp[0].str)); }
-#line 2942 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str),NULL,(grib_yyvsp[0].lval));  free((grib_yyvsp[-3].str)); free((grib_yyvsp[-1].str)); }
+#line 2937 "y.tab.c"
     break;
 
   case 111:
 #line 557 "griby.y"
-        {
-         (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str),(grib_yyvsp[-5].str),(grib_yyvsp[0].lval));  free((grib_yyvsp[-5].str)); free((grib_yyvsp[-3].str)); free((grib_yyvsp[-1].str));
-    }
-#line 2950 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[0].str),NULL,NULL,0);  free((grib_yyvsp[0].str)); }
+#line 2943 "y.tab.c"
     break;
 
   case 112:
-#line 561 "griby.y"
+#line 560 "griby.y"
         {
-         (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[0].str),NULL,(grib_yyvsp[-2].str),0);  free((grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); 
+         (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str),(grib_yyvsp[-5].str),(grib_yyvsp[0].lval));  free((grib_yyvsp[-5].str)); free((grib_yyvsp[-3].str)); free((grib_yyvsp[-1].str));
     }
-#line 2958 "y.tab.c"
+#line 2951 "y.tab.c"
     break;
 
   case 113:
-#line 565 "griby.y"
-        { (grib_yyval.act) = grib_action_create_meta(grib_parser_context,(grib_yyvsp[-6].str),(grib_yyvsp[-5].str),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL); free((grib_yyvsp[-6].str));free((grib_yyvsp[-5].str));}
-#line 2964 "y.tab.c"
+#line 564 "griby.y"
+        {
+         (grib_yyval.act) = grib_action_create_alias(grib_parser_context,(grib_yyvsp[0].str),NULL,(grib_yyvsp[-2].str),0);  free((grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); 
+    }
+#line 2959 "y.tab.c"
     break;
 
   case 114:
 #line 568 "griby.y"
-    { (grib_yyval.act) = grib_action_create_meta(grib_parser_context,(grib_yyvsp[-6].str),(grib_yyvsp[-5].str),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-8].str)); free((grib_yyvsp[-6].str));free((grib_yyvsp[-5].str));free((grib_yyvsp[-8].str));}
-#line 2970 "y.tab.c"
+        { (grib_yyval.act) = grib_action_create_meta(grib_parser_context,(grib_yyvsp[-6].str),(grib_yyvsp[-5].str),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),NULL); free((grib_yyvsp[-6].str));free((grib_yyvsp[-5].str));}
+#line 2965 "y.tab.c"
     break;
 
   case 115:
 #line 571 "griby.y"
+    { (grib_yyval.act) = grib_action_create_meta(grib_parser_context,(grib_yyvsp[-6].str),(grib_yyvsp[-5].str),(grib_yyvsp[-3].explist),(grib_yyvsp[-1].explist),(grib_yyvsp[0].lval),(grib_yyvsp[-8].str)); free((grib_yyvsp[-6].str));free((grib_yyvsp[-5].str));free((grib_yyvsp[-8].str));}
+#line 2971 "y.tab.c"
+    break;
+
+  case 116:
+#line 574 "griby.y"
         {
       grib_arguments* a = grib_arguments_new(
         grib_parser_context,
@@ -2982,11 +2983,11 @@ grib_yyreduce:
       "ITERATOR","iterator",a,NULL,
       GRIB_ACCESSOR_FLAG_HIDDEN|GRIB_ACCESSOR_FLAG_READ_ONLY,NULL); free((grib_yyvsp[-3].str));
     }
-#line 2986 "y.tab.c"
+#line 2987 "y.tab.c"
     break;
 
-  case 116:
-#line 583 "griby.y"
+  case 117:
+#line 586 "griby.y"
         {
       grib_arguments* a = grib_arguments_new(
         grib_parser_context,
@@ -2998,11 +2999,11 @@ grib_yyreduce:
       "NEAREST","nearest",a,NULL,
       GRIB_ACCESSOR_FLAG_HIDDEN|GRIB_ACCESSOR_FLAG_READ_ONLY,NULL); free((grib_yyvsp[-3].str));
     }
-#line 3002 "y.tab.c"
+#line 3003 "y.tab.c"
     break;
 
-  case 117:
-#line 595 "griby.y"
+  case 118:
+#line 598 "griby.y"
         {
       grib_arguments* a = grib_arguments_new(
         grib_parser_context,
@@ -3014,809 +3015,816 @@ grib_yyreduce:
       "BOX","box",a,NULL,
       GRIB_ACCESSOR_FLAG_HIDDEN|GRIB_ACCESSOR_FLAG_READ_ONLY,NULL); free((grib_yyvsp[-3].str));
     }
-#line 3018 "y.tab.c"
-    break;
-
-  case 118:
-#line 607 "griby.y"
-       { (grib_yyval.act) = grib_action_create_put(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].explist));free((grib_yyvsp[-3].str));}
-#line 3024 "y.tab.c"
+#line 3019 "y.tab.c"
     break;
 
   case 119:
 #line 610 "griby.y"
-       { (grib_yyval.act) = grib_action_create_remove(grib_parser_context,(grib_yyvsp[0].explist));}
-#line 3030 "y.tab.c"
+       { (grib_yyval.act) = grib_action_create_put(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].explist));free((grib_yyvsp[-3].str));}
+#line 3025 "y.tab.c"
     break;
 
   case 120:
-#line 612 "griby.y"
-                                     { (grib_yyval.act) = grib_action_create_rename(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str));free((grib_yyvsp[-3].str));free((grib_yyvsp[-1].str));}
-#line 3036 "y.tab.c"
+#line 613 "griby.y"
+       { (grib_yyval.act) = grib_action_create_remove(grib_parser_context,(grib_yyvsp[0].explist));}
+#line 3031 "y.tab.c"
     break;
 
   case 121:
 #line 615 "griby.y"
-       { (grib_yyval.act) = grib_action_create_assert(grib_parser_context,(grib_yyvsp[-1].exp));}
-#line 3042 "y.tab.c"
+                                     { (grib_yyval.act) = grib_action_create_rename(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str));free((grib_yyvsp[-3].str));free((grib_yyvsp[-1].str));}
+#line 3037 "y.tab.c"
     break;
 
   case 122:
 #line 618 "griby.y"
-       { (grib_yyval.act) = grib_action_create_modify(grib_parser_context,(grib_yyvsp[-1].str),(grib_yyvsp[0].lval)); free((grib_yyvsp[-1].str));}
-#line 3048 "y.tab.c"
+       { (grib_yyval.act) = grib_action_create_assert(grib_parser_context,(grib_yyvsp[-1].exp));}
+#line 3043 "y.tab.c"
     break;
 
   case 123:
-#line 620 "griby.y"
-                          { (grib_yyval.act) = grib_action_create_set_missing(grib_parser_context,(grib_yyvsp[-2].str)); free((grib_yyvsp[-2].str)); }
-#line 3054 "y.tab.c"
+#line 621 "griby.y"
+       { (grib_yyval.act) = grib_action_create_modify(grib_parser_context,(grib_yyvsp[-1].str),(grib_yyvsp[0].lval)); free((grib_yyvsp[-1].str));}
+#line 3049 "y.tab.c"
     break;
 
   case 124:
-#line 621 "griby.y"
-                             { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),0); free((grib_yyvsp[-2].str)); }
-#line 3060 "y.tab.c"
+#line 623 "griby.y"
+                          { (grib_yyval.act) = grib_action_create_set_missing(grib_parser_context,(grib_yyvsp[-2].str)); free((grib_yyvsp[-2].str)); }
+#line 3055 "y.tab.c"
     break;
 
   case 125:
-#line 622 "griby.y"
-                                  { (grib_yyval.act) = grib_action_create_set_darray(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].dvalue)); free((grib_yyvsp[-4].str)); }
-#line 3066 "y.tab.c"
+#line 624 "griby.y"
+                             { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),0); free((grib_yyvsp[-2].str)); }
+#line 3061 "y.tab.c"
     break;
 
   case 126:
-#line 623 "griby.y"
-                                  { (grib_yyval.act) = grib_action_create_set_sarray(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].svalue)); free((grib_yyvsp[-4].str)); }
-#line 3072 "y.tab.c"
+#line 625 "griby.y"
+                                  { (grib_yyval.act) = grib_action_create_set_darray(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].dvalue)); free((grib_yyvsp[-4].str)); }
+#line 3067 "y.tab.c"
     break;
 
   case 127:
-#line 625 "griby.y"
-                                    { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),1); free((grib_yyvsp[-2].str)); }
-#line 3078 "y.tab.c"
+#line 626 "griby.y"
+                                  { (grib_yyval.act) = grib_action_create_set_sarray(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].svalue)); free((grib_yyvsp[-4].str)); }
+#line 3073 "y.tab.c"
     break;
 
   case 128:
 #line 628 "griby.y"
-                 { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),0,0); free((grib_yyvsp[0].str));}
-#line 3084 "y.tab.c"
+                                    { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),1); free((grib_yyvsp[-2].str)); }
+#line 3079 "y.tab.c"
     break;
 
   case 129:
-#line 629 "griby.y"
-          { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",0,0); }
-#line 3090 "y.tab.c"
+#line 631 "griby.y"
+                 { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),0,0); free((grib_yyvsp[0].str));}
+#line 3085 "y.tab.c"
     break;
 
   case 130:
-#line 630 "griby.y"
-                                 { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),0,(grib_yyvsp[-2].lval)); free((grib_yyvsp[0].str));}
-#line 3096 "y.tab.c"
+#line 632 "griby.y"
+          { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",0,0); }
+#line 3091 "y.tab.c"
     break;
 
   case 131:
-#line 631 "griby.y"
-                          { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",0,(grib_yyvsp[-1].lval)); }
-#line 3102 "y.tab.c"
+#line 633 "griby.y"
+                                 { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),0,(grib_yyvsp[-2].lval)); free((grib_yyvsp[0].str));}
+#line 3097 "y.tab.c"
     break;
 
   case 132:
-#line 632 "griby.y"
-                  { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),1,0); free((grib_yyvsp[0].str));}
-#line 3108 "y.tab.c"
+#line 634 "griby.y"
+                          { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",0,(grib_yyvsp[-1].lval)); }
+#line 3103 "y.tab.c"
     break;
 
   case 133:
-#line 633 "griby.y"
-           { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",1,0); }
-#line 3114 "y.tab.c"
+#line 635 "griby.y"
+                  { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),1,0); free((grib_yyvsp[0].str));}
+#line 3109 "y.tab.c"
     break;
 
   case 134:
-#line 634 "griby.y"
-                                  { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),1,(grib_yyvsp[-2].lval)); free((grib_yyvsp[0].str));}
-#line 3120 "y.tab.c"
+#line 636 "griby.y"
+           { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",1,0); }
+#line 3115 "y.tab.c"
     break;
 
   case 135:
-#line 635 "griby.y"
-                           { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",1,(grib_yyvsp[-1].lval)); }
-#line 3126 "y.tab.c"
+#line 637 "griby.y"
+                                  { (grib_yyval.act) = grib_action_create_write(grib_parser_context,(grib_yyvsp[0].str),1,(grib_yyvsp[-2].lval)); free((grib_yyvsp[0].str));}
+#line 3121 "y.tab.c"
     break;
 
   case 136:
-#line 637 "griby.y"
-                        { (grib_yyval.act) = grib_action_create_close(grib_parser_context,(grib_yyvsp[-1].str)); free((grib_yyvsp[-1].str));}
-#line 3132 "y.tab.c"
+#line 638 "griby.y"
+                           { (grib_yyval.act) = grib_action_create_write(grib_parser_context,"",1,(grib_yyvsp[-1].lval)); }
+#line 3127 "y.tab.c"
     break;
 
   case 137:
-#line 638 "griby.y"
-                 { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),0); free((grib_yyvsp[0].str)); }
-#line 3138 "y.tab.c"
+#line 640 "griby.y"
+                        { (grib_yyval.act) = grib_action_create_close(grib_parser_context,(grib_yyvsp[-1].str)); free((grib_yyvsp[-1].str));}
+#line 3133 "y.tab.c"
     break;
 
   case 138:
-#line 639 "griby.y"
-                                { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),(grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); free((grib_yyvsp[-2].str));}
-#line 3144 "y.tab.c"
+#line 641 "griby.y"
+                 { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),0); free((grib_yyvsp[0].str)); }
+#line 3139 "y.tab.c"
     break;
 
   case 139:
-#line 640 "griby.y"
-                               { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),(grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); free((grib_yyvsp[-2].str));}
-#line 3150 "y.tab.c"
+#line 642 "griby.y"
+                                { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),(grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); free((grib_yyvsp[-2].str));}
+#line 3145 "y.tab.c"
     break;
 
   case 140:
-#line 641 "griby.y"
-          { (grib_yyval.act) = grib_action_create_print(grib_parser_context,"",0);  }
-#line 3156 "y.tab.c"
+#line 643 "griby.y"
+                               { (grib_yyval.act) = grib_action_create_print(grib_parser_context,(grib_yyvsp[0].str),(grib_yyvsp[-2].str)); free((grib_yyvsp[0].str)); free((grib_yyvsp[-2].str));}
+#line 3151 "y.tab.c"
     break;
 
   case 141:
-#line 645 "griby.y"
-                                             { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),0,0,grib_yylineno,file_being_parsed()); }
-#line 3162 "y.tab.c"
+#line 644 "griby.y"
+          { (grib_yyval.act) = grib_action_create_print(grib_parser_context,"",0);  }
+#line 3157 "y.tab.c"
     break;
 
   case 142:
-#line 646 "griby.y"
-                                                                        { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act),0,grib_yylineno,file_being_parsed()); }
-#line 3168 "y.tab.c"
+#line 648 "griby.y"
+                                             { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),0,0,grib_yylineno,file_being_parsed()); }
+#line 3163 "y.tab.c"
     break;
 
   case 143:
-#line 647 "griby.y"
-                                                       { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),0,1,grib_yylineno,file_being_parsed()); }
-#line 3174 "y.tab.c"
+#line 649 "griby.y"
+                                                                        { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act),0,grib_yylineno,file_being_parsed()); }
+#line 3169 "y.tab.c"
     break;
 
   case 144:
-#line 648 "griby.y"
-                                                                                  { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act),1,grib_yylineno,file_being_parsed()); }
-#line 3180 "y.tab.c"
+#line 650 "griby.y"
+                                                       { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),0,1,grib_yylineno,file_being_parsed()); }
+#line 3175 "y.tab.c"
     break;
 
   case 145:
-#line 652 "griby.y"
-                                     { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-3].exp),(grib_yyvsp[-1].act),NULL); }
-#line 3186 "y.tab.c"
+#line 651 "griby.y"
+                                                                                  { (grib_yyval.act) = grib_action_create_if(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act),1,grib_yylineno,file_being_parsed()); }
+#line 3181 "y.tab.c"
     break;
 
   case 146:
-#line 653 "griby.y"
-                                               { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),NULL); }
-#line 3192 "y.tab.c"
+#line 655 "griby.y"
+                                     { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-3].exp),(grib_yyvsp[-1].act),NULL); }
+#line 3187 "y.tab.c"
     break;
 
   case 147:
-#line 654 "griby.y"
-                                                                   { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act)); }
-#line 3198 "y.tab.c"
+#line 656 "griby.y"
+                                               { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act),NULL); }
+#line 3193 "y.tab.c"
     break;
 
   case 148:
 #line 657 "griby.y"
-                               { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),0); free((grib_yyvsp[-2].str)); }
-#line 3204 "y.tab.c"
+                                                                   { (grib_yyval.act) = grib_action_create_when(grib_parser_context,(grib_yyvsp[-8].exp),(grib_yyvsp[-5].act),(grib_yyvsp[-1].act)); }
+#line 3199 "y.tab.c"
     break;
 
   case 149:
-#line 658 "griby.y"
-                                    { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),1); free((grib_yyvsp[-2].str)); }
-#line 3210 "y.tab.c"
+#line 660 "griby.y"
+                               { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),0); free((grib_yyvsp[-2].str)); }
+#line 3205 "y.tab.c"
     break;
 
-  case 151:
-#line 662 "griby.y"
-                             { (grib_yyvsp[-2].act)->next = (grib_yyvsp[-1].act); (grib_yyval.act) = (grib_yyvsp[-2].act); }
-#line 3216 "y.tab.c"
+  case 150:
+#line 661 "griby.y"
+                                    { (grib_yyval.act) = grib_action_create_set(grib_parser_context,(grib_yyvsp[-2].str),(grib_yyvsp[0].exp),1); free((grib_yyvsp[-2].str)); }
+#line 3211 "y.tab.c"
     break;
 
   case 152:
-#line 666 "griby.y"
-                { (grib_yyval.explist) = NULL ;}
-#line 3222 "y.tab.c"
+#line 665 "griby.y"
+                             { (grib_yyvsp[-2].act)->next = (grib_yyvsp[-1].act); (grib_yyval.act) = (grib_yyvsp[-2].act); }
+#line 3217 "y.tab.c"
     break;
 
   case 153:
-#line 667 "griby.y"
-                       { (grib_yyval.explist) = (grib_yyvsp[0].explist) ;}
-#line 3228 "y.tab.c"
+#line 669 "griby.y"
+                { (grib_yyval.explist) = NULL ;}
+#line 3223 "y.tab.c"
     break;
 
   case 154:
 #line 670 "griby.y"
-                      { (grib_yyval.lval) = 0 ; }
-#line 3234 "y.tab.c"
+                       { (grib_yyval.explist) = (grib_yyvsp[0].explist) ;}
+#line 3229 "y.tab.c"
     break;
 
   case 155:
-#line 671 "griby.y"
-                      { (grib_yyval.lval) = (grib_yyvsp[0].lval); }
-#line 3240 "y.tab.c"
+#line 673 "griby.y"
+                      { (grib_yyval.lval) = 0 ; }
+#line 3235 "y.tab.c"
     break;
 
-  case 157:
-#line 675 "griby.y"
-                        { (grib_yyval.lval) = (grib_yyvsp[-2].lval) | (grib_yyvsp[0].lval); }
-#line 3246 "y.tab.c"
+  case 156:
+#line 674 "griby.y"
+                      { (grib_yyval.lval) = (grib_yyvsp[0].lval); }
+#line 3241 "y.tab.c"
     break;
 
   case 158:
 #line 678 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_READ_ONLY; }
-#line 3252 "y.tab.c"
+                        { (grib_yyval.lval) = (grib_yyvsp[-2].lval) | (grib_yyvsp[0].lval); }
+#line 3247 "y.tab.c"
     break;
 
   case 159:
-#line 679 "griby.y"
-                           { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_LOWERCASE; }
-#line 3258 "y.tab.c"
+#line 681 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_READ_ONLY; }
+#line 3253 "y.tab.c"
     break;
 
   case 160:
-#line 680 "griby.y"
-                      { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_DUMP; }
-#line 3264 "y.tab.c"
+#line 682 "griby.y"
+                           { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_LOWERCASE; }
+#line 3259 "y.tab.c"
     break;
 
   case 161:
-#line 681 "griby.y"
-                         { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_NO_COPY; }
-#line 3270 "y.tab.c"
+#line 683 "griby.y"
+                      { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_DUMP; }
+#line 3265 "y.tab.c"
     break;
 
   case 162:
-#line 682 "griby.y"
-                               { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_NO_FAIL; }
-#line 3276 "y.tab.c"
+#line 684 "griby.y"
+                         { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_NO_COPY; }
+#line 3271 "y.tab.c"
     break;
 
   case 163:
-#line 683 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_HIDDEN; }
-#line 3282 "y.tab.c"
+#line 685 "griby.y"
+                               { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_NO_FAIL; }
+#line 3277 "y.tab.c"
     break;
 
   case 164:
-#line 684 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_EDITION_SPECIFIC; }
-#line 3288 "y.tab.c"
+#line 686 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_HIDDEN; }
+#line 3283 "y.tab.c"
     break;
 
   case 165:
-#line 685 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_CAN_BE_MISSING; }
-#line 3294 "y.tab.c"
+#line 687 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_EDITION_SPECIFIC; }
+#line 3289 "y.tab.c"
     break;
 
   case 166:
-#line 686 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_CONSTRAINT; }
-#line 3300 "y.tab.c"
+#line 688 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_CAN_BE_MISSING; }
+#line 3295 "y.tab.c"
     break;
 
   case 167:
-#line 687 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_COPY_OK; }
-#line 3306 "y.tab.c"
+#line 689 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_CONSTRAINT; }
+#line 3301 "y.tab.c"
     break;
 
   case 168:
-#line 688 "griby.y"
-                    { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_TRANSIENT; }
-#line 3312 "y.tab.c"
+#line 690 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_COPY_OK; }
+#line 3307 "y.tab.c"
     break;
 
   case 169:
-#line 689 "griby.y"
-                          { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_STRING_TYPE; }
-#line 3318 "y.tab.c"
+#line 691 "griby.y"
+                    { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_TRANSIENT; }
+#line 3313 "y.tab.c"
     break;
 
   case 170:
-#line 690 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_LONG_TYPE; }
-#line 3324 "y.tab.c"
+#line 692 "griby.y"
+                          { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_STRING_TYPE; }
+#line 3319 "y.tab.c"
     break;
 
   case 171:
-#line 691 "griby.y"
-                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_DOUBLE_TYPE; }
-#line 3330 "y.tab.c"
+#line 693 "griby.y"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_LONG_TYPE; }
+#line 3325 "y.tab.c"
     break;
 
   case 172:
 #line 694 "griby.y"
-                                                                { (grib_yyval.act) = grib_action_create_list(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act)); free((grib_yyvsp[-7].str)); }
-#line 3336 "y.tab.c"
+                        { (grib_yyval.lval) = GRIB_ACCESSOR_FLAG_DOUBLE_TYPE; }
+#line 3331 "y.tab.c"
     break;
 
   case 173:
 #line 697 "griby.y"
-                                                            { (grib_yyval.act) = grib_action_create_while(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act));  }
-#line 3342 "y.tab.c"
+                                                                { (grib_yyval.act) = grib_action_create_list(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act)); free((grib_yyvsp[-7].str)); }
+#line 3337 "y.tab.c"
     break;
 
   case 174:
 #line 700 "griby.y"
-                                                                   { (grib_yyval.act) = grib_action_create_trigger(grib_parser_context,(grib_yyvsp[-4].explist),(grib_yyvsp[-1].act));  }
-#line 3348 "y.tab.c"
+                                                            { (grib_yyval.act) = grib_action_create_while(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].act));  }
+#line 3343 "y.tab.c"
     break;
 
   case 175:
 #line 703 "griby.y"
-                                                         { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,0,0,0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-4].str)); }
-#line 3354 "y.tab.c"
+                        { (grib_yyval.act) = grib_action_create_include(grib_parser_context,(grib_yyvsp[0].str)); free((grib_yyvsp[0].str));
+                            if (!(grib_yyval.act)) { grib_yyerror("Cannot include file"); YYABORT; } }
+#line 3350 "y.tab.c"
     break;
 
   case 176:
-#line 704 "griby.y"
-                                                            { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,0,(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
-#line 3360 "y.tab.c"
+#line 707 "griby.y"
+                                                                   { (grib_yyval.act) = grib_action_create_trigger(grib_parser_context,(grib_yyvsp[-4].explist),(grib_yyvsp[-1].act));  }
+#line 3356 "y.tab.c"
     break;
 
   case 177:
-#line 705 "griby.y"
-                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),0,(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
-#line 3366 "y.tab.c"
+#line 710 "griby.y"
+                                                         { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,0,0,0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-4].str)); }
+#line 3362 "y.tab.c"
     break;
 
   case 178:
-#line 706 "griby.y"
-                                                                                { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-12].str),0,(grib_yyvsp[-8].str),0,(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-12].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
-#line 3372 "y.tab.c"
+#line 711 "griby.y"
+                                                            { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,0,(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
+#line 3368 "y.tab.c"
     break;
 
   case 179:
-#line 707 "griby.y"
-                                                            { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); }
-#line 3378 "y.tab.c"
+#line 712 "griby.y"
+                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),0,(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
+#line 3374 "y.tab.c"
     break;
 
   case 180:
-#line 708 "griby.y"
-                                                                                { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-12].str),(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str)); free((grib_yyvsp[-2].str)); free((grib_yyvsp[-12].str));}
-#line 3384 "y.tab.c"
+#line 713 "griby.y"
+                                                                                { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-12].str),0,(grib_yyvsp[-8].str),0,(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-12].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
+#line 3380 "y.tab.c"
     break;
 
   case 181:
-#line 709 "griby.y"
-                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-10].str));}
-#line 3390 "y.tab.c"
+#line 714 "griby.y"
+                                                            { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); }
+#line 3386 "y.tab.c"
     break;
 
   case 182:
-#line 710 "griby.y"
-                                                        { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-6].str),0,0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str)); }
-#line 3396 "y.tab.c"
+#line 715 "griby.y"
+                                                                                { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-12].str),(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str)); free((grib_yyvsp[-2].str)); free((grib_yyvsp[-12].str));}
+#line 3392 "y.tab.c"
     break;
 
   case 183:
-#line 711 "griby.y"
-                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-9].str),(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-9].str));free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
-#line 3402 "y.tab.c"
+#line 716 "griby.y"
+                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-10].str));}
+#line 3398 "y.tab.c"
     break;
 
   case 184:
-#line 712 "griby.y"
-                                                    { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,0,0,0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-4].str)); }
-#line 3408 "y.tab.c"
+#line 717 "griby.y"
+                                                        { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-6].str),0,0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str)); }
+#line 3404 "y.tab.c"
     break;
 
   case 185:
-#line 713 "griby.y"
-                                                                   { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,0,(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
-#line 3414 "y.tab.c"
+#line 718 "griby.y"
+                                                                      { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-9].str),(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-9].str));free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
+#line 3410 "y.tab.c"
     break;
 
   case 186:
-#line 714 "griby.y"
-                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),0,(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
-#line 3420 "y.tab.c"
+#line 719 "griby.y"
+                                                    { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,0,0,0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-4].str)); }
+#line 3416 "y.tab.c"
     break;
 
   case 187:
-#line 715 "griby.y"
-                                                                   { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); }
-#line 3426 "y.tab.c"
+#line 720 "griby.y"
+                                                                   { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,0,(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
+#line 3422 "y.tab.c"
     break;
 
   case 188:
-#line 716 "griby.y"
-                                                                                       { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-12].str),(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-12].str));}
-#line 3432 "y.tab.c"
+#line 721 "griby.y"
+                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),0,(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
+#line 3428 "y.tab.c"
     break;
 
   case 189:
-#line 717 "griby.y"
-                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-10].str));}
-#line 3438 "y.tab.c"
+#line 722 "griby.y"
+                                                                   { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); }
+#line 3434 "y.tab.c"
     break;
 
   case 190:
-#line 718 "griby.y"
-                                                               { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-6].str),0,0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str)); }
-#line 3444 "y.tab.c"
+#line 723 "griby.y"
+                                                                                       { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),(grib_yyvsp[-12].str),(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-12].str));}
+#line 3440 "y.tab.c"
     break;
 
   case 191:
-#line 719 "griby.y"
-                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-9].str),(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-9].str));free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
-#line 3450 "y.tab.c"
+#line 724 "griby.y"
+                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-8].str),0,(grib_yyvsp[-4].str),(grib_yyvsp[-10].str),(grib_yyvsp[-6].str),(grib_yyvsp[-2].str),0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-2].str)); free((grib_yyvsp[-10].str));}
+#line 3446 "y.tab.c"
+    break;
+
+  case 192:
+#line 725 "griby.y"
+                                                               { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-6].str),0,0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-6].str));free((grib_yyvsp[-4].str)); }
+#line 3452 "y.tab.c"
     break;
 
   case 193:
-#line 724 "griby.y"
-                                          { (grib_yyval.concept_value) = (grib_yyvsp[0].concept_value); (grib_yyvsp[0].concept_value)->next = (grib_yyvsp[-1].concept_value);   }
-#line 3456 "y.tab.c"
+#line 726 "griby.y"
+                                                                             { (grib_yyval.act) = grib_action_create_concept(grib_parser_context,(grib_yyvsp[-7].str),(grib_yyvsp[-2].concept_value),0,(grib_yyvsp[-9].str),(grib_yyvsp[-5].str),0,0,0,(grib_yyvsp[0].lval),1);  free((grib_yyvsp[-9].str));free((grib_yyvsp[-7].str));free((grib_yyvsp[-5].str)); }
+#line 3458 "y.tab.c"
     break;
 
   case 195:
-#line 728 "griby.y"
+#line 731 "griby.y"
+                                          { (grib_yyval.concept_value) = (grib_yyvsp[0].concept_value); (grib_yyvsp[0].concept_value)->next = (grib_yyvsp[-1].concept_value);   }
+#line 3464 "y.tab.c"
+    break;
+
+  case 197:
+#line 735 "griby.y"
                                                 { (grib_yyval.hash_array_value) = (grib_yyvsp[0].hash_array_value); (grib_yyvsp[0].hash_array_value)->next = (grib_yyvsp[-1].hash_array_value);   }
-#line 3462 "y.tab.c"
+#line 3470 "y.tab.c"
     break;
 
-  case 196:
-#line 731 "griby.y"
+  case 198:
+#line 738 "griby.y"
                                                                   { (grib_yyval.act) = grib_action_create_hash_array(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-2].hash_array_value),0,0,0,0,0,0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-4].str)); }
-#line 3468 "y.tab.c"
+#line 3476 "y.tab.c"
     break;
 
-  case 197:
-#line 732 "griby.y"
+  case 199:
+#line 739 "griby.y"
                                                                          { (grib_yyval.act) = grib_action_create_hash_array(grib_parser_context,(grib_yyvsp[-10].str),0,(grib_yyvsp[-6].str),0,(grib_yyvsp[-8].str),(grib_yyvsp[-4].str),(grib_yyvsp[-2].str),0,(grib_yyvsp[0].lval),0);  free((grib_yyvsp[-10].str));free((grib_yyvsp[-6].str));free((grib_yyvsp[-8].str));free((grib_yyvsp[-4].str));free((grib_yyvsp[-2].str)); }
-#line 3474 "y.tab.c"
+#line 3482 "y.tab.c"
     break;
 
-  case 199:
-#line 736 "griby.y"
+  case 201:
+#line 743 "griby.y"
                                     { (grib_yyval.case_value) = (grib_yyvsp[0].case_value); (grib_yyvsp[0].case_value)->next = (grib_yyvsp[-1].case_value);   }
-#line 3480 "y.tab.c"
+#line 3488 "y.tab.c"
     break;
 
-  case 200:
-#line 739 "griby.y"
+  case 202:
+#line 746 "griby.y"
                                                { (grib_yyval.case_value) = grib_case_new(grib_parser_context,(grib_yyvsp[-2].explist),(grib_yyvsp[0].act));  }
-#line 3486 "y.tab.c"
+#line 3494 "y.tab.c"
     break;
 
-  case 201:
-#line 743 "griby.y"
+  case 203:
+#line 750 "griby.y"
                                                                            { (grib_yyval.act) = grib_action_create_switch(grib_parser_context,(grib_yyvsp[-7].explist),(grib_yyvsp[-4].case_value),(grib_yyvsp[-1].act)); }
-#line 3492 "y.tab.c"
+#line 3500 "y.tab.c"
     break;
 
-  case 202:
-#line 744 "griby.y"
+  case 204:
+#line 751 "griby.y"
                                                                { (grib_yyval.act) = grib_action_create_switch(grib_parser_context,(grib_yyvsp[-6].explist),(grib_yyvsp[-3].case_value),grib_action_create_noop(grib_parser_context,"continue")); }
-#line 3498 "y.tab.c"
+#line 3506 "y.tab.c"
     break;
 
-  case 203:
-#line 745 "griby.y"
+  case 205:
+#line 752 "griby.y"
                                                    { (grib_yyval.act) = grib_action_create_switch(grib_parser_context,(grib_yyvsp[-4].explist),(grib_yyvsp[-1].case_value),0); }
-#line 3504 "y.tab.c"
+#line 3512 "y.tab.c"
     break;
 
-  case 204:
-#line 748 "griby.y"
+  case 206:
+#line 755 "griby.y"
                                                          {
 	  				(grib_yyval.concept_value) = grib_concept_value_new(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].concept_condition)); free((grib_yyvsp[-4].str));}
-#line 3511 "y.tab.c"
+#line 3519 "y.tab.c"
     break;
 
-  case 205:
-#line 750 "griby.y"
+  case 207:
+#line 757 "griby.y"
                                                                        {
 	  				(grib_yyval.concept_value) = grib_concept_value_new(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].concept_condition)); free((grib_yyvsp[-4].str));}
-#line 3518 "y.tab.c"
+#line 3526 "y.tab.c"
     break;
 
-  case 206:
-#line 752 "griby.y"
+  case 208:
+#line 759 "griby.y"
                                                                          {
 					char buf[80]; sprintf(buf,"%ld",(long)(grib_yyvsp[-4].lval)); (grib_yyval.concept_value) = grib_concept_value_new(grib_parser_context,buf,(grib_yyvsp[-1].concept_condition));}
-#line 3525 "y.tab.c"
+#line 3533 "y.tab.c"
     break;
 
-  case 207:
-#line 754 "griby.y"
+  case 209:
+#line 761 "griby.y"
                                                                        {
 					char buf[80]; sprintf(buf,"%g",(double)(grib_yyvsp[-4].dval)); (grib_yyval.concept_value) = grib_concept_value_new(grib_parser_context,buf,(grib_yyvsp[-1].concept_condition));}
-#line 3532 "y.tab.c"
+#line 3540 "y.tab.c"
     break;
 
-  case 209:
-#line 759 "griby.y"
+  case 211:
+#line 766 "griby.y"
                                                        { (grib_yyvsp[-1].concept_condition)->next = (grib_yyvsp[0].concept_condition); (grib_yyval.concept_condition) = (grib_yyvsp[-1].concept_condition); }
-#line 3538 "y.tab.c"
+#line 3546 "y.tab.c"
     break;
 
-  case 210:
-#line 762 "griby.y"
+  case 212:
+#line 769 "griby.y"
                                                { (grib_yyval.concept_condition) = grib_concept_condition_new(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].exp),0); free((grib_yyvsp[-3].str)); }
-#line 3544 "y.tab.c"
+#line 3552 "y.tab.c"
     break;
 
-  case 211:
-#line 763 "griby.y"
+  case 213:
+#line 770 "griby.y"
                                                { (grib_yyval.concept_condition) = grib_concept_condition_new(grib_parser_context,(grib_yyvsp[-5].str),0,(grib_yyvsp[-2].ivalue)); free((grib_yyvsp[-5].str)); }
-#line 3550 "y.tab.c"
+#line 3558 "y.tab.c"
     break;
 
-  case 212:
-#line 767 "griby.y"
+  case 214:
+#line 774 "griby.y"
                                                      {
 	  				(grib_yyval.hash_array_value) = grib_integer_hash_array_value_new(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].ivalue)); free((grib_yyvsp[-4].str));}
-#line 3557 "y.tab.c"
+#line 3565 "y.tab.c"
     break;
 
-  case 213:
-#line 769 "griby.y"
+  case 215:
+#line 776 "griby.y"
                                                                   {
 	  				(grib_yyval.hash_array_value) = grib_integer_hash_array_value_new(grib_parser_context,(grib_yyvsp[-4].str),(grib_yyvsp[-1].ivalue)); free((grib_yyvsp[-4].str));}
-#line 3564 "y.tab.c"
+#line 3572 "y.tab.c"
     break;
 
-  case 214:
-#line 773 "griby.y"
+  case 216:
+#line 780 "griby.y"
                                                                 { (grib_yyval.exp) = new_accessor_expression(grib_parser_context,(grib_yyvsp[-5].str),(grib_yyvsp[-3].lval),(grib_yyvsp[-1].lval));  free((grib_yyvsp[-5].str)); }
-#line 3570 "y.tab.c"
+#line 3578 "y.tab.c"
     break;
 
-  case 215:
-#line 774 "griby.y"
+  case 217:
+#line 781 "griby.y"
                                                                           { (grib_yyval.exp) = new_accessor_expression(grib_parser_context,(grib_yyvsp[0].str),0,0); free((grib_yyvsp[0].str)); }
-#line 3576 "y.tab.c"
+#line 3584 "y.tab.c"
     break;
 
-  case 216:
-#line 775 "griby.y"
+  case 218:
+#line 782 "griby.y"
                                                                  { (grib_yyval.exp) = new_sub_string_expression(grib_parser_context,(grib_yyvsp[-5].str),(grib_yyvsp[-3].lval),(grib_yyvsp[-1].lval));  free((grib_yyvsp[-5].str)); }
-#line 3582 "y.tab.c"
+#line 3590 "y.tab.c"
     break;
 
-  case 217:
-#line 776 "griby.y"
+  case 219:
+#line 783 "griby.y"
                           { (grib_yyval.exp) = new_string_expression(grib_parser_context,(grib_yyvsp[0].str));  free((grib_yyvsp[0].str)); }
-#line 3588 "y.tab.c"
+#line 3596 "y.tab.c"
     break;
 
-  case 219:
-#line 780 "griby.y"
+  case 221:
+#line 787 "griby.y"
                 { (grib_yyval.exp) = new_long_expression(grib_parser_context,(grib_yyvsp[0].lval));  }
-#line 3594 "y.tab.c"
+#line 3602 "y.tab.c"
     break;
 
-  case 220:
-#line 781 "griby.y"
+  case 222:
+#line 788 "griby.y"
               { (grib_yyval.exp) = new_double_expression(grib_parser_context,(grib_yyvsp[0].dval));  /* TODO: change to new_float_expression*/}
-#line 3600 "y.tab.c"
+#line 3608 "y.tab.c"
     break;
 
-  case 221:
-#line 783 "griby.y"
+  case 223:
+#line 790 "griby.y"
               { (grib_yyval.exp) = NULL; }
-#line 3606 "y.tab.c"
+#line 3614 "y.tab.c"
     break;
 
-  case 222:
-#line 784 "griby.y"
+  case 224:
+#line 791 "griby.y"
                     { (grib_yyval.exp) = new_true_expression(grib_parser_context); }
-#line 3612 "y.tab.c"
+#line 3620 "y.tab.c"
     break;
 
-  case 223:
-#line 785 "griby.y"
+  case 225:
+#line 792 "griby.y"
                            { (grib_yyval.exp) = (grib_yyvsp[-1].exp); }
-#line 3618 "y.tab.c"
+#line 3626 "y.tab.c"
     break;
 
-  case 224:
-#line 786 "griby.y"
+  case 226:
+#line 793 "griby.y"
                  { (grib_yyval.exp) = new_unop_expression(grib_parser_context,&grib_op_neg,&grib_op_neg_d,(grib_yyvsp[0].exp)); }
-#line 3624 "y.tab.c"
+#line 3632 "y.tab.c"
     break;
 
-  case 225:
-#line 787 "griby.y"
+  case 227:
+#line 794 "griby.y"
                     { (grib_yyval.exp) = new_func_expression(grib_parser_context,(grib_yyvsp[-2].str),NULL); free((grib_yyvsp[-2].str));}
-#line 3630 "y.tab.c"
+#line 3638 "y.tab.c"
     break;
 
-  case 226:
-#line 788 "griby.y"
+  case 228:
+#line 795 "griby.y"
                                   { (grib_yyval.exp) = new_func_expression(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].explist)); free((grib_yyvsp[-3].str));}
-#line 3636 "y.tab.c"
+#line 3644 "y.tab.c"
     break;
 
-  case 227:
-#line 792 "griby.y"
+  case 229:
+#line 799 "griby.y"
                                     { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_pow,NULL,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3642 "y.tab.c"
+#line 3650 "y.tab.c"
     break;
 
-  case 229:
-#line 796 "griby.y"
+  case 231:
+#line 803 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_mul,&grib_op_mul_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3648 "y.tab.c"
+#line 3656 "y.tab.c"
     break;
 
-  case 230:
-#line 797 "griby.y"
+  case 232:
+#line 804 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_div,&grib_op_div_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3654 "y.tab.c"
+#line 3662 "y.tab.c"
     break;
 
-  case 231:
-#line 798 "griby.y"
+  case 233:
+#line 805 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_modulo,NULL,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3660 "y.tab.c"
+#line 3668 "y.tab.c"
     break;
 
-  case 232:
-#line 799 "griby.y"
+  case 234:
+#line 806 "griby.y"
                                   { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_bit,NULL,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3666 "y.tab.c"
+#line 3674 "y.tab.c"
     break;
 
-  case 233:
-#line 800 "griby.y"
+  case 235:
+#line 807 "griby.y"
                                   { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_bitoff,NULL,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3672 "y.tab.c"
+#line 3680 "y.tab.c"
     break;
 
-  case 235:
-#line 802 "griby.y"
+  case 237:
+#line 809 "griby.y"
                                    { (grib_yyval.exp) = new_length_expression(grib_parser_context,(grib_yyvsp[-1].str)); free((grib_yyvsp[-1].str));}
-#line 3678 "y.tab.c"
+#line 3686 "y.tab.c"
     break;
 
-  case 236:
-#line 803 "griby.y"
+  case 238:
+#line 810 "griby.y"
                                                   { (grib_yyval.exp) = new_is_in_list_expression(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str)); free((grib_yyvsp[-3].str));free((grib_yyvsp[-1].str));}
-#line 3684 "y.tab.c"
+#line 3692 "y.tab.c"
     break;
 
-  case 237:
-#line 804 "griby.y"
+  case 239:
+#line 811 "griby.y"
                                                   { (grib_yyval.exp) = new_is_in_dict_expression(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].str)); free((grib_yyvsp[-3].str));free((grib_yyvsp[-1].str));}
-#line 3690 "y.tab.c"
+#line 3698 "y.tab.c"
     break;
 
-  case 238:
-#line 805 "griby.y"
+  case 240:
+#line 812 "griby.y"
                                                    { (grib_yyval.exp) = new_is_integer_expression(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].lval),0); free((grib_yyvsp[-3].str));}
-#line 3696 "y.tab.c"
+#line 3704 "y.tab.c"
     break;
 
-  case 239:
-#line 806 "griby.y"
+  case 241:
+#line 813 "griby.y"
                                                                { (grib_yyval.exp) = new_is_integer_expression(grib_parser_context,(grib_yyvsp[-5].str),(grib_yyvsp[-3].lval),(grib_yyvsp[-1].lval)); free((grib_yyvsp[-5].str));}
-#line 3702 "y.tab.c"
+#line 3710 "y.tab.c"
     break;
 
-  case 240:
-#line 807 "griby.y"
+  case 242:
+#line 814 "griby.y"
                                        { (grib_yyval.exp) = new_is_integer_expression(grib_parser_context,(grib_yyvsp[-1].str),0,0); free((grib_yyvsp[-1].str));}
-#line 3708 "y.tab.c"
+#line 3716 "y.tab.c"
     break;
 
-  case 241:
-#line 810 "griby.y"
+  case 243:
+#line 817 "griby.y"
                                     { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_add,&grib_op_add_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3714 "y.tab.c"
+#line 3722 "y.tab.c"
     break;
 
-  case 242:
-#line 811 "griby.y"
+  case 244:
+#line 818 "griby.y"
                                     { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_sub,&grib_op_sub_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3720 "y.tab.c"
+#line 3728 "y.tab.c"
     break;
 
-  case 244:
-#line 815 "griby.y"
+  case 246:
+#line 822 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_gt,&grib_op_gt_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3726 "y.tab.c"
+#line 3734 "y.tab.c"
     break;
 
-  case 245:
-#line 817 "griby.y"
+  case 247:
+#line 824 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_eq,&grib_op_eq_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3732 "y.tab.c"
+#line 3740 "y.tab.c"
     break;
 
-  case 246:
-#line 818 "griby.y"
+  case 248:
+#line 825 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_lt,&grib_op_lt_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3738 "y.tab.c"
+#line 3746 "y.tab.c"
     break;
 
-  case 247:
-#line 819 "griby.y"
+  case 249:
+#line 826 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_ge,&grib_op_ge_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3744 "y.tab.c"
+#line 3752 "y.tab.c"
     break;
 
-  case 248:
-#line 820 "griby.y"
+  case 250:
+#line 827 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_le,&grib_op_le_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3750 "y.tab.c"
+#line 3758 "y.tab.c"
     break;
 
-  case 249:
-#line 821 "griby.y"
+  case 251:
+#line 828 "griby.y"
                                      { (grib_yyval.exp) = new_binop_expression(grib_parser_context,&grib_op_ne,&grib_op_ne_d,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3756 "y.tab.c"
+#line 3764 "y.tab.c"
     break;
 
-  case 250:
-#line 822 "griby.y"
+  case 252:
+#line 829 "griby.y"
                                                   { (grib_yyval.exp) = new_string_compare_expression(grib_parser_context,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3762 "y.tab.c"
+#line 3770 "y.tab.c"
     break;
 
-  case 251:
-#line 827 "griby.y"
+  case 253:
+#line 834 "griby.y"
                                       { (grib_yyval.exp) = new_unop_expression(grib_parser_context,&grib_op_not,NULL,(grib_yyvsp[0].exp)); }
-#line 3768 "y.tab.c"
+#line 3776 "y.tab.c"
     break;
 
-  case 253:
-#line 831 "griby.y"
+  case 255:
+#line 838 "griby.y"
                                         { (grib_yyval.exp) = new_logical_and_expression(grib_parser_context,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp)); }
-#line 3774 "y.tab.c"
+#line 3782 "y.tab.c"
     break;
 
-  case 255:
-#line 835 "griby.y"
+  case 257:
+#line 842 "griby.y"
                                             { (grib_yyval.exp) = new_logical_or_expression(grib_parser_context,(grib_yyvsp[-2].exp),(grib_yyvsp[0].exp));}
-#line 3780 "y.tab.c"
+#line 3788 "y.tab.c"
     break;
 
-  case 260:
-#line 849 "griby.y"
+  case 262:
+#line 856 "griby.y"
                                        { (grib_yyval.rule_entry) = grib_new_rule_entry(grib_parser_context,(grib_yyvsp[-3].str),(grib_yyvsp[-1].exp)); free((grib_yyvsp[-3].str)); }
-#line 3786 "y.tab.c"
+#line 3794 "y.tab.c"
     break;
 
-  case 261:
-#line 850 "griby.y"
+  case 263:
+#line 857 "griby.y"
                        { (grib_yyval.rule_entry) = grib_new_rule_entry(grib_parser_context,"skip",0);}
-#line 3792 "y.tab.c"
+#line 3800 "y.tab.c"
     break;
 
-  case 263:
-#line 854 "griby.y"
+  case 265:
+#line 861 "griby.y"
                                        { (grib_yyvsp[-1].rule_entry)->next = (grib_yyvsp[0].rule_entry); (grib_yyval.rule_entry) = (grib_yyvsp[-1].rule_entry); }
-#line 3798 "y.tab.c"
+#line 3806 "y.tab.c"
     break;
 
-  case 264:
-#line 857 "griby.y"
+  case 266:
+#line 864 "griby.y"
                   { (grib_yyval.rules) = grib_new_rule(grib_parser_context,NULL,(grib_yyvsp[0].rule_entry)); }
-#line 3804 "y.tab.c"
+#line 3812 "y.tab.c"
     break;
 
-  case 265:
-#line 861 "griby.y"
+  case 267:
+#line 868 "griby.y"
                                                              { (grib_yyval.rules) = grib_new_rule(grib_parser_context,(grib_yyvsp[-4].exp),(grib_yyvsp[-1].rule_entry)); }
-#line 3810 "y.tab.c"
+#line 3818 "y.tab.c"
     break;
 
-  case 267:
-#line 865 "griby.y"
+  case 269:
+#line 872 "griby.y"
                    { (grib_yyvsp[-1].rules)->next = (grib_yyvsp[0].rules); (grib_yyval.rules) = (grib_yyvsp[-1].rules); }
-#line 3816 "y.tab.c"
+#line 3824 "y.tab.c"
     break;
 
 
-#line 3820 "y.tab.c"
+#line 3828 "y.tab.c"
 
       default: break;
     }
@@ -4048,7 +4056,7 @@ grib_yyreturn:
 #endif
   return grib_yyresult;
 }
-#line 869 "griby.y"
+#line 876 "griby.y"
 
 
 static grib_concept_value *_reverse_concept(grib_concept_value *r,grib_concept_value *s)
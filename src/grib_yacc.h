@@ -58,121 +58,122 @@ extern int grib_yydebug;
     UNSIGNED = 264,
     TEMPLATE = 265,
     TEMPLATE_NOFAIL = 266,
-    TRIGGER = 267,
-    ASCII = 268,
-    GROUP = 269,
-    NON_ALPHA = 270,
-    KSEC1EXPVER = 271,
-    LABEL = 272,
-    LIST = 273,
-    IS_IN_LIST = 274,
-    IS_IN_DICT = 275,
-    IS_INTEGER = 276,
-    TO_INTEGER = 277,
-    TO_STRING = 278,
-    SEX2DEC = 279,
-    WHILE = 280,
-    IBMFLOAT = 281,
-    SIGNED = 282,
-    UINT8 = 283,
-    INT8 = 284,
-    UINT16 = 285,
-    INT16 = 286,
-    UINT16_LITTLE_ENDIAN = 287,
-    INT16_LITTLE_ENDIAN = 288,
-    UINT32 = 289,
-    INT32 = 290,
-    UINT32_LITTLE_ENDIAN = 291,
-    INT32_LITTLE_ENDIAN = 292,
-    UINT64 = 293,
-    INT64 = 294,
-    UINT64_LITTLE_ENDIAN = 295,
-    INT64_LITTLE_ENDIAN = 296,
-    BLOB = 297,
-    BYTE = 298,
-    CODETABLE = 299,
-    SMART_TABLE = 300,
-    DICTIONARY = 301,
-    COMPLEX_CODETABLE = 302,
-    LOOKUP = 303,
-    ALIAS = 304,
-    UNALIAS = 305,
-    META = 306,
-    POS = 307,
-    INTCONST = 308,
-    TRANS = 309,
-    FLAGBIT = 310,
-    CONCEPT = 311,
-    GETENV = 312,
-    HASH_ARRAY = 313,
-    CONCEPT_NOFAIL = 314,
-    NIL = 315,
-    DUMMY = 316,
-    MODIFY = 317,
-    READ_ONLY = 318,
-    STRING_TYPE = 319,
-    LONG_TYPE = 320,
-    DOUBLE_TYPE = 321,
-    NO_COPY = 322,
-    DUMP = 323,
-    JSON = 324,
-    XML = 325,
-    NO_FAIL = 326,
-    EDITION_SPECIFIC = 327,
-    OVERRIDE = 328,
-    HIDDEN = 329,
-    CAN_BE_MISSING = 330,
-    MISSING = 331,
-    CONSTRAINT = 332,
-    COPY_OK = 333,
-    WHEN = 334,
-    SET = 335,
-    SET_NOFAIL = 336,
-    WRITE = 337,
-    APPEND = 338,
-    PRINT = 339,
-    EXPORT = 340,
-    REMOVE = 341,
-    RENAME = 342,
-    SKIP = 343,
-    PAD = 344,
-    SECTION_PADDING = 345,
-    MESSAGE = 346,
-    MESSAGE_COPY = 347,
-    PADTO = 348,
-    PADTOEVEN = 349,
-    PADTOMULTIPLE = 350,
-    G1_HALF_BYTE = 351,
-    G1_MESSAGE_LENGTH = 352,
-    G1_SECTION4_LENGTH = 353,
-    SECTION_LENGTH = 354,
-    LENGTH = 355,
-    FLAG = 356,
-    ITERATOR = 357,
-    NEAREST = 358,
-    BOX = 359,
-    KSEC = 360,
-    ASSERT = 361,
-    SUBSTR = 362,
-    CASE = 363,
-    SWITCH = 364,
-    DEFAULT = 365,
-    EQ = 366,
-    NE = 367,
-    GE = 368,
-    LE = 369,
-    LT = 370,
-    GT = 371,
-    BIT = 372,
-    BITOFF = 373,
-    AND = 374,
-    OR = 375,
-    NOT = 376,
-    IS = 377,
-    IDENT = 378,
-    STRING = 379,
-    INTEGER = 380,
-    FLOAT = 381
+    INCLUDE = 267,
+    TRIGGER = 268,
+    ASCII = 269,
+    GROUP = 270,
+    NON_ALPHA = 271,
+    KSEC1EXPVER = 272,
+    LABEL = 273,
+    LIST = 274,
+    IS_IN_LIST = 275,
+    IS_IN_DICT = 276,
+    IS_INTEGER = 277,
+    TO_INTEGER = 278,
+    TO_STRING = 279,
+    SEX2DEC = 280,
+    WHILE = 281,
+    IBMFLOAT = 282,
+    SIGNED = 283,
+    UINT8 = 284,
+    INT8 = 285,
+    UINT16 = 286,
+    INT16 = 287,
+    UINT16_LITTLE_ENDIAN = 288,
+    INT16_LITTLE_ENDIAN = 289,
+    UINT32 = 290,
+    INT32 = 291,
+    UINT32_LITTLE_ENDIAN = 292,
+    INT32_LITTLE_ENDIAN = 293,
+    UINT64 = 294,
+    INT64 = 295,
+    UINT64_LITTLE_ENDIAN = 296,
+    INT64_LITTLE_ENDIAN = 297,
+    BLOB = 298,
+    BYTE = 299,
+    CODETABLE = 300,
+    SMART_TABLE = 301,
+    DICTIONARY = 302,
+    COMPLEX_CODETABLE = 303,
+    LOOKUP = 304,
+    ALIAS = 305,
+    UNALIAS = 306,
+    META = 307,
+    POS = 308,
+    INTCONST = 309,
+    TRANS = 310,
+    FLAGBIT = 311,
+    CONCEPT = 312,
+    GETENV = 313,
+    HASH_ARRAY = 314,
+    CONCEPT_NOFAIL = 315,
+    NIL = 316,
+    DUMMY = 317,
+    MODIFY = 318,
+    READ_ONLY = 319,
+    STRING_TYPE = 320,
+    LONG_TYPE = 321,
+    DOUBLE_TYPE = 322,
+    NO_COPY = 323,
+    DUMP = 324,
+    JSON = 325,
+    XML = 326,
+    NO_FAIL = 327,
+    EDITION_SPECIFIC = 328,
+    OVERRIDE = 329,
+    HIDDEN = 330,
+    CAN_BE_MISSING = 331,
+    MISSING = 332,
+    CONSTRAINT = 333,
+    COPY_OK = 334,
+    WHEN = 335,
+    SET = 336,
+    SET_NOFAIL = 337,
+    WRITE = 338,
+    APPEND = 339,
+    PRINT = 340,
+    EXPORT = 341,
+    REMOVE = 342,
+    RENAME = 343,
+    SKIP = 344,
+    PAD = 345,
+    SECTION_PADDING = 346,
+    MESSAGE = 347,
+    MESSAGE_COPY = 348,
+    PADTO = 349,
+    PADTOEVEN = 350,
+    PADTOMULTIPLE = 351,
+    G1_HALF_BYTE = 352,
+    G1_MESSAGE_LENGTH = 353,
+    G1_SECTION4_LENGTH = 354,
+    SECTION_LENGTH = 355,
+    LENGTH = 356,
+    FLAG = 357,
+    ITERATOR = 358,
+    NEAREST = 359,
+    BOX = 360,
+    KSEC = 361,
+    ASSERT = 362,
+    SUBSTR = 363,
+    CASE = 364,
+    SWITCH = 365,
+    DEFAULT = 366,
+    EQ = 367,
+    NE = 368,
+    GE = 369,
+    LE = 370,
+    LT = 371,
+    GT = 372,
+    BIT = 373,
+    BITOFF = 374,
+    AND = 375,
+    OR = 376,
+    NOT = 377,
+    IS = 378,
+    IDENT = 379,
+    STRING = 380,
+    INTEGER = 381,
+    FLOAT = 382
   };
 #endif
 /* Tokens.  */
@@ -185,121 +186,122 @@ extern int grib_yydebug;
 #define UNSIGNED 264
 #define TEMPLATE 265
 #define TEMPLATE_NOFAIL 266
-#define TRIGGER 267
-#define ASCII 268
-#define GROUP 269
-#define NON_ALPHA 270
-#define KSEC1EXPVER 271
-#define LABEL 272
-#define LIST 273
-#define IS_IN_LIST 274
-#define IS_IN_DICT 275
-#define IS_INTEGER 276
-#define TO_INTEGER 277
-#define TO_STRING 278
-#define SEX2DEC 279
-#define WHILE 280
-#define IBMFLOAT 281
-#define SIGNED 282
-#define UINT8 283
-#define INT8 284
-#define UINT16 285
-#define INT16 286
-#define UINT16_LITTLE_ENDIAN 287
-#define INT16_LITTLE_ENDIAN 288
-#define UINT32 289
-#define INT32 290
-#define UINT32_LITTLE_ENDIAN 291
-#define INT32_LITTLE_ENDIAN 292
-#define UINT64 293
-#define INT64 294
-#define UINT64_LITTLE_ENDIAN 295
-#define INT64_LITTLE_ENDIAN 296
-#define BLOB 297
-#define BYTE 298
-#define CODETABLE 299
-#define SMART_TABLE 300
-#define DICTIONARY 301
-#define COMPLEX_CODETABLE 302
-#define LOOKUP 303
-#define ALIAS 304
-#define UNALIAS 305
-#define META 306
-#define POS 307
-#define INTCONST 308
-#define TRANS 309
-#define FLAGBIT 310
-#define CONCEPT 311
-#define GETENV 312
-#define HASH_ARRAY 313
-#define CONCEPT_NOFAIL 314
-#define NIL 315
-#define DUMMY 316
-#define MODIFY 317
-#define READ_ONLY 318
-#define STRING_TYPE 319
-#define LONG_TYPE 320
-#define DOUBLE_TYPE 321
-#define NO_COPY 322
-#define DUMP 323
-#define JSON 324
-#define XML 325
-#define NO_FAIL 326
-#define EDITION_SPECIFIC 327
-#define OVERRIDE 328
-#define HIDDEN 329
-#define CAN_BE_MISSING 330
-#define MISSING 331
-#define CONSTRAINT 332
-#define COPY_OK 333
-#define WHEN 334
-#define SET 335
-#define SET_NOFAIL 336
-#define WRITE 337
-#define APPEND 338
-#define PRINT 339
-#define EXPORT 340
-#define REMOVE 341
-#define RENAME 342
-#define SKIP 343
-#define PAD 344
-#define SECTION_PADDING 345
-#define MESSAGE 346
-#define MESSAGE_COPY 347
-#define PADTO 348
-#define PADTOEVEN 349
-#define PADTOMULTIPLE 350
-#define G1_HALF_BYTE 351
-#define G1_MESSAGE_LENGTH 352
-#define G1_SECTION4_LENGTH 353
-#define SECTION_LENGTH 354
-#define LENGTH 355
-#define FLAG 356
-#define ITERATOR 357
-#define NEAREST 358
-#define BOX 359
-#define KSEC 360
-#define ASSERT 361
-#define SUBSTR 362
-#define CASE 363
-#define SWITCH 364
-#define DEFAULT 365
-#define EQ 366
-#define NE 367
-#define GE 368
-#define LE 369
-#define LT 370
-#define GT 371
-#define BIT 372
-#define BITOFF 373
-#define AND 374
-#define OR 375
-#define NOT 376
-#define IS 377
-#define IDENT 378
-#define STRING 379
-#define INTEGER 380
-#define FLOAT 381
+#define INCLUDE 267
+#define TRIGGER 268
+#define ASCII 269
+#define GROUP 270
+#define NON_ALPHA 271
+#define KSEC1EXPVER 272
+#define LABEL 273
+#define LIST 274
+#define IS_IN_LIST 275
+#define IS_IN_DICT 276
+#define IS_INTEGER 277
+#define TO_INTEGER 278
+#define TO_STRING 279
+#define SEX2DEC 280
+#define WHILE 281
+#define IBMFLOAT 282
+#define SIGNED 283
+#define UINT8 284
+#define INT8 285
+#define UINT16 286
+#define INT16 287
+#define UINT16_LITTLE_ENDIAN 288
+#define INT16_LITTLE_ENDIAN 289
+#define UINT32 290
+#define INT32 291
+#define UINT32_LITTLE_ENDIAN 292
+#define INT32_LITTLE_ENDIAN 293
+#define UINT64 294
+#define INT64 295
+#define UINT64_LITTLE_ENDIAN 296
+#define INT64_LITTLE_ENDIAN 297
+#define BLOB 298
+#define BYTE 299
+#define CODETABLE 300
+#define SMART_TABLE 301
+#define DICTIONARY 302
+#define COMPLEX_CODETABLE 303
+#define LOOKUP 304
+#define ALIAS 305
+#define UNALIAS 306
+#define META 307
+#define POS 308
+#define INTCONST 309
+#define TRANS 310
+#define FLAGBIT 311
+#define CONCEPT 312
+#define GETENV 313
+#define HASH_ARRAY 314
+#define CONCEPT_NOFAIL 315
+#define NIL 316
+#define DUMMY 317
+#define MODIFY 318
+#define READ_ONLY 319
+#define STRING_TYPE 320
+#define LONG_TYPE 321
+#define DOUBLE_TYPE 322
+#define NO_COPY 323
+#define DUMP 324
+#define JSON 325
+#define XML 326
+#define NO_FAIL 327
+#define EDITION_SPECIFIC 328
+#define OVERRIDE 329
+#define HIDDEN 330
+#define CAN_BE_MISSING 331
+#define MISSING 332
+#define CONSTRAINT 333
+#define COPY_OK 334
+#define WHEN 335
+#define SET 336
+#define SET_NOFAIL 337
+#define WRITE 338
+#define APPEND 339
+#define PRINT 340
+#define EXPORT 341
+#define REMOVE 342
+#define RENAME 343
+#define SKIP 344
+#define PAD 345
+#define SECTION_PADDING 346
+#define MESSAGE 347
+#define MESSAGE_COPY 348
+#define PADTO 349
+#define PADTOEVEN 350
+#define PADTOMULTIPLE 351
+#define G1_HALF_BYTE 352
+#define G1_MESSAGE_LENGTH 353
+#define G1_SECTION4_LENGTH 354
+#define SECTION_LENGTH 355
+#define LENGTH 356
+#define FLAG 357
+#define ITERATOR 358
+#define NEAREST 359
+#define BOX 360
+#define KSEC 361
+#define ASSERT 362
+#define SUBSTR 363
+#define CASE 364
+#define SWITCH 365
+#define DEFAULT 366
+#define EQ 367
+#define NE 368
+#define GE 369
+#define LE 370
+#define LT 371
+#define GT 372
+#define BIT 373
+#define BITOFF 374
+#define AND 375
+#define OR 376
+#define NOT 377
+#define IS 378
+#define IDENT 379
+#define STRING 380
+#define INTEGER 381
+#define FLOAT 382
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -323,7 +325,7 @@ union YYSTYPE
   grib_rule               *rules;
   grib_rule_entry         *rule_entry;
 
-#line 327 "y.tab.h"
+#line 329 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -65,6 +65,7 @@ static grib_hash_array_value *_reverse_hash_array(grib_hash_array_value *r,grib_
 %token UNSIGNED
 %token TEMPLATE
 %token TEMPLATE_NOFAIL
+%token <str>INCLUDE
 %token TRIGGER
 %token ASCII
 %token GROUP
@@ -213,6 +214,7 @@ static grib_hash_array_value *_reverse_hash_array(grib_hash_array_value *r,grib_
 %type <act>  trigger_block
 %type <act>  concept_block
 %type <act>  hash_array_block
+%type <act>  include_block
 %type <act>  set
 %type <act>  set_list
 
@@ -303,6 +305,7 @@ instruction: simple  ';'
            | hash_array_block
            | when_block
            | switch_block
+           | include_block
 
    ;
 
@@ -697,6 +700,10 @@ list_block : IDENT LIST '(' expression ')' '{' instructions '}' { $$ = grib_acti
 while_block : WHILE '(' expression ')' '{' instructions '}' { $$ = grib_action_create_while(grib_parser_context,$3,$6);  }
   ;
 
+include_block : INCLUDE { $$ = grib_action_create_include(grib_parser_context,$1); free($1);
+                            if (!$$) { yyerror("Cannot include file"); YYABORT; } }
+   ;
+
 trigger_block : TRIGGER '(' argument_list ')' '{' instructions '}' { $$ = grib_action_create_trigger(grib_parser_context,$3,$6);  }
    ;
 
@@ -239,7 +239,11 @@ EOF
         {
             next unless($args->{SUPER});
 
-            foreach my $c ( grep { !$implements{$_} } grep { ! /\binit\b|\bdestroy\b|\bpost_init\b/ } @procs )
+            # unpack_float and unpack_double_element_set are not inherited: a class
+            # overriding unpack_double or unpack_double_element must not pick up the
+            # decoder of its super class. Nor are write_snapshot and read_snapshot,
+            # which save and call the constructor of the class itself
+            foreach my $c ( grep { !$implements{$_} } grep { ! /\binit\b|\bdestroy\b|\bpost_init\b|\bunpack_float\b|\bunpack_double_element_set\b|\bwrite_snapshot\b|\bread_snapshot\b/ } @procs )
             {
                 print OUT "    c->$c    =    (*(c->super))->$c;\n";
             }
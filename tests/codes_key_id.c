@@ -0,0 +1,149 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The header keys, the BUFR data keys and then the arrays, which are not printed */
+static const char* keys[] = {
+    "edition", "centre", "shortName", "paramId", "typeOfLevel", "level",
+    "stepRange", "dataDate", "gridType", "mars.param", "mars.step",
+    "ls.shortName", "time.dataTime", "noSuchKey", "noSuch.level",
+    "numberOfSubsets",
+    "#1#airTemperature", "airTemperature->units",
+    "values", "pl"
+};
+#define NKEYS (sizeof(keys) / sizeof(keys[0]))
+#define NHEADER_KEYS 16
+#define NPRINTED (NKEYS - 2)
+
+/* Every get through a compiled key must give what the get by name gives */
+static void compare_key(codes_handle* h, const char* key, const codes_key_id* k)
+{
+    int err1 = 0, err2 = 0;
+    long l1 = 0, l2 = 0;
+    double d1 = 0, d2 = 0;
+    char s1[1024] = {0,}, s2[1024] = {0,};
+    size_t len1 = sizeof(s1), len2 = sizeof(s2), size1 = 0, size2 = 0;
+
+    err1 = codes_get_long(h, key, &l1);
+    err2 = codes_get_long_by_id(h, k, &l2);
+    assert(err1 == err2 && l1 == l2);
+
+    err1 = codes_get_double(h, key, &d1);
+    err2 = codes_get_double_by_id(h, k, &d2);
+    assert(err1 == err2 && (err1 || d1 == d2 || (d1 != d1 && d2 != d2)));
+
+    err1 = codes_get_string(h, key, s1, &len1);
+    err2 = codes_get_string_by_id(h, k, s2, &len2);
+    assert(err1 == err2 && len1 == len2 && strcmp(s1, s2) == 0);
+
+    err1 = codes_get_size(h, key, &size1);
+    err2 = codes_get_size_by_id(h, k, &size2);
+    assert(err1 == err2 && size1 == size2);
+
+    if (err1 == 0 && size1 > 1) {
+        size_t i = 0, n1 = size1, n2 = size1;
+        double* dv1 = (double*)malloc(size1 * sizeof(double));
+        double* dv2 = (double*)malloc(size1 * sizeof(double));
+        assert(dv1 && dv2);
+        err1 = codes_get_double_array(h, key, dv1, &n1);
+        err2 = codes_get_double_array_by_id(h, k, dv2, &n2);
+        assert(err1 == err2 && n1 == n2);
+        for (i = 0; i < n1 && err1 == 0; i++)
+            assert(dv1[i] == dv2[i]);
+        free(dv1);
+        free(dv2);
+    }
+}
+
+/* Ranks only apply to BUFR data keys */
+static void compare_all(codes_handle* h, codes_key_id* const* ids, int is_bufr)
+{
+    size_t i = 0;
+    for (i = 0; i < NKEYS; i++) {
+        if (keys[i][0] != '#' || is_bufr)
+            compare_key(h, keys[i], ids[i]);
+    }
+}
+
+/* Print keys got through the compiled keys as strings, like the tools with -f -p do */
+static void print_keys(FILE* out, codes_handle* h, codes_key_id* const* ids, size_t from, size_t to)
+{
+    size_t i = 0;
+    for (i = from; i < to; i++) {
+        char s[1024] = {0,};
+        size_t len   = sizeof(s);
+        double d     = 0;
+        if (codes_get_string_by_id(h, ids[i], s, &len) != 0)
+            strcpy(s, "not_found");
+        else if (codes_get_double_by_id(h, ids[i], &d) == 0 && d == CODES_MISSING_DOUBLE)
+            strcpy(s, "MISSING");
+        fprintf(out, i == from ? "%s" : " %s", s);
+    }
+    fprintf(out, "\n");
+}
+
+/*
+ * The header keys of the messages are printed to stdout. Those of the GRIB2
+ * messages once changed and the data keys of the BUFR messages once unpacked
+ * are printed to the second file
+ */
+int main(int argc, char* argv[])
+{
+    int err = 0;
+    size_t i  = 0;
+    FILE *in = NULL, *out = NULL;
+    codes_handle* h = NULL;
+    codes_key_id* ids[NKEYS];
+
+    assert(argc == 3);
+    for (i = 0; i < NKEYS; i++) {
+        ids[i] = codes_key_compile(NULL, keys[i], &err);
+        assert(ids[i] && err == 0);
+    }
+    assert(codes_key_compile(NULL, "", &err) == NULL && err == CODES_INVALID_ARGUMENT);
+
+    in  = fopen(argv[1], "rb");
+    out = fopen(argv[2], "w");
+    assert(in && out);
+
+    /* The same compiled keys are used on all the messages */
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_ANY, &err)) != NULL) {
+        long edition = 0;
+        int is_bufr  = codes_is_defined(h, "unexpandedDescriptors");
+        print_keys(stdout, h, ids, 0, NHEADER_KEYS);
+        if (is_bufr) {
+            CODES_CHECK(codes_set_long(h, "unpack", 1), 0);
+            print_keys(out, h, ids, NHEADER_KEYS - 1, NPRINTED); /* numberOfSubsets and the data keys */
+        }
+        compare_all(h, ids, is_bufr);
+
+        /* and still work once sections have been reparsed */
+        if (codes_get_long(h, "edition", &edition) == 0 && edition == 2 &&
+            codes_is_defined(h, "productDefinitionTemplateNumber")) {
+            CODES_CHECK(codes_set_long(h, "productDefinitionTemplateNumber", 8), 0);
+            CODES_CHECK(codes_set_long(h, "level", 850), 0);
+            compare_all(h, ids, is_bufr);
+            print_keys(out, h, ids, 0, NHEADER_KEYS);
+        }
+
+        codes_handle_delete(h);
+    }
+    assert(err == 0);
+    fclose(in);
+    fclose(out);
+
+    for (i = 0; i < NKEYS; i++)
+        codes_key_delete(ids[i]);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="codes_key_id_test"
+TEMP=temp.$label.data
+TEMP2=temp.$label.2.grib
+OUTPUT=temp.$label.txt
+OUTPUT2=temp.$label.2.txt
+REF=temp.$label.ref
+
+# GRIB1, GRIB2 and BUFR messages in one file, with the same compiled keys
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR4_local_satellite.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR3_local.tmpl > $TEMP
+
+$EXEC ${test_dir}/codes_key_id $TEMP $OUTPUT2 > $OUTPUT
+
+# The values got through the compiled keys are those the tools print
+keys="edition,centre,shortName,paramId,typeOfLevel,level,stepRange,dataDate,gridType"
+keys="$keys,mars.param,mars.step,ls.shortName,time.dataTime,noSuchKey,noSuch.level,numberOfSubsets"
+${tools_dir}/grib_get -f -p "$keys" $TEMP > $REF
+# bufr_get prints the native type unless told otherwise
+${tools_dir}/bufr_get -f -p "`echo $keys | sed -e 's/,/:s,/g' -e 's/$/:s/'`" $TEMP >> $REF
+diff $REF $OUTPUT
+
+# Also once the product definition section has been changed, and for data keys
+${tools_dir}/grib_set -w edition=2 -s productDefinitionTemplateNumber=8,level=850 $TEMP $TEMP2
+${tools_dir}/grib_get -w edition=2 -f -p "$keys" $TEMP2 > $REF
+${tools_dir}/bufr_get -s unpack=1 -f -p "numberOfSubsets,#1#airTemperature,airTemperature->units" $TEMP >> $REF
+diff $REF $OUTPUT2
+
+rm -f $TEMP $TEMP2 $OUTPUT $OUTPUT2 $REF
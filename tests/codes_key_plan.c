@@ -0,0 +1,126 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ROWS 64
+#define STRLEN 64
+
+static const char* keys[] = {
+    "shortName", "paramId", "mars.param", "level", "level", "dataDate",
+    "date", "typeOfLevel", "stepRange", "noSuchKey", "ls.shortName", "numberOfValues"
+};
+static const int types[] = {
+    CODES_TYPE_STRING, CODES_TYPE_LONG, CODES_TYPE_LONG, CODES_TYPE_LONG, CODES_TYPE_DOUBLE, CODES_TYPE_LONG,
+    CODES_TYPE_LONG, CODES_TYPE_STRING, CODES_TYPE_STRING, CODES_TYPE_LONG, CODES_TYPE_STRING, CODES_TYPE_DOUBLE
+};
+#define NKEYS (sizeof(keys) / sizeof(keys[0]))
+
+/* Each cell must hold what the get by name gives, or the missing value */
+static void compare_row(codes_handle* h, void** columns, size_t row, const int* errors)
+{
+    size_t i = 0;
+    for (i = 0; i < NKEYS; i++) {
+        int err = 0;
+        switch (types[i]) {
+            case CODES_TYPE_LONG: {
+                long v = 0;
+                err    = codes_get_long(h, keys[i], &v);
+                assert(err == errors[i]);
+                assert(((long*)columns[i])[row] == (err ? CODES_MISSING_LONG : v));
+                break;
+            }
+            case CODES_TYPE_DOUBLE: {
+                double v = 0;
+                err      = codes_get_double(h, keys[i], &v);
+                assert(err == errors[i]);
+                assert(((double*)columns[i])[row] == (err ? CODES_MISSING_DOUBLE : v));
+                break;
+            }
+            default: {
+                char v[STRLEN] = {0,};
+                size_t len     = STRLEN;
+                err            = codes_get_string(h, keys[i], v, &len);
+                assert(err == errors[i]);
+                assert(strcmp((char*)columns[i] + row * STRLEN, err ? "" : v) == 0);
+                break;
+            }
+        }
+    }
+}
+
+/* Print a row of the columns like grib_get -f -p does with the types of the plan */
+static void print_row(void** columns, size_t row, const int* errors)
+{
+    size_t i = 0;
+    for (i = 0; i < NKEYS; i++) {
+        if (i > 0)
+            printf(" ");
+        if (errors[i])
+            printf("not_found");
+        else if (types[i] == CODES_TYPE_LONG)
+            printf("%ld", ((long*)columns[i])[row]);
+        else if (types[i] == CODES_TYPE_DOUBLE)
+            printf("%g", ((double*)columns[i])[row]);
+        else
+            printf("%s", (char*)columns[i] + row * STRLEN);
+    }
+    printf("\n");
+}
+
+int main(int argc, char* argv[])
+{
+    int err = 0;
+    size_t i = 0, row = 0;
+    FILE* in = NULL;
+    codes_handle* h = NULL;
+    codes_handle* handles[MAX_ROWS];
+    int errors[MAX_ROWS][NKEYS];
+    void* columns[NKEYS];
+    codes_key_plan* plan = NULL;
+
+    assert(argc == 2);
+    assert(codes_key_plan_new(NULL, keys, NULL, NKEYS, 0, &err) == NULL && err == CODES_INVALID_ARGUMENT);
+
+    plan = codes_key_plan_new(NULL, keys, types, NKEYS, STRLEN, &err);
+    assert(plan && err == 0);
+    assert(codes_key_plan_size(plan) == NKEYS);
+
+    for (i = 0; i < NKEYS; i++) {
+        size_t width = types[i] == CODES_TYPE_LONG ? sizeof(long) : types[i] == CODES_TYPE_DOUBLE ? sizeof(double) : STRLEN;
+        columns[i]   = malloc(MAX_ROWS * width);
+        assert(columns[i]);
+    }
+
+    in = fopen(argv[1], "rb");
+    assert(in);
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_GRIB, &err)) != NULL) {
+        assert(row < MAX_ROWS);
+        err = codes_key_plan_execute(plan, h, columns, row, errors[row]);
+        assert(err == CODES_NOT_FOUND); /* noSuchKey, the only missing key */
+        handles[row++] = h;
+    }
+    assert(err == 0);
+    fclose(in);
+
+    for (i = 0; i < row; i++) {
+        compare_row(handles[i], columns, i, errors[i]);
+        print_row(columns, i, errors[i]);
+        codes_handle_delete(handles[i]);
+    }
+
+    for (i = 0; i < NKEYS; i++)
+        free(columns[i]);
+    codes_key_plan_delete(plan);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="codes_key_plan_test"
+TEMP=temp.$label.data
+OUTPUT=temp.$label.txt
+REF=temp.$label.ref
+
+# All the messages go through the same plan, one row each
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/regular_ll_pl_grib1.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_sfc_grib1.tmpl > $TEMP
+
+$EXEC ${test_dir}/codes_key_plan $TEMP > $OUTPUT
+
+# The rows hold what grib_get prints with the same types
+keys="shortName:s,paramId:i,mars.param:i,level:i,level:d,dataDate:i,date:i"
+keys="$keys,typeOfLevel:s,stepRange:s,noSuchKey:i,ls.shortName:s,numberOfValues:d"
+${tools_dir}/grib_get -f -F "%g" -p $keys $TEMP > $REF
+diff $REF $OUTPUT
+
+rm -f $TEMP $OUTPUT $REF
@@ -60,6 +60,33 @@ cat tigge_ecmwf.grib2_[0-9][0-9][0-9] > $temp
 ${tools_dir}/grib_compare $input $temp
 
 
+# Test 4: An invalid message between two valid ones is skipped
+# -----------------------------
+input=invalid.grib
+cat ${data_dir}/sample.grib2 > $input
+head -c 100 ${data_dir}/sample.grib2 >> $input
+cat ${data_dir}/sample.grib2 >> $input
+${tools_dir}/codes_split_file -1 $input
+total=`${tools_dir}/codes_count $input\_[0-9]*`
+[ $total -eq 2 ]
+cat ${data_dir}/sample.grib2 ${data_dir}/sample.grib2 > $temp
+cat $input\_[0-9][0-9][0-9] | cmp - $temp
+
+
+# Test 5: A pipe, which cannot be scanned ahead
+# -----------------------------
+if command -v mkfifo >/dev/null 2>&1; then
+    mkfifo pipe.grib
+    cat ${data_dir}/mixed.grib > pipe.grib &
+    ${tools_dir}/codes_split_file -1 pipe.grib
+    wait
+    total=`${tools_dir}/codes_count pipe.grib_[0-9]*`
+    [ $total -eq 14 ]
+    cat pipe.grib_[0-9][0-9][0-9] > $temp
+    ${tools_dir}/grib_compare ${data_dir}/mixed.grib $temp
+fi
+
+
 # Clean up
 cd $test_dir
 rm -fr $temp_dir
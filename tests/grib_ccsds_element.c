@@ -0,0 +1,201 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Check that the values of CCSDS packed fields got one by one or a few at
+ * once, which only decodes the reference sample intervals holding them, are
+ * those of the whole field, and that fields split across threads are packed as by one.
+ * The fields are written to the file given and their values, got one by one,
+ * printed as grib_get_data does
+ */
+
+static double* get_values(codes_handle* h, size_t* size)
+{
+    double* values = NULL;
+    CODES_CHECK(codes_get_size(h, "values", size), 0);
+    values = (double*)malloc(*size * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(h, "values", values, size), 0);
+    return values;
+}
+
+/* Runs of equal values give zero blocks, steps of all sizes the other codes */
+static void set_values(codes_handle* h, size_t size, int seed)
+{
+    double* values  = (double*)malloc(size * sizeof(double));
+    unsigned long r = (unsigned long)seed;
+    size_t i        = 0;
+
+    assert(values);
+    for (i = 0; i < size; i++) {
+        r = r * 1103515245 + 12345;
+        if ((i / 100) % 3 == 0)
+            values[i] = 273;
+        else if ((i / 100) % 3 == 1)
+            values[i] = 250 + (r >> 16) % 50;
+        else
+            values[i] = 250 + i % 40 + ((r >> 16) % 3) * 0.1;
+    }
+    CODES_CHECK(codes_set_double_array(h, "values", values, size), 0);
+    free(values);
+}
+
+/* Few enough values of the fields for codes_get_double_elements to get them one by one */
+#define NUM_ELEMENTS 50
+
+static void check_elements(codes_handle* h)
+{
+    size_t size = 0, i = 0;
+    double* expected = get_values(h, &size);
+    double* values   = NULL;
+    int* index       = NULL;
+    double v         = 0;
+
+    /* Onwards, backwards, and jumping */
+    for (i = 0; i < size; i++) {
+        CODES_CHECK(codes_get_double_element(h, "values", (int)i, &v), 0);
+        assert(v == expected[i]);
+    }
+    for (i = size; i > 0; i--) {
+        CODES_CHECK(codes_get_double_element(h, "values", (int)(i - 1), &v), 0);
+        assert(v == expected[i - 1]);
+    }
+    for (i = 0; i < size; i++) {
+        size_t j = (i * 7919) % size;
+        CODES_CHECK(codes_get_double_element(h, "values", (int)j, &v), 0);
+        assert(v == expected[j]);
+    }
+
+    /* A few at once, then all of them, which decodes the whole field */
+    index  = (int*)malloc(size * sizeof(int));
+    values = (double*)malloc(size * sizeof(double));
+    assert(index && values);
+    for (i = 0; i < NUM_ELEMENTS; i++)
+        index[i] = (int)((i * 7919) % size);
+    CODES_CHECK(codes_get_double_elements(h, "values", index, NUM_ELEMENTS, values), 0);
+    for (i = 0; i < NUM_ELEMENTS; i++)
+        assert(values[i] == expected[index[i]]);
+    for (i = 0; i < size; i++)
+        index[i] = (int)(size - 1 - i);
+    CODES_CHECK(codes_get_double_elements(h, "values", index, (long)size, values), 0);
+    for (i = 0; i < size; i++)
+        assert(values[i] == expected[index[i]]);
+
+    free(index);
+    free(values);
+    free(expected);
+}
+
+/* Values set with one thread and with several must give the same message */
+static void check_threads(codes_handle* h, size_t size, int seed, int threads)
+{
+    const void *msg1 = NULL, *msg2 = NULL;
+    size_t len1 = 0, len2 = 0;
+    codes_handle* h1 = codes_handle_clone(h);
+    codes_handle* h2 = codes_handle_clone(h);
+
+    assert(h1 && h2);
+    set_values(h1, size, seed);
+    codes_context_set_threads(NULL, threads);
+    set_values(h2, size, seed);
+    check_elements(h2);
+    codes_context_set_threads(NULL, 1);
+
+    CODES_CHECK(codes_get_message(h1, &msg1, &len1), 0);
+    CODES_CHECK(codes_get_message(h2, &msg2, &len2), 0);
+    assert(len1 == len2);
+    assert(memcmp(msg1, msg2, len1) == 0);
+    codes_handle_delete(h1);
+    codes_handle_delete(h2);
+}
+
+static void print_elements(codes_handle* h, size_t size)
+{
+    size_t i = 0;
+    double v = 0;
+    for (i = 0; i < size; i++) {
+        CODES_CHECK(codes_get_double_element(h, "values", (int)i, &v), 0);
+        printf("%.10e\n", v);
+    }
+}
+
+static void test_packing(long bits_per_value, long flags, long block_size, long rsi, int bitmap, FILE* out)
+{
+    codes_handle *h = NULL, *clone = NULL;
+    size_t len       = strlen("grid_ccsds");
+    size_t size      = 0;
+    const void* msg  = NULL;
+
+    h = codes_grib_handle_new_from_samples(NULL, "regular_ll_sfc_grib2");
+    assert(h);
+    if (bitmap) {
+        CODES_CHECK(codes_set_double(h, "missingValue", 273), 0);
+        CODES_CHECK(codes_set_long(h, "bitmapPresent", 1), 0);
+    }
+    CODES_CHECK(codes_set_long(h, "bitsPerValue", bits_per_value), 0);
+    CODES_CHECK(codes_set_long(h, "decimalScaleFactor", 1), 0);
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    set_values(h, size, 1);
+
+    /* The field is packed again with each of the settings */
+    CODES_CHECK(codes_set_string(h, "packingType", "grid_ccsds", &len), 0);
+    CODES_CHECK(codes_set_long(h, "ccsdsFlags", flags), 0);
+    CODES_CHECK(codes_set_long(h, "ccsdsBlockSize", block_size), 0);
+    CODES_CHECK(codes_set_long(h, "ccsdsRsi", rsi), 0);
+    set_values(h, size, 1);
+    check_elements(h);
+
+    /* A clone, and new values */
+    clone = codes_handle_clone(h);
+    assert(clone);
+    check_elements(clone);
+    set_values(h, size, 2);
+    check_elements(h);
+    check_elements(clone);
+    check_threads(h, size, 3, 3);
+
+    print_elements(h, size);
+    CODES_CHECK(codes_get_message(h, &msg, &len), 0);
+    assert(fwrite(msg, 1, len, out) == len);
+
+    codes_handle_delete(clone);
+    codes_handle_delete(h);
+}
+
+int main(int argc, char* argv[])
+{
+    FILE* out = NULL;
+
+    assert(argc == 2);
+    out = fopen(argv[1], "wb");
+    assert(out);
+
+    test_packing(16, 14, 32, 128, 0, out);
+    test_packing(16, 14, 8, 4, 0, out);
+    test_packing(16, 14, 16, 3, 1, out);
+    test_packing(16, 14, 64, 1, 0, out);
+
+    /* 4 bytes per sample without AEC_DATA_3BYTE */
+    test_packing(20, 14, 16, 4, 0, out);
+    test_packing(20, 12, 16, 4, 0, out);
+
+    /* Samples in little-endian bytes, which threads leave to libaec */
+    test_packing(16, 10, 32, 128, 0, out);
+    test_packing(16, 10, 16, 3, 1, out);
+    test_packing(24, 10, 16, 4, 0, out);
+
+    fclose(out);
+    return 0;
+}
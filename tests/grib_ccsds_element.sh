@@ -0,0 +1,26 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_ccsds_element_test"
+TEMP=temp.$label.grib
+OUTPUT=temp.$label.txt
+REF=temp.$label.ref
+
+# Split even the small fields of the test across threads
+ECCODES_THREADS_MIN_VALUES=1 $EXEC ${test_dir}/grib_ccsds_element $TEMP > $OUTPUT
+
+# The values got one by one are those grib_get_data decodes.
+# The fields with a bitmap have 273 as missing value
+${tools_dir}/grib_get_data -m 2.7300000000e+02 $TEMP | awk '$1 != "Latitude," {print $3}' > $REF
+diff $REF $OUTPUT
+
+rm -f $TEMP $OUTPUT $REF
@@ -0,0 +1,181 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Check that a cloned handle, which copies the accessors of the handle it was
+ * cloned from and shares its message, has the same keys as a handle parsed
+ * from a copy of the message, and that setting keys on either of them, or
+ * deleting one of them, does not affect the other.
+ * The edited clones are written to the second file
+ */
+
+static void compare_messages(codes_handle* h1, codes_handle* h2)
+{
+    const void *m1 = NULL, *m2 = NULL;
+    size_t s1 = 0, s2 = 0;
+    CODES_CHECK(codes_get_message(h1, &m1, &s1), 0);
+    CODES_CHECK(codes_get_message(h2, &m2, &s2), 0);
+    assert(s1 == s2);
+    assert(memcmp(m1, m2, s1) == 0);
+}
+
+static void compare_keys(codes_handle* h1, codes_handle* h2)
+{
+    codes_keys_iterator* kiter = codes_keys_iterator_new(h1, CODES_KEYS_ITERATOR_SKIP_DUPLICATES, NULL);
+    assert(kiter);
+    while (codes_keys_iterator_next(kiter)) {
+        const char* name = codes_keys_iterator_get_name(kiter);
+        char v1[1024] = {0,}, v2[1024] = {0,};
+        size_t len1 = sizeof(v1), len2 = sizeof(v2);
+        int err1 = codes_get_string(h1, name, v1, &len1);
+        int err2 = codes_get_string(h2, name, v2, &len2);
+        assert(err1 == err2);
+        assert(err1 || strcmp(v1, v2) == 0);
+    }
+    codes_keys_iterator_delete(kiter);
+}
+
+static int same_message(codes_handle* h1, codes_handle* h2)
+{
+    const void *m1 = NULL, *m2 = NULL;
+    size_t s1 = 0, s2 = 0;
+    CODES_CHECK(codes_get_message(h1, &m1, &s1), 0);
+    CODES_CHECK(codes_get_message(h2, &m2, &s2), 0);
+    return m1 == m2;
+}
+
+/* Decoding the values of the handles must leave their messages where they are */
+static void decode_keeps_messages(codes_handle* h1, codes_handle* h2)
+{
+    const void *m1 = NULL, *m2 = NULL, *m = NULL;
+    void *c1 = NULL, *c2 = NULL;
+    size_t s1 = 0, s2 = 0, s = 0, size = 0;
+    double* values = NULL;
+
+    CODES_CHECK(codes_get_message(h1, &m1, &s1), 0);
+    CODES_CHECK(codes_get_message(h2, &m2, &s2), 0);
+    c1 = malloc(s1);
+    c2 = malloc(s2);
+    assert(c1 && c2);
+    memcpy(c1, m1, s1);
+    memcpy(c2, m2, s2);
+
+    CODES_CHECK(codes_get_size(h2, "values", &size), 0);
+    values = (double*)malloc(size * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(h2, "values", values, &size), 0);
+    CODES_CHECK(codes_get_double_array(h1, "values", values, &size), 0);
+
+    CODES_CHECK(codes_get_message(h1, &m, &s), 0);
+    assert(m == m1 && s == s1);
+    CODES_CHECK(codes_get_message(h2, &m, &s), 0);
+    assert(m == m2 && s == s2);
+    assert(memcmp(m1, c1, s1) == 0);
+    assert(memcmp(m2, c2, s2) == 0);
+
+    free(values);
+    free(c1);
+    free(c2);
+}
+
+/* As grib_set -s level=500,scaleValuesBy=2 */
+static void edit(codes_handle* h)
+{
+    size_t i = 0, size = 0;
+    double* values = NULL;
+
+    CODES_CHECK(codes_set_long(h, "level", 500), 0);
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    values = (double*)malloc(size * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(h, "values", values, &size), 0);
+    for (i = 0; i < size; i++)
+        values[i] *= 2;
+    CODES_CHECK(codes_set_double_array(h, "values", values, size), 0);
+    free(values);
+}
+
+int main(int argc, char* argv[])
+{
+    int err  = 0;
+    FILE *in = NULL, *out = NULL;
+    codes_handle *h = NULL, *clone = NULL, *parsed = NULL, *copy = NULL;
+    const void* msg = NULL;
+    size_t size = 0;
+
+    assert(argc == 3);
+    in  = fopen(argv[1], "rb");
+    out = fopen(argv[2], "wb");
+    assert(in && out);
+
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_GRIB, &err)) != NULL) {
+        CODES_CHECK(codes_get_message(h, &msg, &size), 0);
+        parsed = codes_handle_new_from_message_copy(NULL, msg, size);
+        copy   = codes_handle_new_from_message_copy(NULL, msg, size);
+        clone  = codes_handle_clone(h);
+        assert(parsed && copy && clone);
+        assert(same_message(h, clone));
+
+        compare_messages(clone, parsed);
+        compare_keys(clone, parsed);
+        compare_keys(parsed, clone);
+
+        /* Setting keys on the clone gives the same message as on a parsed handle */
+        edit(clone);
+        edit(parsed);
+        assert(!same_message(h, clone));
+        compare_messages(clone, parsed);
+        compare_keys(clone, parsed);
+        compare_messages(h, copy);
+        compare_keys(h, copy);
+        CODES_CHECK(codes_get_message(clone, &msg, &size), 0);
+        assert(fwrite(msg, 1, size, out) == size);
+        codes_handle_delete(clone);
+
+        /* Nor does setting keys on the source change its clones */
+        clone = codes_handle_clone(h);
+        assert(clone);
+        edit(h);
+        assert(!same_message(h, clone));
+        compare_messages(clone, copy);
+        compare_keys(clone, copy);
+        codes_handle_delete(h);
+
+        /* A clone of a clone outliving both */
+        h = codes_handle_clone(clone);
+        assert(h);
+        codes_handle_delete(clone);
+        compare_messages(h, copy);
+        edit(h);
+        compare_messages(h, parsed);
+
+        /* A clone of an edited clone */
+        clone = codes_handle_clone(h);
+        assert(clone);
+        assert(same_message(h, clone));
+        decode_keeps_messages(h, clone);
+        assert(same_message(h, clone));
+        codes_handle_delete(clone);
+
+        codes_handle_delete(h);
+        codes_handle_delete(parsed);
+        codes_handle_delete(copy);
+    }
+    assert(!err);
+    fclose(in);
+    fclose(out);
+
+    return 0;
+}
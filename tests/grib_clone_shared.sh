@@ -0,0 +1,32 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_clone_shared_test"
+TEMP=temp.$label.grib
+OUTPUT=temp.$label.out.grib
+REF=temp.$label.ref.grib
+
+# Grid point, spectral and reduced Gaussian messages of both editions
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib1.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/regular_ll_sfc_grib2.tmpl > $TEMP
+
+$EXEC ${test_dir}/grib_clone_shared $TEMP $OUTPUT
+
+# The edited clones are what grib_set gives
+${tools_dir}/grib_set -s level=500,scaleValuesBy=2 $TEMP $REF
+cmp $REF $OUTPUT
+
+rm -f $TEMP $OUTPUT $REF
@@ -0,0 +1,58 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_definitions_snapshot_test"
+SNAPSHOT=temp.$label.snapshot
+REF=temp.$label.ref
+OUTPUT=temp.$label.txt
+LOG=temp.$label.log
+
+unset ECCODES_DEFINITIONS_SNAPSHOT
+rm -f $SNAPSHOT
+${tools_dir}/codes_definitions_snapshot $SNAPSHOT
+[ -s $SNAPSHOT ]
+
+# Files read from the snapshot give the same messages as files parsed
+for sample in GRIB1.tmpl GRIB2.tmpl reduced_gg_pl_32_grib2.tmpl regular_ll_pl_grib1.tmpl sh_ml_grib2.tmpl; do
+    ${tools_dir}/grib_dump -O $ECCODES_SAMPLES_PATH/$sample > $REF
+    ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT ${tools_dir}/grib_dump -O $ECCODES_SAMPLES_PATH/$sample > $OUTPUT
+    diff $REF $OUTPUT
+done
+for sample in BUFR3.tmpl BUFR4.tmpl BUFR4_local_satellite.tmpl; do
+    ${tools_dir}/bufr_dump -p $ECCODES_SAMPLES_PATH/$sample > $REF
+    ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT ${tools_dir}/bufr_dump -p $ECCODES_SAMPLES_PATH/$sample > $OUTPUT
+    diff $REF $OUTPUT
+done
+
+# Actions, concepts and hash arrays all come from the snapshot
+ECCODES_DEBUG=1 ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT ${tools_dir}/grib_ls -p shortName $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $LOG 2>&1
+grep -q "boot.def from the definitions snapshot" $LOG
+grep -q "shortName.def from the definitions snapshot" $LOG
+ECCODES_DEBUG=1 ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT ${tools_dir}/bufr_dump -p $ECCODES_SAMPLES_PATH/BUFR4.tmpl > $LOG 2>&1
+grep -q "sequence.def from the definitions snapshot" $LOG
+
+# A snapshot written for another definitions path is not used
+ECCODES_DEBUG=1 ECCODES_DEFINITION_PATH=$ECCODES_DEFINITION_PATH/. ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT \
+    ${tools_dir}/grib_ls $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $LOG 2>&1
+grep -q "Ignoring definitions snapshot" $LOG
+[ `grep -c "from the definitions snapshot" $LOG` -eq 0 ]
+
+# A truncated or damaged snapshot is not used
+${tools_dir}/grib_dump -O $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $REF
+head -c 1000 $SNAPSHOT > $SNAPSHOT.bad
+ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT.bad ${tools_dir}/grib_dump -O $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $OUTPUT
+diff $REF $OUTPUT
+cat $SNAPSHOT | tr 'a' 'b' > $SNAPSHOT.bad
+ECCODES_DEFINITIONS_SNAPSHOT=$SNAPSHOT.bad ${tools_dir}/grib_dump -O $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $OUTPUT
+diff $REF $OUTPUT
+
+rm -f $SNAPSHOT $SNAPSHOT.bad $REF $OUTPUT $LOG
@@ -0,0 +1,219 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Values decoded as float must be the narrowed double values */
+static void compare_float_double(codes_handle* h, const char* key)
+{
+    size_t i = 0, size = 0, dsize = 0, fsize = 0;
+    double* dvals = NULL;
+    float* fvals  = NULL;
+
+    if (!codes_is_defined(h, key))
+        return;
+
+    CODES_CHECK(codes_get_size(h, key, &size), 0);
+    dvals = (double*)malloc(size * sizeof(double));
+    fvals = (float*)malloc(size * sizeof(float));
+    assert(dvals && fvals);
+
+    dsize = fsize = size;
+    CODES_CHECK(codes_get_double_array(h, key, dvals, &dsize), 0);
+    CODES_CHECK(codes_get_float_array(h, key, fvals, &fsize), 0);
+    assert(dsize == size && fsize == size);
+
+    for (i = 0; i < size; i++) {
+        if (fvals[i] != (float)dvals[i]) {
+            fprintf(stderr, "%s[%lu]: float=%.9g double=%.17g\n", key, (unsigned long)i, fvals[i], dvals[i]);
+            exit(1);
+        }
+    }
+
+    /* Too small a buffer is reported like for doubles */
+    if (size > 1) {
+        fsize = size - 1;
+        assert(codes_get_float_array(h, key, fvals, &fsize) == CODES_ARRAY_TOO_SMALL);
+    }
+
+    free(dvals);
+    free(fvals);
+}
+
+/*
+ * Values converted with unitsFactor and unitsBias are only narrowed once as well.
+ * The decimal scaling keeps the decoded values from all being exact floats
+ */
+static void compare_units(codes_handle* h)
+{
+    size_t i = 0, size = 0;
+    double* dvals   = NULL;
+    float* fvals    = NULL;
+    codes_handle* c = codes_handle_clone(h);
+
+    assert(c);
+    CODES_CHECK(codes_set_long(c, "decimalScaleFactor", 1), 0);
+    CODES_CHECK(codes_get_size(c, "values", &size), 0);
+    dvals = (double*)malloc(size * sizeof(double));
+    fvals = (float*)malloc(size * sizeof(float));
+    assert(dvals && fvals);
+
+    /* Both are reset once the values have been decoded */
+    CODES_CHECK(codes_set_double(c, "unitsFactor", 1.0 / 3), 0);
+    CODES_CHECK(codes_set_double(c, "unitsBias", 1), 0);
+    CODES_CHECK(codes_get_float_array(c, "values", fvals, &size), 0);
+    CODES_CHECK(codes_set_double(c, "unitsFactor", 1.0 / 3), 0);
+    CODES_CHECK(codes_set_double(c, "unitsBias", 1), 0);
+    CODES_CHECK(codes_get_double_array(c, "values", dvals, &size), 0);
+
+    for (i = 0; i < size; i++) {
+        if (fvals[i] != (float)dvals[i]) {
+            fprintf(stderr, "values[%lu] in units: float=%.9g double=%.17g\n", (unsigned long)i, fvals[i], dvals[i]);
+            exit(1);
+        }
+    }
+
+    free(dvals);
+    free(fvals);
+    codes_handle_delete(c);
+}
+
+/* Setting floats must give the same message as setting the widened values */
+static void compare_set(codes_handle* h)
+{
+    size_t i = 0, size = 0, len1 = 0, len2 = 0;
+    float* fvals      = NULL;
+    double* dvals     = NULL;
+    codes_handle* h1  = codes_handle_clone(h);
+    codes_handle* h2  = codes_handle_clone(h);
+    const void *msg1 = NULL, *msg2 = NULL;
+
+    assert(h1 && h2);
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    fvals = (float*)malloc(size * sizeof(float));
+    dvals = (double*)malloc(size * sizeof(double));
+    assert(dvals && fvals);
+    CODES_CHECK(codes_get_float_array(h, "values", fvals, &size), 0);
+    for (i = 0; i < size; i++) {
+        fvals[i] = fvals[i] * 0.5f + 1.0f;
+        dvals[i] = fvals[i];
+    }
+
+    CODES_CHECK(codes_set_float_array(h1, "values", fvals, size), 0);
+    CODES_CHECK(codes_set_double_array(h2, "values", dvals, size), 0);
+    CODES_CHECK(codes_get_message(h1, &msg1, &len1), 0);
+    CODES_CHECK(codes_get_message(h2, &msg2, &len2), 0);
+    assert(len1 == len2);
+    assert(memcmp(msg1, msg2, len1) == 0);
+
+    free(fvals);
+    free(dvals);
+    codes_handle_delete(h1);
+    codes_handle_delete(h2);
+}
+
+/*
+ * Write the field repacked in IEEE single precision from the values got as float,
+ * which has to be what grib_set -r gives from the double values
+ */
+static void write_ieee(codes_handle* h, FILE* out)
+{
+    size_t size     = 0, len = 0;
+    float* fvals    = NULL;
+    const void* msg = NULL;
+    codes_handle* c = codes_handle_clone(h);
+
+    assert(c);
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    fvals = (float*)malloc(size * sizeof(float));
+    assert(fvals);
+    CODES_CHECK(codes_get_float_array(h, "values", fvals, &size), 0);
+
+    len = strlen("grid_ieee");
+    CODES_CHECK(codes_set_string(c, "packingType", "grid_ieee", &len), 0);
+    CODES_CHECK(codes_set_long(c, "precision", 1), 0);
+    CODES_CHECK(codes_set_float_array(c, "values", fvals, size), 0);
+    CODES_CHECK(codes_get_message(c, &msg, &len), 0);
+    assert(fwrite(msg, 1, len, out) == len);
+
+    free(fvals);
+    codes_handle_delete(c);
+}
+
+/* Put a bitmap on the field with every third point missing */
+static void add_bitmap(codes_handle* h)
+{
+    size_t i = 0, size = 0;
+    double* vals = NULL;
+
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    vals = (double*)malloc(size * sizeof(double));
+    assert(vals);
+    CODES_CHECK(codes_get_double_array(h, "values", vals, &size), 0);
+    for (i = 0; i < size; i++) {
+        if (i % 3 == 0)
+            vals[i] = 9999;
+        else
+            vals[i] += i % 7;
+    }
+    CODES_CHECK(codes_set_double(h, "missingValue", 9999), 0);
+    CODES_CHECK(codes_set_long(h, "bitmapPresent", 1), 0);
+    CODES_CHECK(codes_set_double_array(h, "values", vals, size), 0);
+    free(vals);
+}
+
+/*
+ * The fields of the first file are written in IEEE to the second file, with
+ * the bitmap added to the third and those repacked in IEEE to the fourth
+ */
+int main(int argc, char* argv[])
+{
+    int err  = 0;
+    FILE* in = NULL;
+    FILE *out_ieee = NULL, *out_bitmap = NULL, *out_bitmap_ieee = NULL;
+    codes_handle* h = NULL;
+    const void* msg = NULL;
+    size_t len      = 0;
+
+    assert(argc == 5);
+    in              = fopen(argv[1], "rb");
+    out_ieee        = fopen(argv[2], "wb");
+    out_bitmap      = fopen(argv[3], "wb");
+    out_bitmap_ieee = fopen(argv[4], "wb");
+    assert(in && out_ieee && out_bitmap && out_bitmap_ieee);
+
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_GRIB, &err)) != NULL) {
+        compare_float_double(h, "values");
+        compare_float_double(h, "codedValues");
+        compare_units(h);
+        compare_set(h);
+        write_ieee(h, out_ieee);
+
+        add_bitmap(h);
+        compare_float_double(h, "values");
+        compare_float_double(h, "codedValues");
+        compare_float_double(h, "bitmap");
+        compare_set(h);
+        CODES_CHECK(codes_get_message(h, &msg, &len), 0);
+        assert(fwrite(msg, 1, len, out_bitmap) == len);
+        write_ieee(h, out_bitmap_ieee);
+
+        codes_handle_delete(h);
+    }
+    assert(err == 0);
+    fclose(in);
+    fclose(out_ieee);
+    fclose(out_bitmap);
+    fclose(out_bitmap_ieee);
+    return 0;
+}
@@ -0,0 +1,40 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_float_array_test"
+TEMP=temp.$label.grib
+OUT_IEEE=temp.$label.ieee.grib
+OUT_BITMAP=temp.$label.bitmap.grib
+OUT_BITMAP_IEEE=temp.$label.bitmap_ieee.grib
+REF=temp.$label.ref.grib
+
+# Constant and non-constant fields with GRIB1 and GRIB2 simple packing,
+# plus CCSDS when it is enabled
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/gg_sfc_grib1.tmpl \
+    $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl > $TEMP
+
+if [ $HAVE_AEC -eq 1 ]; then
+    ${tools_dir}/grib_set -r -s packingType=grid_ccsds $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl temp.$label.1
+    cat temp.$label.1 >> $TEMP
+fi
+
+$EXEC ${test_dir}/grib_float_array $TEMP $OUT_IEEE $OUT_BITMAP $OUT_BITMAP_IEEE
+
+# Packing the float values in single precision gives what the tools give from the doubles
+${tools_dir}/grib_set -r -s packingType=grid_ieee,precision=1 $TEMP $REF
+cmp $REF $OUT_IEEE
+${tools_dir}/grib_set -r -s packingType=grid_ieee,precision=1 $OUT_BITMAP $REF
+cmp $REF $OUT_BITMAP_IEEE
+
+rm -f $TEMP $OUT_IEEE $OUT_BITMAP $OUT_BITMAP_IEEE $REF temp.$label.1
@@ -0,0 +1,36 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_handle_arena_test"
+TEMP=temp.$label.grib
+
+# Handles must decode the same with and without the arena, including
+# after a change of packing which reparses the data sections
+for f in gg_sfc_grib1 gg_sfc_grib2 reduced_gg_pl_32_grib2 sh_ml_grib2 regular_ll_sfc_grib1; do
+    sample=$ECCODES_SAMPLES_PATH/$f.tmpl
+    for a in 0 1; do
+        ECCODES_HANDLE_ARENA=$a ${tools_dir}/grib_dump -O $sample > temp.$label.$a.txt
+        ECCODES_HANDLE_ARENA=$a ${tools_dir}/grib_set -s edition=2,packingType=grid_second_order $sample $TEMP
+        ECCODES_HANDLE_ARENA=$a ${tools_dir}/grib_dump -O $TEMP >> temp.$label.$a.txt
+    done
+    cmp temp.$label.0.txt temp.$label.1.txt
+done
+
+for f in BUFR3 BUFR4_local_satellite; do
+    sample=$ECCODES_SAMPLES_PATH/$f.tmpl
+    for a in 0 1; do
+        ECCODES_HANDLE_ARENA=$a ${tools_dir}/bufr_dump -jf $sample > temp.$label.$a.txt
+    done
+    cmp temp.$label.0.txt temp.$label.1.txt
+done
+
+rm -f $TEMP temp.$label.0.txt temp.$label.1.txt
@@ -0,0 +1,142 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Check that sets done in an update (codes_handle_begin_update) give the same
+ * message as the same sets done one by one.
+ * The updated messages are written to the file given
+ */
+
+typedef struct key_value
+{
+    const char* key;
+    const char* value; /* set as a long if it is a number. NULL ends a batch */
+} key_value;
+
+static const key_value grib2_sets[] = {
+    { "typeOfLevel", "isobaricInhPa" }, { "level", "850" }, { "shortName", "t" }, { NULL, NULL },
+    { "typeOfSecondFixedSurface", "100" }, { "scaledValueOfSecondFixedSurface", "300" }, { NULL, NULL },
+    { "productDefinitionTemplateNumber", "1" }, { "number", "5" }, { "typeOfLevel", "surface" }, { NULL, NULL },
+    { "productDefinitionTemplateNumber", "11" }, { "perturbationNumber", "3" },
+    { "typeOfStatisticalProcessing", "1" }, { "stepRange", "0-6" }, { NULL, NULL },
+    { "gridType", "regular_gg" }, { "paramId", "130" }, { "typeOfLevel", "heightAboveGround" }, { "level", "2" }, { NULL, NULL },
+};
+
+static const key_value grib1_sets[] = {
+    { "indicatorOfTypeOfLevel", "100" }, { "level", "500" }, { "paramId", "130" }, { "stepRange", "0-12" }, { NULL, NULL },
+    { "typeOfLevel", "surface" }, { "shortName", "2t" }, { NULL, NULL },
+};
+
+static void set_batch(codes_handle* h, const key_value* kv, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        char* end  = NULL;
+        long v     = strtol(kv[i].value, &end, 10);
+        size_t len = strlen(kv[i].value);
+        if (*end)
+            CODES_CHECK(codes_set_string(h, kv[i].key, kv[i].value, &len), 0);
+        else
+            CODES_CHECK(codes_set_long(h, kv[i].key, v), 0);
+    }
+}
+
+static void compare_messages(codes_handle* h1, codes_handle* h2)
+{
+    const void *m1 = NULL, *m2 = NULL;
+    size_t s1 = 0, s2 = 0;
+    CODES_CHECK(codes_get_message(h1, &m1, &s1), 0);
+    CODES_CHECK(codes_get_message(h2, &m2, &s2), 0);
+    assert(s1 == s2);
+    assert(memcmp(m1, m2, s1) == 0);
+}
+
+static void test_sets(const char* sample, const key_value* sets, size_t count, FILE* out)
+{
+    codes_handle* h = codes_grib_handle_new_from_samples(NULL, sample);
+    size_t start = 0, end = 0, size = 0;
+    const void* msg = NULL;
+
+    assert(h);
+    for (start = 0; start < count; start = end + 1) {
+        codes_handle* plain   = codes_handle_clone(h);
+        codes_handle* updated = codes_handle_clone(h);
+        assert(plain && updated);
+        for (end = start; sets[end].key; end++)
+            ;
+
+        set_batch(plain, sets + start, end - start);
+
+        CODES_CHECK(codes_handle_begin_update(updated), 0);
+        set_batch(updated, sets + start, end - start);
+        CODES_CHECK(codes_handle_commit_update(updated), 0);
+        compare_messages(plain, updated);
+
+        /* Nested updates, and a message got before the commit */
+        codes_handle_delete(updated);
+        updated = codes_handle_clone(h);
+        CODES_CHECK(codes_handle_begin_update(updated), 0);
+        CODES_CHECK(codes_handle_begin_update(updated), 0);
+        set_batch(updated, sets + start, end - start);
+        CODES_CHECK(codes_handle_commit_update(updated), 0);
+        compare_messages(plain, updated);
+        CODES_CHECK(codes_handle_commit_update(updated), 0);
+        compare_messages(plain, updated);
+
+        CODES_CHECK(codes_get_message(updated, &msg, &size), 0);
+        assert(fwrite(msg, 1, size, out) == size);
+        codes_handle_delete(plain);
+        codes_handle_delete(updated);
+    }
+
+    /* A commit without an update */
+    assert(codes_handle_commit_update(h) == CODES_INVALID_ARGUMENT);
+    codes_handle_delete(h);
+}
+
+/* Keys got in an update are those of the message as it will be once committed */
+static void test_get_in_update(void)
+{
+    codes_handle* h = codes_grib_handle_new_from_samples(NULL, "GRIB2");
+    long number     = 0;
+
+    assert(h);
+    CODES_CHECK(codes_handle_begin_update(h), 0);
+    CODES_CHECK(codes_set_long(h, "productDefinitionTemplateNumber", 1), 0);
+    assert(codes_is_defined(h, "numberOfForecastsInEnsemble"));
+    CODES_CHECK(codes_get_long(h, "perturbationNumber", &number), 0);
+    CODES_CHECK(codes_set_long(h, "productDefinitionTemplateNumber", 0), 0);
+    assert(!codes_is_defined(h, "perturbationNumber"));
+    CODES_CHECK(codes_handle_commit_update(h), 0);
+    codes_handle_delete(h);
+}
+
+#define NUMBER(x) (sizeof(x) / sizeof(x[0]))
+
+int main(int argc, char* argv[])
+{
+    FILE* out = NULL;
+
+    assert(argc == 2);
+    out = fopen(argv[1], "wb");
+    assert(out);
+
+    test_sets("GRIB2", grib2_sets, NUMBER(grib2_sets), out);
+    test_sets("GRIB1", grib1_sets, NUMBER(grib1_sets), out);
+    test_get_in_update();
+
+    fclose(out);
+    return 0;
+}
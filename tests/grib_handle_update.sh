@@ -0,0 +1,39 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_handle_update_test"
+OUTPUT=temp.$label.out.grib
+REF=temp.$label.ref.grib
+TEMP=temp.$label.grib
+
+$EXEC ${test_dir}/grib_handle_update $OUTPUT
+
+# Each batch of keys set in an update gives what grib_set gives
+rm -f $REF
+for sets in \
+    typeOfLevel=isobaricInhPa,level=850,shortName=t \
+    typeOfSecondFixedSurface=100,scaledValueOfSecondFixedSurface=300 \
+    productDefinitionTemplateNumber=1,number=5,typeOfLevel=surface \
+    productDefinitionTemplateNumber=11,perturbationNumber=3,typeOfStatisticalProcessing=1,stepRange=0-6 \
+    gridType=regular_gg,paramId=130,typeOfLevel=heightAboveGround,level=2; do
+    ${tools_dir}/grib_set -s $sets $ECCODES_SAMPLES_PATH/GRIB2.tmpl $TEMP
+    cat $TEMP >> $REF
+done
+for sets in \
+    indicatorOfTypeOfLevel=100,level=500,paramId=130,stepRange=0-12 \
+    typeOfLevel=surface,shortName=2t; do
+    ${tools_dir}/grib_set -s $sets $ECCODES_SAMPLES_PATH/GRIB1.tmpl $TEMP
+    cat $TEMP >> $REF
+done
+cmp $REF $OUTPUT
+
+rm -f $OUTPUT $REF $TEMP
@@ -0,0 +1,43 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+set -u
+# ---------------------------------------------------------
+# Check the headers-only mode (-x) gives the same metadata
+# as reading the whole message, for GRIB1 and GRIB2
+# ---------------------------------------------------------
+label="grib_headers_only_test"
+tempGrib=temp.${label}.grib
+tempBmp=temp.${label}.bmp.grib
+tempFull=temp.${label}.full.txt
+tempHdrs=temp.${label}.hdrs.txt
+
+# GRIB2 with a bitmap in section 6
+${tools_dir}/grib_set -s bitmapPresent=1 $ECCODES_SAMPLES_PATH/regular_ll_sfc_grib2.tmpl $tempBmp
+
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $tempBmp > $tempGrib
+
+if [ $HAVE_AEC -eq 1 ]; then
+    ${tools_dir}/grib_set -r -s packingType=grid_ccsds $tempBmp $tempBmp.ccsds
+    cat $tempBmp.ccsds >> $tempGrib
+    rm -f $tempBmp.ccsds
+fi
+
+# The offsets show the reader is positioned correctly after each message
+keys=edition,centre,shortName,typeOfLevel,level,dataDate,stepRange,gridType,packingType,bitmapPresent,numberOfDataPoints,totalLength,md5Headers,offset
+${tools_dir}/grib_ls -p $keys $tempGrib > $tempFull
+${tools_dir}/grib_ls -x -p $keys $tempGrib > $tempHdrs
+diff $tempFull $tempHdrs
+
+rm -f $tempGrib $tempBmp $tempFull $tempHdrs
@@ -0,0 +1,109 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Check that handles created from a memory-mapped file match those read with stdio,
+ * that setting a key does not alter the file, that the mapping outlives codes_mapped_file_close
+ * and that decoding the values does not copy the message out of it.
+ * The messages got from the mapping are written to the second file and the first one
+ * with bitsPerValue set to 7 to the third, to be compared with the input and grib_set
+ */
+int main(int argc, char* argv[])
+{
+    int err  = 0;
+    FILE* in = NULL;
+    FILE *out = NULL, *out_set = NULL;
+    codes_mapped_file* mf = NULL;
+    codes_handle *hm = NULL, *hf = NULL;
+    codes_handle* kept = NULL;
+    const void *msg_m = NULL, *msg_f = NULL;
+    size_t size_m = 0, size_f = 0;
+    long offset_m = 0, offset_f = 0;
+    double* values = NULL;
+    void* copy     = NULL;
+
+    assert(argc == 4);
+
+    in = fopen(argv[1], "rb");
+    assert(in);
+    out     = fopen(argv[2], "wb");
+    out_set = fopen(argv[3], "wb");
+    assert(out && out_set);
+    mf = codes_mapped_file_open(NULL, argv[1], &err);
+    assert(mf && !err);
+
+    while ((hf = codes_handle_new_from_file(NULL, in, PRODUCT_ANY, &err)) != NULL) {
+        hm = codes_handle_new_from_mapped_file(NULL, mf, PRODUCT_ANY, &err);
+        assert(hm && !err);
+
+        CODES_CHECK(codes_get_message(hf, &msg_f, &size_f), 0);
+        CODES_CHECK(codes_get_message(hm, &msg_m, &size_m), 0);
+        assert(size_m == size_f);
+        assert(memcmp(msg_m, msg_f, size_m) == 0);
+
+        CODES_CHECK(codes_get_long(hf, "offset", &offset_f), 0);
+        CODES_CHECK(codes_get_long(hm, "offset", &offset_m), 0);
+        assert(offset_m == offset_f);
+
+        assert(fwrite(msg_m, 1, size_m, out) == size_m);
+        if (kept == NULL)
+            kept = hm; /* Deleted after the mapped file has been closed */
+        else
+            codes_handle_delete(hm);
+        codes_handle_delete(hf);
+    }
+    assert(!err);
+    hm = codes_handle_new_from_mapped_file(NULL, mf, PRODUCT_ANY, &err);
+    assert(hm == NULL && !err);
+
+    /* Modify the first message: other handles on the same message must not see it */
+    codes_mapped_file_rewind(mf);
+    hm = codes_handle_new_from_mapped_file(NULL, mf, PRODUCT_ANY, &err);
+    assert(hm && !err);
+    CODES_CHECK(codes_set_long(hm, "bitsPerValue", 7), 0);
+    CODES_CHECK(codes_get_message(hm, &msg_m, &size_m), 0);
+    assert(fwrite(msg_m, 1, size_m, out_set) == size_m);
+    codes_handle_delete(hm);
+
+    rewind(in);
+    hf = codes_handle_new_from_file(NULL, in, PRODUCT_ANY, &err);
+    assert(hf);
+    CODES_CHECK(codes_get_message(hf, &msg_f, &size_f), 0);
+    CODES_CHECK(codes_get_message(kept, &msg_m, &size_m), 0);
+    assert(size_m == size_f);
+    assert(memcmp(msg_m, msg_f, size_m) == 0);
+    codes_handle_delete(hf);
+
+    copy = malloc(size_m);
+    assert(copy);
+    memcpy(copy, msg_m, size_m);
+    codes_mapped_file_close(mf);
+
+    CODES_CHECK(codes_get_size(kept, "values", &size_f), 0);
+    values = (double*)malloc(size_f * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(kept, "values", values, &size_f), 0);
+    CODES_CHECK(codes_get_message(kept, &msg_f, &size_f), 0);
+    assert(msg_f == msg_m);
+    assert(memcmp(msg_m, copy, size_m) == 0);
+    free(values);
+    free(copy);
+    codes_handle_delete(kept);
+    fclose(in);
+    fclose(out);
+    fclose(out_set);
+
+    return 0;
+}
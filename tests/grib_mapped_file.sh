@@ -0,0 +1,35 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_mapped_file_test"
+TEMP=temp.$label.data
+OUTPUT=temp.$label.out.data
+OUTPUT_SET=temp.$label.set.grib
+REF_SET=temp.$label.ref.grib
+
+# Mix GRIB1, GRIB2 and BUFR messages
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR4.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR3.tmpl > $TEMP
+
+$EXEC ${test_dir}/grib_mapped_file $TEMP $OUTPUT $OUTPUT_SET
+
+# The messages of the mapping are those of the file
+cmp $TEMP $OUTPUT
+
+# Setting a key on a mapped message gives what grib_set gives
+${tools_dir}/grib_set -s bitsPerValue=7 $ECCODES_SAMPLES_PATH/GRIB1.tmpl $REF_SET
+cmp $REF_SET $OUTPUT_SET
+
+rm -f $TEMP $OUTPUT $OUTPUT_SET $REF_SET
@@ -0,0 +1,71 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+
+/*
+ * Check random access through the offset index gives the same messages as a sequential read.
+ * Messages are visited backwards so that each one is reached without reading the previous ones
+ */
+int main(int argc, char* argv[])
+{
+    int err = 0, count = 0, i = 0;
+    FILE* in = NULL;
+    codes_handle *h = NULL, *hn = NULL;
+    long* offsets = NULL;
+    const void *msg = NULL, *msg_n = NULL;
+    size_t size = 0, size_n = 0;
+    long offset = 0, cnt = 0;
+
+    assert(argc == 2);
+
+    CODES_CHECK(codes_count_in_filename(NULL, argv[1], &count), 0);
+    assert(count > 0);
+    offsets = (long*)malloc(count * sizeof(long));
+
+    in = fopen(argv[1], "rb");
+    assert(in);
+    i = 0;
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_ANY, &err)) != NULL) {
+        CODES_CHECK(codes_get_long(h, "offset", &offsets[i]), 0);
+        codes_handle_delete(h);
+        i++;
+    }
+    assert(i == count);
+
+    for (i = count; i >= 1; i--) {
+        hn = codes_handle_new_from_file_at(NULL, argv[1], i, &err);
+        assert(hn && !err);
+        CODES_CHECK(codes_get_long(hn, "offset", &offset), 0);
+        assert(offset == offsets[i - 1]);
+        CODES_CHECK(codes_get_long(hn, "count", &cnt), 0);
+        assert(cnt == i);
+
+        fseek(in, offset, SEEK_SET);
+        h = codes_handle_new_from_file(NULL, in, PRODUCT_ANY, &err);
+        assert(h);
+        CODES_CHECK(codes_get_message(h, &msg, &size), 0);
+        CODES_CHECK(codes_get_message(hn, &msg_n, &size_n), 0);
+        assert(size == size_n);
+        assert(memcmp(msg, msg_n, size) == 0);
+        codes_handle_delete(h);
+        codes_handle_delete(hn);
+    }
+
+    /* Out of range */
+    hn = codes_handle_new_from_file_at(NULL, argv[1], count + 1, &err);
+    assert(hn == NULL && err);
+
+    fclose(in);
+    free(offsets);
+    printf("%d\n", count);
+    return 0;
+}
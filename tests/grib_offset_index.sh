@@ -0,0 +1,57 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_offset_index_test"
+TEMP=temp.$label.data
+OUTPUT=temp.$label.txt
+
+rm -f $TEMP.offsets
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR4.tmpl \
+    $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl > $TEMP
+
+# The index is created on first use
+$EXEC ${test_dir}/grib_offset_index $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 4 ]
+[ -f $TEMP.offsets ]
+
+# A stale index must be rebuilt
+cat $ECCODES_SAMPLES_PATH/BUFR3.tmpl >> $TEMP
+$EXEC ${test_dir}/grib_offset_index $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 5 ]
+count=`${tools_dir}/codes_count $TEMP`
+[ $count -eq 5 ]
+
+# A corrupt index is ignored
+echo "garbage" > $TEMP.offsets
+count=`${tools_dir}/codes_count $TEMP`
+[ $count -eq 5 ]
+
+# A data file replaced by one of the same size and mtime must not use the old index
+cat $ECCODES_SAMPLES_PATH/GRIB1.tmpl $ECCODES_SAMPLES_PATH/GRIB2.tmpl > $TEMP
+$EXEC ${test_dir}/grib_offset_index $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 2 ]
+cat $ECCODES_SAMPLES_PATH/GRIB2.tmpl $ECCODES_SAMPLES_PATH/GRIB1.tmpl > $TEMP.new
+touch -r $TEMP $TEMP.new
+mv $TEMP.new $TEMP
+$EXEC ${test_dir}/grib_offset_index $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 2 ]
+
+# An index which cannot be saved is kept in memory
+rm -f $TEMP.offsets
+mkdir $TEMP.offsets
+$EXEC ${test_dir}/grib_offset_index $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 2 ]
+rmdir $TEMP.offsets
+
+rm -f $TEMP $TEMP.offsets $OUTPUT
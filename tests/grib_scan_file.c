@@ -0,0 +1,57 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include <assert.h>
+#include "grib_api_internal.h"
+
+/*
+ * Check the parallel scanner finds the same messages as a sequential read,
+ * whatever the number of chunks the file is cut into
+ */
+int main(int argc, char* argv[])
+{
+    int err = 0, nthreads = 0;
+    long count = 0, n = 0, i = 0;
+    FILE* in = NULL;
+    off_t offset = 0;
+    size_t length = 0;
+    off_t* offsets = NULL;
+    size_t* lengths = NULL;
+    off_t seq_offsets[1000];
+    size_t seq_lengths[1000];
+
+    assert(argc == 2);
+
+    in = fopen(argv[1], "rb");
+    assert(in);
+    while ((err = grib_scan_any_from_file(in, &offset, &length)) == GRIB_SUCCESS) {
+        assert(n < 1000);
+        seq_offsets[n] = offset;
+        seq_lengths[n] = length;
+        n++;
+    }
+    assert(err == GRIB_END_OF_FILE);
+    fclose(in);
+
+    for (nthreads = 1; nthreads <= 64; nthreads++) {
+        err = grib_scan_file(NULL, argv[1], PRODUCT_ANY, nthreads, &offsets, &lengths, &count);
+        assert(!err);
+        assert(count == n);
+        for (i = 0; i < n; i++) {
+            assert(offsets[i] == seq_offsets[i]);
+            assert(lengths[i] == seq_lengths[i]);
+        }
+        free(offsets);
+        free(lengths);
+    }
+
+    printf("%ld\n", n);
+    return 0;
+}
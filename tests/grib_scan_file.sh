@@ -0,0 +1,60 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_scan_file_test"
+TEMP=temp.$label.data
+OUTPUT=temp.$label.txt
+
+tempRules=temp.$label.filter
+tempGrib1=temp.$label.1.grib
+tempGrib2=temp.$label.2.grib
+
+# Messages whose data contain false magics, which must not
+# be taken for the start of a message
+cat > $tempRules <<EOF
+  set Ni=4; set Nj=4;
+  set bitsPerValue=8;
+  set values={0,255,71,82,73,66,66,85,70,82,1,2,3,4,5,6};
+  write;
+EOF
+${tools_dir}/grib_filter -o $tempGrib1 $tempRules $ECCODES_SAMPLES_PATH/GRIB1.tmpl
+${tools_dir}/grib_filter -o $tempGrib2 $tempRules $ECCODES_SAMPLES_PATH/GRIB2.tmpl
+
+# Some junk between messages
+printf "junk" > $TEMP
+cat $tempGrib1 >> $TEMP
+printf "junk" >> $TEMP
+cat $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR4.tmpl \
+    $tempGrib2 $tempGrib1 $tempGrib2 $tempGrib2 >> $TEMP
+printf "junk" >> $TEMP
+cat $ECCODES_SAMPLES_PATH/GRIB2.tmpl \
+    $ECCODES_SAMPLES_PATH/BUFR3.tmpl \
+    $ECCODES_SAMPLES_PATH/regular_ll_sfc_grib1.tmpl >> $TEMP
+
+$EXEC ${test_dir}/grib_scan_file $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 10 ] || exit 1
+
+# The tools must agree
+${tools_dir}/codes_count $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 10 ] || exit 1
+${tools_dir}/grib_count $TEMP > $OUTPUT
+[ `cat $OUTPUT` -eq 8 ] || exit 1
+
+${tools_dir}/codes_split_file -1 $TEMP
+[ -f ${TEMP}_010 ]
+cat ${TEMP}_0?? > $TEMP.joined
+${tools_dir}/grib_count $TEMP.joined > $OUTPUT
+[ `cat $OUTPUT` -eq 8 ] || exit 1
+${tools_dir}/grib_compare $TEMP $TEMP.joined
+
+rm -f $TEMP $TEMP.joined ${TEMP}_0?? $OUTPUT $tempRules $tempGrib1 $tempGrib2
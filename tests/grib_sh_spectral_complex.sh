@@ -11,6 +11,11 @@
 . ./include.sh
 
 TEMP=output.grib_sh_spectral_complex.grib
+ERRLOG=temp.grib_sh_spectral_complex.log
 $EXEC ${test_dir}/grib_sh_spectral_complex
 
-rm -f $TEMP
+# Coefficients all above the reference value must not be reported as negative
+${tools_dir}/grib_set -s offsetValuesBy=100 $ECCODES_SAMPLES_PATH/sh_sfc_grib1.tmpl $TEMP 2>$ERRLOG
+[ ! -s $ERRLOG ]
+
+rm -f $TEMP $ERRLOG
@@ -0,0 +1,311 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Decode fields with complex packing and spatial differencing (template 5.3)
+ * written here, as ecCodes only encodes them without differencing nor missing
+ * values, and compare them with the values they were made from.
+ * Every order of differencing, missing value management and a range of
+ * widths of the group references are covered, decoding with one thread and
+ * with several.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SAMPLE "reduced_gg_pl_128_grib2"
+#define EXTRA_OCTETS 4
+#define WIDTH_BITS 5
+#define LENGTH_BITS 12
+
+/* R, E and D of the fields */
+#define REFERENCE_VALUE -50.0
+#define REFERENCE_VALUE_IEEE 0xC2480000UL
+#define BINARY_SCALE_FACTOR -2
+#define DECIMAL_SCALE_FACTOR 1
+
+static unsigned long seed = 12345;
+
+static unsigned long next_random(unsigned long n)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) & 0xffffff) % n;
+}
+
+typedef struct bit_writer
+{
+    unsigned char* p;
+    size_t bitp;
+} bit_writer;
+
+/* Cleared memory is expected */
+static void put_bits(bit_writer* w, unsigned long val, int nbits)
+{
+    int i;
+    for (i = nbits - 1; i >= 0; i--, w->bitp++) {
+        if ((val >> i) & 1)
+            w->p[w->bitp / 8] |= 1 << (7 - w->bitp % 8);
+    }
+}
+
+/* The next part starts on a byte of its own */
+static void align(bit_writer* w)
+{
+    w->bitp = (w->bitp + 7) / 8 * 8;
+}
+
+static void put_octets(unsigned char* p, unsigned long val, int n)
+{
+    int i;
+    for (i = n - 1; i >= 0; i--, val >>= 8)
+        p[i] = (unsigned char)(val & 0xff);
+}
+
+typedef struct group
+{
+    unsigned long ref;
+    int width;
+    long length;
+} group;
+
+/*
+ * Split the n values into groups of random lengths and widths and fill them:
+ * s are the differences less the bias as stored, and missing tells which
+ * values are missing. Returns the number of groups.
+ */
+static long make_groups(long n, int bits, int mvm, group* groups, unsigned long* s, int* missing)
+{
+    const unsigned long maxref = (1UL << bits) - 1;
+    long ng = 0, i = 0, j = 0;
+
+    while (i < n) {
+        group* g = &groups[ng++];
+        g->length = 1 + (long)next_random(next_random(8) ? 64 : 1 << LENGTH_BITS);
+        if (g->length > n - i)
+            g->length = n - i;
+        /* Mostly narrow groups, some as wide as the references and a few wider */
+        switch (next_random(8)) {
+            case 0:
+                g->width = 0;
+                break;
+            case 1:
+                g->width = bits;
+                break;
+            case 2:
+                g->width = bits + 1 + (int)next_random(30 - bits);
+                g->length = g->length > 16 ? 16 : g->length;
+                break;
+            default:
+                g->width = 1 + (int)next_random(bits / 2);
+        }
+        g->ref = next_random(maxref + 1 - mvm);
+
+        if (g->width == 0) {
+            /* All values are the reference, which can be a missing value */
+            if (mvm && next_random(4) == 0)
+                g->ref = maxref - next_random(mvm);
+            for (j = 0; j < g->length; j++, i++) {
+                s[i]       = g->ref;
+                missing[i] = mvm && g->ref >= maxref + 1 - mvm;
+            }
+        }
+        else {
+            /* The mvm largest values of the width flag missing values */
+            const unsigned long maxn = (1UL << g->width) - 1;
+            for (j = 0; j < g->length; j++, i++) {
+                if (maxn + 1 <= (unsigned long)mvm || (mvm && next_random(16) == 0)) {
+                    s[i]       = g->ref + maxn - next_random(mvm);
+                    missing[i] = 1;
+                }
+                else {
+                    s[i]       = g->ref + next_random(maxn + 1 - mvm);
+                    missing[i] = 0;
+                }
+            }
+        }
+    }
+    return ng;
+}
+
+/* A message with its section 5 and 7 replaced by a field of the given kind */
+static unsigned char* make_message(codes_handle* sample, int order, int mvm, int bits, double* expected, size_t* msg_len)
+{
+    const unsigned long extras[2] = { 100000, 100005 };
+    const long bias               = -(1L << (bits - 1));
+    long offset5 = 0, offset6 = 0, length6 = 0, ng = 0, i = 0;
+    size_t n = 0, len = 0, len7 = 0, pos = 0, value_bits = 0;
+    double missing_value = 0;
+    const void* msg = NULL;
+    unsigned char *out = NULL, *sec5 = NULL, *sec7 = NULL;
+    unsigned long* s   = NULL;
+    int* missing       = NULL;
+    group* groups      = NULL;
+    bit_writer w;
+    unsigned long last = 0, penultimate = 0;
+    long seen          = 0;
+
+    CODES_CHECK(codes_get_size(sample, "values", &n), 0);
+    CODES_CHECK(codes_get_message(sample, &msg, &len), 0);
+    CODES_CHECK(codes_get_long(sample, "offsetSection5", &offset5), 0);
+    CODES_CHECK(codes_get_long(sample, "offsetSection6", &offset6), 0);
+    CODES_CHECK(codes_get_long(sample, "section6Length", &length6), 0);
+    CODES_CHECK(codes_get_double(sample, "missingValue", &missing_value), 0);
+
+    s       = (unsigned long*)malloc(n * sizeof(unsigned long));
+    missing = (int*)malloc(n * sizeof(int));
+    groups  = (group*)malloc(n * sizeof(group));
+    assert(s && missing && groups);
+    ng = make_groups(n, bits, mvm, groups, s, missing);
+
+    /* The values the decoder has to find */
+    for (i = 0; i < (long)n; i++) {
+        long x = 0;
+        if (missing[i]) {
+            expected[i] = missing_value;
+            continue;
+        }
+        if (seen < order)
+            x = (long)extras[seen++];
+        else if (order == 1)
+            x = (long)(s[i] + bias + last);
+        else
+            x = (long)(s[i] + bias + 2 * last - penultimate);
+        penultimate = last;
+        last        = (unsigned long)x;
+        expected[i] = (x * 0.25 + REFERENCE_VALUE) * 0.1; /* (x*2^E+R)*10^-D */
+    }
+
+    /* Extra descriptors and the three arrays of the groups, each byte aligned, then the values */
+    for (i = 0; i < ng; i++)
+        value_bits += groups[i].width * groups[i].length;
+    len7 = 5 + ((order + 1) * EXTRA_OCTETS * 8 + ng * bits + 7) / 8;
+    len7 += (ng * WIDTH_BITS + 7) / 8 + (ng * LENGTH_BITS + 7) / 8 + (value_bits + 7) / 8;
+
+    *msg_len = offset5 + 49 + length6 + len7 + 4;
+    out      = (unsigned char*)calloc(*msg_len, 1);
+    assert(out);
+    memcpy(out, msg, offset5);
+    put_octets(out + 8, *msg_len, 8);
+
+    sec5 = out + offset5;
+    put_octets(sec5, 49, 4);
+    sec5[4] = 5;
+    put_octets(sec5 + 5, n, 4);
+    put_octets(sec5 + 9, 3, 2);
+    put_octets(sec5 + 11, REFERENCE_VALUE_IEEE, 4);
+    put_octets(sec5 + 15, 0x8000 | -BINARY_SCALE_FACTOR, 2);
+    put_octets(sec5 + 17, DECIMAL_SCALE_FACTOR, 2);
+    sec5[19] = bits;
+    sec5[20] = 0; /* floating point */
+    sec5[21] = 1; /* general group splitting */
+    sec5[22] = mvm;
+    put_octets(sec5 + 23, 0xffffffff, 4);
+    put_octets(sec5 + 27, 0xfffffffe, 4);
+    put_octets(sec5 + 31, ng, 4);
+    sec5[35] = 0; /* reference for the group widths */
+    sec5[36] = WIDTH_BITS;
+    put_octets(sec5 + 37, 1, 4); /* reference for the group lengths */
+    sec5[41] = 1;                /* length increment */
+    put_octets(sec5 + 42, groups[ng - 1].length, 4);
+    sec5[46] = LENGTH_BITS;
+    sec5[47] = order;
+    sec5[48] = EXTRA_OCTETS;
+
+    memcpy(sec5 + 49, (const unsigned char*)msg + offset6, length6);
+
+    sec7    = sec5 + 49 + length6;
+    sec7[4] = 7;
+    w.p     = sec7 + 5;
+    w.bitp  = 0;
+    for (i = 0; i < order; i++)
+        put_bits(&w, extras[i], 8 * EXTRA_OCTETS);
+    put_bits(&w, (1UL << (8 * EXTRA_OCTETS - 1)) | (unsigned long)-bias, 8 * EXTRA_OCTETS); /* sign and magnitude */
+    for (i = 0; i < ng; i++)
+        put_bits(&w, groups[i].ref, bits);
+    align(&w);
+    for (i = 0; i < ng; i++)
+        put_bits(&w, groups[i].width, WIDTH_BITS);
+    align(&w);
+    for (i = 0; i < ng; i++)
+        put_bits(&w, groups[i].length - 1, LENGTH_BITS);
+    align(&w);
+    for (i = 0; i < ng; i++) {
+        long j = 0;
+        if (groups[i].width == 0) {
+            pos += groups[i].length;
+            continue;
+        }
+        for (j = 0; j < groups[i].length; j++, pos++)
+            put_bits(&w, s[pos] - groups[i].ref, groups[i].width);
+    }
+    align(&w);
+    assert(5 + w.bitp / 8 == len7);
+    put_octets(sec7, len7, 4);
+    memcpy(sec7 + len7, "7777", 4);
+
+    free(s);
+    free(missing);
+    free(groups);
+    return out;
+}
+
+static void check(const unsigned char* msg, size_t len, const double* expected, size_t n, int threads)
+{
+    codes_handle* h = codes_handle_new_from_message(NULL, msg, len);
+    double* vals    = (double*)malloc(n * sizeof(double));
+    size_t size     = n;
+    size_t i        = 0;
+
+    assert(h && vals);
+    codes_context_set_threads(NULL, threads);
+    CODES_CHECK(codes_get_double_array(h, "values", vals, &size), 0);
+    assert(size == n);
+    for (i = 0; i < n; i++) {
+        if (vals[i] != expected[i]) {
+            fprintf(stderr, "value %lu: %.17g instead of %.17g (%d threads)\n",
+                    (unsigned long)i, vals[i], expected[i], threads);
+            exit(1);
+        }
+    }
+    codes_context_set_threads(NULL, 1);
+    codes_handle_delete(h);
+    free(vals);
+}
+
+int main(int argc, char* argv[])
+{
+    codes_handle* sample = codes_grib_handle_new_from_samples(NULL, SAMPLE);
+    double* expected     = NULL;
+    size_t n             = 0;
+    int order = 0, mvm = 0, bits = 0;
+
+    assert(sample);
+    CODES_CHECK(codes_get_size(sample, "values", &n), 0);
+    expected = (double*)malloc(n * sizeof(double));
+    assert(expected);
+
+    for (order = 1; order <= 2; order++) {
+        for (mvm = 0; mvm <= 2; mvm++) {
+            for (bits = 8; bits <= 24; bits += 4) {
+                size_t len         = 0;
+                unsigned char* msg = make_message(sample, order, mvm, bits, expected, &len);
+                check(msg, len, expected, n, 1);
+                check(msg, len, expected, n, 3);
+                free(msg);
+            }
+        }
+    }
+
+    codes_handle_delete(sample);
+    free(expected);
+    return 0;
+}
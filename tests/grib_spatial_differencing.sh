@@ -0,0 +1,15 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+# Orders 1 and 2, missing value management 0 to 2, references of 8 to 24 bits.
+# Fields are split across threads even though they are small
+ECCODES_THREADS_MIN_VALUES=1 $EXEC ${test_dir}/grib_spatial_differencing
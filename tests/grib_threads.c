@@ -0,0 +1,103 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Encode vals into a copy of h using the given number of threads */
+static codes_handle* encode(codes_handle* h, int threads, const double* vals, size_t size)
+{
+    codes_handle* h2 = codes_handle_clone(h);
+    assert(h2);
+    codes_context_set_threads(NULL, threads);
+    CODES_CHECK(codes_set_double_array(h2, "values", vals, size), 0);
+    return h2;
+}
+
+/* Decode the message of h using the given number of threads */
+static double* decode(codes_handle* h, int threads, size_t size)
+{
+    const void* msg  = NULL;
+    size_t len       = 0;
+    double* vals     = (double*)malloc(size * sizeof(double));
+    codes_handle* h2 = NULL;
+
+    assert(vals);
+    CODES_CHECK(codes_get_message(h, &msg, &len), 0);
+    h2 = codes_handle_new_from_message_copy(NULL, msg, len);
+    assert(h2);
+    codes_context_set_threads(NULL, threads);
+    CODES_CHECK(codes_get_double_array(h2, "values", vals, &size), 0);
+    codes_handle_delete(h2);
+    return vals;
+}
+
+/*
+ * Messages and values must not depend on the number of threads.
+ * The messages encoded are written to the second file
+ */
+int main(int argc, char* argv[])
+{
+    const int threads = 3;
+    int err = 0;
+    size_t i = 0, size = 0, len1 = 0, len2 = 0;
+    FILE *in = NULL, *out = NULL;
+    codes_handle* h = NULL;
+
+    assert(argc == 3);
+    in  = fopen(argv[1], "rb");
+    out = fopen(argv[2], "wb");
+    assert(in && out);
+
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_GRIB, &err)) != NULL) {
+        const void *msg1 = NULL, *msg2 = NULL;
+        codes_handle *h1 = NULL, *h2 = NULL;
+        double *vals = NULL, *vals1 = NULL, *vals2 = NULL;
+
+        CODES_CHECK(codes_get_size(h, "values", &size), 0);
+        vals = (double*)malloc(size * sizeof(double));
+        assert(vals);
+        CODES_CHECK(codes_get_double_array(h, "values", vals, &size), 0);
+        for (i = 0; i < size; i++)
+            vals[i] += 10 * sin(i * 0.01);
+
+        h1 = encode(h, 1, vals, size);
+        h2 = encode(h, threads, vals, size);
+        CODES_CHECK(codes_get_message(h1, &msg1, &len1), 0);
+        CODES_CHECK(codes_get_message(h2, &msg2, &len2), 0);
+        assert(len1 == len2);
+        assert(memcmp(msg1, msg2, len1) == 0);
+        assert(fwrite(msg1, 1, len1, out) == len1);
+
+        vals1 = decode(h1, 1, size);
+        vals2 = decode(h1, threads, size);
+        for (i = 0; i < size; i++) {
+            if (vals1[i] != vals2[i]) {
+                fprintf(stderr, "values[%lu]: %.17g != %.17g\n", (unsigned long)i, vals1[i], vals2[i]);
+                exit(1);
+            }
+        }
+
+        free(vals);
+        free(vals1);
+        free(vals2);
+        codes_handle_delete(h1);
+        codes_handle_delete(h2);
+        codes_handle_delete(h);
+    }
+    assert(err == 0);
+    fclose(in);
+    fclose(out);
+    codes_context_set_threads(NULL, 1);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_threads_test"
+TEMP=temp.$label.grib
+OUTPUT=temp.$label.out.grib
+REF1=temp.$label.ref1
+REF3=temp.$label.ref3
+
+# Simple, complex with spatial differencing, spectral complex and CCSDS
+# packing, split across threads even though the fields are small
+cat $ECCODES_SAMPLES_PATH/gg_sfc_grib1.tmpl \
+    $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib1.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib2.tmpl > $TEMP
+${tools_dir}/grib_set -r -s packingType=grid_complex_spatial_differencing $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl temp.$label.1
+cat temp.$label.1 >> $TEMP
+
+if [ $HAVE_AEC -eq 1 ]; then
+    ${tools_dir}/grib_set -r -s packingType=grid_ccsds $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl temp.$label.1
+    cat temp.$label.1 >> $TEMP
+fi
+
+ECCODES_THREADS_MIN_VALUES=1 $EXEC ${test_dir}/grib_threads $TEMP $OUTPUT
+
+# The tools give the same messages and values with one thread and with several
+ECCODES_THREADS=1 ${tools_dir}/grib_set -r $TEMP $REF1
+ECCODES_THREADS=3 ECCODES_THREADS_MIN_VALUES=1 ${tools_dir}/grib_set -r $TEMP $REF3
+cmp $REF1 $REF3
+
+ECCODES_THREADS=1 ${tools_dir}/grib_get_data $OUTPUT > $REF1
+ECCODES_THREADS=3 ECCODES_THREADS_MIN_VALUES=1 ${tools_dir}/grib_get_data $OUTPUT > $REF3
+diff $REF1 $REF3
+
+rm -f $TEMP $OUTPUT $REF1 $REF3 temp.$label.1
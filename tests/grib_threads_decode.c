@@ -0,0 +1,165 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Decode throughput against the number of threads.
+ *
+ * The messages of the input file are read into memory, then every thread
+ * decodes all of them 'iterations' times, each message through its own
+ * handle. This is done with 1, 2, 4... up to max_threads threads and the
+ * rate and speedup over one thread are printed. All the runs must give the
+ * same checksum of the decoded keys and values.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+static void** messages  = NULL;
+static size_t* lengths  = NULL;
+static size_t nmessages = 0;
+static long iterations  = 0;
+
+typedef struct worker
+{
+    pthread_t thread;
+    double checksum;
+} worker;
+
+static double decode_message(const void* msg, size_t len)
+{
+    codes_handle* h = codes_handle_new_from_message(NULL, msg, len);
+    double sum      = 0;
+    double* values  = NULL;
+    size_t i = 0, size = 0;
+    long level    = 0;
+    char name[64] = {0,};
+    size_t nlen   = sizeof(name);
+
+    assert(h);
+    CODES_CHECK(codes_get_string(h, "shortName", name, &nlen), 0);
+    CODES_CHECK(codes_get_long(h, "level", &level), 0);
+    CODES_CHECK(codes_get_size(h, "values", &size), 0);
+    values = (double*)malloc(size * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(h, "values", values, &size), 0);
+
+    for (i = 0; i < size; i++)
+        sum += values[i];
+    sum += level + strlen(name);
+
+    free(values);
+    codes_handle_delete(h);
+    return sum;
+}
+
+static void* run(void* data)
+{
+    worker* w = (worker*)data;
+    long n    = 0;
+    size_t i  = 0;
+
+    w->checksum = 0;
+    for (n = 0; n < iterations; n++) {
+        for (i = 0; i < nmessages; i++)
+            w->checksum += decode_message(messages[i], lengths[i]);
+    }
+    return NULL;
+}
+
+static double now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static void read_messages(const char* path)
+{
+    int err         = 0;
+    codes_handle* h = NULL;
+    FILE* in        = fopen(path, "rb");
+
+    assert(in);
+    while ((h = codes_handle_new_from_file(NULL, in, PRODUCT_GRIB, &err)) != NULL) {
+        const void* msg = NULL;
+        size_t len      = 0;
+        CODES_CHECK(codes_get_message(h, &msg, &len), 0);
+        messages = (void**)realloc(messages, (nmessages + 1) * sizeof(void*));
+        lengths  = (size_t*)realloc(lengths, (nmessages + 1) * sizeof(size_t));
+        assert(messages && lengths);
+        messages[nmessages] = malloc(len);
+        assert(messages[nmessages]);
+        memcpy(messages[nmessages], msg, len);
+        lengths[nmessages++] = len;
+        codes_handle_delete(h);
+    }
+    assert(err == 0 && nmessages > 0);
+    fclose(in);
+}
+
+int main(int argc, char* argv[])
+{
+    int max_threads = 0, nthreads = 0, i = 0;
+    double rate1 = 0, checksum1 = 0;
+    worker* workers = NULL;
+
+    if (argc != 4) {
+        fprintf(stderr, "Usage: %s file max_threads iterations\n", argv[0]);
+        return 1;
+    }
+    max_threads = atoi(argv[2]);
+    iterations  = atol(argv[3]);
+    assert(max_threads > 0 && iterations > 0);
+
+    read_messages(argv[1]);
+    workers = (worker*)calloc(max_threads, sizeof(worker));
+    assert(workers);
+
+    /* Warm up the definitions and the caches of the context */
+    decode_message(messages[0], lengths[0]);
+
+    printf("%8s %14s %8s\n", "threads", "messages/s", "speedup");
+    for (nthreads = 1;; nthreads *= 2) {
+        double start = now(), elapsed = 0, rate = 0;
+
+        if (nthreads > max_threads)
+            nthreads = max_threads;
+
+        for (i = 0; i < nthreads; i++) {
+            int err = pthread_create(&workers[i].thread, NULL, run, &workers[i]);
+            assert(err == 0);
+        }
+        for (i = 0; i < nthreads; i++)
+            pthread_join(workers[i].thread, NULL);
+        elapsed = now() - start;
+
+        rate = nthreads * iterations * nmessages / (elapsed > 0 ? elapsed : 1e-9);
+        if (nthreads == 1) {
+            rate1     = rate;
+            checksum1 = workers[0].checksum;
+        }
+        for (i = 0; i < nthreads; i++)
+            assert(workers[i].checksum == checksum1);
+        printf("%8d %14.1f %8.2f\n", nthreads, rate, rate / rate1);
+        if (nthreads == max_threads)
+            break;
+    }
+
+    for (i = 0; i < (int)nmessages; i++)
+        free(messages[i]);
+    free(messages);
+    free(lengths);
+    free(workers);
+    return 0;
+}
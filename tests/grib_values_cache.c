@@ -0,0 +1,150 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+#include "eccodes.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Check that the values kept by the values cache are those decoded without
+ * it, also after keys changing them are set and when the budget makes the
+ * cache drop the values of other handles
+ */
+
+static double* get_values(codes_handle* h, size_t* size)
+{
+    double* values = NULL;
+    CODES_CHECK(codes_get_size(h, "values", size), 0);
+    values = (double*)malloc(*size * sizeof(double));
+    assert(values);
+    CODES_CHECK(codes_get_double_array(h, "values", values, size), 0);
+    return values;
+}
+
+/* The values of the message decoded by a handle with nothing cached */
+static double* decode(codes_handle* h, size_t* size)
+{
+    const void* msg   = NULL;
+    size_t len        = 0;
+    double* values    = NULL;
+    codes_handle* h2  = NULL;
+
+    CODES_CHECK(codes_get_message(h, &msg, &len), 0);
+    h2 = codes_handle_new_from_message_copy(NULL, msg, len);
+    assert(h2);
+    codes_context_set_values_cache_size(NULL, 0);
+    values = get_values(h2, size);
+    codes_handle_delete(h2);
+    return values;
+}
+
+static void check_values(codes_handle* h, size_t budget)
+{
+    size_t size = 0, size2 = 0, i = 0;
+    double *values = NULL, *expected = NULL, average = 0, v = 0;
+    float* fvalues  = NULL;
+    int index[2]    = {0,};
+    double two[2]   = {0,};
+    int err         = 0;
+    codes_key_id* k = codes_key_compile(NULL, "values", &err);
+
+    assert(k && !err);
+    expected = decode(h, &size2);
+    codes_context_set_values_cache_size(NULL, budget);
+
+    /* Twice, the second from the cache, and after the average */
+    for (i = 0; i < 2; i++) {
+        values = get_values(h, &size);
+        assert(size == size2 && memcmp(values, expected, size * sizeof(double)) == 0);
+        free(values);
+    }
+    CODES_CHECK(codes_get_double(h, "average", &average), 0);
+    values = get_values(h, &size);
+    assert(memcmp(values, expected, size * sizeof(double)) == 0);
+
+    fvalues = (float*)malloc(size * sizeof(float));
+    assert(fvalues);
+    CODES_CHECK(codes_get_float_array(h, "values", fvalues, &size), 0);
+    for (i = 0; i < size; i++)
+        assert(fvalues[i] == (float)expected[i]);
+
+    /* Through a compiled key as well */
+    memset(values, 0, size * sizeof(double));
+    CODES_CHECK(codes_get_double_array_by_id(h, k, values, &size), 0);
+    assert(size == size2 && memcmp(values, expected, size * sizeof(double)) == 0);
+    memset(fvalues, 0, size * sizeof(float));
+    CODES_CHECK(codes_get_float_array_by_id(h, k, fvalues, &size), 0);
+    for (i = 0; i < size; i++)
+        assert(fvalues[i] == (float)expected[i]);
+    free(fvalues);
+    codes_key_delete(k);
+
+    CODES_CHECK(codes_get_double_element(h, "values", (int)(size - 1), &v), 0);
+    assert(v == expected[size - 1]);
+    index[0] = 0;
+    index[1] = (int)(size / 2);
+    CODES_CHECK(codes_get_double_elements(h, "values", index, 2, two), 0);
+    assert(two[0] == expected[0] && two[1] == expected[size / 2]);
+
+    /* Too small a buffer fails as without the cache */
+    size2 = size - 1;
+    assert(codes_get_double_array(h, "values", values, &size2) == CODES_ARRAY_TOO_SMALL);
+
+    free(values);
+    free(expected);
+}
+
+static void edit(codes_handle* h)
+{
+    size_t size = 0, i = 0;
+    double* values = get_values(h, &size);
+
+    for (i = 0; i < size; i++)
+        values[i] = values[i] * 2 + i % 7;
+    CODES_CHECK(codes_set_double_array(h, "values", values, size), 0);
+    free(values);
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t budget = 1024 * 1024;
+    codes_handle *h1 = NULL, *h2 = NULL;
+
+    h1 = codes_grib_handle_new_from_samples(NULL, "regular_ll_sfc_grib2");
+    h2 = codes_grib_handle_new_from_samples(NULL, "sh_ml_grib2");
+    assert(h1 && h2);
+
+    check_values(h1, budget);
+    check_values(h2, budget);
+
+    /* Setting the values, or keys they are decoded with */
+    edit(h1);
+    check_values(h1, budget);
+    CODES_CHECK(codes_set_long(h1, "decimalScaleFactor", 1), 0);
+    check_values(h1, budget);
+    CODES_CHECK(codes_set_double(h1, "missingValue", 9999), 0);
+    CODES_CHECK(codes_set_long(h1, "bitmapPresent", 1), 0);
+    check_values(h1, budget);
+    edit(h2);
+    check_values(h2, budget);
+
+    /* A budget with room for the values of one handle only */
+    check_values(h1, 4200 * sizeof(double));
+    check_values(h2, 4200 * sizeof(double));
+    check_values(h1, 4200 * sizeof(double));
+
+    /* Deleting a handle with cached values, and one using a cache without room */
+    codes_handle_delete(h2);
+    check_values(h1, 8);
+    codes_handle_delete(h1);
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+# (C) Copyright 2005- ECMWF.
+#
+# This software is licensed under the terms of the Apache Licence Version 2.0
+# which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+# virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+#
+
+. ./include.sh
+
+label="grib_values_cache_test"
+TEMP=temp.$label.grib
+
+$EXEC ${test_dir}/grib_values_cache
+
+# The tools give the same output with the cache as without it
+cat $ECCODES_SAMPLES_PATH/gg_sfc_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/sh_ml_grib2.tmpl \
+    $ECCODES_SAMPLES_PATH/reduced_gg_pl_32_grib2.tmpl > $TEMP
+for size in 0 1048576; do
+    export ECCODES_VALUES_CACHE_SIZE=$size
+    ${tools_dir}/grib_ls -n statistics $TEMP > temp.$label.$size.txt
+    ${tools_dir}/grib_get_data $TEMP >> temp.$label.$size.txt
+    ${tools_dir}/grib_set -s decimalScaleFactor=1 $TEMP temp.$label.$size.grib
+    ${tools_dir}/grib_get_data temp.$label.$size.grib >> temp.$label.$size.txt
+done
+unset ECCODES_VALUES_CACHE_SIZE
+diff temp.$label.0.txt temp.$label.1048576.txt
+cmp temp.$label.0.grib temp.$label.1048576.grib
+
+rm -f $TEMP temp.$label.0.* temp.$label.1048576.*
@@ -1514,6 +1514,146 @@ static void test_trimming()
     assert( strcmp(pE, "Apostle In Triumph")==0 );
 }
 
+static void test_decode_array(long bits_per_value, long first_bit, size_t n_vals)
+{
+    const double s = 0.25, ref = -1.5, d = 0.1;
+    size_t i = 0, nbytes = (first_bit + bits_per_value * n_vals + 7) / 8 + 1;
+    unsigned char* data = (unsigned char*)malloc(nbytes);
+    double* dval = (double*)malloc(n_vals * sizeof(double));
+    float* fval = (float*)malloc(n_vals * sizeof(float));
+    long pos = 0, dpos = first_bit, fpos = first_bit;
+
+    assert(data && dval && fval);
+    for (i = 0; i < nbytes; i++)
+        data[i] = (unsigned char)(i * 151 + 7 + (i >> 8));
+
+    grib_decode_double_array(data, &dpos, bits_per_value, ref, s, d, n_vals, dval);
+    grib_decode_float_array(data, &fpos, bits_per_value, ref, s, d, n_vals, fval);
+    assert(dpos == fpos);
+
+    pos = first_bit;
+    for (i = 0; i < n_vals; i++) {
+        unsigned long x = grib_decode_unsigned_long(data, &pos, bits_per_value);
+        double expected = ((x * s) + ref) * d;
+        assert(dval[i] == expected);
+        assert(fval[i] == (float)expected);
+    }
+
+    free(data);
+    free(dval);
+    free(fval);
+}
+
+static void test_decode_arrays()
+{
+    const size_t sizes[] = { 1, 63, 64, 65, 1000, 1003, 4097 };
+    long bpv, first_bit;
+    size_t k;
+
+    printf("Testing: test_decode_arrays...\n");
+    for (bpv = 1; bpv <= 32; bpv++) {
+        /* The byte aligned decoder always starts at the first byte */
+        long max_first_bit = (bpv % 8 == 0) ? 0 : 7;
+        for (first_bit = 0; first_bit <= max_first_bit; first_bit++)
+            for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+                test_decode_array(bpv, first_bit, sizes[k]);
+    }
+}
+
+static void test_encode_array(long bits_per_value, long first_bit, size_t n_vals, int with_outlier)
+{
+    const double ref = -3.0, d = 10.0, divisor = 0.5;
+    const double top = (double)(1UL << bits_per_value) - 1; /* largest code */
+    size_t i = 0, nbytes = (first_bit + bits_per_value * n_vals + 7) / 8 + 1;
+    unsigned char* data = (unsigned char*)malloc(nbytes);
+    unsigned char* expected = (unsigned char*)malloc(nbytes);
+    double* val = (double*)malloc(n_vals * sizeof(double));
+    long off = first_bit, pos = first_bit;
+
+    assert(data && expected && val);
+    for (i = 0; i < n_vals; i++)
+        val[i] = (ref + fmod(i * 7919.3, top / divisor)) / d;
+    if (with_outlier)
+        val[n_vals / 2] = 1e12; /* Out of range of the vector conversion */
+    /* Bits outside the encoded values must be left alone */
+    for (i = 0; i < nbytes; i++)
+        data[i] = expected[i] = (unsigned char)(i * 151 + 7);
+
+    grib_encode_double_array(n_vals, val, bits_per_value, ref, d, divisor, data, &off);
+    for (i = 0; i < n_vals; i++) {
+        unsigned long x = (unsigned long)((((val[i] * d) - ref) * divisor) + 0.5);
+        grib_encode_unsigned_longb(expected, x, &pos, bits_per_value);
+    }
+    assert(off == pos);
+    assert(memcmp(data, expected, nbytes) == 0);
+
+    free(data);
+    free(expected);
+    free(val);
+}
+
+static void test_encode_arrays()
+{
+    const size_t sizes[] = { 1, 63, 64, 65, 1000, 1003, 4097 };
+    long bpv, first_bit;
+    size_t k;
+
+    printf("Testing: test_encode_arrays...\n");
+    for (bpv = 1; bpv <= 32; bpv++) {
+        /* The byte aligned encoder always starts at the first byte */
+        long max_first_bit = (bpv % 8 == 0) ? 0 : 7;
+        for (first_bit = 0; first_bit <= max_first_bit; first_bit++)
+            for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+                test_encode_array(bpv, first_bit, sizes[k], 0);
+                test_encode_array(bpv, first_bit, sizes[k], 1);
+            }
+    }
+}
+
+static void test_minmax_array(size_t n_vals, size_t nan_at)
+{
+    size_t i = 0;
+    double* val = (double*)calloc(n_vals, sizeof(double));
+    double min = 0, max = 0, emin = 0, emax = 0;
+
+    assert(val);
+    for (i = 0; i < n_vals; i++)
+        val[i] = sin(i * 0.37) * (double)(i % 101);
+    if (nan_at < n_vals)
+        val[nan_at] = NAN;
+
+    emin = emax = val[0];
+    for (i = 1; i < n_vals; i++) {
+        if (val[i] > emax)
+            emax = val[i];
+        else if (val[i] < emin)
+            emin = val[i];
+    }
+    grib_minmax_double_array(val, n_vals, &min, &max);
+    if (isnan(emin)) {
+        assert(isnan(min) && isnan(max));
+    }
+    else {
+        assert(min == emin && max == emax);
+    }
+
+    free(val);
+}
+
+static void test_minmax_arrays()
+{
+    const size_t sizes[] = { 1, 2, 63, 64, 65, 1000, 1003, 4097 };
+    size_t k;
+
+    printf("Testing: test_minmax_arrays...\n");
+    for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+        test_minmax_array(sizes[k], sizes[k]);
+        test_minmax_array(sizes[k], 0);
+        test_minmax_array(sizes[k], sizes[k] / 2);
+        test_minmax_array(sizes[k], sizes[k] - 1);
+    }
+}
+
 int main(int argc, char** argv)
 {
     /*printf("Doing unit tests. ecCodes version = %ld\n", grib_get_api_version());*/
@@ -1548,5 +1688,9 @@ int main(int argc, char** argv)
 
     test_string_splitting();
 
+    test_decode_arrays();
+    test_encode_arrays();
+    test_minmax_arrays();
+
     return 0;
 }
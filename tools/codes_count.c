@@ -72,6 +72,29 @@ static int count_messages(FILE* in, int message_type, unsigned long* count)
     return err;
 }
 
+/* Regular files are scanned in parallel without reading the messages */
+static int scan_messages(const char* filename, int message_type, unsigned long* count)
+{
+    off_t* offsets      = NULL;
+    size_t* lengths     = NULL;
+    long n              = 0;
+    ProductKind product = PRODUCT_ANY;
+    grib_context* c     = grib_context_get_default();
+    int err             = 0;
+
+    if (message_type == CODES_GRIB)
+        product = PRODUCT_GRIB;
+    else if (message_type == CODES_BUFR)
+        product = PRODUCT_BUFR;
+
+    err    = grib_scan_file(c, filename, product, 0, &offsets, &lengths, &n);
+    *count = n;
+    grib_context_free(c, offsets);
+    grib_context_free(c, lengths);
+
+    return err;
+}
+
 int main(int argc, char* argv[])
 {
     FILE* infh = NULL;
@@ -118,7 +141,10 @@ int main(int argc, char* argv[])
         }
         files_processed = 1; /* At least one file processed */
         count_curr      = 0;
-        err             = count_messages(infh, message_type, &count_curr);
+        if (fail_on_error && infh != stdin && message_type != CODES_GTS)
+            err = scan_messages(filename, message_type, &count_curr);
+        else
+            err = count_messages(infh, message_type, &count_curr);
         if (err && fail_on_error) {
             fprintf(stderr, "Invalid message(s) found in %s", filename);
             if (count_curr > 0)
@@ -0,0 +1,168 @@
+/*
+ * (C) Copyright 2005- ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * In applying this licence, ECMWF does not waive the privileges and immunities granted to it by
+ * virtue of its status as an intergovernmental organisation nor does it submit to any jurisdiction.
+ */
+
+/*
+ * Parse every definition file of the definitions path and write the trees to a snapshot,
+ * to be used with ECCODES_DEFINITIONS_SNAPSHOT (see src/grib_definitions_snapshot.c)
+ */
+
+#include "grib_api_internal.h"
+
+static int verbose = 0;
+static long added  = 0;
+static long failed = 0;
+
+static void usage(const char* prog)
+{
+    printf("Usage: %s [-v] snapshot_file\n", prog);
+    printf("Parse the definition files of the definitions path and write them to snapshot_file\n");
+    printf("    -v  print the name of each file\n");
+    exit(1);
+}
+
+static int is_definition_file(const char* path)
+{
+    size_t len = strlen(path);
+    return len > 4 && strcmp(path + len - 4, ".def") == 0;
+}
+
+/* relative: the path of the file in the definitions directory, as used in an include */
+static void add_file(grib_snapshot_writer* w, const char* relative)
+{
+    int err = grib_snapshot_writer_add_file(w, relative);
+    if (err) {
+        fprintf(stderr, "Skipping %s: %s\n", relative, grib_get_error_message(err));
+        failed++;
+        return;
+    }
+    if (verbose)
+        printf("%s\n", relative);
+    added++;
+}
+
+static void process(grib_snapshot_writer* w, const char* root, const char* relative);
+
+#ifndef ECCODES_ON_WINDOWS
+static void scan(grib_snapshot_writer* w, const char* root, const char* relative)
+{
+    struct dirent* s;
+    DIR* d;
+    char dir[1024];
+
+    sprintf(dir, "%s/%s", root, relative);
+    d = opendir(dir);
+    if (!d) {
+        grib_context_log(w->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "opendir %s", dir);
+        return;
+    }
+
+    while ((s = readdir(d))) {
+        if (strcmp(s->d_name, ".") != 0 && strcmp(s->d_name, "..") != 0) {
+            char buf[1024];
+            if (*relative)
+                sprintf(buf, "%s/%s", relative, s->d_name);
+            else
+                strcpy(buf, s->d_name);
+            process(w, root, buf);
+        }
+    }
+    closedir(d);
+}
+#else
+static void scan(grib_snapshot_writer* w, const char* root, const char* relative)
+{
+    struct _finddata_t fileinfo;
+    intptr_t handle;
+    char buffer[1024];
+    sprintf(buffer, "%s/%s/*", root, relative);
+    if ((handle = _findfirst(buffer, &fileinfo)) != -1) {
+        do {
+            if (strcmp(fileinfo.name, ".") != 0 && strcmp(fileinfo.name, "..") != 0) {
+                char buf[1024];
+                if (*relative)
+                    sprintf(buf, "%s/%s", relative, fileinfo.name);
+                else
+                    strcpy(buf, fileinfo.name);
+                process(w, root, buf);
+            }
+        } while (!_findnext(handle, &fileinfo));
+
+        _findclose(handle);
+    }
+    else {
+        grib_context_log(w->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "opendir %s", buffer);
+    }
+}
+#endif
+
+static void process(grib_snapshot_writer* w, const char* root, const char* relative)
+{
+    struct stat s;
+    char path[1024];
+
+    sprintf(path, "%s/%s", root, relative);
+    if (stat(path, &s) != 0) {
+        grib_context_log(w->context, (GRIB_LOG_ERROR) | (GRIB_LOG_PERROR), "Cannot stat %s", path);
+        return;
+    }
+
+    if (S_ISDIR(s.st_mode))
+        scan(w, root, relative);
+    else if (is_definition_file(relative))
+        add_file(w, relative);
+}
+
+int main(int argc, char* argv[])
+{
+    grib_context* c         = grib_context_get_default();
+    grib_snapshot_writer* w = NULL;
+    grib_string_list* dir   = NULL;
+    const char* output      = NULL;
+    int err                 = 0;
+    int i                   = 0;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0)
+            verbose = 1;
+        else if (argv[i][0] == '-' || output)
+            usage(argv[0]);
+        else
+            output = argv[i];
+    }
+    if (!output)
+        usage(argv[0]);
+
+    /* The files must be parsed, not read from an older snapshot */
+    grib_definitions_snapshot_close(c);
+
+    /* Sets up the list of definitions directories */
+    if (!grib_context_full_defs_path(c, "boot.def")) {
+        fprintf(stderr, "%s: No definition files found. Definitions path: %s\n", argv[0],
+                c->grib_definition_files_path ? c->grib_definition_files_path : "");
+        return 1;
+    }
+
+    w = grib_snapshot_writer_new(c);
+    if (!w)
+        return 1;
+    /* A file in more than one directory is taken from the first, as when it is parsed */
+    for (dir = c->grib_definition_files_dir; dir; dir = dir->next)
+        scan(w, dir->value, "");
+
+    err = grib_snapshot_writer_save(w, output);
+    grib_snapshot_writer_delete(w);
+    if (err) {
+        fprintf(stderr, "%s: Unable to write %s: %s\n", argv[0], output, grib_get_error_message(err));
+        return 1;
+    }
+    if (verbose)
+        printf("%ld files written to %s, %ld skipped\n", added, output, failed);
+    return 0;
+}
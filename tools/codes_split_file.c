@@ -29,20 +29,82 @@ static void usage(const char* prog)
     exit(1);
 }
 
+/* The messages of a regular file, located by grib_scan_file before they are read */
+typedef struct scanned_file
+{
+    off_t* offsets;
+    size_t* lengths;
+    long count;
+    long next;
+    unsigned char* mesg; /* reused for each message */
+    size_t mesg_alloc;
+} scanned_file;
+
+/* Locate all the messages first, in parallel for large files. Pipes are not
+ * scanned, nor files with invalid messages, which the reader skips */
+static void scan_file(grib_context* c, const char* filename, scanned_file* sf)
+{
+    memset(sf, 0, sizeof(*sf));
+    if (!path_is_regular_file(filename))
+        return;
+    if (grib_scan_file(c, filename, PRODUCT_ANY, 0, &sf->offsets, &sf->lengths, &sf->count) != GRIB_SUCCESS) {
+        grib_context_free(c, sf->offsets);
+        grib_context_free(c, sf->lengths);
+        memset(sf, 0, sizeof(*sf));
+    }
+}
+
+/* The next message of the file, which the caller frees unless the file was
+ * scanned. Messages of a scanned file are all valid: an error is fatal */
+static void* next_message(grib_context* c, FILE* in, const char* filename, scanned_file* sf, size_t* size, int* err)
+{
+    off_t offset = 0;
+    long k       = sf->next;
+
+    if (!sf->offsets)
+        return wmo_read_any_from_file_malloc(in, 0, size, &offset, err);
+
+    if (k == sf->count) {
+        *err = GRIB_END_OF_FILE;
+        return NULL;
+    }
+    sf->next++;
+    *size = sf->lengths[k];
+    if (*size > sf->mesg_alloc) {
+        grib_context_free(c, sf->mesg);
+        sf->mesg_alloc = *size;
+        sf->mesg       = (unsigned char*)grib_context_malloc(c, sf->mesg_alloc);
+    }
+    if (!sf->mesg) {
+        sf->mesg_alloc = 0;
+        *err           = GRIB_OUT_OF_MEMORY;
+        return NULL;
+    }
+    if (fseeko(in, sf->offsets[k], SEEK_SET) != 0 || fread(sf->mesg, 1, *size, in) != *size) {
+        perror(filename);
+        *err = GRIB_IO_PROBLEM;
+        return NULL;
+    }
+    *err = GRIB_SUCCESS;
+    return sf->mesg;
+}
+
 static int split_file(FILE* in, const char* filename, const int nchunks, unsigned long* count)
 {
     void* mesg = NULL;
     FILE* out;
     size_t size = 0, read_size = 0, insize = 0, chunk_size, msg_size = 0, num_msg = 0;
-    off_t offset = 0;
-    int err      = GRIB_SUCCESS;
+    int err     = GRIB_SUCCESS;
     int i;
     char* ofilename;
     grib_context* c = grib_context_get_default();
+    scanned_file sf;
 
     if (!in)
         return 1;
 
+    scan_file(c, filename, &sf);
+
     /* name of output file */
     ofilename = (char*)calloc(1, strlen(filename) + 10);
 
@@ -62,22 +124,27 @@ static int split_file(FILE* in, const char* filename, const int nchunks, unsigne
     out = fopen(ofilename, "w");
     if (!out) {
         perror(ofilename);
-        free(ofilename);
-        return GRIB_IO_PROBLEM;
+        err = GRIB_IO_PROBLEM;
+        goto cleanup;
     }
 
     while (err != GRIB_END_OF_FILE) {
-        mesg = wmo_read_any_from_file_malloc(in, 0, &size, &offset, &err);
+        mesg = next_message(c, in, filename, &sf, &size, &err);
         num_msg++;
-        /*printf("=1=%d\t%d\t%d\n",*count,size,insize);*/
+        if (sf.offsets && err && err != GRIB_END_OF_FILE) {
+            fclose(out);
+            goto cleanup;
+        }
         if (mesg != NULL && err == 0) {
-            if (fwrite(mesg, 1, size, out) != size) {
+            size_t written = fwrite(mesg, 1, size, out);
+            if (!sf.offsets)
+                grib_context_free(c, mesg);
+            if (written != size) {
                 perror(ofilename);
-                free(ofilename);
                 fclose(out);
-                return GRIB_IO_PROBLEM;
+                err = GRIB_IO_PROBLEM;
+                goto cleanup;
             }
-            grib_context_free(c, mesg);
             read_size += size;
             msg_size += size;
             if (read_size > chunk_size && msg_size < insize) {
@@ -86,13 +153,12 @@ static int split_file(FILE* in, const char* filename, const int nchunks, unsigne
                 fclose(out);
                 i++;
                 /* Start writing to the next file */
-                /*printf("=2=%d\t%d\n",*count,msg_size);*/
                 sprintf(ofilename, OUTPUT_FILENAME_FORMAT, filename, i);
                 out = fopen(ofilename, "w");
                 if (!out) {
                     perror(ofilename);
-                    free(ofilename);
-                    return GRIB_IO_PROBLEM;
+                    err = GRIB_IO_PROBLEM;
+                    goto cleanup;
                 }
                 read_size = 0;
                 num_msg   = 0;
@@ -103,11 +169,16 @@ static int split_file(FILE* in, const char* filename, const int nchunks, unsigne
     if (verbose)
         printf("Wrote output file %s (%lu msgs)\n", ofilename, (unsigned long)num_msg - 1);
     fclose(out);
-    free(ofilename);
 
     if (err == GRIB_END_OF_FILE)
         err = GRIB_SUCCESS;
 
+cleanup:
+    free(ofilename);
+    grib_context_free(c, sf.mesg);
+    grib_context_free(c, sf.offsets);
+    grib_context_free(c, sf.lengths);
+
     return err;
 }
 
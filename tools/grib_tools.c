@@ -765,7 +765,7 @@ static void grib_tools_set_print_keys(grib_runtime_options* options, grib_handle
             printf("ERROR: namespace \"%s\" does not contain any key.\n", ns);
             printf("Here are the available namespaces in this message:\n");
             for (i = 0; i < ACCESSORS_ARRAY_SIZE; i++) {
-                grib_accessor* anAccessor = h->accessors[i];
+                grib_accessor* anAccessor = grib_handle_get_accessor_by_id(h, i);
                 if (anAccessor) {
                     for (j = 0; j < MAX_ACCESSOR_NAMES; j++) {
                         const char* a_namespace = anAccessor->all_name_spaces[j];